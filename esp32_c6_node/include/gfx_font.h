@@ -0,0 +1,109 @@
+#ifndef GFX_FONT_H
+#define GFX_FONT_H
+
+#include <Arduino_GFX_Library.h>
+
+// Antialiased UTF-8 text for an Arduino_Canvas, from the 4 bpp glyph
+// atlases that scripts/font_subset.py generates (include/ui_glyphs.h): only
+// the glyphs the UI uses, Spanish letters and ° included. Each glyph is
+// blended into the framebuffer over whatever is already drawn there, so
+// text needs no background colour. A code point missing from the atlas
+// draws nothing.
+
+struct GfxGlyph {
+  uint16_t cp;
+  uint16_t offset; // Into the bitmap, 2 pixels per byte, rows packed
+  uint8_t w, h;
+  int8_t x, y; // Box from the pen on the baseline, y negative above it
+  uint8_t adv;
+};
+
+struct GfxFont {
+  const uint8_t *bitmap;
+  const GfxGlyph *glyphs; // By code point, ASCII 0x20-0x7E first
+  uint16_t count;
+  uint8_t lineHeight;
+  uint8_t baseline; // Above the bottom of the line
+};
+
+inline const GfxGlyph *gfxGlyph(const GfxFont &f, uint32_t cp) {
+  if (cp >= 0x20 && cp < 0x7F)
+    return &f.glyphs[cp - 0x20];
+  uint16_t lo = 0x7F - 0x20, hi = f.count;
+  while (lo < hi) {
+    uint16_t mid = (lo + hi) / 2;
+    if (f.glyphs[mid].cp < cp)
+      lo = mid + 1;
+    else
+      hi = mid;
+  }
+  return lo < f.count && f.glyphs[lo].cp == cp ? &f.glyphs[lo] : NULL;
+}
+
+// Next code point of a UTF-8 string; a stray byte counts as itself
+inline uint32_t gfxNextCp(const char *&s) {
+  uint8_t c = *s++;
+  uint8_t n = c >= 0xF0 ? 3 : c >= 0xE0 ? 2 : c >= 0xC0 ? 1 : 0;
+  uint32_t cp = n ? c & (0x3F >> n) : c;
+  for (; n && (*s & 0xC0) == 0x80; n--)
+    cp = (cp << 6) | (*s++ & 0x3F);
+  return cp;
+}
+
+inline uint16_t gfxTextWidth(const GfxFont &f, const char *s) {
+  uint16_t w = 0;
+  while (*s) {
+    const GfxGlyph *g = gfxGlyph(f, gfxNextCp(s));
+    if (g)
+      w += g->adv;
+  }
+  return w;
+}
+
+// fg over bg with alpha 0..32
+inline uint16_t gfxBlend(uint16_t fg, uint16_t bg, uint8_t alpha) {
+  uint32_t f = (fg | ((uint32_t)fg << 16)) & 0x07E0F81F;
+  uint32_t b = (bg | ((uint32_t)bg << 16)) & 0x07E0F81F;
+  uint32_t r = ((((f - b) * alpha) >> 5) + b) & 0x07E0F81F;
+  return (uint16_t)(r | (r >> 16));
+}
+
+// Draws `s` with the top of its line at (x, y), like setCursor() and
+// print() with the built-in font; '\n' goes on below at x. Returns the pen
+// x after the last glyph. Without rotation glyphs are blended straight in
+// the framebuffer; rotated canvases get their solid pixels only.
+inline int16_t gfxDrawText(Arduino_Canvas *c, int16_t x, int16_t y,
+                           const char *s, const GfxFont &f, uint16_t color) {
+  uint16_t *fb = c->getRotation() == 0 ? c->getFramebuffer() : NULL;
+  int16_t cw = c->width(), ch = c->height();
+  int16_t penX = x, base = y + f.lineHeight - f.baseline;
+  while (*s) {
+    uint32_t cp = gfxNextCp(s);
+    if (cp == '\n') {
+      penX = x;
+      base += f.lineHeight;
+      continue;
+    }
+    const GfxGlyph *g = gfxGlyph(f, cp);
+    if (!g)
+      continue;
+    const uint8_t *px = f.bitmap + g->offset;
+    for (uint16_t i = 0; i < g->w * g->h; i++) {
+      uint8_t a = (px[i / 2] >> (i & 1 ? 0 : 4)) & 0x0F;
+      int16_t gx = penX + g->x + i % g->w, gy = base + g->y + i / g->w;
+      if (!a || gx < 0 || gy < 0 || gx >= cw || gy >= ch)
+        continue;
+      if (!fb) {
+        if (a >= 8)
+          c->writePixel(gx, gy, color);
+        continue;
+      }
+      uint16_t &d = fb[gy * cw + gx];
+      d = a == 15 ? color : gfxBlend(color, d, (a * 32 + 7) / 15);
+    }
+    penX += g->adv;
+  }
+  return penX;
+}
+
+#endif
@@ -0,0 +1,1190 @@
+// Generated by scripts/font_subset.py, do not edit.
+// Glyphs: 0x20-0x7E,0xA1,0xB0,0xBF,0xC1,0xC9,0xCD,0xD1,0xD3,0xDA,0xDC,0xE1,0xE9,0xED,0xF1,0xF3,0xFA,0xFC
+//
+// 4 bpp glyph atlases of Montserrat Medium for gfx_font.h.
+
+#ifndef UI_GLYPHS_H
+#define UI_GLYPHS_H
+
+#include "gfx_font.h"
+
+static const uint8_t ui_font_12_bitmap[] = {
+    0x1f, 0x40, 0xf4, 0x0f, 0x30, 0xe2, 0x0e, 0x20, 0xd1, 0x00, 0x00, 0x00,
+    0x1e, 0x30, 0x4b, 0x1e, 0x3b, 0x1d, 0x3b, 0x0d, 0x00, 0x58, 0x03, 0xa0,
+    0x00, 0x07, 0x60, 0x58, 0x00, 0x4f, 0xff, 0xff, 0xff, 0x20, 0x1a, 0x41,
+    0x95, 0x10, 0x00, 0xb1, 0x0a, 0x30, 0x00, 0x0d, 0x00, 0xb2, 0x00, 0xae,
+    0xfe, 0xef, 0xeb, 0x01, 0x3c, 0x22, 0xd2, 0x20, 0x03, 0xa0, 0x1b, 0x00,
+    0x00, 0x00, 0x09, 0x30, 0x00, 0x00, 0x93, 0x00, 0x04, 0xcf, 0xeb, 0x31,
+    0xe7, 0xa5, 0x74, 0x4e, 0x09, 0x30, 0x01, 0xe8, 0xa3, 0x00, 0x03, 0xbf,
+    0xd7, 0x00, 0x00, 0x97, 0xda, 0x00, 0x09, 0x34, 0xe5, 0xa3, 0xa5, 0xaa,
+    0x18, 0xdf, 0xea, 0x10, 0x00, 0x93, 0x00, 0x00, 0x04, 0x10, 0x00, 0x0a,
+    0xe8, 0x00, 0x0c, 0x20, 0x69, 0x2c, 0x30, 0x76, 0x00, 0x84, 0x07, 0x52,
+    0xb0, 0x00, 0x57, 0x0a, 0x2b, 0x30, 0x00, 0x09, 0xb6, 0x68, 0x5b, 0x91,
+    0x00, 0x01, 0xc1, 0xb0, 0x57, 0x00, 0x0a, 0x43, 0x90, 0x2a, 0x00, 0x59,
+    0x01, 0xd2, 0x87, 0x01, 0xc1, 0x00, 0x7e, 0xb1, 0x00, 0x9e, 0xd5, 0x00,
+    0x05, 0xd3, 0x5d, 0x00, 0x05, 0xb0, 0x4c, 0x00, 0x01, 0xda, 0xd2, 0x00,
+    0x03, 0xce, 0x70, 0x11, 0x2d, 0x32, 0xd6, 0x88, 0x6b, 0x00, 0x2d, 0xe2,
+    0x4e, 0x52, 0x4c, 0xe6, 0x06, 0xdf, 0xd6, 0x29, 0x4b, 0x3b, 0x3b, 0x0a,
+    0x71, 0xe1, 0x5b, 0x09, 0x80, 0xb6, 0x0c, 0x50, 0xd4, 0x0c, 0x50, 0xb6,
+    0x09, 0x80, 0x5b, 0x01, 0xe1, 0x0a, 0x70, 0x6a, 0x01, 0xe2, 0x0b, 0x60,
+    0x7a, 0x05, 0xc0, 0x4d, 0x03, 0xe0, 0x4d, 0x05, 0xc0, 0x7a, 0x0b, 0x61,
+    0xe2, 0x6a, 0x00, 0x00, 0xb0, 0x08, 0x8c, 0xa5, 0x0b, 0xf8, 0x08, 0x8c,
+    0xa5, 0x00, 0xb0, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00,
+    0x0f, 0x00, 0x03, 0xee, 0xfe, 0xe3, 0x02, 0x2f, 0x22, 0x00, 0x00, 0xf0,
+    0x00, 0x4e, 0x13, 0xf1, 0x1c, 0x04, 0x80, 0x4e, 0xed, 0x12, 0x22, 0x3b,
+    0x04, 0xe1, 0x00, 0x00, 0x34, 0x00, 0x00, 0xa5, 0x00, 0x01, 0xe1, 0x00,
+    0x05, 0xb0, 0x00, 0x0a, 0x60, 0x00, 0x0e, 0x10, 0x00, 0x4b, 0x00, 0x00,
+    0x97, 0x00, 0x00, 0xe2, 0x00, 0x04, 0xc0, 0x00, 0x08, 0x70, 0x00, 0x0d,
+    0x30, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x9e, 0xe9, 0x00, 0x09, 0xc3, 0x3c,
+    0x90, 0x2f, 0x20, 0x02, 0xf2, 0x5d, 0x00, 0x00, 0xd5, 0x6c, 0x00, 0x00,
+    0xc6, 0x5d, 0x00, 0x00, 0xd5, 0x2f, 0x20, 0x02, 0xf2, 0x0a, 0xc3, 0x3c,
+    0xa0, 0x00, 0x9e, 0xe9, 0x00, 0xef, 0xf3, 0x12, 0xf3, 0x00, 0xf3, 0x00,
+    0xf3, 0x00, 0xf3, 0x00, 0xf3, 0x00, 0xf3, 0x00, 0xf3, 0x00, 0xf3, 0x19,
+    0xee, 0xb3, 0x08, 0xa3, 0x29, 0xd0, 0x00, 0x00, 0x2f, 0x10, 0x00, 0x05,
+    0xe0, 0x00, 0x02, 0xe6, 0x00, 0x02, 0xd8, 0x00, 0x01, 0xd8, 0x00, 0x01,
+    0xca, 0x11, 0x11, 0x8f, 0xff, 0xff, 0x70, 0x8f, 0xff, 0xff, 0x01, 0x11,
+    0x2d, 0x80, 0x00, 0x09, 0xb0, 0x00, 0x05, 0xf3, 0x00, 0x00, 0x7c, 0xf8,
+    0x00, 0x00, 0x03, 0xf3, 0x00, 0x00, 0x0e, 0x4a, 0x73, 0x28, 0xe1, 0x4b,
+    0xef, 0xc3, 0x00, 0x00, 0x00, 0x9b, 0x00, 0x00, 0x04, 0xe1, 0x00, 0x00,
+    0x1e, 0x50, 0x00, 0x00, 0xaa, 0x01, 0x00, 0x05, 0xe1, 0x0d, 0x40, 0x2e,
+    0x40, 0x0d, 0x40, 0x8f, 0xff, 0xff, 0xfd, 0x12, 0x22, 0x2d, 0x62, 0x00,
+    0x00, 0x0d, 0x40, 0x0c, 0xff, 0xff, 0x00, 0xe4, 0x11, 0x10, 0x0f, 0x20,
+    0x00, 0x02, 0xfe, 0xdb, 0x30, 0x02, 0x23, 0x9e, 0x20, 0x00, 0x00, 0xd6,
+    0x10, 0x00, 0x0c, 0x69, 0xa3, 0x27, 0xe2, 0x3a, 0xef, 0xc4, 0x00, 0x00,
+    0x7d, 0xfd, 0x50, 0x8d, 0x52, 0x32, 0x1e, 0x20, 0x00, 0x05, 0xd7, 0xde,
+    0xa1, 0x6f, 0xc4, 0x3c, 0xa5, 0xf3, 0x00, 0x3f, 0x2f, 0x30, 0x03, 0xf0,
+    0xac, 0x33, 0xba, 0x01, 0xae, 0xea, 0x10, 0xaf, 0xff, 0xff, 0xba, 0x81,
+    0x11, 0xd7, 0x75, 0x00, 0x4e, 0x10, 0x00, 0x0a, 0x90, 0x00, 0x01, 0xf3,
+    0x00, 0x00, 0x7b, 0x00, 0x00, 0x0d, 0x50, 0x00, 0x05, 0xe0, 0x00, 0x00,
+    0xb8, 0x00, 0x00, 0x03, 0xbf, 0xe9, 0x10, 0x0e, 0x92, 0x3c, 0xa0, 0x2f,
+    0x10, 0x05, 0xd0, 0x0e, 0x70, 0x1a, 0xa0, 0x06, 0xff, 0xfe, 0x20, 0x3e,
+    0x73, 0x3a, 0xd0, 0x7c, 0x00, 0x01, 0xf2, 0x3f, 0x62, 0x39, 0xe1, 0x05,
+    0xcf, 0xeb, 0x30, 0x07, 0xdf, 0xc4, 0x06, 0xe4, 0x26, 0xe2, 0x98, 0x00,
+    0x0b, 0x87, 0xd2, 0x04, 0xeb, 0x1a, 0xff, 0xd9, 0xc0, 0x01, 0x20, 0x8b,
+    0x00, 0x00, 0x0d, 0x70, 0x52, 0x3b, 0xd1, 0x1c, 0xee, 0xa2, 0x00, 0x3b,
+    0x04, 0xe1, 0x00, 0x00, 0x00, 0x00, 0x03, 0xb0, 0x4e, 0x10, 0x3b, 0x04,
+    0xe1, 0x00, 0x00, 0x00, 0x00, 0x04, 0xe1, 0x3f, 0x11, 0xc0, 0x48, 0x00,
+    0x00, 0x00, 0x39, 0x20, 0x16, 0xcc, 0x61, 0x2e, 0x93, 0x00, 0x01, 0x9d,
+    0x93, 0x00, 0x00, 0x16, 0xcc, 0x20, 0x00, 0x00, 0x31, 0x3f, 0xff, 0xff,
+    0x30, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x03, 0xee, 0xee, 0xe3, 0x02,
+    0x22, 0x22, 0x00, 0x28, 0x30, 0x00, 0x01, 0x6c, 0xc6, 0x10, 0x00, 0x03,
+    0x9e, 0x20, 0x03, 0x9d, 0x91, 0x2c, 0xc6, 0x10, 0x01, 0x20, 0x00, 0x00,
+    0x19, 0xee, 0xb3, 0x9a, 0x32, 0xad, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x8c,
+    0x00, 0x05, 0xe3, 0x00, 0x1e, 0x50, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x4d, 0x00, 0x00, 0x05, 0xbe, 0xed, 0x81, 0x00, 0x00, 0x9d, 0x63,
+    0x24, 0x9e, 0x30, 0x07, 0xb1, 0x8e, 0xe7, 0xc7, 0xd1, 0x0d, 0x17, 0xd4,
+    0x2a, 0xf3, 0x87, 0x4a, 0x0d, 0x50, 0x01, 0xe3, 0x2b, 0x68, 0x0e, 0x20,
+    0x00, 0xc3, 0x0c, 0x68, 0x0d, 0x40, 0x00, 0xe3, 0x1b, 0x4a, 0x07, 0xc2,
+    0x19, 0xf5, 0x67, 0x0d, 0x10, 0x8e, 0xe8, 0x6e, 0xb1, 0x06, 0xb1, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x9d, 0x63, 0x25, 0x60, 0x00, 0x00, 0x05, 0xbe,
+    0xec, 0x50, 0x00, 0x00, 0x06, 0xf3, 0x00, 0x00, 0x00, 0xdd, 0x90, 0x00,
+    0x00, 0x4e, 0x4f, 0x10, 0x00, 0x0a, 0x80, 0xc7, 0x00, 0x02, 0xf3, 0x06,
+    0xd0, 0x00, 0x8c, 0x00, 0x1f, 0x50, 0x0e, 0xfe, 0xee, 0xfb, 0x06, 0xe2,
+    0x22, 0x24, 0xf2, 0xc7, 0x00, 0x00, 0x0b, 0x90, 0xbf, 0xff, 0xeb, 0x20,
+    0xb8, 0x11, 0x3a, 0xc0, 0xb7, 0x00, 0x03, 0xf0, 0xb7, 0x00, 0x19, 0xb0,
+    0xbf, 0xee, 0xff, 0x40, 0xb8, 0x22, 0x36, 0xe3, 0xb7, 0x00, 0x00, 0xc7,
+    0xb8, 0x11, 0x25, 0xf4, 0xbf, 0xff, 0xfd, 0x60, 0x00, 0x3b, 0xee, 0xb4,
+    0x00, 0x5f, 0x83, 0x27, 0xd1, 0x0e, 0x60, 0x00, 0x00, 0x04, 0xe0, 0x00,
+    0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x04, 0xe0, 0x00, 0x00, 0x00, 0x1e,
+    0x60, 0x00, 0x00, 0x00, 0x5f, 0x83, 0x27, 0xd1, 0x00, 0x4b, 0xee, 0xb4,
+    0x00, 0xbf, 0xff, 0xea, 0x30, 0x0b, 0x81, 0x13, 0x8f, 0x40, 0xb7, 0x00,
+    0x00, 0x7d, 0x0b, 0x70, 0x00, 0x01, 0xf3, 0xb7, 0x00, 0x00, 0x0d, 0x5b,
+    0x70, 0x00, 0x01, 0xf3, 0xb7, 0x00, 0x00, 0x7d, 0x0b, 0x81, 0x13, 0x8f,
+    0x40, 0xbf, 0xff, 0xea, 0x30, 0x00, 0xbf, 0xff, 0xff, 0x3b, 0x81, 0x11,
+    0x10, 0xb7, 0x00, 0x00, 0x0b, 0x70, 0x00, 0x00, 0xbf, 0xee, 0xea, 0x0b,
+    0x82, 0x22, 0x10, 0xb7, 0x00, 0x00, 0x0b, 0x81, 0x11, 0x10, 0xbf, 0xff,
+    0xff, 0x50, 0xbf, 0xff, 0xff, 0x3b, 0x81, 0x11, 0x10, 0xb7, 0x00, 0x00,
+    0x0b, 0x70, 0x00, 0x00, 0xbf, 0xee, 0xea, 0x0b, 0x82, 0x22, 0x10, 0xb7,
+    0x00, 0x00, 0x0b, 0x70, 0x00, 0x00, 0xb7, 0x00, 0x00, 0x00, 0x00, 0x3b,
+    0xee, 0xb4, 0x00, 0x5f, 0x83, 0x26, 0xd1, 0x0e, 0x60, 0x00, 0x00, 0x04,
+    0xe0, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x08, 0x24, 0xe0, 0x00, 0x00,
+    0xe4, 0x1e, 0x60, 0x00, 0x0e, 0x40, 0x5f, 0x83, 0x26, 0xf3, 0x00, 0x3b,
+    0xee, 0xc5, 0x00, 0xb7, 0x00, 0x00, 0xb7, 0xb7, 0x00, 0x00, 0xb7, 0xb7,
+    0x00, 0x00, 0xb7, 0xb7, 0x00, 0x00, 0xb7, 0xbf, 0xee, 0xee, 0xf7, 0xb8,
+    0x22, 0x22, 0xb7, 0xb7, 0x00, 0x00, 0xb7, 0xb7, 0x00, 0x00, 0xb7, 0xb7,
+    0x00, 0x00, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7,
+    0x4f, 0xff, 0xf0, 0x11, 0x4f, 0x00, 0x03, 0xf0, 0x00, 0x3f, 0x00, 0x03,
+    0xf0, 0x00, 0x3f, 0x00, 0x04, 0xec, 0x52, 0xba, 0x5d, 0xeb, 0x20, 0xb7,
+    0x00, 0x06, 0xd1, 0xb7, 0x00, 0x5e, 0x20, 0xb7, 0x04, 0xe4, 0x00, 0xb7,
+    0x3e, 0x50, 0x00, 0xb9, 0xde, 0x20, 0x00, 0xbf, 0xab, 0xc1, 0x00, 0xba,
+    0x01, 0xca, 0x00, 0xb7, 0x00, 0x2e, 0x70, 0xb7, 0x00, 0x03, 0xe4, 0xb7,
+    0x00, 0x00, 0xb7, 0x00, 0x00, 0xb7, 0x00, 0x00, 0xb7, 0x00, 0x00, 0xb7,
+    0x00, 0x00, 0xb7, 0x00, 0x00, 0xb7, 0x00, 0x00, 0xb8, 0x22, 0x22, 0xbf,
+    0xff, 0xff, 0xb8, 0x00, 0x00, 0x02, 0xe3, 0xbe, 0x20, 0x00, 0x09, 0xf3,
+    0xbe, 0x90, 0x00, 0x3e, 0xf3, 0xb8, 0xe3, 0x00, 0xb7, 0xf3, 0xb6, 0x7b,
+    0x04, 0xd0, 0xf3, 0xb6, 0x1d, 0x4c, 0x50, 0xe3, 0xb6, 0x05, 0xec, 0x00,
+    0xe3, 0xb6, 0x00, 0xb4, 0x00, 0xe3, 0xb6, 0x00, 0x00, 0x00, 0xe3, 0xb9,
+    0x00, 0x00, 0xb7, 0xbf, 0x50, 0x00, 0xb7, 0xbd, 0xe2, 0x00, 0xb7, 0xb7,
+    0xac, 0x10, 0xb7, 0xb7, 0x1d, 0x90, 0xb7, 0xb7, 0x03, 0xf5, 0xb7, 0xb7,
+    0x00, 0x6e, 0xd7, 0xb7, 0x00, 0x0a, 0xf7, 0xb7, 0x00, 0x01, 0xd7, 0x00,
+    0x3b, 0xee, 0xb4, 0x00, 0x05, 0xf8, 0x32, 0x7e, 0x60, 0x0e, 0x60, 0x00,
+    0x05, 0xe1, 0x4e, 0x00, 0x00, 0x00, 0xd6, 0x6c, 0x00, 0x00, 0x00, 0xb7,
+    0x4e, 0x00, 0x00, 0x00, 0xd6, 0x0e, 0x60, 0x00, 0x05, 0xe1, 0x05, 0xf8,
+    0x22, 0x7e, 0x60, 0x00, 0x3b, 0xee, 0xb4, 0x00, 0xbf, 0xff, 0xd8, 0x0b,
+    0x81, 0x24, 0xd9, 0xb7, 0x00, 0x04, 0xeb, 0x70, 0x00, 0x4e, 0xb7, 0x00,
+    0x2b, 0xab, 0xfe, 0xff, 0xa1, 0xb8, 0x22, 0x00, 0x0b, 0x70, 0x00, 0x00,
+    0xb7, 0x00, 0x00, 0x00, 0x00, 0x3b, 0xee, 0xb4, 0x00, 0x05, 0xf8, 0x32,
+    0x7e, 0x60, 0x0e, 0x60, 0x00, 0x05, 0xe1, 0x4e, 0x00, 0x00, 0x00, 0xd5,
+    0x6c, 0x00, 0x00, 0x00, 0xb7, 0x5e, 0x00, 0x00, 0x00, 0xd6, 0x1e, 0x60,
+    0x00, 0x05, 0xf1, 0x05, 0xf8, 0x22, 0x7f, 0x70, 0x00, 0x4c, 0xef, 0xc5,
+    0x00, 0x00, 0x00, 0x1c, 0xa1, 0x38, 0x00, 0x00, 0x01, 0xbf, 0xe5, 0x00,
+    0x00, 0x00, 0x01, 0x10, 0xbf, 0xff, 0xd8, 0x0b, 0x81, 0x24, 0xd9, 0xb7,
+    0x00, 0x04, 0xeb, 0x70, 0x00, 0x4f, 0xb7, 0x00, 0x2b, 0xab, 0xfe, 0xff,
+    0xb1, 0xb8, 0x22, 0xb9, 0x0b, 0x70, 0x02, 0xe4, 0xb7, 0x00, 0x07, 0xd0,
+    0x04, 0xce, 0xeb, 0x31, 0xe7, 0x23, 0x74, 0x4e, 0x00, 0x00, 0x01, 0xe9,
+    0x20, 0x00, 0x03, 0xbf, 0xd8, 0x00, 0x00, 0x15, 0xca, 0x00, 0x00, 0x04,
+    0xe5, 0xb4, 0x23, 0xba, 0x18, 0xdf, 0xea, 0x10, 0xef, 0xff, 0xff, 0xf1,
+    0x12, 0xf3, 0x11, 0x00, 0x1f, 0x20, 0x00, 0x01, 0xf2, 0x00, 0x00, 0x1f,
+    0x20, 0x00, 0x01, 0xf2, 0x00, 0x00, 0x1f, 0x20, 0x00, 0x01, 0xf2, 0x00,
+    0x00, 0x1f, 0x20, 0x00, 0xc6, 0x00, 0x00, 0xd4, 0xc6, 0x00, 0x00, 0xd4,
+    0xc6, 0x00, 0x00, 0xd4, 0xc6, 0x00, 0x00, 0xd4, 0xc6, 0x00, 0x00, 0xd4,
+    0xb7, 0x00, 0x00, 0xe4, 0x9a, 0x00, 0x02, 0xf1, 0x2f, 0x72, 0x4c, 0xa0,
+    0x04, 0xcf, 0xd8, 0x10, 0xc7, 0x00, 0x00, 0x0d, 0x56, 0xd0, 0x00, 0x04,
+    0xe0, 0x1e, 0x50, 0x00, 0xa8, 0x00, 0x9b, 0x00, 0x1f, 0x20, 0x02, 0xf2,
+    0x07, 0xb0, 0x00, 0x0b, 0x80, 0xd5, 0x00, 0x00, 0x5e, 0x5d, 0x00, 0x00,
+    0x00, 0xee, 0x70, 0x00, 0x00, 0x08, 0xf1, 0x00, 0x00, 0x7c, 0x00, 0x00,
+    0xe8, 0x00, 0x03, 0xe2, 0xf1, 0x00, 0x4f, 0xc0, 0x00, 0x7a, 0x0d, 0x60,
+    0x08, 0xaf, 0x20, 0x0c, 0x50, 0x8b, 0x00, 0xd4, 0xb7, 0x02, 0xf1, 0x03,
+    0xf1, 0x3e, 0x06, 0xc0, 0x6b, 0x00, 0x0d, 0x58, 0x90, 0x1f, 0x1b, 0x60,
+    0x00, 0x9a, 0xd4, 0x00, 0xb7, 0xf1, 0x00, 0x04, 0xfe, 0x00, 0x06, 0xec,
+    0x00, 0x00, 0x0e, 0x90, 0x00, 0x2f, 0x70, 0x00, 0x5e, 0x20, 0x01, 0xd5,
+    0x0a, 0xb0, 0x09, 0xa0, 0x01, 0xe6, 0x4e, 0x10, 0x00, 0x5e, 0xd5, 0x00,
+    0x00, 0x0d, 0xd0, 0x00, 0x00, 0x6d, 0xd7, 0x00, 0x02, 0xe4, 0x3e, 0x30,
+    0x0c, 0x80, 0x07, 0xd1, 0x7d, 0x00, 0x00, 0xc9, 0xc8, 0x00, 0x00, 0xa8,
+    0x3e, 0x20, 0x03, 0xe1, 0x0a, 0x90, 0x0c, 0x60, 0x02, 0xe3, 0x5c, 0x00,
+    0x00, 0x8b, 0xd4, 0x00, 0x00, 0x1e, 0xb0, 0x00, 0x00, 0x0b, 0x70, 0x00,
+    0x00, 0x0b, 0x70, 0x00, 0x00, 0x0b, 0x70, 0x00, 0x6f, 0xff, 0xff, 0xf6,
+    0x11, 0x11, 0x19, 0xd1, 0x00, 0x00, 0x4e, 0x30, 0x00, 0x01, 0xe6, 0x00,
+    0x00, 0x0b, 0xa0, 0x00, 0x00, 0x7d, 0x10, 0x00, 0x04, 0xe3, 0x00, 0x00,
+    0x1e, 0x81, 0x11, 0x11, 0x7f, 0xff, 0xff, 0xf8, 0xbf, 0xcb, 0x71, 0xb6,
+    0x0b, 0x60, 0xb6, 0x0b, 0x60, 0xb6, 0x0b, 0x60, 0xb6, 0x0b, 0x60, 0xb6,
+    0x0b, 0x71, 0xbf, 0xc0, 0x35, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x0c, 0x30,
+    0x00, 0x08, 0x80, 0x00, 0x03, 0xd0, 0x00, 0x00, 0xd3, 0x00, 0x00, 0x87,
+    0x00, 0x00, 0x4c, 0x00, 0x00, 0x0e, 0x20, 0x00, 0x09, 0x70, 0x00, 0x04,
+    0xb0, 0x00, 0x00, 0xe1, 0x00, 0x00, 0xa6, 0xcf, 0xb1, 0x7b, 0x06, 0xb0,
+    0x6b, 0x06, 0xb0, 0x6b, 0x06, 0xb0, 0x6b, 0x06, 0xb0, 0x6b, 0x06, 0xb1,
+    0x7b, 0xcf, 0xb0, 0x00, 0x71, 0x00, 0x5e, 0x60, 0x0b, 0x5b, 0x02, 0xc0,
+    0xc2, 0x86, 0x06, 0x8d, 0x10, 0x1d, 0xee, 0xee, 0xee, 0x22, 0x22, 0x22,
+    0x27, 0x10, 0x05, 0xc2, 0x08, 0xde, 0xc3, 0x00, 0x94, 0x29, 0xd0, 0x00,
+    0x00, 0x1f, 0x10, 0x8d, 0xee, 0xf2, 0x4e, 0x42, 0x2f, 0x25, 0xe3, 0x38,
+    0xf2, 0x09, 0xee, 0x6e, 0x20, 0xe4, 0x00, 0x00, 0x0e, 0x40, 0x00, 0x00,
+    0xe4, 0x00, 0x00, 0x0e, 0x7c, 0xfc, 0x40, 0xee, 0x52, 0x7f, 0x2e, 0x60,
+    0x00, 0xa8, 0xe4, 0x00, 0x08, 0xae, 0x70, 0x00, 0xa8, 0xee, 0x52, 0x8f,
+    0x2e, 0x6c, 0xfc, 0x40, 0x02, 0xbe, 0xe8, 0x01, 0xda, 0x24, 0xd3, 0x5d,
+    0x00, 0x00, 0x07, 0xa0, 0x00, 0x00, 0x5d, 0x00, 0x00, 0x01, 0xda, 0x24,
+    0xd3, 0x02, 0xbe, 0xe8, 0x00, 0x00, 0x00, 0x01, 0xf1, 0x00, 0x00, 0x01,
+    0xf1, 0x00, 0x00, 0x01, 0xf1, 0x02, 0xbe, 0xd6, 0xf1, 0x1d, 0xa2, 0x4d,
+    0xf1, 0x5d, 0x00, 0x04, 0xf1, 0x7a, 0x00, 0x01, 0xf1, 0x5d, 0x00, 0x04,
+    0xf1, 0x1d, 0xa2, 0x4d, 0xf1, 0x02, 0xbf, 0xd5, 0xf1, 0x02, 0xbe, 0xd5,
+    0x01, 0xd8, 0x25, 0xe4, 0x5c, 0x00, 0x06, 0xa7, 0xfe, 0xee, 0xfc, 0x5d,
+    0x22, 0x22, 0x21, 0xd9, 0x23, 0x92, 0x02, 0xbe, 0xe9, 0x10, 0x02, 0xce,
+    0x70, 0x9a, 0x22, 0x0b, 0x60, 0x0c, 0xff, 0xf4, 0x1b, 0x71, 0x00, 0xb6,
+    0x00, 0x0b, 0x60, 0x00, 0xb6, 0x00, 0x0b, 0x60, 0x00, 0xb6, 0x00, 0x02,
+    0xbe, 0xd6, 0xe3, 0x1d, 0x92, 0x4c, 0xf3, 0x5d, 0x00, 0x03, 0xf3, 0x7b,
+    0x00, 0x00, 0xf3, 0x5d, 0x00, 0x02, 0xf3, 0x1d, 0xa2, 0x3d, 0xf3, 0x02,
+    0xbe, 0xd6, 0xf2, 0x00, 0x00, 0x02, 0xf0, 0x0c, 0x62, 0x3b, 0xa0, 0x07,
+    0xce, 0xe9, 0x10, 0xe4, 0x00, 0x00, 0x0e, 0x40, 0x00, 0x00, 0xe4, 0x00,
+    0x00, 0x0e, 0x7c, 0xec, 0x20, 0xed, 0x42, 0xac, 0x0e, 0x60, 0x02, 0xf1,
+    0xe4, 0x00, 0x0f, 0x2e, 0x40, 0x00, 0xf2, 0xe4, 0x00, 0x0f, 0x2e, 0x40,
+    0x00, 0xf2, 0xd4, 0x00, 0x00, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4,
+    0x00, 0xd5, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd4, 0x00, 0xd4, 0x00, 0xd4,
+    0x00, 0xd4, 0x00, 0xd4, 0x00, 0xd4, 0x00, 0xd4, 0x00, 0xd4, 0x33, 0xf2,
+    0xde, 0x80, 0xe4, 0x00, 0x00, 0x0e, 0x40, 0x00, 0x00, 0xe4, 0x00, 0x00,
+    0x0e, 0x40, 0x1b, 0xa0, 0xe4, 0x0b, 0xb0, 0x0e, 0x4b, 0xc1, 0x00, 0xed,
+    0xfc, 0x00, 0x0e, 0xc3, 0xd8, 0x00, 0xe4, 0x03, 0xf4, 0x0e, 0x40, 0x06,
+    0xe1, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe7,
+    0xdf, 0xb2, 0x8e, 0xe8, 0x0e, 0xd4, 0x3c, 0xeb, 0x34, 0xe5, 0xe6, 0x00,
+    0x4f, 0x20, 0x09, 0x9e, 0x40, 0x03, 0xe0, 0x00, 0x8a, 0xe4, 0x00, 0x3e,
+    0x00, 0x08, 0xae, 0x40, 0x03, 0xe0, 0x00, 0x8a, 0xe4, 0x00, 0x3e, 0x00,
+    0x08, 0xa0, 0xe6, 0xce, 0xc2, 0x0e, 0xd4, 0x2a, 0xc0, 0xe6, 0x00, 0x2f,
+    0x1e, 0x40, 0x00, 0xf2, 0xe4, 0x00, 0x0f, 0x2e, 0x40, 0x00, 0xf2, 0xe4,
+    0x00, 0x0f, 0x20, 0x02, 0xbe, 0xe8, 0x00, 0x1d, 0xa2, 0x4d, 0x80, 0x5d,
+    0x00, 0x04, 0xe0, 0x7a, 0x00, 0x01, 0xf1, 0x5d, 0x00, 0x04, 0xe0, 0x1d,
+    0xa2, 0x4d, 0x80, 0x02, 0xbe, 0xe8, 0x00, 0xe6, 0xcf, 0xc4, 0x0e, 0xe5,
+    0x27, 0xf2, 0xe7, 0x00, 0x0a, 0x8e, 0x40, 0x00, 0x8a, 0xe7, 0x00, 0x0a,
+    0x8e, 0xe5, 0x28, 0xf2, 0xe7, 0xcf, 0xc4, 0x0e, 0x40, 0x00, 0x00, 0xe4,
+    0x00, 0x00, 0x0e, 0x40, 0x00, 0x00, 0x02, 0xbe, 0xd5, 0xf1, 0x1d, 0xa2,
+    0x4d, 0xf1, 0x5d, 0x00, 0x04, 0xf1, 0x7a, 0x00, 0x01, 0xf1, 0x5d, 0x00,
+    0x04, 0xf1, 0x1d, 0xa2, 0x4d, 0xf1, 0x02, 0xbf, 0xd6, 0xf1, 0x00, 0x00,
+    0x01, 0xf1, 0x00, 0x00, 0x01, 0xf1, 0x00, 0x00, 0x01, 0xf1, 0xe7, 0xd8,
+    0xed, 0x41, 0xe6, 0x00, 0xe4, 0x00, 0xe4, 0x00, 0xe4, 0x00, 0xe4, 0x00,
+    0x09, 0xee, 0xb3, 0x6d, 0x32, 0x71, 0x7d, 0x20, 0x00, 0x19, 0xee, 0x91,
+    0x00, 0x03, 0xc8, 0x56, 0x32, 0xb8, 0x4c, 0xee, 0xa1, 0x06, 0x30, 0x00,
+    0xb6, 0x00, 0xcf, 0xff, 0x41, 0xb7, 0x10, 0x0b, 0x60, 0x00, 0xb6, 0x00,
+    0x0b, 0x60, 0x00, 0xaa, 0x12, 0x03, 0xde, 0x60, 0xf3, 0x00, 0x2f, 0xf3,
+    0x00, 0x2f, 0xf3, 0x00, 0x2f, 0xf3, 0x00, 0x2f, 0xe4, 0x00, 0x4f, 0xab,
+    0x33, 0xcf, 0x1a, 0xed, 0x6f, 0xc5, 0x00, 0x09, 0x87, 0xb0, 0x01, 0xe2,
+    0x1e, 0x20, 0x6b, 0x00, 0xa8, 0x0c, 0x50, 0x04, 0xe3, 0xe0, 0x00, 0x0d,
+    0xd8, 0x00, 0x00, 0x7f, 0x20, 0x00, 0xb5, 0x00, 0x4f, 0x10, 0x07, 0x86,
+    0xa0, 0x09, 0xf6, 0x00, 0xc3, 0x1e, 0x00, 0xe7, 0xb0, 0x2d, 0x00, 0xb5,
+    0x4c, 0x1e, 0x18, 0x80, 0x06, 0xa9, 0x60, 0xa6, 0xd3, 0x00, 0x1e, 0xe1,
+    0x04, 0xdd, 0x00, 0x00, 0xbb, 0x00, 0x0e, 0x80, 0x00, 0x6d, 0x10, 0x4e,
+    0x10, 0xa9, 0x1d, 0x40, 0x01, 0xec, 0x90, 0x00, 0x08, 0xf2, 0x00, 0x02,
+    0xeb, 0xa0, 0x00, 0xb8, 0x1d, 0x60, 0x7c, 0x00, 0x3e, 0x20, 0x0d, 0x50,
+    0x00, 0x98, 0x07, 0xb0, 0x00, 0xe2, 0x01, 0xf2, 0x05, 0xb0, 0x00, 0xa7,
+    0x0b, 0x60, 0x00, 0x5d, 0x2e, 0x10, 0x00, 0x0e, 0xb9, 0x00, 0x00, 0x08,
+    0xf3, 0x00, 0x00, 0x05, 0xc0, 0x00, 0x05, 0x2c, 0x60, 0x00, 0x1c, 0xe9,
+    0x00, 0x00, 0x7f, 0xff, 0xfb, 0x11, 0x13, 0xe4, 0x00, 0x0c, 0x70, 0x00,
+    0x8b, 0x00, 0x04, 0xe1, 0x00, 0x2e, 0x51, 0x11, 0x8f, 0xff, 0xfc, 0x00,
+    0xbf, 0x04, 0xe2, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x06, 0xc0, 0x4f,
+    0x70, 0x18, 0xb0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x04, 0xe2, 0x00,
+    0xbf, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5,
+    0xb5, 0xb5, 0xbc, 0x20, 0x1c, 0x70, 0x09, 0x90, 0x09, 0x90, 0x09, 0x90,
+    0x08, 0xa0, 0x03, 0xf7, 0x08, 0xb1, 0x09, 0x90, 0x09, 0x90, 0x09, 0x90,
+    0x1c, 0x80, 0xbc, 0x20, 0x0a, 0xd8, 0x19, 0x33, 0xb2, 0xaf, 0xc0, 0x11,
+    0x00, 0x10, 0x00, 0x1e, 0x30, 0x00, 0x0d, 0x10, 0xe2, 0x0e, 0x20, 0xf3,
+    0x0f, 0x41, 0xf4, 0x09, 0xe9, 0x05, 0x93, 0x95, 0x57, 0x06, 0x61, 0xcf,
+    0xc1, 0x00, 0x20, 0x00, 0x00, 0x1e, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2a, 0x10, 0x00, 0x0a, 0xb0, 0x00, 0x09, 0xc1, 0x00, 0x01, 0xf2, 0x00,
+    0x00, 0x1f, 0x60, 0x29, 0x60, 0x6e, 0xff, 0xb2, 0x00, 0x02, 0x10, 0x00,
+    0x00, 0x00, 0x17, 0x20, 0x00, 0x00, 0x2c, 0x50, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x6f, 0x30, 0x00, 0x00, 0x0d, 0xd9, 0x00, 0x00, 0x04,
+    0xe4, 0xf1, 0x00, 0x00, 0xa8, 0x0c, 0x70, 0x00, 0x2f, 0x30, 0x6d, 0x00,
+    0x08, 0xc0, 0x01, 0xf5, 0x00, 0xef, 0xee, 0xef, 0xb0, 0x6e, 0x22, 0x22,
+    0x4f, 0x2c, 0x70, 0x00, 0x00, 0xb9, 0x00, 0x02, 0x71, 0x00, 0x03, 0xc3,
+    0x00, 0x00, 0x00, 0x00, 0x0b, 0xff, 0xff, 0xf3, 0xb8, 0x11, 0x11, 0x0b,
+    0x70, 0x00, 0x00, 0xb7, 0x00, 0x00, 0x0b, 0xfe, 0xee, 0xa0, 0xb8, 0x22,
+    0x21, 0x0b, 0x70, 0x00, 0x00, 0xb8, 0x11, 0x11, 0x0b, 0xff, 0xff, 0xf5,
+    0x05, 0x58, 0xa1, 0x00, 0x0b, 0x70, 0xb7, 0x0b, 0x70, 0xb7, 0x0b, 0x70,
+    0xb7, 0x0b, 0x70, 0xb7, 0x0b, 0x70, 0x00, 0xab, 0x1a, 0x00, 0x01, 0xa5,
+    0xf8, 0x00, 0x00, 0x10, 0x10, 0x00, 0xb9, 0x00, 0x00, 0xb7, 0xbf, 0x50,
+    0x00, 0xb7, 0xbd, 0xe2, 0x00, 0xb7, 0xb7, 0xac, 0x10, 0xb7, 0xb7, 0x1d,
+    0x90, 0xb7, 0xb7, 0x03, 0xf5, 0xb7, 0xb7, 0x00, 0x6e, 0xd7, 0xb7, 0x00,
+    0x0a, 0xf7, 0xb7, 0x00, 0x01, 0xd7, 0x00, 0x00, 0x04, 0x60, 0x00, 0x00,
+    0x00, 0x5b, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0xee,
+    0xb4, 0x00, 0x05, 0xf8, 0x32, 0x7e, 0x60, 0x0e, 0x60, 0x00, 0x05, 0xe1,
+    0x4e, 0x00, 0x00, 0x00, 0xd6, 0x6c, 0x00, 0x00, 0x00, 0xb7, 0x4e, 0x00,
+    0x00, 0x00, 0xd6, 0x0e, 0x60, 0x00, 0x05, 0xe1, 0x05, 0xf8, 0x22, 0x7e,
+    0x60, 0x00, 0x3b, 0xee, 0xb4, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x09,
+    0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x00, 0x00, 0xd4, 0xc6, 0x00,
+    0x00, 0xd4, 0xc6, 0x00, 0x00, 0xd4, 0xc6, 0x00, 0x00, 0xd4, 0xc6, 0x00,
+    0x00, 0xd4, 0xb7, 0x00, 0x00, 0xe4, 0x9a, 0x00, 0x02, 0xf1, 0x2f, 0x72,
+    0x4c, 0xa0, 0x04, 0xcf, 0xd8, 0x10, 0x00, 0xc2, 0x85, 0x00, 0x00, 0x10,
+    0x10, 0x00, 0xc6, 0x00, 0x00, 0xd4, 0xc6, 0x00, 0x00, 0xd4, 0xc6, 0x00,
+    0x00, 0xd4, 0xc6, 0x00, 0x00, 0xd4, 0xc6, 0x00, 0x00, 0xd4, 0xb7, 0x00,
+    0x00, 0xe4, 0x9a, 0x00, 0x02, 0xf1, 0x2f, 0x72, 0x4c, 0xa0, 0x04, 0xcf,
+    0xd8, 0x10, 0x00, 0x01, 0x73, 0x00, 0x01, 0xb6, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x8d, 0xec, 0x30, 0x09, 0x42, 0x9d, 0x00, 0x00, 0x01, 0xf1, 0x08,
+    0xde, 0xef, 0x24, 0xe4, 0x22, 0xf2, 0x5e, 0x33, 0x8f, 0x20, 0x9e, 0xe6,
+    0xe2, 0x00, 0x00, 0x64, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2b, 0xed, 0x50, 0x1d, 0x82, 0x5e, 0x45, 0xc0, 0x00, 0x6a, 0x7f, 0xee,
+    0xef, 0xc5, 0xd2, 0x22, 0x22, 0x1d, 0x92, 0x39, 0x20, 0x2b, 0xee, 0x91,
+    0x06, 0x4a, 0x80, 0x00, 0x0e, 0x40, 0xe4, 0x0e, 0x40, 0xe4, 0x0e, 0x40,
+    0xe4, 0x0e, 0x40, 0x06, 0xd3, 0x91, 0x00, 0xb3, 0xdc, 0x00, 0x01, 0x01,
+    0x00, 0x0e, 0x6c, 0xec, 0x20, 0xed, 0x42, 0xac, 0x0e, 0x60, 0x02, 0xf1,
+    0xe4, 0x00, 0x0f, 0x2e, 0x40, 0x00, 0xf2, 0xe4, 0x00, 0x0f, 0x2e, 0x40,
+    0x00, 0xf2, 0x00, 0x00, 0x65, 0x00, 0x00, 0x08, 0x91, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0xbe, 0xe8, 0x00, 0x1d, 0xa2, 0x4d, 0x80, 0x5d, 0x00,
+    0x04, 0xe0, 0x7a, 0x00, 0x01, 0xf1, 0x5d, 0x00, 0x04, 0xe0, 0x1d, 0xa2,
+    0x4d, 0x80, 0x02, 0xbe, 0xe8, 0x00, 0x00, 0x04, 0x60, 0x00, 0x5b, 0x20,
+    0x00, 0x00, 0x00, 0xf3, 0x00, 0x2f, 0xf3, 0x00, 0x2f, 0xf3, 0x00, 0x2f,
+    0xf3, 0x00, 0x2f, 0xe4, 0x00, 0x4f, 0xab, 0x33, 0xcf, 0x1a, 0xed, 0x6f,
+    0x08, 0x55, 0x90, 0x01, 0x00, 0x10, 0xf3, 0x00, 0x2f, 0xf3, 0x00, 0x2f,
+    0xf3, 0x00, 0x2f, 0xf3, 0x00, 0x2f, 0xe4, 0x00, 0x4f, 0xab, 0x33, 0xcf,
+    0x1a, 0xed, 0x6f,
+};
+
+static const GfxGlyph ui_font_12_glyphs[] = {
+    {0x0020, 0, 0, 0, 0, 0, 3}, // U+0020 " "
+    {0x0021, 0, 3, 9, 0, -9, 3}, // U+0021 "!"
+    {0x0022, 14, 4, 3, 0, -9, 5}, // U+0022 "\""
+    {0x0023, 20, 9, 9, 0, -9, 8}, // U+0023 "#"
+    {0x0024, 61, 7, 13, 0, -11, 7}, // U+0024 "$"
+    {0x0025, 107, 10, 9, 0, -9, 10}, // U+0025 "%"
+    {0x0026, 152, 8, 9, 0, -9, 8}, // U+0026 "&"
+    {0x0027, 188, 2, 3, 0, -9, 3}, // U+0027 "'"
+    {0x0028, 191, 3, 13, 1, -10, 4}, // U+0028 "("
+    {0x0029, 211, 3, 13, 0, -10, 4}, // U+0029 ")"
+    {0x002A, 231, 5, 5, 0, -10, 5}, // U+002A "*"
+    {0x002B, 244, 7, 6, 0, -8, 7}, // U+002B "+"
+    {0x002C, 265, 3, 4, 0, -2, 3}, // U+002C ","
+    {0x002D, 271, 4, 2, 0, -4, 5}, // U+002D "-"
+    {0x002E, 275, 3, 2, 0, -2, 3}, // U+002E "."
+    {0x002F, 278, 6, 13, -1, -12, 4}, // U+002F "/"
+    {0x0030, 317, 8, 9, 0, -9, 8}, // U+0030 "0"
+    {0x0031, 353, 4, 9, 0, -9, 4}, // U+0031 "1"
+    {0x0032, 371, 7, 9, 0, -9, 7}, // U+0032 "2"
+    {0x0033, 403, 7, 9, 0, -9, 7}, // U+0033 "3"
+    {0x0034, 435, 8, 9, 0, -9, 8}, // U+0034 "4"
+    {0x0035, 471, 7, 9, 0, -9, 7}, // U+0035 "5"
+    {0x0036, 503, 7, 9, 0, -9, 7}, // U+0036 "6"
+    {0x0037, 535, 7, 9, 0, -9, 7}, // U+0037 "7"
+    {0x0038, 567, 8, 9, 0, -9, 8}, // U+0038 "8"
+    {0x0039, 603, 7, 9, 0, -9, 7}, // U+0039 "9"
+    {0x003A, 635, 3, 7, 0, -7, 3}, // U+003A ":"
+    {0x003B, 646, 3, 9, 0, -7, 3}, // U+003B ";"
+    {0x003C, 660, 7, 6, 0, -7, 7}, // U+003C "<"
+    {0x003D, 681, 7, 5, 0, -7, 7}, // U+003D "="
+    {0x003E, 699, 7, 6, 0, -7, 7}, // U+003E ">"
+    {0x003F, 720, 6, 9, 0, -9, 7}, // U+003F "?"
+    {0x0040, 747, 12, 12, 0, -9, 12}, // U+0040 "@"
+    {0x0041, 819, 9, 9, 0, -9, 9}, // U+0041 "A"
+    {0x0042, 860, 8, 9, 1, -9, 9}, // U+0042 "B"
+    {0x0043, 896, 9, 9, 0, -9, 9}, // U+0043 "C"
+    {0x0044, 937, 9, 9, 1, -9, 10}, // U+0044 "D"
+    {0x0045, 978, 7, 9, 1, -9, 8}, // U+0045 "E"
+    {0x0046, 1010, 7, 9, 1, -9, 8}, // U+0046 "F"
+    {0x0047, 1042, 9, 9, 0, -9, 9}, // U+0047 "G"
+    {0x0048, 1083, 8, 9, 1, -9, 10}, // U+0048 "H"
+    {0x0049, 1119, 2, 9, 1, -9, 4}, // U+0049 "I"
+    {0x004A, 1128, 5, 9, 0, -9, 6}, // U+004A "J"
+    {0x004B, 1151, 8, 9, 1, -9, 9}, // U+004B "K"
+    {0x004C, 1187, 6, 9, 1, -9, 7}, // U+004C "L"
+    {0x004D, 1214, 10, 9, 1, -9, 11}, // U+004D "M"
+    {0x004E, 1259, 8, 9, 1, -9, 10}, // U+004E "N"
+    {0x004F, 1295, 10, 9, 0, -9, 10}, // U+004F "O"
+    {0x0050, 1340, 7, 9, 1, -9, 9}, // U+0050 "P"
+    {0x0051, 1372, 10, 12, 0, -9, 10}, // U+0051 "Q"
+    {0x0052, 1432, 7, 9, 1, -9, 9}, // U+0052 "R"
+    {0x0053, 1464, 7, 9, 0, -9, 7}, // U+0053 "S"
+    {0x0054, 1496, 7, 9, 0, -9, 7}, // U+0054 "T"
+    {0x0055, 1528, 8, 9, 1, -9, 10}, // U+0055 "U"
+    {0x0056, 1564, 9, 9, 0, -9, 9}, // U+0056 "V"
+    {0x0057, 1605, 13, 9, 0, -9, 14}, // U+0057 "W"
+    {0x0058, 1664, 8, 9, 0, -9, 8}, // U+0058 "X"
+    {0x0059, 1700, 8, 9, 0, -9, 8}, // U+0059 "Y"
+    {0x005A, 1736, 8, 9, 0, -9, 8}, // U+005A "Z"
+    {0x005B, 1772, 3, 13, 1, -10, 4}, // U+005B "["
+    {0x005C, 1792, 6, 13, -1, -12, 4}, // U+005C "\\"
+    {0x005D, 1831, 3, 13, 0, -10, 4}, // U+005D "]"
+    {0x005E, 1851, 5, 6, 1, -8, 7}, // U+005E "^"
+    {0x005F, 1866, 6, 2, 0, 0, 6}, // U+005F "_"
+    {0x0060, 1872, 4, 2, 1, -10, 7}, // U+0060 "`"
+    {0x0061, 1876, 7, 7, 0, -7, 7}, // U+0061 "a"
+    {0x0062, 1901, 7, 10, 1, -10, 8}, // U+0062 "b"
+    {0x0063, 1936, 7, 7, 0, -7, 7}, // U+0063 "c"
+    {0x0064, 1961, 8, 10, 0, -10, 8}, // U+0064 "d"
+    {0x0065, 2001, 7, 7, 0, -7, 7}, // U+0065 "e"
+    {0x0066, 2026, 5, 10, 0, -10, 4}, // U+0066 "f"
+    {0x0067, 2051, 8, 10, 0, -7, 8}, // U+0067 "g"
+    {0x0068, 2091, 7, 10, 1, -10, 8}, // U+0068 "h"
+    {0x0069, 2126, 2, 10, 1, -10, 3}, // U+0069 "i"
+    {0x006A, 2136, 4, 13, -1, -10, 3}, // U+006A "j"
+    {0x006B, 2162, 7, 10, 1, -10, 7}, // U+006B "k"
+    {0x006C, 2197, 2, 10, 1, -10, 3}, // U+006C "l"
+    {0x006D, 2207, 11, 7, 1, -7, 13}, // U+006D "m"
+    {0x006E, 2246, 7, 7, 1, -7, 8}, // U+006E "n"
+    {0x006F, 2271, 8, 7, 0, -7, 8}, // U+006F "o"
+    {0x0070, 2299, 7, 10, 1, -7, 8}, // U+0070 "p"
+    {0x0071, 2334, 8, 10, 0, -7, 8}, // U+0071 "q"
+    {0x0072, 2374, 4, 7, 1, -7, 5}, // U+0072 "r"
+    {0x0073, 2388, 6, 7, 0, -7, 6}, // U+0073 "s"
+    {0x0074, 2409, 5, 9, 0, -9, 5}, // U+0074 "t"
+    {0x0075, 2432, 6, 7, 1, -7, 8}, // U+0075 "u"
+    {0x0076, 2453, 7, 7, 0, -7, 7}, // U+0076 "v"
+    {0x0077, 2478, 11, 7, 0, -7, 11}, // U+0077 "w"
+    {0x0078, 2517, 7, 7, 0, -7, 7}, // U+0078 "x"
+    {0x0079, 2542, 8, 10, -1, -7, 7}, // U+0079 "y"
+    {0x007A, 2582, 6, 7, 0, -7, 6}, // U+007A "z"
+    {0x007B, 2603, 4, 13, 0, -10, 4}, // U+007B "{"
+    {0x007C, 2629, 2, 13, 1, -10, 4}, // U+007C "|"
+    {0x007D, 2642, 4, 13, 0, -10, 4}, // U+007D "}"
+    {0x007E, 2668, 7, 3, 0, -6, 7}, // U+007E "~"
+    {0x00A1, 2679, 3, 8, 0, -7, 3}, // U+00A1 "¡"
+    {0x00B0, 2691, 5, 5, 0, -9, 5}, // U+00B0 "°"
+    {0x00BF, 2704, 7, 9, 0, -7, 7}, // U+00BF "¿"
+    {0x00C1, 2736, 9, 12, 0, -12, 9}, // U+00C1 "Á"
+    {0x00C9, 2790, 7, 12, 1, -12, 8}, // U+00C9 "É"
+    {0x00CD, 2832, 3, 12, 1, -12, 4}, // U+00CD "Í"
+    {0x00D1, 2850, 8, 12, 1, -12, 10}, // U+00D1 "Ñ"
+    {0x00D3, 2898, 10, 12, 0, -12, 10}, // U+00D3 "Ó"
+    {0x00DA, 2958, 8, 12, 1, -12, 10}, // U+00DA "Ú"
+    {0x00DC, 3006, 8, 11, 1, -11, 10}, // U+00DC "Ü"
+    {0x00E1, 3050, 7, 10, 0, -10, 7}, // U+00E1 "á"
+    {0x00E9, 3085, 7, 10, 0, -10, 7}, // U+00E9 "é"
+    {0x00ED, 3120, 3, 10, 1, -10, 3}, // U+00ED "í"
+    {0x00F1, 3135, 7, 10, 1, -10, 8}, // U+00F1 "ñ"
+    {0x00F3, 3170, 8, 10, 0, -10, 8}, // U+00F3 "ó"
+    {0x00FA, 3210, 6, 10, 1, -10, 8}, // U+00FA "ú"
+    {0x00FC, 3240, 6, 9, 1, -9, 8}, // U+00FC "ü"
+};
+
+static const GfxFont ui_font_12 = {ui_font_12_bitmap, ui_font_12_glyphs, 112, 15, 3};
+
+static const uint8_t ui_font_20_bitmap[] = {
+    0x6f, 0xc6, 0xfb, 0x5f, 0xb5, 0xfa, 0x4f, 0xa4, 0xf9, 0x3f, 0x93, 0xf8,
+    0x2f, 0x71, 0xf7, 0x00, 0x03, 0xc7, 0x9f, 0xe4, 0xe9, 0xbe, 0x02, 0xf8,
+    0xbd, 0x01, 0xf8, 0xad, 0x01, 0xf7, 0xad, 0x01, 0xf7, 0xac, 0x00, 0xf7,
+    0x00, 0x00, 0x7e, 0x00, 0x04, 0xf2, 0x00, 0x00, 0x00, 0x9c, 0x00, 0x07,
+    0xf0, 0x00, 0x00, 0x00, 0xca, 0x00, 0x09, 0xd0, 0x00, 0x0c, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf8, 0x09, 0xbb, 0xfc, 0xbb, 0xbe, 0xdb, 0xb6, 0x00,
+    0x02, 0xf5, 0x00, 0x0e, 0x70, 0x00, 0x00, 0x03, 0xf3, 0x00, 0x1f, 0x60,
+    0x00, 0x00, 0x05, 0xf1, 0x00, 0x2f, 0x40, 0x00, 0x00, 0x07, 0xe0, 0x00,
+    0x4f, 0x20, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x5b, 0xbe,
+    0xeb, 0xbb, 0xdf, 0xbb, 0x90, 0x00, 0x0c, 0x90, 0x00, 0x9c, 0x00, 0x00,
+    0x00, 0x0e, 0x70, 0x00, 0xba, 0x00, 0x00, 0x00, 0x1f, 0x50, 0x00, 0xd8,
+    0x00, 0x00, 0x00, 0x00, 0x05, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x05, 0xe0,
+    0x00, 0x00, 0x00, 0x00, 0x05, 0xe0, 0x00, 0x00, 0x00, 0x17, 0xcf, 0xfe,
+    0xc8, 0x20, 0x01, 0xcf, 0xec, 0xfc, 0xef, 0xd0, 0x08, 0xfb, 0x15, 0xe0,
+    0x06, 0x70, 0x0c, 0xf3, 0x05, 0xe0, 0x00, 0x00, 0x0b, 0xf5, 0x05, 0xe0,
+    0x00, 0x00, 0x07, 0xfe, 0x66, 0xe0, 0x00, 0x00, 0x00, 0x9f, 0xff, 0xf8,
+    0x40, 0x00, 0x00, 0x02, 0x7c, 0xff, 0xfd, 0x40, 0x00, 0x00, 0x05, 0xe5,
+    0xbf, 0xf2, 0x00, 0x00, 0x05, 0xe0, 0x09, 0xf7, 0x01, 0x00, 0x05, 0xe0,
+    0x06, 0xf8, 0x0c, 0x92, 0x05, 0xe0, 0x2d, 0xf5, 0x1c, 0xff, 0xdc, 0xfc,
+    0xff, 0xa0, 0x00, 0x5a, 0xdf, 0xff, 0xc6, 0x00, 0x00, 0x00, 0x05, 0xe0,
+    0x00, 0x00, 0x00, 0x00, 0x05, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x02, 0x70,
+    0x00, 0x00, 0x01, 0x9e, 0xe9, 0x10, 0x00, 0x01, 0xda, 0x00, 0x00, 0xab,
+    0x22, 0xba, 0x00, 0x00, 0x9d, 0x10, 0x00, 0x1f, 0x30, 0x03, 0xf1, 0x00,
+    0x4f, 0x40, 0x00, 0x03, 0xf1, 0x00, 0x1f, 0x30, 0x1d, 0x90, 0x00, 0x00,
+    0x2f, 0x30, 0x03, 0xf1, 0x0a, 0xd1, 0x00, 0x00, 0x00, 0xbb, 0x22, 0xbb,
+    0x05, 0xf4, 0x00, 0x00, 0x00, 0x02, 0xcf, 0xfc, 0x21, 0xe8, 0x1a, 0xee,
+    0x80, 0x00, 0x00, 0x11, 0x00, 0xac, 0x0a, 0xc4, 0x5e, 0x60, 0x00, 0x00,
+    0x00, 0x6f, 0x32, 0xf3, 0x00, 0x7d, 0x00, 0x00, 0x00, 0x2e, 0x70, 0x5f,
+    0x00, 0x04, 0xf1, 0x00, 0x00, 0x0b, 0xc0, 0x05, 0xe0, 0x00, 0x3f, 0x10,
+    0x00, 0x06, 0xf2, 0x00, 0x2f, 0x20, 0x06, 0xd0, 0x00, 0x02, 0xe7, 0x00,
+    0x00, 0xaa, 0x13, 0xd6, 0x00, 0x00, 0xcb, 0x00, 0x00, 0x01, 0xae, 0xe8,
+    0x00, 0x00, 0x01, 0x9d, 0xed, 0x70, 0x00, 0x00, 0x00, 0x0d, 0xfd, 0xbe,
+    0xf7, 0x00, 0x00, 0x00, 0x4f, 0xb0, 0x01, 0xec, 0x00, 0x00, 0x00, 0x5f,
+    0x70, 0x00, 0xcc, 0x00, 0x00, 0x00, 0x1f, 0xc1, 0x08, 0xf6, 0x00, 0x00,
+    0x00, 0x07, 0xfb, 0xcf, 0x70, 0x00, 0x00, 0x00, 0x03, 0xef, 0xf4, 0x00,
+    0x00, 0x00, 0x00, 0x6f, 0xd9, 0xfc, 0x10, 0x06, 0x20, 0x06, 0xfa, 0x00,
+    0x6f, 0xd2, 0x1f, 0x90, 0x0e, 0xe0, 0x00, 0x05, 0xfd, 0x9f, 0x40, 0x1f,
+    0xd0, 0x00, 0x00, 0x4e, 0xfb, 0x00, 0x0d, 0xf7, 0x00, 0x00, 0x6e, 0xfe,
+    0x40, 0x04, 0xff, 0xec, 0xbe, 0xfd, 0x5e, 0xe3, 0x00, 0x29, 0xdf, 0xec,
+    0x70, 0x03, 0xa0, 0xbe, 0xbd, 0xad, 0xad, 0xac, 0x00, 0x1e, 0xd0, 0x07,
+    0xf6, 0x00, 0xde, 0x00, 0x3f, 0xa0, 0x08, 0xf5, 0x00, 0xbf, 0x20, 0x0d,
+    0xf0, 0x00, 0xfd, 0x00, 0x1f, 0xd0, 0x01, 0xfc, 0x00, 0x1f, 0xd0, 0x00,
+    0xfd, 0x00, 0x0d, 0xf0, 0x00, 0xbf, 0x20, 0x08, 0xf5, 0x00, 0x3f, 0xa0,
+    0x00, 0xde, 0x00, 0x07, 0xf6, 0x00, 0x1e, 0xd0, 0x2f, 0xb0, 0x00, 0xaf,
+    0x40, 0x03, 0xfa, 0x00, 0x0d, 0xe0, 0x00, 0x9f, 0x40, 0x06, 0xf7, 0x00,
+    0x3f, 0xa0, 0x02, 0xfb, 0x00, 0x1f, 0xc0, 0x00, 0xfd, 0x00, 0x1f, 0xc0,
+    0x02, 0xfb, 0x00, 0x3f, 0xa0, 0x06, 0xf7, 0x00, 0x9f, 0x40, 0x0d, 0xe0,
+    0x03, 0xfa, 0x00, 0xaf, 0x30, 0x2f, 0xb0, 0x00, 0x00, 0x09, 0x90, 0x00,
+    0x14, 0x09, 0x90, 0x41, 0x6f, 0x9a, 0xa9, 0xf6, 0x04, 0xdf, 0xfd, 0x40,
+    0x03, 0xcf, 0xfc, 0x30, 0x6f, 0xaa, 0xaa, 0xf6, 0x25, 0x09, 0x90, 0x51,
+    0x00, 0x09, 0x90, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x00, 0xfa,
+    0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x00,
+    0xaf, 0xff, 0xff, 0xff, 0xf4, 0x7b, 0xbb, 0xfe, 0xbb, 0xb3, 0x00, 0x00,
+    0xfa, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00,
+    0x00, 0xae, 0x4f, 0xf8, 0x9f, 0x65, 0xf2, 0x9c, 0x0c, 0x70, 0x9b, 0xbb,
+    0xb6, 0xdf, 0xff, 0xf8, 0x8c, 0x3f, 0xf8, 0xae, 0x40, 0x00, 0x00, 0x00,
+    0x07, 0x50, 0x00, 0x00, 0x04, 0xf7, 0x00, 0x00, 0x00, 0xaf, 0x20, 0x00,
+    0x00, 0x0e, 0xc0, 0x00, 0x00, 0x05, 0xf6, 0x00, 0x00, 0x00, 0xaf, 0x10,
+    0x00, 0x00, 0x1e, 0xb0, 0x00, 0x00, 0x05, 0xf6, 0x00, 0x00, 0x00, 0xaf,
+    0x10, 0x00, 0x00, 0x1e, 0xb0, 0x00, 0x00, 0x05, 0xf6, 0x00, 0x00, 0x00,
+    0xaf, 0x10, 0x00, 0x00, 0x1f, 0xb0, 0x00, 0x00, 0x05, 0xf6, 0x00, 0x00,
+    0x00, 0xbf, 0x10, 0x00, 0x00, 0x1f, 0xb0, 0x00, 0x00, 0x06, 0xf6, 0x00,
+    0x00, 0x00, 0xbf, 0x10, 0x00, 0x00, 0x1f, 0xa0, 0x00, 0x00, 0x06, 0xf5,
+    0x00, 0x00, 0x00, 0x00, 0x18, 0xde, 0xda, 0x30, 0x00, 0x02, 0xdf, 0xeb,
+    0xdf, 0xf6, 0x00, 0x0c, 0xf8, 0x00, 0x04, 0xef, 0x30, 0x6f, 0xb0, 0x00,
+    0x00, 0x6f, 0xb0, 0xbf, 0x40, 0x00, 0x00, 0x0e, 0xf1, 0xef, 0x10, 0x00,
+    0x00, 0x0b, 0xf4, 0xff, 0x00, 0x00, 0x00, 0x0a, 0xf5, 0xff, 0x00, 0x00,
+    0x00, 0x0a, 0xf5, 0xef, 0x10, 0x00, 0x00, 0x0b, 0xf4, 0xbf, 0x40, 0x00,
+    0x00, 0x0e, 0xf1, 0x6f, 0xb0, 0x00, 0x00, 0x6f, 0xb0, 0x0c, 0xf8, 0x00,
+    0x04, 0xef, 0x30, 0x02, 0xdf, 0xeb, 0xdf, 0xf6, 0x00, 0x00, 0x18, 0xde,
+    0xda, 0x30, 0x00, 0xdf, 0xff, 0xf4, 0x9b, 0xbe, 0xf4, 0x00, 0x0a, 0xf4,
+    0x00, 0x0a, 0xf4, 0x00, 0x0a, 0xf4, 0x00, 0x0a, 0xf4, 0x00, 0x0a, 0xf4,
+    0x00, 0x0a, 0xf4, 0x00, 0x0a, 0xf4, 0x00, 0x0a, 0xf4, 0x00, 0x0a, 0xf4,
+    0x00, 0x0a, 0xf4, 0x00, 0x0a, 0xf4, 0x00, 0x0a, 0xf4, 0x00, 0x6b, 0xef,
+    0xea, 0x30, 0x02, 0xdf, 0xfc, 0xbe, 0xff, 0x50, 0x5f, 0x81, 0x00, 0x07,
+    0xfe, 0x00, 0x20, 0x00, 0x00, 0x0e, 0xf2, 0x00, 0x00, 0x00, 0x00, 0xdf,
+    0x20, 0x00, 0x00, 0x00, 0x3f, 0xd0, 0x00, 0x00, 0x00, 0x1d, 0xf5, 0x00,
+    0x00, 0x00, 0x1c, 0xf8, 0x00, 0x00, 0x00, 0x1c, 0xf9, 0x00, 0x00, 0x00,
+    0x2d, 0xf8, 0x00, 0x00, 0x00, 0x2d, 0xf7, 0x00, 0x00, 0x00, 0x2d, 0xf7,
+    0x00, 0x00, 0x00, 0x2e, 0xfe, 0xbb, 0xbb, 0xbb, 0x94, 0xff, 0xff, 0xff,
+    0xff, 0xfc, 0x4f, 0xff, 0xff, 0xff, 0xff, 0x03, 0xbb, 0xbb, 0xbb, 0xdf,
+    0xc0, 0x00, 0x00, 0x00, 0x3e, 0xe2, 0x00, 0x00, 0x00, 0x1d, 0xf4, 0x00,
+    0x00, 0x00, 0x0c, 0xf6, 0x00, 0x00, 0x00, 0x09, 0xfa, 0x00, 0x00, 0x00,
+    0x01, 0xff, 0xfd, 0x70, 0x00, 0x00, 0x06, 0x79, 0xef, 0xb0, 0x00, 0x00,
+    0x00, 0x01, 0xdf, 0x50, 0x00, 0x00, 0x00, 0x08, 0xf8, 0x00, 0x00, 0x00,
+    0x00, 0x9f, 0x76, 0xc4, 0x00, 0x00, 0x5f, 0xf2, 0x8f, 0xfe, 0xcb, 0xdf,
+    0xf6, 0x00, 0x39, 0xce, 0xfd, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x07, 0xfa,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0xd1, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0xef, 0x30, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xf6, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x8f, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x05, 0xfd, 0x10, 0x12, 0x10,
+    0x00, 0x00, 0x2e, 0xe2, 0x00, 0x6f, 0x70, 0x00, 0x00, 0xcf, 0x50, 0x00,
+    0x6f, 0x70, 0x00, 0x09, 0xf9, 0x00, 0x00, 0x6f, 0x70, 0x00, 0x3f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf2, 0x3c, 0xcc, 0xcc, 0xcc, 0xdf, 0xdc, 0xc2,
+    0x00, 0x00, 0x00, 0x00, 0x7f, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f,
+    0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x70, 0x00, 0x00, 0xef, 0xff,
+    0xff, 0xff, 0x00, 0x1f, 0xeb, 0xbb, 0xbb, 0xb0, 0x03, 0xfa, 0x00, 0x00,
+    0x00, 0x00, 0x4f, 0x90, 0x00, 0x00, 0x00, 0x06, 0xf7, 0x00, 0x00, 0x00,
+    0x00, 0x7f, 0xdb, 0xa9, 0x61, 0x00, 0x09, 0xff, 0xff, 0xff, 0xe6, 0x00,
+    0x00, 0x00, 0x13, 0x8f, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x8f, 0xa0, 0x00,
+    0x00, 0x00, 0x04, 0xfb, 0x01, 0x00, 0x00, 0x00, 0x6f, 0xa3, 0xe6, 0x10,
+    0x00, 0x3e, 0xf5, 0x5f, 0xff, 0xcb, 0xdf, 0xf9, 0x00, 0x28, 0xce, 0xfe,
+    0xb5, 0x00, 0x00, 0x05, 0xad, 0xfd, 0xb6, 0x00, 0x1a, 0xff, 0xdb, 0xce,
+    0xb0, 0x0a, 0xfb, 0x20, 0x00, 0x12, 0x04, 0xfb, 0x00, 0x00, 0x00, 0x00,
+    0xaf, 0x40, 0x00, 0x00, 0x00, 0x0d, 0xf1, 0x6c, 0xee, 0xc6, 0x00, 0xff,
+    0x9f, 0xeb, 0xdf, 0xfa, 0x0f, 0xff, 0x70, 0x00, 0x3e, 0xf5, 0xef, 0xa0,
+    0x00, 0x00, 0x5f, 0xac, 0xf7, 0x00, 0x00, 0x03, 0xfb, 0x7f, 0xa0, 0x00,
+    0x00, 0x5f, 0xa1, 0xef, 0x70, 0x00, 0x3e, 0xf4, 0x04, 0xef, 0xeb, 0xcf,
+    0xf8, 0x00, 0x02, 0x9d, 0xfe, 0xb5, 0x00, 0x6f, 0xff, 0xff, 0xff, 0xff,
+    0xf2, 0x6f, 0xdb, 0xbb, 0xbb, 0xbf, 0xf1, 0x6f, 0x80, 0x00, 0x00, 0x7f,
+    0xa0, 0x6f, 0x80, 0x00, 0x00, 0xdf, 0x30, 0x13, 0x20, 0x00, 0x05, 0xfb,
+    0x00, 0x00, 0x00, 0x00, 0x0c, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x4f, 0xd0,
+    0x00, 0x00, 0x00, 0x00, 0xaf, 0x60, 0x00, 0x00, 0x00, 0x02, 0xfe, 0x10,
+    0x00, 0x00, 0x00, 0x09, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x1e, 0xf1, 0x00,
+    0x00, 0x00, 0x00, 0x7f, 0x90, 0x00, 0x00, 0x00, 0x00, 0xef, 0x30, 0x00,
+    0x00, 0x00, 0x06, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x17, 0xce, 0xfe, 0xb6,
+    0x00, 0x01, 0xcf, 0xfc, 0xbd, 0xff, 0xb0, 0x07, 0xfc, 0x20, 0x00, 0x2d,
+    0xf5, 0x09, 0xf6, 0x00, 0x00, 0x08, 0xf7, 0x05, 0xfc, 0x10, 0x00, 0x2d,
+    0xf3, 0x00, 0x8f, 0xfc, 0xbc, 0xff, 0x70, 0x00, 0x7e, 0xff, 0xff, 0xfe,
+    0x50, 0x07, 0xfe, 0x62, 0x02, 0x7e, 0xf5, 0x0e, 0xf3, 0x00, 0x00, 0x05,
+    0xfc, 0x1f, 0xe0, 0x00, 0x00, 0x01, 0xfe, 0x0f, 0xf1, 0x00, 0x00, 0x03,
+    0xfd, 0x0a, 0xfb, 0x20, 0x00, 0x3d, 0xf8, 0x01, 0xdf, 0xfc, 0xbd, 0xff,
+    0xb1, 0x00, 0x07, 0xbe, 0xfe, 0xb6, 0x00, 0x00, 0x3a, 0xef, 0xea, 0x40,
+    0x00, 0x06, 0xff, 0xdb, 0xcf, 0xf8, 0x00, 0x1f, 0xf5, 0x00, 0x02, 0xcf,
+    0x50, 0x5f, 0x90, 0x00, 0x00, 0x3f, 0xc0, 0x6f, 0x90, 0x00, 0x00, 0x3f,
+    0xf2, 0x2f, 0xf5, 0x00, 0x02, 0xcf, 0xf4, 0x08, 0xff, 0xdb, 0xcf, 0xeb,
+    0xf5, 0x00, 0x5b, 0xef, 0xd9, 0x1a, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x0c,
+    0xf3, 0x00, 0x00, 0x00, 0x00, 0x2f, 0xe0, 0x00, 0x00, 0x00, 0x00, 0xaf,
+    0x90, 0x00, 0x30, 0x00, 0x19, 0xfe, 0x10, 0x06, 0xfd, 0xbc, 0xff, 0xd3,
+    0x00, 0x04, 0xad, 0xfe, 0xc7, 0x10, 0x00, 0x8c, 0x3f, 0xf8, 0xae, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x3f, 0xf8, 0xae, 0x40,
+    0x8c, 0x3f, 0xf8, 0xae, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xae, 0x4f, 0xf8, 0x9f, 0x65, 0xf2, 0x9c, 0x0c, 0x70, 0x00, 0x00, 0x00,
+    0x00, 0x22, 0x00, 0x00, 0x00, 0x4a, 0xf4, 0x00, 0x02, 0x8d, 0xfe, 0x91,
+    0x05, 0xbf, 0xfb, 0x50, 0x00, 0x9f, 0xd8, 0x20, 0x00, 0x00, 0x9f, 0xd7,
+    0x20, 0x00, 0x00, 0x05, 0xbf, 0xfb, 0x50, 0x00, 0x00, 0x02, 0x8d, 0xfe,
+    0x91, 0x00, 0x00, 0x00, 0x5a, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x22, 0xaf,
+    0xff, 0xff, 0xff, 0xf4, 0x7b, 0xbb, 0xbb, 0xbb, 0xb3, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xaf, 0xff, 0xff, 0xff, 0xf4, 0x7b, 0xbb, 0xbb, 0xbb, 0xb3, 0x30, 0x00,
+    0x00, 0x00, 0x00, 0xae, 0x82, 0x00, 0x00, 0x00, 0x4b, 0xff, 0xb5, 0x00,
+    0x00, 0x00, 0x27, 0xdf, 0xe9, 0x30, 0x00, 0x00, 0x04, 0xae, 0xf4, 0x00,
+    0x00, 0x04, 0x9e, 0xf4, 0x00, 0x27, 0xdf, 0xe9, 0x30, 0x4b, 0xff, 0xb5,
+    0x00, 0x00, 0xae, 0x82, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x7c, 0xef, 0xda, 0x30, 0x02, 0xdf, 0xec, 0xbe, 0xff, 0x60, 0x6f,
+    0x81, 0x00, 0x08, 0xfe, 0x00, 0x10, 0x00, 0x00, 0x0f, 0xf1, 0x00, 0x00,
+    0x00, 0x02, 0xfd, 0x00, 0x00, 0x00, 0x01, 0xcf, 0x50, 0x00, 0x00, 0x02,
+    0xdf, 0x60, 0x00, 0x00, 0x00, 0xdf, 0x60, 0x00, 0x00, 0x00, 0x5f, 0xb0,
+    0x00, 0x00, 0x00, 0x02, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0xc5, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xc0, 0x00, 0x00,
+    0x00, 0x05, 0xe7, 0x00, 0x00, 0x00, 0x00, 0x04, 0x9c, 0xef, 0xec, 0x83,
+    0x00, 0x00, 0x00, 0x00, 0x3c, 0xff, 0xec, 0xbd, 0xef, 0xfb, 0x10, 0x00,
+    0x00, 0x5f, 0xf8, 0x30, 0x00, 0x00, 0x49, 0xfe, 0x30, 0x00, 0x3f, 0xc3,
+    0x01, 0x7a, 0xa6, 0x14, 0xb8, 0xde, 0x20, 0x0d, 0xe2, 0x04, 0xef, 0xff,
+    0xfd, 0x7f, 0x53, 0xeb, 0x06, 0xf5, 0x02, 0xef, 0x71, 0x14, 0xcf, 0xf5,
+    0x07, 0xf2, 0xbd, 0x00, 0x8f, 0x70, 0x00, 0x01, 0xef, 0x50, 0x1e, 0x7e,
+    0x90, 0x0c, 0xf1, 0x00, 0x00, 0x08, 0xf5, 0x00, 0xca, 0xf7, 0x00, 0xed,
+    0x00, 0x00, 0x00, 0x6f, 0x50, 0x0a, 0xbf, 0x70, 0x0d, 0xe0, 0x00, 0x00,
+    0x07, 0xf5, 0x00, 0xba, 0xe9, 0x00, 0xaf, 0x40, 0x00, 0x00, 0xbf, 0x50,
+    0x0d, 0x8b, 0xd0, 0x03, 0xfc, 0x10, 0x00, 0x7f, 0xf7, 0x03, 0xf4, 0x6f,
+    0x40, 0x07, 0xfe, 0xa9, 0xcf, 0x7f, 0xe9, 0xec, 0x00, 0xdd, 0x10, 0x05,
+    0xbe, 0xeb, 0x40, 0x6d, 0xea, 0x10, 0x03, 0xfc, 0x20, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x05, 0xfe, 0x83, 0x00, 0x00, 0x04, 0x20, 0x00,
+    0x00, 0x00, 0x03, 0xdf, 0xfe, 0xcb, 0xce, 0xf7, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x5a, 0xde, 0xfe, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6f, 0xfe, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x0c, 0xf9, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x04, 0xfa, 0x1f, 0xd0,
+    0x00, 0x00, 0x00, 0x00, 0xbf, 0x40, 0xaf, 0x50, 0x00, 0x00, 0x00, 0x3f,
+    0xc0, 0x03, 0xfc, 0x00, 0x00, 0x00, 0x09, 0xf5, 0x00, 0x0c, 0xf4, 0x00,
+    0x00, 0x02, 0xfe, 0x00, 0x00, 0x5f, 0xb0, 0x00, 0x00, 0x8f, 0x70, 0x00,
+    0x00, 0xdf, 0x20, 0x00, 0x1e, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x00, 0x07,
+    0xfc, 0xaa, 0xaa, 0xaa, 0xaf, 0xf1, 0x00, 0xdf, 0x30, 0x00, 0x00, 0x00,
+    0x9f, 0x80, 0x5f, 0xb0, 0x00, 0x00, 0x00, 0x02, 0xfe, 0x1c, 0xf4, 0x00,
+    0x00, 0x00, 0x00, 0x0a, 0xf6, 0xef, 0xff, 0xff, 0xfe, 0xb6, 0x00, 0x0e,
+    0xfb, 0xbb, 0xbb, 0xdf, 0xfa, 0x00, 0xef, 0x10, 0x00, 0x00, 0x5f, 0xf3,
+    0x0e, 0xf1, 0x00, 0x00, 0x00, 0xaf, 0x60, 0xef, 0x10, 0x00, 0x00, 0x0b,
+    0xf4, 0x0e, 0xf1, 0x00, 0x00, 0x29, 0xfc, 0x00, 0xef, 0xff, 0xff, 0xff,
+    0xfd, 0x20, 0x0e, 0xfb, 0xbb, 0xbb, 0xce, 0xfc, 0x20, 0xef, 0x10, 0x00,
+    0x00, 0x19, 0xfb, 0x0e, 0xf1, 0x00, 0x00, 0x00, 0x0f, 0xf1, 0xef, 0x10,
+    0x00, 0x00, 0x00, 0xef, 0x2e, 0xf1, 0x00, 0x00, 0x00, 0x8f, 0xd0, 0xef,
+    0xbb, 0xbb, 0xbc, 0xef, 0xf5, 0x0e, 0xff, 0xff, 0xff, 0xfd, 0x93, 0x00,
+    0x00, 0x01, 0x7c, 0xef, 0xeb, 0x60, 0x00, 0x05, 0xef, 0xfd, 0xbd, 0xff,
+    0xc2, 0x05, 0xff, 0x81, 0x00, 0x02, 0xaf, 0x52, 0xff, 0x50, 0x00, 0x00,
+    0x00, 0x20, 0x8f, 0x90, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xf3, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xdf, 0x30, 0x00, 0x00, 0x00, 0x00, 0x08, 0xf9,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0xf5, 0x00, 0x00, 0x00, 0x02, 0x00,
+    0x5f, 0xf8, 0x10, 0x00, 0x2a, 0xf5, 0x00, 0x5e, 0xff, 0xcb, 0xcf, 0xfc,
+    0x20, 0x00, 0x17, 0xce, 0xfe, 0xb5, 0x00, 0xef, 0xff, 0xff, 0xed, 0x94,
+    0x00, 0x00, 0xef, 0xbb, 0xbb, 0xce, 0xff, 0xb1, 0x00, 0xef, 0x10, 0x00,
+    0x00, 0x4c, 0xfd, 0x10, 0xef, 0x10, 0x00, 0x00, 0x00, 0xbf, 0xa0, 0xef,
+    0x10, 0x00, 0x00, 0x00, 0x1f, 0xf2, 0xef, 0x10, 0x00, 0x00, 0x00, 0x0a,
+    0xf6, 0xef, 0x10, 0x00, 0x00, 0x00, 0x07, 0xf8, 0xef, 0x10, 0x00, 0x00,
+    0x00, 0x08, 0xf7, 0xef, 0x10, 0x00, 0x00, 0x00, 0x0a, 0xf6, 0xef, 0x10,
+    0x00, 0x00, 0x00, 0x1e, 0xf2, 0xef, 0x10, 0x00, 0x00, 0x00, 0xbf, 0xa0,
+    0xef, 0x10, 0x00, 0x00, 0x4c, 0xfd, 0x10, 0xef, 0xbb, 0xbb, 0xce, 0xff,
+    0xb2, 0x00, 0xef, 0xff, 0xff, 0xed, 0xa4, 0x00, 0x00, 0xef, 0xff, 0xff,
+    0xff, 0xff, 0x0e, 0xfb, 0xbb, 0xbb, 0xbb, 0xb0, 0xef, 0x10, 0x00, 0x00,
+    0x00, 0x0e, 0xf1, 0x00, 0x00, 0x00, 0x00, 0xef, 0x10, 0x00, 0x00, 0x00,
+    0x0e, 0xf1, 0x00, 0x00, 0x00, 0x00, 0xef, 0xff, 0xff, 0xff, 0xf2, 0x0e,
+    0xfb, 0xbb, 0xbb, 0xbb, 0x10, 0xef, 0x10, 0x00, 0x00, 0x00, 0x0e, 0xf1,
+    0x00, 0x00, 0x00, 0x00, 0xef, 0x10, 0x00, 0x00, 0x00, 0x0e, 0xf1, 0x00,
+    0x00, 0x00, 0x00, 0xef, 0xbb, 0xbb, 0xbb, 0xbb, 0x3e, 0xff, 0xff, 0xff,
+    0xff, 0xf4, 0xef, 0xff, 0xff, 0xff, 0xff, 0xef, 0xbb, 0xbb, 0xbb, 0xbb,
+    0xef, 0x10, 0x00, 0x00, 0x00, 0xef, 0x10, 0x00, 0x00, 0x00, 0xef, 0x10,
+    0x00, 0x00, 0x00, 0xef, 0x10, 0x00, 0x00, 0x00, 0xef, 0xbb, 0xbb, 0xbb,
+    0xb1, 0xef, 0xff, 0xff, 0xff, 0xf2, 0xef, 0x10, 0x00, 0x00, 0x00, 0xef,
+    0x10, 0x00, 0x00, 0x00, 0xef, 0x10, 0x00, 0x00, 0x00, 0xef, 0x10, 0x00,
+    0x00, 0x00, 0xef, 0x10, 0x00, 0x00, 0x00, 0xef, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x6b, 0xdf, 0xeb, 0x71, 0x00, 0x05, 0xef, 0xfd, 0xbc, 0xff,
+    0xe4, 0x05, 0xff, 0x82, 0x00, 0x01, 0x8f, 0x62, 0xef, 0x50, 0x00, 0x00,
+    0x00, 0x10, 0x8f, 0x90, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xf3, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x01, 0x1f, 0xf0, 0x00,
+    0x00, 0x00, 0x03, 0xfb, 0xdf, 0x30, 0x00, 0x00, 0x00, 0x3f, 0xb8, 0xf9,
+    0x00, 0x00, 0x00, 0x03, 0xfb, 0x2e, 0xf5, 0x00, 0x00, 0x00, 0x3f, 0xb0,
+    0x5f, 0xf8, 0x10, 0x00, 0x18, 0xfb, 0x00, 0x5e, 0xff, 0xdb, 0xdf, 0xfe,
+    0x60, 0x00, 0x17, 0xbe, 0xfe, 0xb7, 0x10, 0xef, 0x10, 0x00, 0x00, 0x00,
+    0xdf, 0x2e, 0xf1, 0x00, 0x00, 0x00, 0x0d, 0xf2, 0xef, 0x10, 0x00, 0x00,
+    0x00, 0xdf, 0x2e, 0xf1, 0x00, 0x00, 0x00, 0x0d, 0xf2, 0xef, 0x10, 0x00,
+    0x00, 0x00, 0xdf, 0x2e, 0xf1, 0x00, 0x00, 0x00, 0x0d, 0xf2, 0xef, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x2e, 0xfb, 0xbb, 0xbb, 0xbb, 0xbe, 0xf2, 0xef,
+    0x10, 0x00, 0x00, 0x00, 0xdf, 0x2e, 0xf1, 0x00, 0x00, 0x00, 0x0d, 0xf2,
+    0xef, 0x10, 0x00, 0x00, 0x00, 0xdf, 0x2e, 0xf1, 0x00, 0x00, 0x00, 0x0d,
+    0xf2, 0xef, 0x10, 0x00, 0x00, 0x00, 0xdf, 0x2e, 0xf1, 0x00, 0x00, 0x00,
+    0x0d, 0xf2, 0xef, 0x1e, 0xf1, 0xef, 0x1e, 0xf1, 0xef, 0x1e, 0xf1, 0xef,
+    0x1e, 0xf1, 0xef, 0x1e, 0xf1, 0xef, 0x1e, 0xf1, 0xef, 0x1e, 0xf1, 0x0c,
+    0xff, 0xff, 0xff, 0x40, 0x8b, 0xbb, 0xbe, 0xf4, 0x00, 0x00, 0x00, 0xbf,
+    0x40, 0x00, 0x00, 0x0b, 0xf4, 0x00, 0x00, 0x00, 0xbf, 0x40, 0x00, 0x00,
+    0x0b, 0xf4, 0x00, 0x00, 0x00, 0xbf, 0x40, 0x00, 0x00, 0x0b, 0xf4, 0x00,
+    0x00, 0x00, 0xbf, 0x40, 0x00, 0x00, 0x0b, 0xf4, 0x11, 0x00, 0x00, 0xdf,
+    0x3b, 0xb1, 0x00, 0x5f, 0xe0, 0xaf, 0xfc, 0xcf, 0xf6, 0x00, 0x6c, 0xee,
+    0xc5, 0x00, 0xef, 0x10, 0x00, 0x00, 0x1b, 0xf8, 0x0e, 0xf1, 0x00, 0x00,
+    0x0b, 0xf9, 0x00, 0xef, 0x10, 0x00, 0x0a, 0xf9, 0x00, 0x0e, 0xf1, 0x00,
+    0x0a, 0xfa, 0x00, 0x00, 0xef, 0x10, 0x0a, 0xfb, 0x00, 0x00, 0x0e, 0xf1,
+    0x09, 0xfb, 0x10, 0x00, 0x00, 0xef, 0x19, 0xff, 0x30, 0x00, 0x00, 0x0e,
+    0xfa, 0xfe, 0xfd, 0x10, 0x00, 0x00, 0xef, 0xfd, 0x2b, 0xfb, 0x00, 0x00,
+    0x0e, 0xfd, 0x20, 0x1c, 0xf9, 0x00, 0x00, 0xef, 0x30, 0x00, 0x2d, 0xf7,
+    0x00, 0x0e, 0xf1, 0x00, 0x00, 0x3e, 0xf4, 0x00, 0xef, 0x10, 0x00, 0x00,
+    0x4f, 0xe2, 0x0e, 0xf1, 0x00, 0x00, 0x00, 0x6f, 0xd1, 0xef, 0x10, 0x00,
+    0x00, 0x00, 0xef, 0x10, 0x00, 0x00, 0x00, 0xef, 0x10, 0x00, 0x00, 0x00,
+    0xef, 0x10, 0x00, 0x00, 0x00, 0xef, 0x10, 0x00, 0x00, 0x00, 0xef, 0x10,
+    0x00, 0x00, 0x00, 0xef, 0x10, 0x00, 0x00, 0x00, 0xef, 0x10, 0x00, 0x00,
+    0x00, 0xef, 0x10, 0x00, 0x00, 0x00, 0xef, 0x10, 0x00, 0x00, 0x00, 0xef,
+    0x10, 0x00, 0x00, 0x00, 0xef, 0x10, 0x00, 0x00, 0x00, 0xef, 0xcc, 0xcc,
+    0xcc, 0xc8, 0xef, 0xff, 0xff, 0xff, 0xfa, 0xee, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x1e, 0xfe, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0xef, 0xf3,
+    0x00, 0x00, 0x00, 0x02, 0xff, 0xfe, 0xff, 0xc0, 0x00, 0x00, 0x00, 0xbf,
+    0xff, 0xef, 0xaf, 0x60, 0x00, 0x00, 0x4f, 0xae, 0xfe, 0xf1, 0xee, 0x10,
+    0x00, 0x0d, 0xe2, 0xef, 0xef, 0x06, 0xf9, 0x00, 0x07, 0xf7, 0x0e, 0xfe,
+    0xf0, 0x0c, 0xf3, 0x01, 0xed, 0x00, 0xef, 0xef, 0x00, 0x3f, 0xc0, 0xaf,
+    0x40, 0x0e, 0xfe, 0xf0, 0x00, 0x9f, 0x9f, 0xa0, 0x00, 0xef, 0xef, 0x00,
+    0x01, 0xef, 0xe2, 0x00, 0x0e, 0xfe, 0xf0, 0x00, 0x06, 0xf7, 0x00, 0x00,
+    0xef, 0xef, 0x00, 0x00, 0x04, 0x00, 0x00, 0x0e, 0xfe, 0xf0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xef, 0xee, 0x30, 0x00, 0x00, 0x00, 0xdf, 0x2e, 0xfd,
+    0x10, 0x00, 0x00, 0x0d, 0xf2, 0xef, 0xfb, 0x00, 0x00, 0x00, 0xdf, 0x2e,
+    0xfe, 0xf8, 0x00, 0x00, 0x0d, 0xf2, 0xef, 0x5f, 0xf5, 0x00, 0x00, 0xdf,
+    0x2e, 0xf1, 0x6f, 0xe3, 0x00, 0x0d, 0xf2, 0xef, 0x10, 0x9f, 0xd1, 0x00,
+    0xdf, 0x2e, 0xf1, 0x00, 0xbf, 0xb0, 0x0d, 0xf2, 0xef, 0x10, 0x01, 0xdf,
+    0x90, 0xdf, 0x2e, 0xf1, 0x00, 0x03, 0xef, 0x6d, 0xf2, 0xef, 0x10, 0x00,
+    0x05, 0xff, 0xef, 0x2e, 0xf1, 0x00, 0x00, 0x08, 0xff, 0xf2, 0xef, 0x10,
+    0x00, 0x00, 0x0b, 0xff, 0x2e, 0xf1, 0x00, 0x00, 0x00, 0x1d, 0xf2, 0x00,
+    0x01, 0x7b, 0xdf, 0xdb, 0x51, 0x00, 0x00, 0x05, 0xef, 0xfc, 0xbd, 0xff,
+    0xd3, 0x00, 0x05, 0xff, 0x81, 0x00, 0x02, 0xaf, 0xe3, 0x02, 0xef, 0x50,
+    0x00, 0x00, 0x00, 0x8f, 0xd0, 0x8f, 0x90, 0x00, 0x00, 0x00, 0x00, 0xcf,
+    0x5d, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x06, 0xfa, 0xff, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x3f, 0xcf, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xfc, 0xdf,
+    0x30, 0x00, 0x00, 0x00, 0x00, 0x6f, 0xa8, 0xf9, 0x00, 0x00, 0x00, 0x00,
+    0x0c, 0xf5, 0x2e, 0xf5, 0x00, 0x00, 0x00, 0x08, 0xfd, 0x00, 0x5f, 0xf8,
+    0x10, 0x00, 0x2a, 0xfe, 0x30, 0x00, 0x5e, 0xff, 0xcb, 0xdf, 0xfd, 0x30,
+    0x00, 0x00, 0x17, 0xbe, 0xfd, 0xb6, 0x10, 0x00, 0xef, 0xff, 0xff, 0xec,
+    0x71, 0x00, 0xef, 0xbb, 0xbb, 0xdf, 0xfd, 0x20, 0xef, 0x10, 0x00, 0x02,
+    0xaf, 0xc0, 0xef, 0x10, 0x00, 0x00, 0x1d, 0xf3, 0xef, 0x10, 0x00, 0x00,
+    0x0a, 0xf6, 0xef, 0x10, 0x00, 0x00, 0x0b, 0xf5, 0xef, 0x10, 0x00, 0x00,
+    0x2e, 0xf2, 0xef, 0x10, 0x00, 0x26, 0xdf, 0xa0, 0xef, 0xff, 0xff, 0xff,
+    0xfa, 0x00, 0xef, 0xbb, 0xbb, 0xa8, 0x30, 0x00, 0xef, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0xef, 0x10, 0x00, 0x00, 0x00, 0x00, 0xef, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0xef, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6b, 0xdf,
+    0xdb, 0x50, 0x00, 0x00, 0x00, 0x4e, 0xff, 0xcb, 0xdf, 0xfd, 0x30, 0x00,
+    0x05, 0xff, 0x81, 0x00, 0x02, 0xaf, 0xe3, 0x00, 0x2e, 0xf5, 0x00, 0x00,
+    0x00, 0x08, 0xfd, 0x00, 0x8f, 0x90, 0x00, 0x00, 0x00, 0x00, 0xcf, 0x50,
+    0xdf, 0x30, 0x00, 0x00, 0x00, 0x00, 0x6f, 0xa0, 0xff, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x3f, 0xc0, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xc0,
+    0xdf, 0x30, 0x00, 0x00, 0x00, 0x00, 0x6f, 0xa0, 0x9f, 0x90, 0x00, 0x00,
+    0x00, 0x00, 0xcf, 0x60, 0x2f, 0xf5, 0x00, 0x00, 0x00, 0x08, 0xfd, 0x10,
+    0x07, 0xff, 0x81, 0x00, 0x02, 0xaf, 0xf4, 0x00, 0x00, 0x6f, 0xff, 0xcb,
+    0xdf, 0xfe, 0x40, 0x00, 0x00, 0x02, 0x8c, 0xef, 0xfd, 0x71, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x09, 0xfd, 0x30, 0x02, 0xa1, 0x00, 0x00, 0x00, 0x00,
+    0x8f, 0xfc, 0xcf, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x04, 0xbe, 0xeb, 0x30,
+    0xef, 0xff, 0xff, 0xec, 0x71, 0x00, 0xef, 0xbb, 0xbb, 0xdf, 0xfd, 0x20,
+    0xef, 0x10, 0x00, 0x02, 0xaf, 0xc0, 0xef, 0x10, 0x00, 0x00, 0x1d, 0xf3,
+    0xef, 0x10, 0x00, 0x00, 0x0a, 0xf6, 0xef, 0x10, 0x00, 0x00, 0x0b, 0xf5,
+    0xef, 0x10, 0x00, 0x00, 0x2e, 0xf2, 0xef, 0x10, 0x00, 0x26, 0xdf, 0x90,
+    0xef, 0xff, 0xff, 0xff, 0xf9, 0x00, 0xef, 0xbb, 0xbb, 0xdf, 0x90, 0x00,
+    0xef, 0x10, 0x00, 0x1e, 0xf3, 0x00, 0xef, 0x10, 0x00, 0x04, 0xfd, 0x10,
+    0xef, 0x10, 0x00, 0x00, 0x9f, 0x90, 0xef, 0x10, 0x00, 0x00, 0x1d, 0xf4,
+    0x00, 0x06, 0xbe, 0xfe, 0xb7, 0x10, 0x01, 0xcf, 0xfc, 0xbc, 0xff, 0xd0,
+    0x08, 0xfc, 0x20, 0x00, 0x16, 0x60, 0x0c, 0xf3, 0x00, 0x00, 0x00, 0x00,
+    0x0b, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x06, 0xfe, 0x71, 0x00, 0x00, 0x00,
+    0x00, 0x8f, 0xff, 0xd9, 0x40, 0x00, 0x00, 0x02, 0x6b, 0xef, 0xfd, 0x40,
+    0x00, 0x00, 0x00, 0x03, 0xaf, 0xf2, 0x00, 0x00, 0x00, 0x00, 0x08, 0xf7,
+    0x01, 0x00, 0x00, 0x00, 0x07, 0xf8, 0x0c, 0xa3, 0x00, 0x00, 0x3d, 0xf4,
+    0x1b, 0xff, 0xec, 0xbd, 0xff, 0x90, 0x00, 0x49, 0xde, 0xfd, 0xa4, 0x00,
+    0xef, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xab, 0xbb, 0xbf, 0xeb, 0xbb, 0xb7,
+    0x00, 0x00, 0x2f, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x2f, 0xd0, 0x00, 0x00,
+    0x00, 0x00, 0x2f, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x2f, 0xd0, 0x00, 0x00,
+    0x00, 0x00, 0x2f, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x2f, 0xd0, 0x00, 0x00,
+    0x00, 0x00, 0x2f, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x2f, 0xd0, 0x00, 0x00,
+    0x00, 0x00, 0x2f, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x2f, 0xd0, 0x00, 0x00,
+    0x00, 0x00, 0x2f, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x2f, 0xd0, 0x00, 0x00,
+    0xff, 0x00, 0x00, 0x00, 0x02, 0xfc, 0xff, 0x00, 0x00, 0x00, 0x02, 0xfc,
+    0xff, 0x00, 0x00, 0x00, 0x02, 0xfc, 0xff, 0x00, 0x00, 0x00, 0x02, 0xfc,
+    0xff, 0x00, 0x00, 0x00, 0x02, 0xfc, 0xff, 0x00, 0x00, 0x00, 0x02, 0xfc,
+    0xff, 0x00, 0x00, 0x00, 0x02, 0xfc, 0xff, 0x00, 0x00, 0x00, 0x02, 0xfc,
+    0xff, 0x00, 0x00, 0x00, 0x03, 0xfc, 0xdf, 0x30, 0x00, 0x00, 0x05, 0xfa,
+    0x9f, 0x80, 0x00, 0x00, 0x0b, 0xf6, 0x2f, 0xf6, 0x00, 0x00, 0x8f, 0xd1,
+    0x05, 0xff, 0xeb, 0xbe, 0xfe, 0x30, 0x00, 0x29, 0xdf, 0xec, 0x81, 0x00,
+    0xcf, 0x50, 0x00, 0x00, 0x00, 0x00, 0xef, 0x15, 0xfc, 0x00, 0x00, 0x00,
+    0x00, 0x6f, 0x90, 0x0d, 0xf4, 0x00, 0x00, 0x00, 0x0d, 0xf3, 0x00, 0x7f,
+    0xa0, 0x00, 0x00, 0x04, 0xfb, 0x00, 0x01, 0xef, 0x20, 0x00, 0x00, 0xbf,
+    0x40, 0x00, 0x09, 0xf8, 0x00, 0x00, 0x2f, 0xd0, 0x00, 0x00, 0x2f, 0xe1,
+    0x00, 0x09, 0xf6, 0x00, 0x00, 0x00, 0xbf, 0x60, 0x01, 0xee, 0x10, 0x00,
+    0x00, 0x04, 0xfd, 0x00, 0x7f, 0x80, 0x00, 0x00, 0x00, 0x0d, 0xf5, 0x0e,
+    0xf2, 0x00, 0x00, 0x00, 0x00, 0x6f, 0xb5, 0xfa, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0xef, 0xdf, 0x30, 0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0xc0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x2f, 0xf5, 0x00, 0x00, 0x00, 0x3f, 0xd0, 0x00,
+    0x00, 0x00, 0xbf, 0x60, 0x00, 0x00, 0x03, 0xfb, 0x0d, 0xf3, 0x00, 0x00,
+    0x02, 0xff, 0xc0, 0x00, 0x00, 0x08, 0xf6, 0x08, 0xf8, 0x00, 0x00, 0x07,
+    0xff, 0xf2, 0x00, 0x00, 0x0d, 0xf1, 0x03, 0xfd, 0x00, 0x00, 0x0c, 0xf9,
+    0xf7, 0x00, 0x00, 0x3f, 0xb0, 0x00, 0xdf, 0x30, 0x00, 0x2f, 0xb2, 0xfc,
+    0x00, 0x00, 0x8f, 0x60, 0x00, 0x8f, 0x80, 0x00, 0x7f, 0x60, 0xcf, 0x20,
+    0x00, 0xdf, 0x10, 0x00, 0x3f, 0xd0, 0x00, 0xcf, 0x10, 0x7f, 0x70, 0x03,
+    0xfb, 0x00, 0x00, 0x0d, 0xf3, 0x03, 0xfa, 0x00, 0x2f, 0xc0, 0x08, 0xf6,
+    0x00, 0x00, 0x08, 0xf8, 0x08, 0xf5, 0x00, 0x0c, 0xf2, 0x0d, 0xf1, 0x00,
+    0x00, 0x03, 0xfd, 0x0d, 0xe1, 0x00, 0x07, 0xf7, 0x3f, 0xb0, 0x00, 0x00,
+    0x00, 0xdf, 0x6f, 0xa0, 0x00, 0x02, 0xfc, 0x8f, 0x60, 0x00, 0x00, 0x00,
+    0x8f, 0xef, 0x50, 0x00, 0x00, 0xcf, 0xef, 0x10, 0x00, 0x00, 0x00, 0x3f,
+    0xfe, 0x00, 0x00, 0x00, 0x6f, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xf9,
+    0x00, 0x00, 0x00, 0x1f, 0xf6, 0x00, 0x00, 0x2e, 0xf3, 0x00, 0x00, 0x00,
+    0xbf, 0x70, 0x5f, 0xd1, 0x00, 0x00, 0x6f, 0xb0, 0x00, 0x9f, 0xa0, 0x00,
+    0x2e, 0xe2, 0x00, 0x01, 0xdf, 0x60, 0x0c, 0xf5, 0x00, 0x00, 0x03, 0xfe,
+    0x28, 0xf9, 0x00, 0x00, 0x00, 0x07, 0xfd, 0xfc, 0x00, 0x00, 0x00, 0x00,
+    0x0b, 0xff, 0x30, 0x00, 0x00, 0x00, 0x01, 0xdf, 0xf6, 0x00, 0x00, 0x00,
+    0x00, 0xaf, 0xae, 0xf3, 0x00, 0x00, 0x00, 0x6f, 0xc0, 0x6f, 0xd1, 0x00,
+    0x00, 0x3f, 0xe2, 0x00, 0xaf, 0x90, 0x00, 0x1d, 0xf5, 0x00, 0x01, 0xdf,
+    0x50, 0x0a, 0xfa, 0x00, 0x00, 0x03, 0xfe, 0x25, 0xfd, 0x10, 0x00, 0x00,
+    0x07, 0xfc, 0xcf, 0x50, 0x00, 0x00, 0x00, 0x4f, 0xb3, 0xfe, 0x10, 0x00,
+    0x00, 0x0d, 0xf2, 0x08, 0xf9, 0x00, 0x00, 0x07, 0xf8, 0x00, 0x1d, 0xf3,
+    0x00, 0x02, 0xed, 0x00, 0x00, 0x5f, 0xc0, 0x00, 0xaf, 0x40, 0x00, 0x00,
+    0xbf, 0x60, 0x4f, 0xa0, 0x00, 0x00, 0x02, 0xfe, 0x2d, 0xe2, 0x00, 0x00,
+    0x00, 0x08, 0xfd, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x1d, 0xfd, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x8f, 0x70, 0x00, 0x00, 0x00, 0x00, 0x08, 0xf7, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x8f, 0x70, 0x00, 0x00, 0x00, 0x00, 0x08, 0xf7,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0x70, 0x00, 0x00, 0x0f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x40, 0xbb, 0xbb, 0xbb, 0xbb, 0xdf, 0xf2, 0x00, 0x00,
+    0x00, 0x00, 0x1d, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xf9, 0x00, 0x00,
+    0x00, 0x00, 0x09, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x06, 0xfd, 0x10, 0x00,
+    0x00, 0x00, 0x03, 0xff, 0x30, 0x00, 0x00, 0x00, 0x01, 0xdf, 0x60, 0x00,
+    0x00, 0x00, 0x00, 0xcf, 0x90, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xb0, 0x00,
+    0x00, 0x00, 0x00, 0x6f, 0xd1, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xf3, 0x00,
+    0x00, 0x00, 0x00, 0x1e, 0xfe, 0xbb, 0xbb, 0xbb, 0xbb, 0x62, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf8, 0xef, 0xff, 0x4e, 0xfb, 0xb3, 0xef, 0x00, 0x0e,
+    0xf0, 0x00, 0xef, 0x00, 0x0e, 0xf0, 0x00, 0xef, 0x00, 0x0e, 0xf0, 0x00,
+    0xef, 0x00, 0x0e, 0xf0, 0x00, 0xef, 0x00, 0x0e, 0xf0, 0x00, 0xef, 0x00,
+    0x0e, 0xf0, 0x00, 0xef, 0x00, 0x0e, 0xf0, 0x00, 0xef, 0x00, 0x0e, 0xfb,
+    0xb3, 0xef, 0xff, 0x40, 0x57, 0x00, 0x00, 0x00, 0x06, 0xf5, 0x00, 0x00,
+    0x00, 0x1f, 0xa0, 0x00, 0x00, 0x00, 0xbe, 0x10, 0x00, 0x00, 0x06, 0xf5,
+    0x00, 0x00, 0x00, 0x1f, 0xa0, 0x00, 0x00, 0x00, 0xbe, 0x10, 0x00, 0x00,
+    0x06, 0xf5, 0x00, 0x00, 0x00, 0x1f, 0xa0, 0x00, 0x00, 0x00, 0xbf, 0x10,
+    0x00, 0x00, 0x06, 0xf5, 0x00, 0x00, 0x00, 0x1f, 0xb0, 0x00, 0x00, 0x00,
+    0xbf, 0x10, 0x00, 0x00, 0x05, 0xf6, 0x00, 0x00, 0x00, 0x1f, 0xb0, 0x00,
+    0x00, 0x00, 0xaf, 0x10, 0x00, 0x00, 0x05, 0xf6, 0x00, 0x00, 0x00, 0x1e,
+    0xb0, 0x00, 0x00, 0x00, 0xaf, 0x10, 0x00, 0x00, 0x05, 0xf6, 0x9f, 0xff,
+    0x87, 0xbc, 0xf8, 0x00, 0x5f, 0x80, 0x05, 0xf8, 0x00, 0x5f, 0x80, 0x05,
+    0xf8, 0x00, 0x5f, 0x80, 0x05, 0xf8, 0x00, 0x5f, 0x80, 0x05, 0xf8, 0x00,
+    0x5f, 0x80, 0x05, 0xf8, 0x00, 0x5f, 0x80, 0x05, 0xf8, 0x00, 0x5f, 0x80,
+    0x05, 0xf8, 0x00, 0x5f, 0x87, 0xbc, 0xf8, 0x9f, 0xff, 0x80, 0x00, 0x00,
+    0x76, 0x00, 0x00, 0x00, 0x6f, 0xf1, 0x00, 0x00, 0x0c, 0xcf, 0x70, 0x00,
+    0x03, 0xf5, 0x9d, 0x00, 0x00, 0x9d, 0x03, 0xf4, 0x00, 0x1f, 0x70, 0x0c,
+    0xb0, 0x07, 0xf1, 0x00, 0x6f, 0x20, 0xda, 0x00, 0x01, 0xe8, 0x4f, 0x40,
+    0x00, 0x09, 0xe0, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x27, 0x71, 0x00, 0x05, 0xec, 0x10, 0x00, 0x2c, 0xd2, 0x04, 0xad,
+    0xfe, 0xb4, 0x00, 0x7f, 0xfc, 0xbd, 0xff, 0x50, 0x27, 0x10, 0x00, 0x5f,
+    0xd0, 0x00, 0x00, 0x00, 0x0c, 0xf2, 0x02, 0x8a, 0xbb, 0xbe, 0xf3, 0x4f,
+    0xff, 0xff, 0xff, 0xf3, 0xcf, 0x81, 0x00, 0x0b, 0xf3, 0xfe, 0x00, 0x00,
+    0x0c, 0xf3, 0xdf, 0x40, 0x00, 0x7f, 0xf3, 0x6f, 0xfc, 0xbe, 0xfc, 0xf3,
+    0x05, 0xce, 0xeb, 0x39, 0xf3, 0x3f, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x3f,
+    0xb0, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x3f,
+    0xb0, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xb1, 0x9d, 0xfd, 0x92, 0x00, 0x3f,
+    0xdd, 0xfc, 0xbe, 0xfe, 0x40, 0x3f, 0xfd, 0x30, 0x00, 0x8f, 0xe1, 0x3f,
+    0xf3, 0x00, 0x00, 0x0a, 0xf7, 0x3f, 0xd0, 0x00, 0x00, 0x04, 0xfa, 0x3f,
+    0xb0, 0x00, 0x00, 0x03, 0xfc, 0x3f, 0xd0, 0x00, 0x00, 0x04, 0xfa, 0x3f,
+    0xf3, 0x00, 0x00, 0x0a, 0xf7, 0x3f, 0xfd, 0x30, 0x00, 0x8f, 0xe1, 0x3f,
+    0xce, 0xfc, 0xbe, 0xfe, 0x40, 0x3f, 0xa1, 0x9d, 0xfd, 0x92, 0x00, 0x00,
+    0x03, 0xad, 0xfd, 0x92, 0x00, 0x07, 0xff, 0xdb, 0xef, 0xe3, 0x04, 0xfe,
+    0x40, 0x00, 0x7f, 0x60, 0xcf, 0x50, 0x00, 0x00, 0x10, 0x1f, 0xe0, 0x00,
+    0x00, 0x00, 0x02, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xe0, 0x00, 0x00,
+    0x00, 0x00, 0xcf, 0x50, 0x00, 0x00, 0x10, 0x04, 0xfe, 0x40, 0x00, 0x6e,
+    0x60, 0x07, 0xff, 0xdb, 0xdf, 0xe3, 0x00, 0x03, 0xad, 0xfd, 0x92, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x01, 0xfc,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x01, 0xfc,
+    0x00, 0x05, 0xbe, 0xec, 0x62, 0xfc, 0x00, 0x8f, 0xfd, 0xbe, 0xfb, 0xfc,
+    0x05, 0xfe, 0x40, 0x00, 0x7f, 0xfc, 0x0c, 0xf5, 0x00, 0x00, 0x09, 0xfc,
+    0x1f, 0xe0, 0x00, 0x00, 0x03, 0xfc, 0x2f, 0xc0, 0x00, 0x00, 0x02, 0xfc,
+    0x1f, 0xe0, 0x00, 0x00, 0x03, 0xfc, 0x0c, 0xf5, 0x00, 0x00, 0x09, 0xfc,
+    0x05, 0xfe, 0x40, 0x00, 0x7f, 0xfc, 0x00, 0x8f, 0xfd, 0xbe, 0xfa, 0xfc,
+    0x00, 0x05, 0xbe, 0xfc, 0x60, 0xfc, 0x00, 0x04, 0xbe, 0xec, 0x70, 0x00,
+    0x00, 0x8f, 0xfc, 0xce, 0xfc, 0x10, 0x05, 0xfb, 0x20, 0x01, 0x8f, 0x90,
+    0x0c, 0xf1, 0x00, 0x00, 0x0b, 0xf1, 0x1f, 0xeb, 0xbb, 0xbb, 0xbd, 0xf5,
+    0x2f, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x1f, 0xe0, 0x00, 0x00, 0x00, 0x00,
+    0x0c, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x05, 0xfe, 0x50, 0x00, 0x3c, 0x20,
+    0x00, 0x7f, 0xfd, 0xbc, 0xff, 0x60, 0x00, 0x03, 0xad, 0xfe, 0xa4, 0x00,
+    0x00, 0x06, 0xde, 0xd6, 0x00, 0x7f, 0xeb, 0xd7, 0x00, 0xcf, 0x30, 0x00,
+    0x00, 0xef, 0x00, 0x00, 0xbf, 0xff, 0xff, 0xf1, 0x8b, 0xff, 0xbb, 0xb1,
+    0x00, 0xef, 0x00, 0x00, 0x00, 0xef, 0x00, 0x00, 0x00, 0xef, 0x00, 0x00,
+    0x00, 0xef, 0x00, 0x00, 0x00, 0xef, 0x00, 0x00, 0x00, 0xef, 0x00, 0x00,
+    0x00, 0xef, 0x00, 0x00, 0x00, 0xef, 0x00, 0x00, 0x00, 0xef, 0x00, 0x00,
+    0x00, 0x04, 0xbe, 0xfc, 0x70, 0xde, 0x00, 0x8f, 0xfd, 0xbd, 0xfc, 0xde,
+    0x05, 0xfe, 0x40, 0x00, 0x5e, 0xfe, 0x0c, 0xf4, 0x00, 0x00, 0x06, 0xfe,
+    0x1f, 0xe0, 0x00, 0x00, 0x01, 0xfe, 0x2f, 0xc0, 0x00, 0x00, 0x00, 0xee,
+    0x1f, 0xe0, 0x00, 0x00, 0x01, 0xfe, 0x0c, 0xf5, 0x00, 0x00, 0x07, 0xfe,
+    0x05, 0xfe, 0x40, 0x00, 0x5f, 0xfe, 0x00, 0x8f, 0xfd, 0xbd, 0xfc, 0xfe,
+    0x00, 0x04, 0xbe, 0xfd, 0x71, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x04, 0xfa,
+    0x01, 0xa4, 0x00, 0x00, 0x3d, 0xf5, 0x05, 0xff, 0xec, 0xbd, 0xff, 0xa0,
+    0x00, 0x28, 0xce, 0xfe, 0xb6, 0x00, 0x3f, 0xb0, 0x00, 0x00, 0x00, 0x03,
+    0xfb, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xb0, 0x00, 0x00, 0x00, 0x03, 0xfb,
+    0x00, 0x00, 0x00, 0x00, 0x3f, 0xb2, 0x9d, 0xfd, 0x91, 0x03, 0xfd, 0xef,
+    0xcc, 0xef, 0xd1, 0x3f, 0xfc, 0x20, 0x02, 0xcf, 0x73, 0xff, 0x20, 0x00,
+    0x04, 0xfb, 0x3f, 0xd0, 0x00, 0x00, 0x2f, 0xd3, 0xfb, 0x00, 0x00, 0x01,
+    0xfd, 0x3f, 0xb0, 0x00, 0x00, 0x1f, 0xd3, 0xfb, 0x00, 0x00, 0x01, 0xfd,
+    0x3f, 0xb0, 0x00, 0x00, 0x1f, 0xd3, 0xfb, 0x00, 0x00, 0x01, 0xfd, 0x3f,
+    0xb0, 0x00, 0x00, 0x1f, 0xd0, 0x3e, 0xa0, 0x7f, 0xf1, 0x2b, 0x80, 0x00,
+    0x00, 0x3f, 0xb0, 0x3f, 0xb0, 0x3f, 0xb0, 0x3f, 0xb0, 0x3f, 0xb0, 0x3f,
+    0xb0, 0x3f, 0xb0, 0x3f, 0xb0, 0x3f, 0xb0, 0x3f, 0xb0, 0x3f, 0xb0, 0x00,
+    0x02, 0xdb, 0x00, 0x00, 0x6f, 0xf2, 0x00, 0x01, 0xb9, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0xfd, 0x00, 0x00, 0x1f, 0xd0, 0x00, 0x01, 0xfd, 0x00,
+    0x00, 0x1f, 0xd0, 0x00, 0x01, 0xfd, 0x00, 0x00, 0x1f, 0xd0, 0x00, 0x01,
+    0xfd, 0x00, 0x00, 0x1f, 0xd0, 0x00, 0x01, 0xfd, 0x00, 0x00, 0x1f, 0xd0,
+    0x00, 0x01, 0xfd, 0x00, 0x00, 0x1f, 0xc0, 0x00, 0x05, 0xfa, 0x07, 0xdb,
+    0xff, 0x40, 0x7d, 0xec, 0x50, 0x00, 0x3f, 0xb0, 0x00, 0x00, 0x00, 0x00,
+    0x3f, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xb0, 0x00, 0x00, 0x00, 0x00,
+    0x3f, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xb0, 0x00, 0x02, 0xdf, 0x50,
+    0x3f, 0xb0, 0x00, 0x2d, 0xf6, 0x00, 0x3f, 0xb0, 0x03, 0xef, 0x60, 0x00,
+    0x3f, 0xb0, 0x3e, 0xf7, 0x00, 0x00, 0x3f, 0xb3, 0xef, 0x90, 0x00, 0x00,
+    0x3f, 0xde, 0xff, 0xe2, 0x00, 0x00, 0x3f, 0xff, 0x6a, 0xfc, 0x00, 0x00,
+    0x3f, 0xf5, 0x01, 0xcf, 0x90, 0x00, 0x3f, 0xb0, 0x00, 0x2e, 0xf5, 0x00,
+    0x3f, 0xb0, 0x00, 0x04, 0xfe, 0x30, 0x3f, 0xb0, 0x00, 0x00, 0x7f, 0xd1,
+    0x3f, 0xb3, 0xfb, 0x3f, 0xb3, 0xfb, 0x3f, 0xb3, 0xfb, 0x3f, 0xb3, 0xfb,
+    0x3f, 0xb3, 0xfb, 0x3f, 0xb3, 0xfb, 0x3f, 0xb3, 0xfb, 0x3f, 0xb0, 0x3f,
+    0xa2, 0xae, 0xfd, 0x70, 0x05, 0xbe, 0xec, 0x50, 0x03, 0xfc, 0xef, 0xcc,
+    0xff, 0x98, 0xfe, 0xcd, 0xff, 0x70, 0x3f, 0xfc, 0x10, 0x04, 0xff, 0xfa,
+    0x10, 0x05, 0xfe, 0x13, 0xff, 0x20, 0x00, 0x09, 0xfe, 0x10, 0x00, 0x0b,
+    0xf5, 0x3f, 0xd0, 0x00, 0x00, 0x6f, 0xa0, 0x00, 0x00, 0x8f, 0x63, 0xfb,
+    0x00, 0x00, 0x05, 0xf9, 0x00, 0x00, 0x08, 0xf6, 0x3f, 0xb0, 0x00, 0x00,
+    0x5f, 0x90, 0x00, 0x00, 0x8f, 0x63, 0xfb, 0x00, 0x00, 0x05, 0xf9, 0x00,
+    0x00, 0x08, 0xf6, 0x3f, 0xb0, 0x00, 0x00, 0x5f, 0x90, 0x00, 0x00, 0x8f,
+    0x63, 0xfb, 0x00, 0x00, 0x05, 0xf9, 0x00, 0x00, 0x08, 0xf6, 0x3f, 0xb0,
+    0x00, 0x00, 0x5f, 0x90, 0x00, 0x00, 0x8f, 0x60, 0x3f, 0xa2, 0xae, 0xfd,
+    0x91, 0x03, 0xfc, 0xef, 0xcc, 0xef, 0xd1, 0x3f, 0xfc, 0x20, 0x02, 0xcf,
+    0x73, 0xff, 0x20, 0x00, 0x04, 0xfb, 0x3f, 0xd0, 0x00, 0x00, 0x2f, 0xd3,
+    0xfb, 0x00, 0x00, 0x01, 0xfd, 0x3f, 0xb0, 0x00, 0x00, 0x1f, 0xd3, 0xfb,
+    0x00, 0x00, 0x01, 0xfd, 0x3f, 0xb0, 0x00, 0x00, 0x1f, 0xd3, 0xfb, 0x00,
+    0x00, 0x01, 0xfd, 0x3f, 0xb0, 0x00, 0x00, 0x1f, 0xd0, 0x00, 0x04, 0xae,
+    0xfd, 0x92, 0x00, 0x00, 0x7f, 0xfd, 0xbe, 0xfe, 0x40, 0x05, 0xfe, 0x40,
+    0x00, 0x7f, 0xe1, 0x0c, 0xf5, 0x00, 0x00, 0x09, 0xf7, 0x1f, 0xe0, 0x00,
+    0x00, 0x03, 0xfb, 0x2f, 0xc0, 0x00, 0x00, 0x02, 0xfc, 0x1f, 0xe0, 0x00,
+    0x00, 0x03, 0xfb, 0x0c, 0xf5, 0x00, 0x00, 0x09, 0xf7, 0x05, 0xfe, 0x40,
+    0x00, 0x7f, 0xe1, 0x00, 0x7f, 0xfd, 0xbe, 0xfe, 0x40, 0x00, 0x04, 0xae,
+    0xfd, 0x92, 0x00, 0x3f, 0xa1, 0x9d, 0xfd, 0x92, 0x00, 0x3f, 0xce, 0xfd,
+    0xbe, 0xfe, 0x40, 0x3f, 0xfd, 0x30, 0x00, 0x8f, 0xe1, 0x3f, 0xf4, 0x00,
+    0x00, 0x0a, 0xf7, 0x3f, 0xd0, 0x00, 0x00, 0x04, 0xfa, 0x3f, 0xb0, 0x00,
+    0x00, 0x03, 0xfc, 0x3f, 0xd0, 0x00, 0x00, 0x04, 0xfa, 0x3f, 0xf3, 0x00,
+    0x00, 0x0a, 0xf7, 0x3f, 0xfd, 0x30, 0x00, 0x8f, 0xe1, 0x3f, 0xdd, 0xfc,
+    0xbe, 0xfe, 0x40, 0x3f, 0xb1, 0x9d, 0xfd, 0x92, 0x00, 0x3f, 0xb0, 0x00,
+    0x00, 0x00, 0x00, 0x3f, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xb0, 0x00,
+    0x00, 0x00, 0x00, 0x3f, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xbe,
+    0xec, 0x60, 0xfc, 0x00, 0x8f, 0xfd, 0xbe, 0xfa, 0xfc, 0x05, 0xfe, 0x40,
+    0x00, 0x7f, 0xfc, 0x0c, 0xf5, 0x00, 0x00, 0x09, 0xfc, 0x1f, 0xe0, 0x00,
+    0x00, 0x03, 0xfc, 0x2f, 0xc0, 0x00, 0x00, 0x02, 0xfc, 0x1f, 0xe0, 0x00,
+    0x00, 0x03, 0xfc, 0x0c, 0xf5, 0x00, 0x00, 0x09, 0xfc, 0x05, 0xfe, 0x40,
+    0x00, 0x7f, 0xfc, 0x00, 0x8f, 0xfd, 0xbe, 0xfb, 0xfc, 0x00, 0x05, 0xbe,
+    0xfc, 0x62, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x01, 0xfc, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x01, 0xfc, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0xfc, 0x3f, 0xa2, 0xae, 0x83, 0xfc, 0xef, 0xc6, 0x3f, 0xfc,
+    0x20, 0x03, 0xff, 0x30, 0x00, 0x3f, 0xd0, 0x00, 0x03, 0xfb, 0x00, 0x00,
+    0x3f, 0xb0, 0x00, 0x03, 0xfb, 0x00, 0x00, 0x3f, 0xb0, 0x00, 0x03, 0xfb,
+    0x00, 0x00, 0x3f, 0xb0, 0x00, 0x00, 0x00, 0x5b, 0xef, 0xda, 0x40, 0x09,
+    0xff, 0xcb, 0xef, 0xd0, 0x1f, 0xe2, 0x00, 0x04, 0x40, 0x2f, 0xc0, 0x00,
+    0x00, 0x00, 0x0d, 0xfb, 0x63, 0x00, 0x00, 0x02, 0xbf, 0xff, 0xfb, 0x30,
+    0x00, 0x01, 0x47, 0xbf, 0xe2, 0x00, 0x00, 0x00, 0x09, 0xf6, 0x09, 0x30,
+    0x00, 0x0b, 0xf5, 0x5f, 0xfe, 0xbb, 0xef, 0xc0, 0x05, 0xad, 0xfe, 0xc7,
+    0x10, 0x00, 0x78, 0x00, 0x00, 0x00, 0xef, 0x00, 0x00, 0x00, 0xef, 0x00,
+    0x00, 0xbf, 0xff, 0xff, 0xf1, 0x8b, 0xff, 0xbb, 0xb1, 0x00, 0xef, 0x00,
+    0x00, 0x00, 0xef, 0x00, 0x00, 0x00, 0xef, 0x00, 0x00, 0x00, 0xef, 0x00,
+    0x00, 0x00, 0xef, 0x00, 0x00, 0x00, 0xdf, 0x00, 0x00, 0x00, 0xcf, 0x40,
+    0x00, 0x00, 0x6f, 0xea, 0xc7, 0x00, 0x07, 0xde, 0xd5, 0x4f, 0xa0, 0x00,
+    0x00, 0x3f, 0xb4, 0xfa, 0x00, 0x00, 0x03, 0xfb, 0x4f, 0xa0, 0x00, 0x00,
+    0x3f, 0xb4, 0xfa, 0x00, 0x00, 0x03, 0xfb, 0x4f, 0xa0, 0x00, 0x00, 0x3f,
+    0xb4, 0xfa, 0x00, 0x00, 0x03, 0xfb, 0x4f, 0xa0, 0x00, 0x00, 0x5f, 0xb2,
+    0xfd, 0x00, 0x00, 0x09, 0xfb, 0x0d, 0xf8, 0x00, 0x06, 0xff, 0xb0, 0x5f,
+    0xfd, 0xbd, 0xfb, 0xfb, 0x00, 0x3b, 0xef, 0xc6, 0x2f, 0xb0, 0xdf, 0x20,
+    0x00, 0x00, 0x0d, 0xe1, 0x6f, 0x90, 0x00, 0x00, 0x5f, 0x90, 0x1e, 0xe1,
+    0x00, 0x00, 0xbf, 0x20, 0x09, 0xf6, 0x00, 0x02, 0xfb, 0x00, 0x02, 0xfc,
+    0x00, 0x09, 0xf5, 0x00, 0x00, 0xbf, 0x30, 0x1e, 0xd0, 0x00, 0x00, 0x5f,
+    0x90, 0x6f, 0x70, 0x00, 0x00, 0x0d, 0xe1, 0xde, 0x10, 0x00, 0x00, 0x07,
+    0xfa, 0xf9, 0x00, 0x00, 0x00, 0x01, 0xff, 0xf3, 0x00, 0x00, 0x00, 0x00,
+    0x9f, 0xc0, 0x00, 0x00, 0xbf, 0x20, 0x00, 0x00, 0xee, 0x10, 0x00, 0x01,
+    0xfa, 0x5f, 0x70, 0x00, 0x05, 0xff, 0x60, 0x00, 0x06, 0xf5, 0x1e, 0xc0,
+    0x00, 0x0a, 0xff, 0xb0, 0x00, 0x0b, 0xe0, 0x09, 0xf2, 0x00, 0x1f, 0xbb,
+    0xf1, 0x00, 0x2f, 0x90, 0x04, 0xf8, 0x00, 0x6f, 0x55, 0xf7, 0x00, 0x7f,
+    0x40, 0x00, 0xdd, 0x00, 0xce, 0x01, 0xec, 0x00, 0xcd, 0x00, 0x00, 0x8f,
+    0x32, 0xf9, 0x00, 0x9f, 0x23, 0xf8, 0x00, 0x00, 0x3f, 0x88, 0xf3, 0x00,
+    0x4f, 0x88, 0xf2, 0x00, 0x00, 0x0d, 0xed, 0xd0, 0x00, 0x0d, 0xdd, 0xc0,
+    0x00, 0x00, 0x07, 0xff, 0x70, 0x00, 0x07, 0xff, 0x70, 0x00, 0x00, 0x02,
+    0xff, 0x20, 0x00, 0x02, 0xff, 0x10, 0x00, 0x3f, 0xe1, 0x00, 0x01, 0xdf,
+    0x30, 0x6f, 0xb0, 0x00, 0xaf, 0x70, 0x00, 0xaf, 0x70, 0x5f, 0xb0, 0x00,
+    0x01, 0xdf, 0x5e, 0xd1, 0x00, 0x00, 0x04, 0xff, 0xf4, 0x00, 0x00, 0x00,
+    0x0b, 0xfb, 0x00, 0x00, 0x00, 0x05, 0xff, 0xf5, 0x00, 0x00, 0x02, 0xee,
+    0x3e, 0xe2, 0x00, 0x00, 0xcf, 0x40, 0x4f, 0xc1, 0x00, 0x9f, 0x80, 0x00,
+    0x8f, 0x90, 0x5f, 0xc0, 0x00, 0x00, 0xcf, 0x60, 0x0c, 0xf2, 0x00, 0x00,
+    0x00, 0xde, 0x10, 0x6f, 0x90, 0x00, 0x00, 0x5f, 0x80, 0x01, 0xee, 0x10,
+    0x00, 0x0b, 0xf2, 0x00, 0x08, 0xf7, 0x00, 0x02, 0xfb, 0x00, 0x00, 0x2f,
+    0xd0, 0x00, 0x9f, 0x40, 0x00, 0x00, 0xaf, 0x40, 0x1e, 0xd0, 0x00, 0x00,
+    0x04, 0xfb, 0x06, 0xf6, 0x00, 0x00, 0x00, 0x0c, 0xf2, 0xce, 0x10, 0x00,
+    0x00, 0x00, 0x6f, 0xcf, 0x80, 0x00, 0x00, 0x00, 0x01, 0xef, 0xf2, 0x00,
+    0x00, 0x00, 0x00, 0x08, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0x40,
+    0x00, 0x00, 0x04, 0x00, 0x3f, 0xc0, 0x00, 0x00, 0x03, 0xfd, 0xbf, 0xf3,
+    0x00, 0x00, 0x00, 0x19, 0xde, 0xc4, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff,
+    0xff, 0xff, 0xf8, 0x1b, 0xbb, 0xbb, 0xbf, 0xf5, 0x00, 0x00, 0x00, 0x8f,
+    0x90, 0x00, 0x00, 0x05, 0xfc, 0x00, 0x00, 0x00, 0x3e, 0xe2, 0x00, 0x00,
+    0x01, 0xdf, 0x40, 0x00, 0x00, 0x0b, 0xf7, 0x00, 0x00, 0x00, 0x8f, 0xa0,
+    0x00, 0x00, 0x04, 0xfd, 0x10, 0x00, 0x00, 0x1e, 0xfc, 0xbb, 0xbb, 0xb7,
+    0x3f, 0xff, 0xff, 0xff, 0xfa, 0x00, 0x3c, 0xea, 0x01, 0xef, 0xd7, 0x03,
+    0xfc, 0x00, 0x04, 0xfa, 0x00, 0x04, 0xfa, 0x00, 0x04, 0xfa, 0x00, 0x04,
+    0xfa, 0x00, 0x05, 0xfa, 0x00, 0x9e, 0xf6, 0x00, 0xdf, 0xe3, 0x00, 0x07,
+    0xf9, 0x00, 0x04, 0xfa, 0x00, 0x04, 0xfa, 0x00, 0x04, 0xfa, 0x00, 0x04,
+    0xfa, 0x00, 0x04, 0xfa, 0x00, 0x03, 0xfd, 0x00, 0x00, 0xdf, 0xd7, 0x00,
+    0x3c, 0xea, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed,
+    0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0x9e, 0xc4, 0x00,
+    0x7d, 0xfe, 0x10, 0x00, 0xcf, 0x40, 0x00, 0x9f, 0x40, 0x00, 0x9f, 0x40,
+    0x00, 0x9f, 0x40, 0x00, 0x9f, 0x40, 0x00, 0x9f, 0x60, 0x00, 0x5f, 0xe9,
+    0x00, 0x3e, 0xfd, 0x00, 0x8f, 0x70, 0x00, 0x9f, 0x40, 0x00, 0x9f, 0x40,
+    0x00, 0x9f, 0x40, 0x00, 0x9f, 0x40, 0x00, 0xaf, 0x40, 0x00, 0xcf, 0x30,
+    0x7d, 0xfe, 0x10, 0x9e, 0xc3, 0x00, 0x04, 0xa9, 0x20, 0x00, 0x95, 0x3f,
+    0xff, 0xe5, 0x02, 0xf5, 0x9d, 0x23, 0xdf, 0xce, 0xe1, 0xc7, 0x00, 0x19,
+    0xed, 0x40, 0x4e, 0x99, 0xfe, 0x3c, 0x70, 0x00, 0x00, 0x02, 0xf7, 0x2f,
+    0x73, 0xf8, 0x3f, 0x94, 0xf9, 0x5f, 0xa5, 0xfb, 0x6f, 0xb6, 0xfc, 0x00,
+    0x7d, 0xea, 0x10, 0x07, 0xc3, 0x19, 0xc0, 0x0e, 0x30, 0x00, 0xd5, 0x1f,
+    0x10, 0x00, 0xa7, 0x0e, 0x30, 0x00, 0xd5, 0x07, 0xc3, 0x19, 0xc0, 0x00,
+    0x7d, 0xea, 0x20, 0x00, 0x02, 0xdc, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xf2,
+    0x00, 0x00, 0x00, 0x01, 0xb9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xd0, 0x00, 0x00,
+    0x00, 0x0a, 0xf8, 0x00, 0x00, 0x00, 0x09, 0xfc, 0x10, 0x00, 0x00, 0x09,
+    0xfc, 0x10, 0x00, 0x00, 0x03, 0xfd, 0x10, 0x00, 0x00, 0x00, 0x8f, 0x70,
+    0x00, 0x00, 0x00, 0x09, 0xf8, 0x00, 0x00, 0x05, 0x30, 0x5f, 0xf6, 0x10,
+    0x28, 0xfe, 0x10, 0x9f, 0xff, 0xff, 0xfd, 0x40, 0x00, 0x38, 0xab, 0x95,
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x50, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x8f, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9e, 0x50, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xf8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x06, 0xff, 0xe1, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0x9f, 0x60,
+    0x00, 0x00, 0x00, 0x00, 0x4f, 0xa1, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x0b,
+    0xf4, 0x0a, 0xf5, 0x00, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x3f, 0xc0, 0x00,
+    0x00, 0x00, 0x9f, 0x50, 0x00, 0xcf, 0x40, 0x00, 0x00, 0x2f, 0xe0, 0x00,
+    0x05, 0xfb, 0x00, 0x00, 0x08, 0xf7, 0x00, 0x00, 0x0d, 0xf2, 0x00, 0x01,
+    0xef, 0xff, 0xff, 0xff, 0xff, 0x90, 0x00, 0x7f, 0xca, 0xaa, 0xaa, 0xaa,
+    0xff, 0x10, 0x0d, 0xf3, 0x00, 0x00, 0x00, 0x09, 0xf8, 0x05, 0xfb, 0x00,
+    0x00, 0x00, 0x00, 0x2f, 0xe1, 0xcf, 0x40, 0x00, 0x00, 0x00, 0x00, 0xaf,
+    0x60, 0x00, 0x00, 0x00, 0x78, 0x30, 0x00, 0x00, 0x01, 0xbf, 0x60, 0x00,
+    0x00, 0x01, 0xcd, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0e, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xef, 0xbb,
+    0xbb, 0xbb, 0xbb, 0x0e, 0xf1, 0x00, 0x00, 0x00, 0x00, 0xef, 0x10, 0x00,
+    0x00, 0x00, 0x0e, 0xf1, 0x00, 0x00, 0x00, 0x00, 0xef, 0x10, 0x00, 0x00,
+    0x00, 0x0e, 0xff, 0xff, 0xff, 0xff, 0x20, 0xef, 0xbb, 0xbb, 0xbb, 0xb1,
+    0x0e, 0xf1, 0x00, 0x00, 0x00, 0x00, 0xef, 0x10, 0x00, 0x00, 0x00, 0x0e,
+    0xf1, 0x00, 0x00, 0x00, 0x00, 0xef, 0x10, 0x00, 0x00, 0x00, 0x0e, 0xfb,
+    0xbb, 0xbb, 0xbb, 0xb3, 0xef, 0xff, 0xff, 0xff, 0xff, 0x40, 0x00, 0x07,
+    0x83, 0x01, 0xbf, 0x60, 0x1c, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0e, 0xf1, 0x00, 0x0e, 0xf1, 0x00, 0x0e, 0xf1, 0x00, 0x0e, 0xf1,
+    0x00, 0x0e, 0xf1, 0x00, 0x0e, 0xf1, 0x00, 0x0e, 0xf1, 0x00, 0x0e, 0xf1,
+    0x00, 0x0e, 0xf1, 0x00, 0x0e, 0xf1, 0x00, 0x0e, 0xf1, 0x00, 0x0e, 0xf1,
+    0x00, 0x0e, 0xf1, 0x00, 0x0e, 0xf1, 0x00, 0x00, 0x08, 0xec, 0x51, 0xc5,
+    0x00, 0x00, 0x02, 0xe2, 0x4b, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xee, 0x30, 0x00,
+    0x00, 0x00, 0xdf, 0x2e, 0xfd, 0x10, 0x00, 0x00, 0x0d, 0xf2, 0xef, 0xfb,
+    0x00, 0x00, 0x00, 0xdf, 0x2e, 0xfe, 0xf8, 0x00, 0x00, 0x0d, 0xf2, 0xef,
+    0x5f, 0xf5, 0x00, 0x00, 0xdf, 0x2e, 0xf1, 0x6f, 0xe3, 0x00, 0x0d, 0xf2,
+    0xef, 0x10, 0x9f, 0xd1, 0x00, 0xdf, 0x2e, 0xf1, 0x00, 0xbf, 0xb0, 0x0d,
+    0xf2, 0xef, 0x10, 0x01, 0xdf, 0x90, 0xdf, 0x2e, 0xf1, 0x00, 0x03, 0xef,
+    0x6d, 0xf2, 0xef, 0x10, 0x00, 0x05, 0xff, 0xef, 0x2e, 0xf1, 0x00, 0x00,
+    0x08, 0xff, 0xf2, 0xef, 0x10, 0x00, 0x00, 0x0b, 0xff, 0x2e, 0xf1, 0x00,
+    0x00, 0x00, 0x1d, 0xf2, 0x00, 0x00, 0x00, 0x00, 0x58, 0x60, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x7f, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0x60,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0xbd, 0xfd, 0xb5, 0x10,
+    0x00, 0x00, 0x5e, 0xff, 0xcb, 0xdf, 0xfd, 0x30, 0x00, 0x5f, 0xf8, 0x10,
+    0x00, 0x2a, 0xfe, 0x30, 0x2e, 0xf5, 0x00, 0x00, 0x00, 0x08, 0xfd, 0x08,
+    0xf9, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xf5, 0xdf, 0x30, 0x00, 0x00, 0x00,
+    0x00, 0x6f, 0xaf, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xfc, 0xff, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x3f, 0xcd, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x06,
+    0xfa, 0x8f, 0x90, 0x00, 0x00, 0x00, 0x00, 0xcf, 0x52, 0xef, 0x50, 0x00,
+    0x00, 0x00, 0x8f, 0xd0, 0x05, 0xff, 0x81, 0x00, 0x02, 0xaf, 0xe3, 0x00,
+    0x05, 0xef, 0xfc, 0xbd, 0xff, 0xd3, 0x00, 0x00, 0x01, 0x7b, 0xef, 0xdb,
+    0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x72, 0x00, 0x00, 0x00, 0x02,
+    0xde, 0x50, 0x00, 0x00, 0x00, 0x2d, 0xc2, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,
+    0x00, 0x02, 0xfc, 0xff, 0x00, 0x00, 0x00, 0x02, 0xfc, 0xff, 0x00, 0x00,
+    0x00, 0x02, 0xfc, 0xff, 0x00, 0x00, 0x00, 0x02, 0xfc, 0xff, 0x00, 0x00,
+    0x00, 0x02, 0xfc, 0xff, 0x00, 0x00, 0x00, 0x02, 0xfc, 0xff, 0x00, 0x00,
+    0x00, 0x02, 0xfc, 0xff, 0x00, 0x00, 0x00, 0x02, 0xfc, 0xff, 0x00, 0x00,
+    0x00, 0x03, 0xfc, 0xdf, 0x30, 0x00, 0x00, 0x05, 0xfa, 0x9f, 0x80, 0x00,
+    0x00, 0x0b, 0xf6, 0x2f, 0xf6, 0x00, 0x00, 0x8f, 0xd1, 0x05, 0xff, 0xeb,
+    0xbe, 0xfe, 0x30, 0x00, 0x29, 0xdf, 0xec, 0x81, 0x00, 0x00, 0x07, 0x80,
+    0x19, 0x50, 0x00, 0x00, 0x0b, 0xd0, 0x2d, 0x90, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,
+    0x00, 0x02, 0xfc, 0xff, 0x00, 0x00, 0x00, 0x02, 0xfc, 0xff, 0x00, 0x00,
+    0x00, 0x02, 0xfc, 0xff, 0x00, 0x00, 0x00, 0x02, 0xfc, 0xff, 0x00, 0x00,
+    0x00, 0x02, 0xfc, 0xff, 0x00, 0x00, 0x00, 0x02, 0xfc, 0xff, 0x00, 0x00,
+    0x00, 0x02, 0xfc, 0xff, 0x00, 0x00, 0x00, 0x02, 0xfc, 0xff, 0x00, 0x00,
+    0x00, 0x03, 0xfc, 0xdf, 0x30, 0x00, 0x00, 0x05, 0xfa, 0x9f, 0x80, 0x00,
+    0x00, 0x0b, 0xf6, 0x2f, 0xf6, 0x00, 0x00, 0x8f, 0xd1, 0x05, 0xff, 0xeb,
+    0xbe, 0xfe, 0x30, 0x00, 0x29, 0xdf, 0xec, 0x81, 0x00, 0x00, 0x00, 0x02,
+    0x77, 0x10, 0x00, 0x00, 0x2d, 0xd4, 0x00, 0x00, 0x03, 0xeb, 0x10, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xad, 0xfe, 0xb4, 0x00, 0x7f, 0xfc,
+    0xbd, 0xff, 0x50, 0x27, 0x10, 0x00, 0x5f, 0xd0, 0x00, 0x00, 0x00, 0x0c,
+    0xf2, 0x02, 0x8a, 0xbb, 0xbe, 0xf3, 0x4f, 0xff, 0xff, 0xff, 0xf3, 0xcf,
+    0x81, 0x00, 0x0b, 0xf3, 0xfe, 0x00, 0x00, 0x0c, 0xf3, 0xdf, 0x40, 0x00,
+    0x7f, 0xf3, 0x6f, 0xfc, 0xbe, 0xfc, 0xf3, 0x05, 0xce, 0xeb, 0x39, 0xf3,
+    0x00, 0x00, 0x00, 0x07, 0x83, 0x00, 0x00, 0x00, 0x00, 0xaf, 0x70, 0x00,
+    0x00, 0x00, 0x1b, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0xbe, 0xec, 0x70, 0x00, 0x00, 0x8f, 0xfc, 0xce, 0xfc, 0x10,
+    0x05, 0xfb, 0x20, 0x01, 0x8f, 0x90, 0x0c, 0xf1, 0x00, 0x00, 0x0b, 0xf1,
+    0x1f, 0xeb, 0xbb, 0xbb, 0xbd, 0xf5, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xf6,
+    0x1f, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xf5, 0x00, 0x00, 0x00, 0x00,
+    0x05, 0xfe, 0x50, 0x00, 0x3c, 0x20, 0x00, 0x7f, 0xfd, 0xbc, 0xff, 0x60,
+    0x00, 0x03, 0xad, 0xfe, 0xa4, 0x00, 0x00, 0x28, 0x71, 0x03, 0xed, 0x30,
+    0x4e, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xb0, 0x00, 0x3f, 0xb0, 0x00,
+    0x3f, 0xb0, 0x00, 0x3f, 0xb0, 0x00, 0x3f, 0xb0, 0x00, 0x3f, 0xb0, 0x00,
+    0x3f, 0xb0, 0x00, 0x3f, 0xb0, 0x00, 0x3f, 0xb0, 0x00, 0x3f, 0xb0, 0x00,
+    0x3f, 0xb0, 0x00, 0x00, 0x1b, 0xeb, 0x32, 0xe2, 0x00, 0x06, 0xb1, 0x5d,
+    0xe7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x3f, 0xa2, 0xae, 0xfd, 0x91, 0x03, 0xfc, 0xef, 0xcc, 0xef, 0xd1,
+    0x3f, 0xfc, 0x20, 0x02, 0xcf, 0x73, 0xff, 0x20, 0x00, 0x04, 0xfb, 0x3f,
+    0xd0, 0x00, 0x00, 0x2f, 0xd3, 0xfb, 0x00, 0x00, 0x01, 0xfd, 0x3f, 0xb0,
+    0x00, 0x00, 0x1f, 0xd3, 0xfb, 0x00, 0x00, 0x01, 0xfd, 0x3f, 0xb0, 0x00,
+    0x00, 0x1f, 0xd3, 0xfb, 0x00, 0x00, 0x01, 0xfd, 0x3f, 0xb0, 0x00, 0x00,
+    0x1f, 0xd0, 0x00, 0x00, 0x00, 0x05, 0x85, 0x00, 0x00, 0x00, 0x00, 0x8f,
+    0x91, 0x00, 0x00, 0x00, 0x09, 0xe5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0xae, 0xfd, 0x92, 0x00, 0x00, 0x7f, 0xfd, 0xbe,
+    0xfe, 0x40, 0x05, 0xfe, 0x40, 0x00, 0x7f, 0xe1, 0x0c, 0xf5, 0x00, 0x00,
+    0x09, 0xf7, 0x1f, 0xe0, 0x00, 0x00, 0x03, 0xfb, 0x2f, 0xc0, 0x00, 0x00,
+    0x02, 0xfc, 0x1f, 0xe0, 0x00, 0x00, 0x03, 0xfb, 0x0c, 0xf5, 0x00, 0x00,
+    0x09, 0xf7, 0x05, 0xfe, 0x40, 0x00, 0x7f, 0xe1, 0x00, 0x7f, 0xfd, 0xbe,
+    0xfe, 0x40, 0x00, 0x04, 0xae, 0xfd, 0x92, 0x00, 0x00, 0x00, 0x00, 0x38,
+    0x71, 0x00, 0x00, 0x00, 0x3e, 0xd3, 0x00, 0x00, 0x00, 0x4e, 0xa1, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0xa0, 0x00, 0x00, 0x3f, 0xb4,
+    0xfa, 0x00, 0x00, 0x03, 0xfb, 0x4f, 0xa0, 0x00, 0x00, 0x3f, 0xb4, 0xfa,
+    0x00, 0x00, 0x03, 0xfb, 0x4f, 0xa0, 0x00, 0x00, 0x3f, 0xb4, 0xfa, 0x00,
+    0x00, 0x03, 0xfb, 0x4f, 0xa0, 0x00, 0x00, 0x5f, 0xb2, 0xfd, 0x00, 0x00,
+    0x09, 0xfb, 0x0d, 0xf8, 0x00, 0x06, 0xff, 0xb0, 0x5f, 0xfd, 0xbd, 0xfb,
+    0xfb, 0x00, 0x3b, 0xef, 0xc6, 0x2f, 0xb0, 0x00, 0x09, 0x60, 0x29, 0x30,
+    0x00, 0x01, 0xda, 0x04, 0xe6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0xa0, 0x00, 0x00, 0x3f, 0xb4, 0xfa,
+    0x00, 0x00, 0x03, 0xfb, 0x4f, 0xa0, 0x00, 0x00, 0x3f, 0xb4, 0xfa, 0x00,
+    0x00, 0x03, 0xfb, 0x4f, 0xa0, 0x00, 0x00, 0x3f, 0xb4, 0xfa, 0x00, 0x00,
+    0x03, 0xfb, 0x4f, 0xa0, 0x00, 0x00, 0x5f, 0xb2, 0xfd, 0x00, 0x00, 0x09,
+    0xfb, 0x0d, 0xf8, 0x00, 0x06, 0xff, 0xb0, 0x5f, 0xfd, 0xbd, 0xfb, 0xfb,
+    0x00, 0x3b, 0xef, 0xc6, 0x2f, 0xb0,
+};
+
+static const GfxGlyph ui_font_20_glyphs[] = {
+    {0x0020, 0, 0, 0, 0, 0, 5}, // U+0020 " "
+    {0x0021, 0, 3, 14, 1, -14, 5}, // U+0021 "!"
+    {0x0022, 21, 6, 5, 1, -14, 8}, // U+0022 "\""
+    {0x0023, 36, 14, 14, 0, -14, 14}, // U+0023 "#"
+    {0x0024, 134, 12, 20, 0, -17, 12}, // U+0024 "$"
+    {0x0025, 254, 17, 14, 0, -14, 17}, // U+0025 "%"
+    {0x0026, 373, 14, 14, 0, -14, 14}, // U+0026 "&"
+    {0x0027, 471, 2, 5, 1, -14, 4}, // U+0027 "'"
+    {0x0028, 476, 5, 19, 1, -15, 7}, // U+0028 "("
+    {0x0029, 524, 5, 19, 0, -15, 7}, // U+0029 ")"
+    {0x002A, 572, 8, 8, 0, -15, 8}, // U+002A "*"
+    {0x002B, 604, 10, 9, 1, -12, 12}, // U+002B "+"
+    {0x002C, 649, 3, 6, 1, -3, 5}, // U+002C ","
+    {0x002D, 658, 6, 2, 1, -7, 8}, // U+002D "-"
+    {0x002E, 664, 3, 3, 1, -3, 5}, // U+002E "."
+    {0x002F, 669, 9, 20, -1, -18, 7}, // U+002F "/"
+    {0x0030, 759, 12, 14, 1, -14, 13}, // U+0030 "0"
+    {0x0031, 843, 6, 14, 0, -14, 7}, // U+0031 "1"
+    {0x0032, 885, 11, 14, 0, -14, 12}, // U+0032 "2"
+    {0x0033, 962, 11, 14, 0, -14, 11}, // U+0033 "3"
+    {0x0034, 1039, 14, 14, 0, -14, 13}, // U+0034 "4"
+    {0x0035, 1137, 11, 14, 0, -14, 12}, // U+0035 "5"
+    {0x0036, 1214, 11, 14, 1, -14, 12}, // U+0036 "6"
+    {0x0037, 1291, 12, 14, 0, -14, 12}, // U+0037 "7"
+    {0x0038, 1375, 12, 14, 0, -14, 13}, // U+0038 "8"
+    {0x0039, 1459, 12, 14, 0, -14, 12}, // U+0039 "9"
+    {0x003A, 1543, 3, 11, 1, -11, 5}, // U+003A ":"
+    {0x003B, 1560, 3, 14, 1, -11, 5}, // U+003B ";"
+    {0x003C, 1581, 10, 10, 1, -12, 12}, // U+003C "<"
+    {0x003D, 1631, 10, 7, 1, -11, 12}, // U+003D "="
+    {0x003E, 1666, 10, 10, 1, -12, 12}, // U+003E ">"
+    {0x003F, 1716, 11, 14, 0, -14, 11}, // U+003F "?"
+    {0x0040, 1793, 19, 18, 1, -14, 21}, // U+0040 "@"
+    {0x0041, 1964, 15, 14, 0, -14, 15}, // U+0041 "A"
+    {0x0042, 2069, 13, 14, 2, -14, 15}, // U+0042 "B"
+    {0x0043, 2160, 13, 14, 1, -14, 14}, // U+0043 "C"
+    {0x0044, 2251, 14, 14, 2, -14, 17}, // U+0044 "D"
+    {0x0045, 2349, 11, 14, 2, -14, 13}, // U+0045 "E"
+    {0x0046, 2426, 10, 14, 2, -14, 13}, // U+0046 "F"
+    {0x0047, 2496, 13, 14, 1, -14, 15}, // U+0047 "G"
+    {0x0048, 2587, 13, 14, 2, -14, 16}, // U+0048 "H"
+    {0x0049, 2678, 3, 14, 2, -14, 6}, // U+0049 "I"
+    {0x004A, 2699, 9, 14, 0, -14, 10}, // U+004A "J"
+    {0x004B, 2762, 13, 14, 2, -14, 14}, // U+004B "K"
+    {0x004C, 2853, 10, 14, 2, -14, 12}, // U+004C "L"
+    {0x004D, 2923, 15, 14, 2, -14, 19}, // U+004D "M"
+    {0x004E, 3028, 13, 14, 2, -14, 16}, // U+004E "N"
+    {0x004F, 3119, 15, 14, 1, -14, 17}, // U+004F "O"
+    {0x0050, 3224, 12, 14, 2, -14, 14}, // U+0050 "P"
+    {0x0051, 3308, 16, 17, 1, -14, 17}, // U+0051 "Q"
+    {0x0052, 3444, 12, 14, 2, -14, 15}, // U+0052 "R"
+    {0x0053, 3528, 12, 14, 0, -14, 12}, // U+0053 "S"
+    {0x0054, 3612, 12, 14, 0, -14, 12}, // U+0054 "T"
+    {0x0055, 3696, 12, 14, 2, -14, 16}, // U+0055 "U"
+    {0x0056, 3780, 15, 14, 0, -14, 14}, // U+0056 "V"
+    {0x0057, 3885, 22, 14, 0, -14, 23}, // U+0057 "W"
+    {0x0058, 4039, 13, 14, 0, -14, 13}, // U+0058 "X"
+    {0x0059, 4130, 13, 14, 0, -14, 13}, // U+0059 "Y"
+    {0x005A, 4221, 13, 14, 0, -14, 13}, // U+005A "Z"
+    {0x005B, 4312, 5, 19, 2, -15, 7}, // U+005B "["
+    {0x005C, 4360, 9, 20, -1, -18, 7}, // U+005C "\\"
+    {0x005D, 4450, 5, 19, 0, -15, 7}, // U+005D "]"
+    {0x005E, 4498, 9, 9, 1, -12, 12}, // U+005E "^"
+    {0x005F, 4539, 10, 2, 0, -1, 10}, // U+005F "_"
+    {0x0060, 4549, 6, 3, 2, -15, 12}, // U+0060 "`"
+    {0x0061, 4558, 10, 11, 1, -11, 12}, // U+0061 "a"
+    {0x0062, 4613, 12, 15, 1, -15, 14}, // U+0062 "b"
+    {0x0063, 4703, 11, 11, 0, -11, 11}, // U+0063 "c"
+    {0x0064, 4764, 12, 15, 0, -15, 14}, // U+0064 "d"
+    {0x0065, 4854, 12, 11, 0, -11, 12}, // U+0065 "e"
+    {0x0066, 4920, 8, 15, 0, -15, 7}, // U+0066 "f"
+    {0x0067, 4980, 12, 15, 0, -11, 14}, // U+0067 "g"
+    {0x0068, 5070, 11, 15, 1, -15, 14}, // U+0068 "h"
+    {0x0069, 5153, 4, 15, 1, -15, 6}, // U+0069 "i"
+    {0x006A, 5183, 7, 19, -2, -15, 6}, // U+006A "j"
+    {0x006B, 5250, 12, 15, 1, -15, 12}, // U+006B "k"
+    {0x006C, 5340, 3, 15, 1, -15, 6}, // U+006C "l"
+    {0x006D, 5363, 19, 11, 1, -11, 21}, // U+006D "m"
+    {0x006E, 5468, 11, 11, 1, -11, 14}, // U+006E "n"
+    {0x006F, 5529, 12, 11, 0, -11, 13}, // U+006F "o"
+    {0x0070, 5595, 12, 15, 1, -11, 14}, // U+0070 "p"
+    {0x0071, 5685, 12, 15, 0, -11, 14}, // U+0071 "q"
+    {0x0072, 5775, 7, 11, 1, -11, 8}, // U+0072 "r"
+    {0x0073, 5814, 10, 11, 0, -11, 10}, // U+0073 "s"
+    {0x0074, 5869, 8, 14, 0, -14, 8}, // U+0074 "t"
+    {0x0075, 5925, 11, 11, 1, -11, 14}, // U+0075 "u"
+    {0x0076, 5986, 12, 11, 0, -11, 11}, // U+0076 "v"
+    {0x0077, 6052, 18, 11, 0, -11, 18}, // U+0077 "w"
+    {0x0078, 6151, 11, 11, 0, -11, 11}, // U+0078 "x"
+    {0x0079, 6212, 13, 15, -1, -11, 11}, // U+0079 "y"
+    {0x007A, 6310, 10, 11, 0, -11, 10}, // U+007A "z"
+    {0x007B, 6365, 6, 19, 1, -15, 7}, // U+007B "{"
+    {0x007C, 6422, 2, 19, 2, -15, 6}, // U+007C "|"
+    {0x007D, 6441, 6, 19, 0, -15, 7}, // U+007D "}"
+    {0x007E, 6498, 10, 4, 1, -10, 12}, // U+007E "~"
+    {0x00A1, 6518, 3, 14, 1, -11, 5}, // U+00A1 "¡"
+    {0x00B0, 6539, 8, 7, 0, -15, 8}, // U+00B0 "°"
+    {0x00BF, 6567, 11, 15, 1, -11, 11}, // U+00BF "¿"
+    {0x00C1, 6650, 15, 19, 0, -19, 15}, // U+00C1 "Á"
+    {0x00C9, 6793, 11, 19, 2, -19, 13}, // U+00C9 "É"
+    {0x00CD, 6898, 6, 19, 1, -19, 6}, // U+00CD "Í"
+    {0x00D1, 6955, 13, 18, 2, -18, 16}, // U+00D1 "Ñ"
+    {0x00D3, 7072, 15, 19, 1, -19, 17}, // U+00D3 "Ó"
+    {0x00DA, 7215, 12, 19, 2, -19, 16}, // U+00DA "Ú"
+    {0x00DC, 7329, 12, 18, 2, -18, 16}, // U+00DC "Ü"
+    {0x00E1, 7437, 10, 15, 1, -15, 12}, // U+00E1 "á"
+    {0x00E9, 7512, 12, 15, 0, -15, 12}, // U+00E9 "é"
+    {0x00ED, 7602, 6, 15, 1, -15, 6}, // U+00ED "í"
+    {0x00F1, 7647, 11, 15, 1, -15, 14}, // U+00F1 "ñ"
+    {0x00F3, 7730, 12, 15, 0, -15, 13}, // U+00F3 "ó"
+    {0x00FA, 7820, 11, 15, 1, -15, 14}, // U+00FA "ú"
+    {0x00FC, 7903, 11, 15, 1, -15, 14}, // U+00FC "ü"
+};
+
+static const GfxFont ui_font_20 = {ui_font_20_bitmap, ui_font_20_glyphs, 112, 23, 4};
+
+#endif
@@ -1,6 +1,7 @@
 #ifndef UI_MANAGER_H
 #define UI_MANAGER_H
 
+#include "ui_glyphs.h"
 #include <Arduino_GFX_Library.h>
 
 // Colores Modernos
@@ -16,12 +17,15 @@ class UIManager {
 public:
   UIManager(Arduino_Canvas *canvas) : _gfx(canvas) {}
 
+  // Text with its line's top-left at x, y (include/ui_glyphs.h fonts)
+  int16_t drawText(int16_t x, int16_t y, const char *s,
+                   const GfxFont &font = ui_font_12, uint16_t color = C_TEXT) {
+    return gfxDrawText(_gfx, x, y, s, font, color);
+  }
+
   void drawHeader(const char *title) {
     _gfx->fillRect(0, 0, 480, 40, C_HEADER);
-    _gfx->setTextColor(C_TEXT);
-    _gfx->setTextSize(2);
-    _gfx->setCursor(15, 10);
-    _gfx->print(title);
+    drawText(15, 8, title, ui_font_20);
   }
 
   void drawMap(int width, int height) {
@@ -36,25 +40,19 @@ public:
   void drawNode(int x, int y, const char *label, bool active) {
     _gfx->fillRoundRect(x - 20, y - 10, 40, 20, 4,
                         active ? C_ACCENT : C_DANGER);
-    _gfx->setTextColor(C_BG);
-    _gfx->setTextSize(1);
-    _gfx->setCursor(x - 15, y - 4);
-    _gfx->print(label);
+    drawText(x - gfxTextWidth(ui_font_12, label) / 2, y - 7, label,
+             ui_font_12, C_BG);
   }
 
   void drawUser(int x, int y, const char *name) {
     _gfx->fillCircle(x, y, 6, C_PRIMARY);
     _gfx->drawCircle(x, y, 10, C_PRIMARY);
-    _gfx->setTextColor(C_TEXT);
-    _gfx->setCursor(x + 12, y - 4);
-    _gfx->print(name);
+    drawText(x + 12, y - 7, name);
   }
 
   void drawFooter(const char *info) {
     _gfx->fillRect(0, 290, 480, 30, C_GRAY);
-    _gfx->setCursor(10, 300);
-    _gfx->setTextSize(1);
-    _gfx->print(info);
+    drawText(10, 298, info);
   }
 
 private:
@@ -10,6 +10,7 @@
 #include <WiFi.h>
 
 #if HAS_SCREEN
+#include "axs_touch.h"
 #include "ui_manager.h"
 #include <Arduino_GFX_Library.h>
 #endif
@@ -41,6 +42,7 @@ Arduino_AXS15231B *g = new Arduino_AXS15231B(
     bus, -1 /* RST */, 0 /* Rotation */, true /* IPS */, 480, 320);
 Arduino_Canvas *gfx = new Arduino_Canvas(480, 320, g, 0, 0, 0);
 UIManager ui(gfx);
+AxsTouch axs;
 #endif
 
 // ========== ESTRUCTURAS DE DATOS ==========
@@ -216,32 +218,17 @@ void addDevice(const char *name, const char *mac) {
 // ========== TOUCH HANDLING ==========
 bool getTouchPoint(uint16_t &x, uint16_t &y) {
 #if HAS_SCREEN
-  uint8_t data[8] = {0};
-  const uint8_t read_cmd[11] = {0xb5, 0xab, 0xa5, 0x5a, 0x00, 0x00,
-                                0x00, 0x08, 0x00, 0x00, 0x00};
-  Wire.beginTransmission(0x3B);
-  Wire.write(read_cmd, 11);
-  if (Wire.endTransmission() != 0)
-    return false;
-  if (Wire.requestFrom(0x3B, 8) != 8)
-    return false;
-  for (int i = 0; i < 8; i++)
-    data[i] = Wire.read();
-  if (data[1] > 0) {
-    uint16_t rawX = ((data[2] & 0x0F) << 8) | data[3];
-    uint16_t rawY = ((data[4] & 0x0F) << 8) | data[5];
-    y = map(rawX, 0, 320, 320, 0);
-    x = rawY;
-    return true;
-  }
-#endif
+  return axs.readPoint(x, y) > 0;
+#else
   return false;
+#endif
 }
 
 void setup() {
   Serial.begin(115200);
 #if HAS_SCREEN
   Wire.begin(4, 8);
+  axs.begin(axsCal(1, 480, 320)); // Same mapping as the panels
 #endif
 
   if (!SPIFFS.begin(true)) {
@@ -323,16 +310,18 @@ void loop() {
     }
   } else if (currentPage == 1) {
     ui.drawHeader("DISPOSITIVOS");
-    gfx->setCursor(20, 60);
+    char line[48];
     for (int i = 0; i < deviceCount; i++) {
-      gfx->printf("%s: %.2fm\n", trackedDevices[i].name,
-                  trackedDevices[i].distance);
+      snprintf(line, sizeof(line), "%s: %.2f m", trackedDevices[i].name,
+               trackedDevices[i].distance);
+      ui.drawText(20, 60 + i * ui_font_12.lineHeight, line);
     }
   } else {
     ui.drawHeader("CONFIGURACIÓN MESH");
-    gfx->setCursor(20, 60);
-    gfx->printf("Nodo ID: %u\n", mesh.getNodeId());
-    gfx->printf("Nodos activos: %u\n", mesh.getNodeList().size());
+    char line[48];
+    snprintf(line, sizeof(line), "Nodo ID: %u\nNodos activos: %u",
+             mesh.getNodeId(), mesh.getNodeList().size());
+    ui.drawText(20, 60, line);
   }
 
   ui.drawFooter("MAPA          DEVICES          CONFIG");
@@ -2,22 +2,24 @@
  * Home Assistant Control Panel - Sunton ESP32-S3 3.5"
  * Based on F1ATB examples with manual I2C touch
  */
+#include "axs_touch.h"
+#include "boot_seq.h"
+#include "ha_client.h"
+#include "ha_commands.h"
 #include "secrets.h"
+#include "wifi_manager.h"
 #include <ArduinoJson.h>
 #include <Arduino_GFX_Library.h>
-#include <HTTPClient.h>
 #include <WiFi.h>
 #include <Wire.h>
 
 // Pin definitions
 #define GFX_BL 1
-#define TOUCH_ADDR 0x3B
 #define TOUCH_SDA 4
 #define TOUCH_SCL 8
 #define TOUCH_I2C_CLOCK 400000
 #define TOUCH_RST_PIN 12
 #define TOUCH_INT_PIN 11
-#define AXS_MAX_TOUCH_NUMBER 1
 
 // Custom colors
 #define PANEL_RED 0xF800
@@ -64,30 +66,39 @@ GridButton panelButtons[6] = {
 String lastDebugMsg = "";
 int lastHttpCode = 0;
 
+HaClient ha;
+WifiManager wifi;
+HaCommandQueue pending; // Presses waiting for the link
+AxsTouch axs;
+
+// Boot phases, see boot_seq.h: the grid is drawn while the touch
+// controller comes out of reset on a task of its own. wifi is only timed.
+// Same order as the boot.add() calls in setup().
+enum { PHASE_DISPLAY, PHASE_TOUCH, PHASE_UI, PHASE_WIFI };
+BootSeq boot;
+volatile bool touchReady = false; // Set by bootTouch() after the reset
+
 // Prototypes
 bool getTouchPoint(uint16_t &x, uint16_t &y);
-void connectWiFi();
+void onWifi(bool online);
 void callHAService(const char *domain, const char *service,
                    const char *entity_id);
 void drawUI();
 
-void setup() {
-  Serial.begin(115200);
-
-  // Initialize Display
-  gfx->begin();
+bool bootDisplay() {
+  if (!gfx->begin()) {
+    Serial.println("Gfx FAIL");
+    return false;
+  }
   gfx->setRotation(1);
   gfx->fillScreen(PANEL_BLACK);
 
   pinMode(GFX_BL, OUTPUT);
   digitalWrite(GFX_BL, HIGH);
+  return true;
+}
 
-  gfx->setTextSize(2);
-  gfx->setTextColor(PANEL_WHITE);
-  gfx->setCursor(20, 140);
-  gfx->print("CONECTANDO WIFI...");
-  gfx->flush();
-
+bool bootTouch() {
   // Initialize touch (MANUAL I2C - NO GT911 library)
   Wire.begin(TOUCH_SDA, TOUCH_SCL);
   Wire.setClock(TOUCH_I2C_CLOCK);
@@ -99,12 +110,34 @@ void setup() {
   delay(200);
   digitalWrite(TOUCH_RST_PIN, HIGH);
   delay(200);
+  axs.begin(axsCal(1, 480, 320));
+  touchReady = true;
+  return true;
+}
 
-  connectWiFi();
+bool bootUi() {
+  ha.begin(HA_URL, HA_TOKEN);
   drawUI();
+  wifi.begin(WIFI_SSID, WIFI_PASS, onWifi); // Connects from loop()
+  return true;
+}
+
+void setup() {
+  Serial.begin(115200);
+  boot.add("display", BOOT_MAIN, bootDisplay);
+  boot.add("touch", BOOT_TASK, bootTouch);
+  boot.add("ui", BOOT_MAIN, bootUi, BOOT_BIT(PHASE_DISPLAY));
+  boot.add("wifi", BOOT_EXTERNAL, NULL, BOOT_BIT(PHASE_UI));
+  // The loop below never runs without the grid on screen
+  while (!boot.ended(PHASE_UI)) {
+    boot.poll();
+    delay(1);
+  }
 }
 
 void loop() {
+  boot.poll();
+  wifi.loop();
   bool touched = getTouchPoint(touchX, touchY);
 
   if (touched && !lastTouched) {
@@ -123,8 +156,9 @@ void loop() {
         gfx->fillRect(bx, by, colW - 10, rowH - 10, PANEL_YELLOW);
         gfx->flush();
 
-        callHAService(panelButtons[idx].domain, panelButtons[idx].service,
-                      panelButtons[idx].entity_id);
+        if (!pending.post(panelButtons[idx].domain, panelButtons[idx].service,
+                          panelButtons[idx].entity_id, -1, 0))
+          Serial.println("HA: queue full, press dropped");
 
         delay(300);
         drawUI();
@@ -133,6 +167,13 @@ void loop() {
   }
 
   lastTouched = touched;
+
+  // Sent in order once online; two toggles of one entity cancel out
+  HaCommand cmd;
+  while (wifi.connected() && pending.take(cmd)) {
+    callHAService(cmd.domain, cmd.service, cmd.entity);
+    pending.finish();
+  }
   delay(5);
 }
 
@@ -168,12 +209,18 @@ void drawUI() {
   gfx->setTextSize(1);
   gfx->setTextColor(PANEL_WHITE);
   gfx->setCursor(10, 290);
-  if (WiFi.status() == WL_CONNECTED) {
+  if (wifi.connected()) {
     gfx->print("WiFi: ");
     gfx->print(WiFi.localIP());
+  } else if (wifi.state() == WIFI_CONNECTING) {
+    gfx->print("WiFi: CONECTANDO...");
   } else {
     gfx->print("WiFi: ERROR");
   }
+  if (pending.size() > 0) {
+    gfx->print("  PENDIENTES: ");
+    gfx->print(pending.size());
+  }
 
   gfx->setCursor(10, 300);
   if (lastHttpCode != 0) {
@@ -195,36 +242,25 @@ void drawUI() {
   gfx->flush();
 }
 
-void connectWiFi() {
-  WiFi.begin(WIFI_SSID, WIFI_PASS);
-  int counter = 0;
-  while (WiFi.status() != WL_CONNECTED && counter < 20) {
-    delay(500);
-    Serial.print(".");
-    counter++;
-  }
+// From wifi.loop() on every link change
+void onWifi(bool online) {
+  if (online && boot.running(PHASE_WIFI))
+    boot.complete(PHASE_WIFI);
+  Serial.printf("WiFi: %s, %lu reconnects\n", online ? "up" : "down",
+                (unsigned long)wifi.reconnects());
+  drawUI();
 }
 
 void callHAService(const char *domain, const char *service,
                    const char *entity_id) {
   if (WiFi.status() == WL_CONNECTED) {
-    HTTPClient http;
-    String url = String(HA_URL) + "/api/services/" + String(domain) + "/" +
-                 String(service);
-
     lastDebugMsg = String(domain) + "/" + String(service);
-
-    http.begin(url);
-    http.addHeader("Authorization", "Bearer " + String(HA_TOKEN));
-    http.addHeader("Content-Type", "application/json");
-
-    StaticJsonDocument<256> doc;
-    doc["entity_id"] = entity_id;
-    String requestBody;
-    serializeJson(doc, requestBody);
-
-    lastHttpCode = http.POST(requestBody);
-    http.end();
+    lastHttpCode = ha.callService(domain, service, entity_id);
+    uint32_t mean, p99;
+    ha.stats(mean, p99);
+    Serial.printf("HA: %d, mean %lu ms, p99 %lu ms, %lu connects\n",
+                  lastHttpCode, (unsigned long)mean, (unsigned long)p99,
+                  (unsigned long)ha.connects());
   } else {
     lastDebugMsg = "WiFi OFF";
     lastHttpCode = -999;
@@ -232,41 +268,7 @@ void callHAService(const char *domain, const char *service,
 }
 
 bool getTouchPoint(uint16_t &x, uint16_t &y) {
-  uint8_t data[AXS_MAX_TOUCH_NUMBER * 6 + 2] = {0};
-
-  const uint8_t read_cmd[11] = {
-      0xb5,
-      0xab,
-      0xa5,
-      0x5a,
-      0x00,
-      0x00,
-      (uint8_t)((AXS_MAX_TOUCH_NUMBER * 6 + 2) >> 8),
-      (uint8_t)((AXS_MAX_TOUCH_NUMBER * 6 + 2) & 0xff),
-      0x00,
-      0x00,
-      0x00};
-
-  Wire.beginTransmission(TOUCH_ADDR);
-  Wire.write(read_cmd, 11);
-  if (Wire.endTransmission() != 0)
-    return false;
-
-  if (Wire.requestFrom(TOUCH_ADDR, sizeof(data)) != sizeof(data))
+  if (!touchReady)
     return false;
-
-  for (int i = 0; i < sizeof(data); i++) {
-    data[i] = Wire.read();
-  }
-
-  if (data[1] > 0 && data[1] <= AXS_MAX_TOUCH_NUMBER) {
-    uint16_t rawX = ((data[2] & 0x0F) << 8) | data[3];
-    uint16_t rawY = ((data[4] & 0x0F) << 8) | data[5];
-    if (rawX > 500 || rawY > 500)
-      return false;
-    y = map(rawX, 0, 320, 320, 0);
-    x = rawY;
-    return true;
-  }
-  return false;
+  return axs.readPoint(x, y) > 0;
 }
@@ -0,0 +1,213 @@
+#ifndef AXS_TOUCH_H
+#define AXS_TOUCH_H
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#include <Wire.h>
+#endif
+#include <stdint.h>
+#include <stdlib.h>
+
+// AXS15231B capacitive touch of the Sunton 3.5" boards, one copy for every
+// project that drives one (lib_extra_dirs = ../lib in its platformio.ini).
+// One I2C burst reads up to AXS_MAX_POINTS points, which AxsCal maps to
+// screen coordinates in Q16 fixed point. TouchGestures turns the first
+// point into tap, long press and horizontal swipe as soon as each one is
+// certain.
+//
+// axsParse() and TouchGestures use no hardware, so recorded frames and
+// touch traces can be replayed through them off the board; AxsTouch, the
+// Wire driver, only builds on the device.
+
+#define AXS_TOUCH_ADDR 0x3B
+#define AXS_MAX_POINTS 5
+#define AXS_FRAME_LEN (2 + AXS_MAX_POINTS * 6) // Count, then 6 B per point
+
+#define GESTURE_SLOP_PX 12   // Movement still counted as holding still
+#define GESTURE_LONG_MS 500  // Hold for a long press
+#define GESTURE_SWIPE_PX 60  // Horizontal travel for a swipe
+#define GESTURE_SWIPE_MS 400 // ... reached within this time
+
+struct AxsPoint {
+  uint16_t x;
+  uint16_t y;
+  uint8_t id;
+};
+
+// Raw to screen: x = (xx * rx + xy * ry + x0) >> 16, same for y, clamped
+// to the screen. Raw points beyond rawMaxX / rawMaxY are noise and dropped.
+struct AxsCal {
+  int32_t xx, xy, x0;
+  int32_t yx, yy, y0;
+  uint16_t w, h;
+  uint16_t rawMaxX, rawMaxY;
+};
+
+// `rotation` as Arduino_GFX setRotation(), for a screen of w x h. The raw
+// ranges default to the panel's native 320 x 480 and can be narrowed to
+// what a given panel measures at its edges.
+inline AxsCal axsCal(uint8_t rotation, uint16_t w, uint16_t h,
+                     uint16_t rawX0 = 0, uint16_t rawX1 = 320,
+                     uint16_t rawY0 = 0, uint16_t rawY1 = 480) {
+  bool swap = rotation & 1; // Raw x runs along the screen's y
+  int32_t sx = ((int32_t)(swap ? h : w) << 16) / (rawX1 - rawX0);
+  int32_t sy = ((int32_t)(swap ? w : h) << 16) / (rawY1 - rawY0);
+  AxsCal c = {0, 0, 0, 0, 0, 0, w, h, rawX1, rawY1};
+  switch (rotation & 3) {
+  case 0: // x = rx, y = ry
+    c.xx = sx, c.x0 = -rawX0 * sx;
+    c.yy = sy, c.y0 = -rawY0 * sy;
+    break;
+  case 1: // x = ry, y = rawX1 - rx
+    c.xy = sy, c.x0 = -rawY0 * sy;
+    c.yx = -sx, c.y0 = rawX1 * sx;
+    break;
+  case 2: // x = rawX1 - rx, y = rawY1 - ry
+    c.xx = -sx, c.x0 = rawX1 * sx;
+    c.yy = -sy, c.y0 = rawY1 * sy;
+    break;
+  default: // x = rawY1 - ry, y = rx
+    c.xy = -sy, c.x0 = rawY1 * sy;
+    c.yx = sx, c.y0 = -rawX0 * sx;
+    break;
+  }
+  return c;
+}
+
+inline uint16_t axsClamp(int32_t v, uint16_t max) {
+  v >>= 16;
+  return v < 0 ? 0 : v >= max ? max - 1 : v;
+}
+
+// Points of one frame into `pts`, in controller order; returns the count
+inline uint8_t axsParse(const uint8_t *frame, const AxsCal &cal,
+                        AxsPoint *pts) {
+  uint8_t n = frame[1];
+  if (n > AXS_MAX_POINTS)
+    return 0; // Idle or garbled frame
+  uint8_t out = 0;
+  for (uint8_t i = 0; i < n; i++) {
+    const uint8_t *p = frame + 2 + i * 6;
+    int32_t rx = ((p[0] & 0x0F) << 8) | p[1];
+    int32_t ry = ((p[2] & 0x0F) << 8) | p[3];
+    if (rx > cal.rawMaxX || ry > cal.rawMaxY)
+      continue;
+    pts[out].x = axsClamp(cal.xx * rx + cal.xy * ry + cal.x0, cal.w);
+    pts[out].y = axsClamp(cal.yx * rx + cal.yy * ry + cal.y0, cal.h);
+    pts[out].id = p[2] >> 4;
+    out++;
+  }
+  return out;
+}
+
+#ifdef ARDUINO
+class AxsTouch {
+public:
+  // After the controller reset and Wire.begin()
+  void begin(const AxsCal &cal, TwoWire &wire = Wire,
+             uint8_t addr = AXS_TOUCH_ADDR) {
+    _cal = cal;
+    _wire = &wire;
+    _addr = addr;
+  }
+
+  // Up to AXS_MAX_POINTS points into `pts`: their count, -1 on a bus error
+  int8_t read(AxsPoint *pts) {
+    static const uint8_t cmd[11] = {0xb5, 0xab, 0xa5, 0x5a, 0x00, 0x00,
+                                    0x00, AXS_FRAME_LEN, 0x00, 0x00, 0x00};
+    uint8_t frame[AXS_FRAME_LEN];
+    _wire->beginTransmission(_addr);
+    _wire->write(cmd, sizeof(cmd));
+    if (_wire->endTransmission() != 0)
+      return -1;
+    if (_wire->requestFrom((uint16_t)_addr, (uint8_t)sizeof(frame)) !=
+        sizeof(frame))
+      return -1;
+    for (uint8_t i = 0; i < sizeof(frame); i++)
+      frame[i] = _wire->read();
+    return axsParse(frame, _cal, pts);
+  }
+
+  // First point only: 1 touched, 0 none, -1 bus error
+  int8_t readPoint(uint16_t &x, uint16_t &y) {
+    AxsPoint pts[AXS_MAX_POINTS];
+    int8_t n = read(pts);
+    if (n <= 0)
+      return n;
+    x = pts[0].x;
+    y = pts[0].y;
+    return 1;
+  }
+
+private:
+  AxsCal _cal = axsCal(1, 480, 320);
+  TwoWire *_wire = &Wire;
+  uint8_t _addr = AXS_TOUCH_ADDR;
+};
+#endif
+
+enum TouchGesture : uint8_t {
+  GESTURE_NONE,
+  GESTURE_TAP,
+  GESTURE_LONG_PRESS,
+  GESTURE_SWIPE_LEFT, // Finger moved left: next page
+  GESTURE_SWIPE_RIGHT,
+};
+
+// Fed once per touch read. A swipe is reported while the finger is still
+// moving and a long press while it is still down; a tap needs the release.
+// At most one gesture per touch, and none once a second finger lands.
+class TouchGestures {
+public:
+  TouchGesture feed(uint32_t ms, uint8_t points, uint16_t x, uint16_t y) {
+    if (points == 0) {
+      bool tap = _down && !_done && !_moved && ms - _t0 < GESTURE_LONG_MS;
+      _down = false;
+      return tap ? GESTURE_TAP : GESTURE_NONE;
+    }
+    if (!_down) {
+      _down = true;
+      _done = _swiped = _moved = false;
+      _t0 = ms;
+      _x0 = x;
+      _y0 = y;
+    }
+    if (points > 1)
+      _done = true;
+    if (_done)
+      return GESTURE_NONE;
+    int16_t dx = (int16_t)(x - _x0), dy = (int16_t)(y - _y0);
+    uint16_t ax = abs(dx), ay = abs(dy);
+    _moved |= ax > GESTURE_SLOP_PX || ay > GESTURE_SLOP_PX;
+    uint32_t held = ms - _t0;
+    if (ax >= GESTURE_SWIPE_PX && ax >= 2 * ay && held <= GESTURE_SWIPE_MS) {
+      _done = _swiped = true;
+      return dx < 0 ? GESTURE_SWIPE_LEFT : GESTURE_SWIPE_RIGHT;
+    }
+    if (_moved && held > GESTURE_SWIPE_MS) {
+      _done = true; // A drag or scroll, not a gesture
+    } else if (!_moved && held >= GESTURE_LONG_MS) {
+      _done = true;
+      return GESTURE_LONG_PRESS;
+    }
+    return GESTURE_NONE;
+  }
+
+  // A swipe took the current touch: the UI should not see the rest of it
+  bool swiped() const { return _down && _swiped; }
+
+  // No gestures for the rest of the current touch, e.g. when it drags a
+  // slider sideways
+  void cancel() { _done = true; }
+
+private:
+  bool _down = false;
+  bool _done = false; // No more gestures in this touch
+  bool _swiped = false;
+  bool _moved = false;
+  uint32_t _t0 = 0;
+  uint16_t _x0 = 0;
+  uint16_t _y0 = 0;
+};
+
+#endif
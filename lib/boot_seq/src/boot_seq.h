@@ -0,0 +1,229 @@
+#ifndef BOOT_SEQ_H
+#define BOOT_SEQ_H
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#endif
+#include <stdint.h>
+
+// setup() as phases with dependencies instead of one serial list. A phase
+// runs on the loop task (BOOT_MAIN: display, LVGL, anything that is not
+// thread safe), on a FreeRTOS task of its own (BOOT_TASK: reset pulses, SD
+// mount, BLE stack) or outside (BOOT_EXTERNAL: WiFi association, first HA
+// states), ended with complete(). A phase starts once every phase in its
+// `after` mask has ended, ok or not, so the UI is up while slow peripherals
+// are still starting. Phases in its `needs` mask must also have ended ok:
+// when one failed or was skipped, the phase is skipped without running.
+// When all have ended a boot report goes to serial:
+//
+//   Boot: touch        12 ..  226 ms  ok
+//   Boot: done in 2840 ms
+//
+// BootPlan holds the order and timing and no hardware, so the host can
+// drive it with simulated peripheral latencies.
+
+#define BOOT_MAX_PHASES 12
+#define BOOT_NONE 0xFF // add() when all BOOT_MAX_PHASES are taken
+#define BOOT_STACK 6144
+#define BOOT_EXTERNAL_MS 30000 // An external phase not done by then fails
+#define BOOT_BIT(phase) (1UL << (phase))
+
+typedef bool (*BootFn)(); // false when the phase failed
+
+enum BootRun : uint8_t { BOOT_MAIN, BOOT_TASK, BOOT_EXTERNAL };
+enum BootState : uint8_t {
+  BOOT_WAITING,
+  BOOT_RUNNING,
+  BOOT_OK,
+  BOOT_FAILED,
+  BOOT_SKIPPED
+};
+
+class BootPlan {
+public:
+  // Phases are numbered in the order they are added; BOOT_NONE, and
+  // nothing added, once the table is full
+  uint8_t add(const char *name, BootRun run, BootFn fn, uint32_t after = 0,
+              uint32_t needs = 0) {
+    if (_count >= BOOT_MAX_PHASES)
+      return BOOT_NONE;
+    Phase &p = _phase[_count];
+    p.name = name;
+    p.run = run;
+    p.fn = fn;
+    p.after = after | needs;
+    p.needs = needs;
+    return _count++;
+  }
+
+  // A phase of kind `run` whose dependencies have ended, marked running at
+  // `now`; -1 when none
+  int8_t take(BootRun run, uint32_t now) {
+    for (uint8_t i = 0; i < _count; i++) {
+      Phase &p = _phase[i];
+      if (p.run != run || !ready(p) || (p.needs & _failed))
+        continue;
+      p.state = BOOT_RUNNING;
+      p.start = now;
+      return i;
+    }
+    return -1;
+  }
+
+  // Ends, as skipped, the phases whose `needs` did not end ok; how many
+  uint8_t skip(uint32_t now) {
+    uint8_t n = 0;
+    for (uint8_t i = 0; i < _count; i++) {
+      Phase &p = _phase[i];
+      if (!ready(p) || !(p.needs & _failed))
+        continue;
+      p.state = BOOT_SKIPPED;
+      p.start = p.end = now;
+      _ended |= BOOT_BIT(i);
+      _failed |= BOOT_BIT(i); // So what needs it is skipped too
+      n++;
+    }
+    return n;
+  }
+
+  void finish(uint8_t i, bool ok, uint32_t now) {
+    Phase &p = _phase[i];
+    if (p.state != BOOT_RUNNING)
+      return;
+    p.state = ok ? BOOT_OK : BOOT_FAILED;
+    p.end = now;
+    _ended |= BOOT_BIT(i);
+    if (!ok)
+      _failed |= BOOT_BIT(i);
+  }
+
+  // Fails external phases that have waited too long
+  void expire(uint32_t now) {
+    for (uint8_t i = 0; i < _count; i++)
+      if (_phase[i].run == BOOT_EXTERNAL && running(i) &&
+          now - _phase[i].start >= BOOT_EXTERNAL_MS)
+        finish(i, false, now);
+  }
+
+  bool done() const { return _count && _ended == BOOT_BIT(_count) - 1; }
+  bool running(uint8_t i) const { return _phase[i].state == BOOT_RUNNING; }
+  bool ok(uint8_t i) const { return _phase[i].state == BOOT_OK; }
+  bool ended(uint8_t i) const { return _ended & BOOT_BIT(i); }
+  BootState state(uint8_t i) const { return _phase[i].state; }
+  uint8_t count() const { return _count; }
+  const char *name(uint8_t i) const { return _phase[i].name; }
+  BootFn fn(uint8_t i) const { return _phase[i].fn; }
+  uint32_t start(uint8_t i) const { return _phase[i].start; }
+  uint32_t end(uint8_t i) const { return _phase[i].end; }
+
+  // Time the last phase ended
+  uint32_t total() const {
+    uint32_t t = 0;
+    for (uint8_t i = 0; i < _count; i++)
+      if (_phase[i].end > t)
+        t = _phase[i].end;
+    return t;
+  }
+
+private:
+  struct Phase {
+    const char *name;
+    BootRun run;
+    BootFn fn;
+    uint32_t after;
+    uint32_t needs;
+    BootState state;
+    uint32_t start;
+    uint32_t end;
+  };
+
+  bool ready(const Phase &p) const {
+    return p.state == BOOT_WAITING && (p.after & _ended) == p.after;
+  }
+
+  Phase _phase[BOOT_MAX_PHASES] = {};
+  uint8_t _count = 0;
+  uint32_t _ended = 0;
+  uint32_t _failed = 0; // Failed or skipped
+};
+
+#ifdef ARDUINO
+class BootSeq : public BootPlan {
+public:
+  // From setup() and then every loop(): starts what is ready. Main phases
+  // run right here, in order; tasks only hand back their result.
+  void poll() {
+    bool more = true;
+    while (more) {
+      more = false;
+      for (uint8_t i = 0; i < count(); i++) {
+        if (_done[i]) {
+          _done[i] = false;
+          finish(i, _ok[i], _end[i]);
+        }
+      }
+      expire(millis());
+      if (skip(millis()))
+        more = true;
+      int8_t i;
+      while ((i = take(BOOT_TASK, millis())) >= 0) {
+        _slot[i].seq = this;
+        _slot[i].i = i;
+        if (xTaskCreate(task, name(i), BOOT_STACK, &_slot[i], 1, NULL) !=
+            pdPASS) {
+          Serial.printf("Boot: no task for %s\n", name(i));
+          finish(i, false, millis());
+          more = true;
+        }
+      }
+      while (take(BOOT_EXTERNAL, millis()) >= 0) {
+      }
+      if ((i = take(BOOT_MAIN, millis())) >= 0) {
+        bool ok = fn(i)();
+        finish(i, ok, millis());
+        more = true; // It may have unblocked others
+      }
+    }
+    if (done() && !_reported) {
+      _reported = true;
+      report();
+    }
+  }
+
+  // Ends an external phase; from the loop task
+  void complete(uint8_t i, bool ok = true) { finish(i, ok, millis()); }
+
+  void report() const {
+    static const char *const STATE[] = {"waiting", "running", "ok", "failed",
+                                        "skipped"};
+    for (uint8_t i = 0; i < count(); i++)
+      Serial.printf("Boot: %-10s %5lu .. %5lu ms  %s\n", name(i),
+                    (unsigned long)start(i), (unsigned long)end(i),
+                    STATE[state(i)]);
+    Serial.printf("Boot: done in %lu ms\n", (unsigned long)total());
+  }
+
+private:
+  struct Slot {
+    BootSeq *seq;
+    uint8_t i;
+  };
+
+  static void task(void *arg) {
+    Slot *s = (Slot *)arg;
+    bool ok = s->seq->fn(s->i)();
+    s->seq->_ok[s->i] = ok;
+    s->seq->_end[s->i] = millis();
+    s->seq->_done[s->i] = true; // Last: poll() reads the two above after it
+    vTaskDelete(NULL);
+  }
+
+  Slot _slot[BOOT_MAX_PHASES];
+  volatile bool _done[BOOT_MAX_PHASES] = {};
+  volatile bool _ok[BOOT_MAX_PHASES];
+  volatile uint32_t _end[BOOT_MAX_PHASES];
+  bool _reported = false;
+};
+#endif
+
+#endif
@@ -0,0 +1,87 @@
+#ifndef ENTITY_BINDINGS_H
+#define ENTITY_BINDINGS_H
+
+#include "entity_store.h"
+#include <lvgl.h>
+
+// Maps store entities to LVGL widgets. refresh() touches only the widgets
+// whose entity changed since the last refresh, and returns straight away
+// when nothing in the store did, so an idle screen invalidates nothing.
+//
+// A binding goes away with its widget (LV_EVENT_DELETE), so pages can be
+// deleted and rebuilt; a new binding shows the stored value on the next
+// refresh.
+
+#ifndef BINDING_MAX
+#define BINDING_MAX 32
+#endif
+
+enum BindingKind : uint8_t { BIND_LABEL, BIND_SWITCH };
+
+struct EntityBinding {
+  int16_t entity;
+  BindingKind kind;
+  lv_obj_t *obj;
+  const char *fmt; // BIND_LABEL: printf format taking the state text
+  uint32_t seen;   // Entity version last shown
+};
+
+class EntityBinder {
+public:
+  bool label(int16_t entity, lv_obj_t *obj, const char *fmt = "%s") {
+    return add(entity, BIND_LABEL, obj, fmt);
+  }
+  // `entity` should be interned as ENTITY_BOOL
+  bool toggle(int16_t entity, lv_obj_t *obj) {
+    return add(entity, BIND_SWITCH, obj, NULL);
+  }
+
+  // Returns the number of widgets updated.
+  uint8_t refresh(const EntityStore &store) {
+    if (store.version() == _version)
+      return 0;
+    _version = store.version();
+    uint8_t updated = 0;
+    for (uint8_t i = 0; i < _count; i++) {
+      EntityBinding &b = _bindings[i];
+      const Entity &e = store.get(b.entity);
+      if (!e.valid || e.version == b.seen)
+        continue;
+      b.seen = e.version;
+      if (b.kind == BIND_LABEL)
+        lv_label_set_text_fmt(b.obj, b.fmt, e.text);
+      else if (e.on)
+        lv_obj_add_state(b.obj, LV_STATE_CHECKED);
+      else
+        lv_obj_clear_state(b.obj, LV_STATE_CHECKED);
+      updated++;
+    }
+    return updated;
+  }
+
+private:
+  bool add(int16_t entity, BindingKind kind, lv_obj_t *obj, const char *fmt) {
+    if (entity < 0 || !obj || _count >= BINDING_MAX)
+      return false;
+    _bindings[_count++] = {entity, kind, obj, fmt, 0};
+    lv_obj_add_event_cb(obj, onDelete, LV_EVENT_DELETE, this);
+    _version = 0; // Show the current value on the next refresh
+    return true;
+  }
+
+  static void onDelete(lv_event_t *e) {
+    EntityBinder *self = (EntityBinder *)lv_event_get_user_data(e);
+    lv_obj_t *obj = lv_event_get_target(e);
+    uint8_t n = 0;
+    for (uint8_t i = 0; i < self->_count; i++)
+      if (self->_bindings[i].obj != obj)
+        self->_bindings[n++] = self->_bindings[i];
+    self->_count = n;
+  }
+
+  EntityBinding _bindings[BINDING_MAX];
+  uint8_t _count = 0;
+  uint32_t _version = 0;
+};
+
+#endif
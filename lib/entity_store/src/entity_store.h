@@ -0,0 +1,107 @@
+#ifndef ENTITY_STORE_H
+#define ENTITY_STORE_H
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Last known value of every entity the panel shows. Ids are interned once
+// into handles (indexes), values are kept typed, and each entity carries
+// the store version at which its value last changed. Setting a value that
+// equals the stored one changes nothing, so bindings (entity_bindings.h)
+// can skip widgets whose entity did not move.
+
+#ifndef ENTITY_MAX
+#define ENTITY_MAX 32
+#endif
+#define ENTITY_STATE_LEN 24
+
+enum EntityType : uint8_t { ENTITY_TEXT, ENTITY_NUMBER, ENTITY_BOOL };
+
+struct Entity {
+  const char *id;
+  uint32_t hash;
+  EntityType type;
+  bool valid;
+  char text[ENTITY_STATE_LEN]; // State as sent by HA
+  float number;                // ENTITY_NUMBER
+  bool on;                     // ENTITY_BOOL
+  uint32_t version;            // Store version of the last change
+};
+
+class EntityStore {
+public:
+  // Returns the handle for `id`, adding it on first use; -1 when full.
+  // `id` must outlive the store (config strings are literals).
+  int16_t intern(const char *id, EntityType type = ENTITY_TEXT) {
+    int16_t h = find(id);
+    if (h >= 0 || _count >= ENTITY_MAX)
+      return h;
+    Entity &e = _entities[_count];
+    memset(&e, 0, sizeof(e));
+    e.id = id;
+    e.hash = hash(id);
+    e.type = type;
+    return _count++;
+  }
+
+  int16_t find(const char *id) const {
+    uint32_t h = hash(id);
+    for (uint8_t i = 0; i < _count; i++)
+      if (_entities[i].hash == h && strcmp(_entities[i].id, id) == 0)
+        return i;
+    return -1;
+  }
+
+  // Stores `state`; returns true if the value changed.
+  bool set(int16_t h, const char *state) {
+    if (h < 0 || h >= _count || !state)
+      return false;
+    Entity &e = _entities[h];
+    if (e.valid && strncmp(e.text, state, ENTITY_STATE_LEN - 1) == 0)
+      return false;
+    strncpy(e.text, state, ENTITY_STATE_LEN - 1);
+    e.text[ENTITY_STATE_LEN - 1] = '\0';
+    if (e.type == ENTITY_NUMBER)
+      e.number = strtof(state, NULL);
+    else if (e.type == ENTITY_BOOL)
+      e.on = strcmp(state, "on") == 0 || strcmp(state, "open") == 0;
+    e.valid = true;
+    e.version = ++_version;
+    return true;
+  }
+
+  bool set(const char *id, const char *state) { return set(find(id), state); }
+
+  // Marks `h` changed without a new value, so its bindings show the stored
+  // one again, e.g. over a switch whose call failed.
+  void touch(int16_t h) {
+    if (h >= 0 && h < _count && _entities[h].valid)
+      _entities[h].version = ++_version;
+  }
+
+  // Puts a boolean back after a failed call. The user's switch shows the
+  // other value, so it is redrawn even when the store already held this one.
+  void restore(int16_t h, bool on) {
+    if (!set(h, on ? "on" : "off"))
+      touch(h);
+  }
+
+  const Entity &get(int16_t h) const { return _entities[h]; }
+  uint8_t size() const { return _count; }
+  uint32_t version() const { return _version; }
+
+private:
+  static uint32_t hash(const char *s) { // FNV-1a
+    uint32_t h = 2166136261u;
+    while (*s)
+      h = (h ^ (uint8_t)*s++) * 16777619u;
+    return h;
+  }
+
+  Entity _entities[ENTITY_MAX];
+  uint8_t _count = 0;
+  uint32_t _version = 0;
+};
+
+#endif
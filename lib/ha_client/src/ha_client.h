@@ -0,0 +1,307 @@
+#ifndef HA_CLIENT_H
+#define HA_CLIENT_H
+
+#include <Arduino.h>
+#include <WiFiClient.h>
+#include <algorithm>
+
+// Keep-alive REST client for Home Assistant.
+//
+// HTTPClient opens a new TCP connection per call and rebuilds the URL and
+// the "Bearer <token>" header String every time. HaClient keeps one
+// connection open across calls and writes each request in a single send:
+// the Host/Authorization lines are formatted once in begin(), only the
+// request line and Content-Length change. When HA has closed the idle
+// connection a GET is retried once on a fresh one; other requests are
+// only retried when they could not be written, so HA never runs a service
+// call twice.
+//
+// Requests run one at a time (the panels call HA from loop() only), so a
+// single socket is the whole pool.
+
+#define HA_CLIENT_TIMEOUT 3000
+#define HA_CLIENT_SAMPLES 64 // Latency samples kept for stats()
+#define HA_CLIENT_BUF 768
+
+// Response body, limited to Content-Length or decoded from chunks, so the
+// connection can be reused after deserializeJson() or any other reader has
+// stopped early.
+class HaBody : public Stream {
+public:
+  void begin(WiFiClient *c, int32_t len, bool chunked = false) {
+    _c = c;
+    _left = len;
+    _chunked = chunked;
+    _chunkCrlf = false;
+  }
+  // Bytes still to read: -1 until the server closes, -2 after a broken
+  // chunk header. A chunked body counts 1 between chunks.
+  int32_t left() const { return _chunked && _left == 0 ? 1 : _left; }
+
+  // Only what is left of the current chunk; 0 between chunks.
+  int available() override {
+    if (!_c || _left == 0 || _left == -2)
+      return 0;
+    int n = _c->available();
+    return _left > 0 ? std::min<int32_t>(n, _left) : n;
+  }
+  int read() override {
+    if (!more())
+      return -1;
+    int b = _c->read();
+    if (b >= 0 && _left > 0)
+      _left--;
+    return b;
+  }
+  int peek() override {
+    if (!more())
+      return -1;
+    return _c->peek();
+  }
+  size_t write(uint8_t) override { return 0; }
+
+  // One raw line from the socket without CRLF, for the status line,
+  // headers and chunk sizes; longer lines are truncated.
+  bool readLine(char *out, size_t size) {
+    size_t n = 0;
+    for (;;) {
+      if (!_c || !wait())
+        return false;
+      int c = _c->read();
+      if (c < 0)
+        return false;
+      if (c == '\n')
+        break;
+      if (c != '\r' && n + 1 < size)
+        out[n++] = c;
+    }
+    out[n] = '\0';
+    return true;
+  }
+
+private:
+  bool more() {
+    if (!_c || _left == -2)
+      return false;
+    if (_chunked && _left == 0)
+      nextChunk();
+    return _left != 0 && _left != -2 && wait();
+  }
+
+  // "<hex size>[;ext]" CRLF data CRLF ... "0" CRLF [trailers] CRLF
+  void nextChunk() {
+    char line[32];
+    long n = -1;
+    // The CRLF that ends the previous chunk's data comes first
+    if ((!_chunkCrlf || (readLine(line, sizeof(line)) && !line[0])) &&
+        readLine(line, sizeof(line))) {
+      char *end;
+      n = strtol(line, &end, 16);
+      if (end == line)
+        n = -1;
+    }
+    _chunkCrlf = true;
+    _left = n < 0 ? -2 : n;
+    if (_left == 0) {
+      while (readLine(line, sizeof(line)) && line[0]) {
+      } // Trailers
+    }
+    if (_left <= 0)
+      _chunked = false; // Last chunk read, or broken
+  }
+
+  bool wait() {
+    uint32_t t0 = millis();
+    while (!_c->available()) {
+      if (!_c->connected() || millis() - t0 > HA_CLIENT_TIMEOUT)
+        return false;
+      delay(1);
+    }
+    return true;
+  }
+
+  WiFiClient *_c = NULL;
+  int32_t _left = 0;
+  bool _chunked = false;
+  bool _chunkCrlf = false; // The CRLF after a chunk's data is still unread
+};
+
+class HaClient {
+public:
+  // `url` is HA_URL ("http://host:port"), with or without whitespace.
+  void begin(const char *url, const char *token) {
+    String host = url;
+    host.trim();
+    int scheme = host.indexOf("://");
+    if (scheme >= 0)
+      host = host.substring(scheme + 3);
+    int slash = host.indexOf('/');
+    if (slash >= 0)
+      host = host.substring(0, slash);
+    String hostHeader = host;
+    _port = 80;
+    int colon = host.indexOf(':');
+    if (colon >= 0) {
+      _port = host.substring(colon + 1).toInt();
+      host = host.substring(0, colon);
+    }
+    _host = host;
+    _headers = "Host: " + hostHeader + "\r\nAuthorization: Bearer " + token +
+               "\r\nConnection: keep-alive\r\n";
+  }
+
+  // POST /api/services/<domain>/<service> {"entity_id":"<id>"}, plus
+  // "<field>":<value> when `field` is set. Returns the HTTP status, or -1
+  // if HA could not be reached.
+  int callService(const char *domain, const char *service,
+                  const char *entityId, const char *field = NULL,
+                  int value = 0) {
+    char path[96];
+    snprintf(path, sizeof(path), "/api/services/%s/%s", domain, service);
+    char body[160];
+    int len = snprintf(body, sizeof(body), "{\"entity_id\":\"%s\"", entityId);
+    if (field)
+      len += snprintf(body + len, sizeof(body) - len, ",\"%s\":%d", field,
+                      value);
+    len += snprintf(body + len, sizeof(body) - len, "}");
+    int code = request("POST", path, body, len);
+    end();
+    return code;
+  }
+
+  // GET `path`. The body is read from body() before calling end().
+  int get(const char *path) { return request("GET", path, NULL, 0); }
+  // POST `path` with a JSON body; the response is read as for get().
+  int post(const char *path, const char *body, int len) {
+    return request("POST", path, body, len);
+  }
+  Stream &body() { return _body; }
+
+  // Skips what is left of the body and keeps the connection for the next
+  // request, or closes it when that is not possible.
+  void end() {
+    if (_body.left() > 0) {
+      while (_body.read() >= 0) {
+      }
+    }
+    if (!_keepAlive || _body.left() != 0)
+      _sock.stop();
+    _body.begin(NULL, 0);
+    if (_t0) {
+      record(millis() - _t0);
+      _t0 = 0;
+    }
+  }
+
+  // Mean and 99th percentile of the last HA_CLIENT_SAMPLES requests, from
+  // sending the request to end(), in ms.
+  void stats(uint32_t &mean, uint32_t &p99) const {
+    uint8_t n = std::min<uint32_t>(_samples, HA_CLIENT_SAMPLES);
+    uint16_t sorted[HA_CLIENT_SAMPLES];
+    uint32_t sum = 0;
+    for (uint8_t i = 0; i < n; i++)
+      sum += sorted[i] = _latency[i];
+    std::sort(sorted, sorted + n);
+    mean = n ? sum / n : 0;
+    p99 = n ? sorted[(n * 99 + 99) / 100 - 1] : 0;
+  }
+  uint32_t connects() const { return _connects; }
+
+private:
+  int request(const char *method, const char *path, const char *body,
+              int len) {
+    uint32_t t0 = millis();
+    int n = snprintf(_buf, sizeof(_buf), "%s %s HTTP/1.1\r\n%s", method, path,
+                     _headers.c_str());
+    if (body)
+      n += snprintf(_buf + n, sizeof(_buf) - n,
+                    "Content-Type: application/json\r\n"
+                    "Content-Length: %d\r\n",
+                    len);
+    n += snprintf(_buf + n, sizeof(_buf) - n, "\r\n");
+    if (body && n + len < (int)sizeof(_buf)) {
+      memcpy(_buf + n, body, len);
+      n += len;
+      body = NULL;
+    }
+    if (n >= (int)sizeof(_buf))
+      return -1;
+
+    bool safe = strcmp(method, "GET") == 0;
+    for (int attempt = 0; attempt < 2; attempt++) {
+      bool reused = _sock.connected();
+      if (!reused) {
+        if (!_sock.connect(_host.c_str(), _port, HA_CLIENT_TIMEOUT))
+          return -1;
+        _sock.setNoDelay(true);
+        _connects++;
+      }
+      bool written = _sock.write((const uint8_t *)_buf, n) == (size_t)n;
+      if (written && body)
+        written = _sock.write((const uint8_t *)body, len) == (size_t)len;
+      int code = written ? readHead() : -1;
+      if (code > 0) {
+        _t0 = t0;
+        return code;
+      }
+      _sock.stop();
+      if (!reused || (written && !safe))
+        break; // A fresh connection failed too, or HA may have acted
+    }
+    return -1;
+  }
+
+  // Status line and headers; sets up _body for the rest.
+  int readHead() {
+    _body.begin(&_sock, -1);
+    int code = -1;
+    int32_t length = -1;
+    bool chunked = false;
+    _keepAlive = true;
+    char line[128];
+    for (bool first = true;; first = false) {
+      if (!_body.readLine(line, sizeof(line)))
+        return -1;
+      if (first) {
+        if (strncmp(line, "HTTP/1.", 7) != 0)
+          return -1;
+        code = atoi(line + 9);
+        _keepAlive = line[7] == '1';
+      } else if (line[0] == '\0') {
+        break;
+      } else if (strncasecmp(line, "Content-Length:", 15) == 0) {
+        length = atol(line + 15);
+      } else if (strncasecmp(line, "Connection:", 11) == 0) {
+        _keepAlive = strstr(line + 11, "close") == NULL;
+      } else if (strncasecmp(line, "Transfer-Encoding:", 18) == 0) {
+        chunked = strstr(line + 18, "chunked") != NULL;
+      }
+    }
+    if (chunked) {
+      _body.begin(&_sock, 0, true);
+    } else {
+      if (length < 0)
+        _keepAlive = false; // Read until close
+      _body.begin(&_sock, length);
+    }
+    return code;
+  }
+
+  void record(uint32_t ms) {
+    _latency[_samples++ % HA_CLIENT_SAMPLES] = std::min<uint32_t>(ms, 0xFFFF);
+  }
+
+  WiFiClient _sock;
+  HaBody _body;
+  String _host;
+  uint16_t _port = 80;
+  String _headers;
+  bool _keepAlive = false;
+  char _buf[HA_CLIENT_BUF];
+  uint16_t _latency[HA_CLIENT_SAMPLES];
+  uint32_t _samples = 0;
+  uint32_t _t0 = 0;
+  uint32_t _connects = 0;
+};
+
+#endif
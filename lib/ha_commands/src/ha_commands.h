@@ -0,0 +1,234 @@
+#ifndef HA_COMMANDS_H
+#define HA_COMMANDS_H
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#endif
+#include <stdint.h>
+#include <string.h>
+
+// Service calls leave the LVGL callbacks through a queue drained by a
+// network task on core 0 (loop() and LVGL run on core 1).
+//
+// Pending commands are coalesced per entity: a second post for an entity
+// that has not been sent yet replaces the service of the first (last writer
+// wins) and keeps its place in line; different entities go out in the
+// order they were first posted. Two pending toggles cancel out. Results
+// come back to loop() through poll(), carrying the caller's handle of the
+// entity and the state it had before the first coalesced command, so a
+// failed call can be rolled back. No widget pointer is kept: a page may be
+// deleted while its command waits, so loop() finds what to redraw from the
+// handle (EntityStore + bindings). A command may carry one numeric service
+// field (brightness_pct, position); a coalesced command takes the newest
+// value.
+//
+// While the worker is offline commands stay queued (up to HA_CMD_SLOTS
+// entities) and go out once it is back online. HaCommandQueue is plain
+// C++ and also builds on the host (pio test -e native); the FreeRTOS
+// worker only on the device.
+
+#define HA_CMD_SLOTS 8
+#define HA_CMD_ID_LEN 48
+
+struct HaCommand {
+  const char *domain; // String literals
+  const char *service;
+  char entity[HA_CMD_ID_LEN];
+  int16_t handle;    // Caller's entity handle, rolled back on failure; -1
+  int8_t rollback;   // State to restore
+  const char *field; // Service data key, a literal; NULL for none
+  int16_t value;
+};
+
+struct HaResult {
+  HaCommand cmd;
+  int code;        // HTTP status, or < 0 when HA was not reached
+  bool superseded; // A newer command for the entity is already queued
+};
+
+class HaCommandQueue {
+public:
+  bool post(const char *domain, const char *service, const char *entity,
+            int16_t handle, int8_t rollback, const char *field = NULL,
+            int16_t value = 0) {
+    for (uint8_t i = 0; i < _count; i++) {
+      if (strcmp(_slots[i].entity, entity) == 0) {
+        if (strcmp(service, "toggle") == 0 &&
+            strcmp(_slots[i].service, "toggle") == 0) {
+          memmove(_slots + i, _slots + i + 1,
+                  (--_count - i) * sizeof(HaCommand));
+          return true;
+        }
+        _slots[i].domain = domain;
+        _slots[i].service = service;
+        _slots[i].field = field;
+        _slots[i].value = value;
+        return true;
+      }
+    }
+    if (_count >= HA_CMD_SLOTS)
+      return false;
+    // Behind a call in flight, restore what was there before that one
+    if (_busy && strcmp(_inflight.entity, entity) == 0)
+      rollback = _inflight.rollback;
+    HaCommand &c = _slots[_count++];
+    c.domain = domain;
+    c.service = service;
+    strncpy(c.entity, entity, sizeof(c.entity) - 1);
+    c.entity[sizeof(c.entity) - 1] = '\0';
+    c.handle = handle;
+    c.rollback = rollback;
+    c.field = field;
+    c.value = value;
+    return true;
+  }
+
+  // Moves the oldest command in flight.
+  bool take(HaCommand &out) {
+    if (_count == 0)
+      return false;
+    out = _inflight = _slots[0];
+    memmove(_slots, _slots + 1, --_count * sizeof(HaCommand));
+    _busy = true;
+    return true;
+  }
+
+  // Ends the command in flight; true if it has been superseded.
+  bool finish() {
+    _busy = false;
+    for (uint8_t i = 0; i < _count; i++)
+      if (strcmp(_slots[i].entity, _inflight.entity) == 0)
+        return true;
+    return false;
+  }
+
+  uint8_t size() const { return _count; }
+
+private:
+  HaCommand _slots[HA_CMD_SLOTS];
+  uint8_t _count = 0;
+  HaCommand _inflight;
+  bool _busy = false;
+};
+
+#ifdef ARDUINO
+typedef int (*HaExecFn)(const HaCommand &cmd);
+typedef void (*HaResultFn)(const HaResult &result);
+// Background work on the worker task, cut into slices: a step returns true
+// while there is more to do.
+typedef bool (*HaJobStep)(void *arg);
+typedef void (*HaJobDone)(void *arg);
+
+class HaCommandWorker {
+public:
+  // `exec` runs on the worker task, `done` on whoever calls poll().
+  void begin(HaExecFn exec, HaResultFn done) {
+    _exec = exec;
+    _done = done;
+    _lock = xSemaphoreCreateMutex();
+    _results = xQueueCreate(HA_CMD_SLOTS, sizeof(HaResult));
+    xTaskCreatePinnedToCore(task, "ha_cmd", 6144, this, 1, &_task, 0);
+  }
+
+  // False when the queue is full; nothing was queued then.
+  bool post(const char *domain, const char *service, const char *entity,
+            int16_t handle = -1, int8_t rollback = 0,
+            const char *field = NULL, int16_t value = 0) {
+    xSemaphoreTake(_lock, portMAX_DELAY);
+    bool ok =
+        _queue.post(domain, service, entity, handle, rollback, field, value);
+    xSemaphoreGive(_lock);
+    if (ok)
+      xTaskNotifyGive(_task);
+    return ok;
+  }
+
+  // Holds the queue while offline, e.g. from the WiFi state callback.
+  void online(bool up) {
+    _online = up;
+    if (up && _task)
+      xTaskNotifyGive(_task);
+  }
+
+  // Runs `step` on the worker task, one slice between commands, until it
+  // returns false; then `done` runs from poll(). For long downloads that
+  // must not block loop() nor hold back the commands. One job at a time:
+  // false while another is pending. Its state belongs to the worker until
+  // `done` runs.
+  bool job(HaJobStep step, HaJobDone done, void *arg) {
+    xSemaphoreTake(_lock, portMAX_DELAY);
+    bool ok = !_jobStep && !_jobDone;
+    if (ok) {
+      _jobStep = step;
+      _jobDone = done;
+      _jobArg = arg;
+    }
+    xSemaphoreGive(_lock);
+    if (ok)
+      xTaskNotifyGive(_task);
+    return ok;
+  }
+
+  // Delivers finished commands and jobs; call from loop().
+  void poll() {
+    HaResult r;
+    while (xQueueReceive(_results, &r, 0) == pdTRUE)
+      _done(r);
+    HaJobDone done = NULL;
+    void *arg = NULL;
+    xSemaphoreTake(_lock, portMAX_DELAY);
+    if (!_jobStep && _jobDone) {
+      done = _jobDone;
+      arg = _jobArg;
+      _jobDone = NULL;
+    }
+    xSemaphoreGive(_lock);
+    if (done)
+      done(arg);
+  }
+
+private:
+  static void task(void *arg) { ((HaCommandWorker *)arg)->run(); }
+
+  void run() {
+    for (;;) {
+      // With a job running, wait one tick between slices so the idle task
+      // on this core still gets to run
+      ulTaskNotifyTake(pdTRUE, _online && _jobStep ? 1 : portMAX_DELAY);
+      HaResult r;
+      while (_online && take(r.cmd)) {
+        r.code = _exec(r.cmd);
+        xSemaphoreTake(_lock, portMAX_DELAY);
+        r.superseded = _queue.finish();
+        xSemaphoreGive(_lock);
+        xQueueSend(_results, &r, portMAX_DELAY);
+      }
+      if (_online && _jobStep && !_jobStep(_jobArg)) {
+        xSemaphoreTake(_lock, portMAX_DELAY);
+        _jobStep = NULL; // poll() runs _jobDone
+        xSemaphoreGive(_lock);
+      }
+    }
+  }
+
+  bool take(HaCommand &cmd) {
+    xSemaphoreTake(_lock, portMAX_DELAY);
+    bool ok = _queue.take(cmd);
+    xSemaphoreGive(_lock);
+    return ok;
+  }
+
+  HaCommandQueue _queue;
+  HaExecFn _exec = NULL;
+  HaResultFn _done = NULL;
+  SemaphoreHandle_t _lock = NULL;
+  QueueHandle_t _results = NULL;
+  TaskHandle_t _task = NULL;
+  volatile bool _online = true;
+  HaJobStep volatile _jobStep = NULL;
+  HaJobDone _jobDone = NULL;
+  void *_jobArg = NULL;
+};
+#endif
+
+#endif
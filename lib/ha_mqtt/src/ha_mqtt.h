@@ -0,0 +1,163 @@
+#ifndef HA_MQTT_H
+#define HA_MQTT_H
+
+#include <Arduino.h>
+#include <PubSubClient.h>
+#include <WiFiClient.h>
+
+// Home Assistant over MQTT, the alternative to REST + WebSocket for builds
+// with HA_TRANSPORT_MQTT=1.
+//
+// States come from HA's mqtt_statestream integration, which publishes each
+// state change to <prefix>/<domain>/<object_id>/state as the bare state
+// string, retained. Only the topics of the configured ids are subscribed,
+// so an update is a single PUBLISH of a few dozen bytes, and the retained
+// messages resync every entity on each (re)connect.
+//
+// Commands go to <cmd prefix>/<domain>/<object_id>/set with
+// "<domain>.<service>" as payload; an HA automation (see README) turns them
+// into service calls. They are QoS 0: a successful publish means the broker
+// took the command, not that HA ran it.
+//
+// loop() and command() may run on different tasks; a mutex keeps them from
+// using the client at the same time.
+
+#ifndef HA_MQTT_PORT
+#define HA_MQTT_PORT 1883
+#endif
+#ifndef HA_MQTT_STATE_PREFIX
+#define HA_MQTT_STATE_PREFIX "homeassistant/statestream"
+#endif
+#ifndef HA_MQTT_CMD_PREFIX
+#define HA_MQTT_CMD_PREFIX "delfin/cmd"
+#endif
+#define HA_MQTT_BACKOFF_MIN 1000
+#define HA_MQTT_BACKOFF_MAX 60000
+#define HA_MQTT_TOPIC_LEN 128
+#define HA_MQTT_STATE_LEN 64
+
+typedef void (*HaMqttCallback)(const char *entityId, const char *state);
+
+class HaMqtt {
+public:
+  // `user` may be NULL for brokers without auth. The strings and `ids`
+  // must outlive the client.
+  void begin(const char *server, const char *user, const char *pass,
+             const char *const *ids, uint8_t count, HaMqttCallback cb) {
+    _user = user;
+    _pass = pass;
+    _ids = ids;
+    _count = count;
+    _cb = cb;
+    // Low MAC bytes; the high ones are the vendor prefix
+    snprintf(_clientId, sizeof(_clientId), "delfin-%06lx",
+             (unsigned long)((ESP.getEfuseMac() >> 24) & 0xFFFFFF));
+    _lock = xSemaphoreCreateMutex();
+    _mqtt.setClient(_sock);
+    _mqtt.setServer(server, HA_MQTT_PORT);
+    _mqtt.setCallback([this](char *topic, uint8_t *payload, unsigned int len) {
+      onMessage(topic, payload, len);
+    });
+  }
+
+  void loop() {
+    xSemaphoreTake(_lock, portMAX_DELAY);
+    if (!_mqtt.loop()) {
+      if (_ready)
+        Serial.printf("HA mqtt: disconnected (%d)\n", _mqtt.state());
+      _ready = false;
+      if (millis() - _lastTry >= _backoff) {
+        _lastTry = millis();
+        connect();
+      }
+    }
+    xSemaphoreGive(_lock);
+  }
+
+  // Publishes a service call for `entityId`; false when it was not sent.
+  bool command(const char *domain, const char *service,
+               const char *entityId) {
+    char topic[HA_MQTT_TOPIC_LEN];
+    char payload[64];
+    if (!topicFor(topic, HA_MQTT_CMD_PREFIX, entityId, "set"))
+      return false;
+    snprintf(payload, sizeof(payload), "%s.%s", domain, service);
+    xSemaphoreTake(_lock, portMAX_DELAY);
+    bool ok = _ready && _mqtt.publish(topic, payload);
+    xSemaphoreGive(_lock);
+    return ok;
+  }
+
+  // True while connected and subscribed to every state topic
+  bool ready() const { return _ready; }
+  uint32_t bytesReceived() const { return _bytes; }
+  uint32_t updates() const { return _updates; }
+
+private:
+  void connect() {
+    if (!_mqtt.connect(_clientId, _user, _pass)) {
+      _backoff = min(_backoff * 2, (unsigned long)HA_MQTT_BACKOFF_MAX);
+      Serial.printf("HA mqtt: connect failed (%d), retry in %lu ms\n",
+                    _mqtt.state(), _backoff);
+      return;
+    }
+    bool ok = true;
+    char topic[HA_MQTT_TOPIC_LEN];
+    for (uint8_t i = 0; i < _count; i++)
+      ok = topicFor(topic, HA_MQTT_STATE_PREFIX, _ids[i], "state") &&
+           _mqtt.subscribe(topic) && ok;
+    _ready = ok;
+    _backoff = HA_MQTT_BACKOFF_MIN;
+    Serial.printf("HA mqtt: subscribe %s\n", ok ? "ok" : "failed");
+  }
+
+  // <prefix>/<domain>/<object_id>/<leaf> for "<domain>.<object_id>"
+  static bool topicFor(char *out, const char *prefix, const char *id,
+                       const char *leaf) {
+    int n = snprintf(out, HA_MQTT_TOPIC_LEN, "%s/%s/%s", prefix, id, leaf);
+    char *dot = strchr(out + strlen(prefix) + 1, '.');
+    if (n >= HA_MQTT_TOPIC_LEN || !dot)
+      return false;
+    *dot = '/';
+    return true;
+  }
+
+  void onMessage(char *topic, uint8_t *payload, unsigned int len) {
+    // Fixed header and topic length prefix, as sent for short messages
+    _bytes += 4 + strlen(topic) + len;
+    size_t plen = strlen(HA_MQTT_STATE_PREFIX);
+    if (strncmp(topic, HA_MQTT_STATE_PREFIX, plen) != 0 || topic[plen] != '/')
+      return;
+    char id[HA_MQTT_TOPIC_LEN];
+    strlcpy(id, topic + plen + 1, sizeof(id));
+    char *dot = strchr(id, '/');
+    char *leaf = strrchr(id, '/');
+    if (!dot || leaf == dot || strcmp(leaf, "/state") != 0)
+      return;
+    *dot = '.';
+    *leaf = '\0';
+    char state[HA_MQTT_STATE_LEN];
+    len = min(len, (unsigned int)sizeof(state) - 1);
+    memcpy(state, payload, len);
+    state[len] = '\0';
+    _updates++;
+    _cb(id, state);
+  }
+
+  WiFiClient _sock;
+  PubSubClient _mqtt;
+  SemaphoreHandle_t _lock = NULL;
+  char _clientId[16];
+  const char *_user = NULL;
+  const char *_pass = NULL;
+  const char *const *_ids = NULL;
+  uint8_t _count = 0;
+  HaMqttCallback _cb = NULL;
+  unsigned long _backoff = HA_MQTT_BACKOFF_MIN;
+  unsigned long _lastTry = 0;
+  bool _ready = false;
+  uint32_t _bytes = 0;
+  uint32_t _updates = 0;
+};
+
+#endif
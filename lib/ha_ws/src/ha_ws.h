@@ -0,0 +1,159 @@
+#ifndef HA_WS_H
+#define HA_WS_H
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include <WebSocketsClient.h>
+
+// Home Assistant WebSocket API client. After auth it sends a single
+// subscribe_entities for the configured ids; HA answers with the full state
+// of each ("a") and from then on pushes only what changed ("c"), so the
+// panel stops polling while the socket is up.
+//
+// The subscription is re-sent on every reconnect, and its first event
+// carries every entity again, so a reconnect is also a full resync.
+// Reconnects back off from HA_WS_BACKOFF_MIN to HA_WS_BACKOFF_MAX.
+
+#define HA_WS_BACKOFF_MIN 1000
+#define HA_WS_BACKOFF_MAX 60000
+
+typedef void (*HaStateCallback)(const char *entityId, const char *state);
+
+class HaWebSocket {
+public:
+  // `url` is HA_URL ("http://host:port"); `ids` must outlive the client.
+  void begin(const char *url, const char *token, const char *const *ids,
+             uint8_t count, HaStateCallback cb) {
+    _token = token;
+    _cb = cb;
+
+    DynamicJsonDocument req(JSON_OBJECT_SIZE(3) + JSON_ARRAY_SIZE(count));
+    req["id"] = 1;
+    req["type"] = "subscribe_entities";
+    JsonArray list = req.createNestedArray("entity_ids");
+    for (uint8_t i = 0; i < count; i++)
+      list.add(ids[i]);
+    serializeJson(req, _subscribe);
+
+    // Only the state of each entity is kept; attributes and contexts are
+    // dropped while parsing. Strings point into the frame (zero-copy).
+    _filter["type"] = true;
+    _filter["success"] = true;
+    _filter["event"]["a"]["*"]["s"] = true;
+    _filter["event"]["c"]["*"]["+"]["s"] = true;
+    _filter["event"]["r"] = true;
+    _doc = new DynamicJsonDocument(JSON_OBJECT_SIZE(4) + JSON_OBJECT_SIZE(3) +
+                                   2 * JSON_OBJECT_SIZE(count) +
+                                   JSON_ARRAY_SIZE(count) +
+                                   count * 3 * JSON_OBJECT_SIZE(1));
+
+    String host = url;
+    host.trim();
+    uint16_t port = 80;
+    int scheme = host.indexOf("://");
+    if (scheme >= 0)
+      host = host.substring(scheme + 3);
+    int slash = host.indexOf('/');
+    if (slash >= 0)
+      host = host.substring(0, slash);
+    int colon = host.indexOf(':');
+    if (colon >= 0) {
+      port = host.substring(colon + 1).toInt();
+      host = host.substring(0, colon);
+    }
+
+    _ws.onEvent([this](WStype_t type, uint8_t *payload, size_t len) {
+      onEvent(type, payload, len);
+    });
+    _ws.setReconnectInterval(_backoff);
+    _ws.enableHeartbeat(15000, 3000, 2);
+    _ws.begin(host, port, "/api/websocket");
+  }
+
+  void loop() { _ws.loop(); }
+
+  // True once HA has accepted the subscription on the current connection
+  bool ready() const { return _subscribed; }
+  uint32_t bytesReceived() const { return _bytes; }
+  uint32_t updates() const { return _updates; }
+
+private:
+  void onEvent(WStype_t type, uint8_t *payload, size_t len) {
+    switch (type) {
+    case WStype_ERROR:
+    case WStype_DISCONNECTED:
+      if (_subscribed || _connected)
+        Serial.printf("HA ws: disconnected, retry in %lu ms\n", _backoff);
+      _subscribed = _connected = false;
+      _backoff = min(_backoff * 2, (unsigned long)HA_WS_BACKOFF_MAX);
+      _ws.setReconnectInterval(_backoff);
+      break;
+    case WStype_CONNECTED:
+      _connected = true;
+      break;
+    case WStype_TEXT:
+      _bytes += len;
+      onMessage((char *)payload, len);
+      break;
+    default:
+      break;
+    }
+  }
+
+  void onMessage(char *payload, size_t len) {
+    DeserializationError err = deserializeJson(
+        *_doc, payload, len, DeserializationOption::Filter(_filter));
+    if (err) {
+      Serial.printf("HA ws: %s\n", err.c_str());
+      return;
+    }
+    const char *type = (*_doc)["type"] | "";
+    if (strcmp(type, "event") == 0) {
+      JsonObjectConst ev = (*_doc)["event"];
+      for (JsonPairConst kv : ev["a"].as<JsonObjectConst>())
+        apply(kv.key().c_str(), kv.value()["s"]);
+      for (JsonPairConst kv : ev["c"].as<JsonObjectConst>())
+        apply(kv.key().c_str(), kv.value()["+"]["s"]);
+      for (JsonVariantConst id : ev["r"].as<JsonArrayConst>())
+        apply(id.as<const char *>(), "unavailable");
+    } else if (strcmp(type, "auth_required") == 0) {
+      String auth = String("{\"type\":\"auth\",\"access_token\":\"") + _token +
+                    "\"}";
+      _ws.sendTXT(auth);
+    } else if (strcmp(type, "auth_ok") == 0) {
+      _backoff = HA_WS_BACKOFF_MIN;
+      _ws.setReconnectInterval(_backoff);
+      _ws.sendTXT(_subscribe);
+    } else if (strcmp(type, "auth_invalid") == 0) {
+      Serial.println("HA ws: auth invalid, check HA_TOKEN");
+      _backoff = HA_WS_BACKOFF_MAX;
+      _ws.setReconnectInterval(_backoff);
+    } else if (strcmp(type, "result") == 0) {
+      _subscribed = (*_doc)["success"] | false;
+      Serial.printf("HA ws: subscribe %s\n", _subscribed ? "ok" : "failed");
+    }
+  }
+
+  // Changes that only touch attributes carry no "s"
+  void apply(const char *id, const char *state) {
+    if (!id || !state)
+      return;
+    _updates++;
+    _cb(id, state);
+  }
+
+  WebSocketsClient _ws;
+  const char *_token = NULL;
+  HaStateCallback _cb = NULL;
+  String _subscribe;
+  StaticJsonDocument<2 * JSON_OBJECT_SIZE(3) + 5 * JSON_OBJECT_SIZE(1)>
+      _filter;
+  DynamicJsonDocument *_doc = NULL;
+  unsigned long _backoff = HA_WS_BACKOFF_MIN;
+  bool _connected = false;
+  bool _subscribed = false;
+  uint32_t _bytes = 0;
+  uint32_t _updates = 0;
+};
+
+#endif
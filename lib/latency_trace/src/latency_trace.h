@@ -0,0 +1,198 @@
+#ifndef LATENCY_TRACE_H
+#define LATENCY_TRACE_H
+
+// Touch-to-photon latency and frame rate, built in with -DLATENCY_TRACE=1
+// (env "trace"). Each press is timestamped in the touch read and followed
+// through three marks, each kept as a histogram from the press:
+//
+//   dispatch  LVGL sends LV_EVENT_PRESSED (indev feedback_cb)
+//   render    the next frame's last area is in the canvas (my_disp_flush)
+//   photon    gfx->flush() has sent that frame to the panel
+//
+// Every LAT_REPORT_MS a line goes to serial, and to a HUD on the top layer
+// unless LATENCY_HUD is 0:
+//
+//   LAT {"ui":"ha_control","fps":24,"presses":31,"missed":2,
+//        "dispatch_us":[310,820,1400],"render_us":[...],"photon_us":[...]}
+//
+// Arrays are p50/p95/p99 since boot, within 12.5 %. A press that LVGL
+// does not dispatch, or that shows nothing within LAT_TIMEOUT_US, counts
+// as missed. fps counts frames sent to the panel, the HUD's own update
+// included.
+//
+// Without LATENCY_TRACE the LAT_* hooks are empty and nothing is compiled.
+
+#if LATENCY_TRACE
+#include <Arduino.h>
+#include <lvgl.h>
+
+#ifndef LATENCY_HUD
+#define LATENCY_HUD 1
+#endif
+#define LAT_REPORT_MS 2000
+#define LAT_TIMEOUT_US 1000000
+#define LAT_SUB 8                  // Buckets per power of two
+#define LAT_BUCKETS (LAT_SUB * 23) // Up to 16 s in us
+
+// Log-linear histogram of microseconds
+class LatHist {
+public:
+  void add(uint32_t us) {
+    uint16_t b = bucket(us);
+    if (_n[b] < UINT16_MAX)
+      _n[b]++;
+    _count++;
+  }
+
+  // Upper bound of the bucket holding the p-th percentile, 0 when empty
+  uint32_t pct(uint8_t p) const {
+    uint32_t want = (_count * p + 99) / 100, seen = 0;
+    for (uint16_t b = 0; b < LAT_BUCKETS && want; b++) {
+      seen += _n[b];
+      if (seen >= want)
+        return upper(b);
+    }
+    return 0;
+  }
+
+  uint32_t count() const { return _count; }
+
+private:
+  static uint16_t bucket(uint32_t us) {
+    if (us < LAT_SUB)
+      return us;
+    uint8_t msb = 31 - __builtin_clz(us);
+    uint16_t b = (msb - 2) * LAT_SUB + ((us >> (msb - 3)) & (LAT_SUB - 1));
+    return b < LAT_BUCKETS ? b : LAT_BUCKETS - 1;
+  }
+
+  static uint32_t upper(uint16_t b) {
+    if (b < LAT_SUB)
+      return b;
+    uint8_t shift = b / LAT_SUB - 1;
+    return ((LAT_SUB + b % LAT_SUB + 1) << shift) - 1;
+  }
+
+  uint16_t _n[LAT_BUCKETS] = {0};
+  uint32_t _count = 0;
+};
+
+class LatencyTrace {
+public:
+  void begin(const char *ui) {
+    _ui = ui;
+    _since = millis();
+#if LATENCY_HUD
+    _hud = lv_label_create(lv_layer_top());
+    lv_obj_set_style_bg_color(_hud, lv_color_black(), 0);
+    lv_obj_set_style_bg_opa(_hud, LV_OPA_70, 0);
+    lv_obj_set_style_text_color(_hud, lv_color_hex(0x00FF00), 0);
+    lv_obj_set_style_pad_hor(_hud, 4, 0);
+    lv_obj_align(_hud, LV_ALIGN_TOP_RIGHT, 0, 0);
+    lv_label_set_text(_hud, "-- fps");
+#endif
+  }
+
+  // From the touch read, on every call; `us` is when the touch was seen
+  void touch(uint32_t us, bool pressed) {
+    if (pressed && !_wasPressed && !_t0) {
+      _t0 = us | 1;
+      _stage = 0;
+    }
+    _wasPressed = pressed;
+  }
+
+  // From the indev feedback_cb, for each event LVGL sends
+  void dispatched(uint8_t code) {
+    if (_t0 && _stage == 0 && code == LV_EVENT_PRESSED) {
+      _dispatch.add(micros() - _t0);
+      _stage = 1;
+    }
+  }
+
+  // From the flush callback
+  void flushed(lv_disp_drv_t *disp) {
+    if (!lv_disp_flush_is_last(disp))
+      return;
+    _frame = true;
+    if (_t0 && _stage == 1) { // Not a frame already under way
+      _render.add(micros() - _t0);
+      _stage = 2;
+    }
+  }
+
+  // After gfx->flush(), once per loop
+  void presented() {
+    uint32_t now = micros();
+    if (_frame) {
+      _frames++;
+      if (_t0 && _stage == 2) {
+        _photon.add(now - _t0);
+        _t0 = 0;
+      }
+      _frame = false;
+    }
+    if (_t0 && now - _t0 > LAT_TIMEOUT_US) {
+      _missed++;
+      _t0 = 0;
+    }
+    if (millis() - _since >= LAT_REPORT_MS && !_t0)
+      report();
+  }
+
+private:
+  void report() {
+    uint32_t fps = _frames * 1000 / (millis() - _since);
+    Serial.printf("LAT {\"ui\":\"%s\",\"fps\":%lu,\"presses\":%lu,"
+                  "\"missed\":%lu,\"dispatch_us\":[%lu,%lu,%lu],"
+                  "\"render_us\":[%lu,%lu,%lu],\"photon_us\":[%lu,%lu,%lu]}\n",
+                  _ui, (unsigned long)fps, (unsigned long)_photon.count(),
+                  (unsigned long)_missed, pct(_dispatch, 50),
+                  pct(_dispatch, 95), pct(_dispatch, 99), pct(_render, 50),
+                  pct(_render, 95), pct(_render, 99), pct(_photon, 50),
+                  pct(_photon, 95), pct(_photon, 99));
+#if LATENCY_HUD
+    lv_label_set_text_fmt(_hud, "%lu fps  %lu/%lu/%lu ms", (unsigned long)fps,
+                          pct(_photon, 50) / 1000, pct(_photon, 95) / 1000,
+                          pct(_photon, 99) / 1000);
+#endif
+    _frames = 0;
+    _since = millis();
+  }
+
+  static unsigned long pct(const LatHist &h, uint8_t p) { return h.pct(p); }
+
+  const char *_ui = "";
+  LatHist _dispatch, _render, _photon;
+  uint32_t _t0 = 0; // Press being followed, 0 for none
+  uint8_t _stage = 0;
+  bool _wasPressed = false;
+  bool _frame = false; // A frame reached the canvas since the last flush
+  uint32_t _frames = 0;
+  uint32_t _missed = 0;
+  uint32_t _since = 0;
+#if LATENCY_HUD
+  lv_obj_t *_hud = NULL;
+#endif
+};
+
+extern LatencyTrace latTrace;
+
+#define LAT_BEGIN(ui) latTrace.begin(ui)
+#define LAT_TOUCH(us, pressed) latTrace.touch(us, pressed)
+#define LAT_INDEV(drv) (drv).feedback_cb = latFeedback
+#define LAT_FLUSHED(disp) latTrace.flushed(disp)
+#define LAT_PRESENTED() latTrace.presented()
+
+inline void latFeedback(lv_indev_drv_t *, uint8_t code) {
+  latTrace.dispatched(code);
+}
+#else
+#define LAT_BEGIN(ui)
+#define LAT_TOUCH(us, pressed)
+#define LAT_INDEV(drv)
+#define LAT_FLUSHED(disp)
+#define LAT_PRESENTED()
+#endif
+
+#endif
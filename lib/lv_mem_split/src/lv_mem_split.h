@@ -0,0 +1,185 @@
+#ifndef LV_MEM_SPLIT_H
+#define LV_MEM_SPLIT_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// LVGL allocator that splits by size. Blocks under LV_SPLIT_LARGE (widgets,
+// styles, labels: the hot objects) come from a TLSF pool of
+// LV_SPLIT_SRAM_SIZE in internal SRAM; larger ones (images, layer and chart
+// buffers) go to PSRAM. Each side falls back to the other when full.
+//
+// Enabled from platformio.ini with LV_MEM_CUSTOM=1 and LV_MEM_CUSTOM_ALLOC /
+// _FREE / _REALLOC set to the functions below; lv_mem.c includes this file
+// for the declarations. Without those flags LVGL keeps its own pool of
+// LV_MEM_SIZE and lvMemReport() reads that instead.
+//
+// The pool is an ESP-IDF multi_heap over a static buffer (TLSF since IDF
+// 4.3): LVGL's own TLSF is only compiled in with LV_MEM_CUSTOM=0. One file,
+// main.cpp, defines LV_SPLIT_IMPLEMENTATION before including this header.
+
+#ifndef LV_SPLIT_SRAM_SIZE
+#define LV_SPLIT_SRAM_SIZE (48 * 1024)
+#endif
+#ifndef LV_SPLIT_LARGE
+#define LV_SPLIT_LARGE 1024
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+void *lv_split_alloc(size_t size);
+void lv_split_free(void *p);
+void *lv_split_realloc(void *p, size_t size);
+#ifdef __cplusplus
+}
+#endif
+
+#ifdef __cplusplus
+#include <lvgl.h>
+
+struct LvMemReport {
+  uint32_t size;    // Internal pool
+  uint32_t used;
+  uint32_t free;
+  uint32_t biggest; // Largest free block
+  uint8_t usedPct;
+  uint8_t fragPct;  // 100 - biggest / free, as lv_mem_monitor()
+  uint32_t psram;   // Bytes LVGL holds in PSRAM
+  uint32_t spilled; // Small blocks that found the pool full
+  uint32_t failed;  // Allocations neither side could serve
+};
+
+void lvMemReport(LvMemReport &r);
+
+#ifdef LV_SPLIT_IMPLEMENTATION
+#if LV_MEM_CUSTOM
+#include <esp_heap_caps.h>
+#include <multi_heap.h>
+#include <string.h>
+
+// PSRAM blocks carry their size in front, keeping 8-byte alignment
+#define LV_SPLIT_HEADER 8
+
+static uint8_t lvSplitPool[LV_SPLIT_SRAM_SIZE] __attribute__((aligned(8)));
+static multi_heap_handle_t lvSplitHeap = NULL;
+static uint32_t lvSplitPsram = 0;
+static uint32_t lvSplitSpilled = 0;
+static uint32_t lvSplitFailed = 0;
+
+// lv_init() allocates before setup() could set anything up
+static multi_heap_handle_t lvSplitSram() {
+  if (!lvSplitHeap)
+    lvSplitHeap = multi_heap_register(lvSplitPool, sizeof(lvSplitPool));
+  return lvSplitHeap;
+}
+
+static bool lvSplitOwns(const void *p) {
+  return (const uint8_t *)p >= lvSplitPool &&
+         (const uint8_t *)p < lvSplitPool + sizeof(lvSplitPool);
+}
+
+static void *lvSplitPsramAlloc(size_t size) {
+  uint8_t *b = (uint8_t *)heap_caps_malloc(size + LV_SPLIT_HEADER,
+                                           MALLOC_CAP_SPIRAM);
+  if (!b)
+    return NULL;
+  *(uint32_t *)b = size;
+  lvSplitPsram += size;
+  return b + LV_SPLIT_HEADER;
+}
+
+static uint32_t lvSplitSize(void *p) {
+  if (lvSplitOwns(p))
+    return multi_heap_get_allocated_size(lvSplitSram(), p);
+  return *(uint32_t *)((uint8_t *)p - LV_SPLIT_HEADER);
+}
+
+extern "C" void *lv_split_alloc(size_t size) {
+  void *p;
+  if (size < LV_SPLIT_LARGE) {
+    p = multi_heap_malloc(lvSplitSram(), size);
+    if (!p && (p = lvSplitPsramAlloc(size)))
+      lvSplitSpilled++;
+  } else {
+    p = lvSplitPsramAlloc(size);
+    if (!p)
+      p = multi_heap_malloc(lvSplitSram(), size); // Boards without PSRAM
+  }
+  if (!p)
+    lvSplitFailed++;
+  return p;
+}
+
+extern "C" void lv_split_free(void *p) {
+  if (!p)
+    return;
+  if (lvSplitOwns(p)) {
+    multi_heap_free(lvSplitSram(), p);
+    return;
+  }
+  uint8_t *b = (uint8_t *)p - LV_SPLIT_HEADER;
+  lvSplitPsram -= *(uint32_t *)b;
+  heap_caps_free(b);
+}
+
+extern "C" void *lv_split_realloc(void *p, size_t size) {
+  if (!p)
+    return lv_split_alloc(size);
+  bool large = size >= LV_SPLIT_LARGE;
+  // Grow or shrink in place while the block stays on its side
+  if (lvSplitOwns(p) && !large) {
+    void *q = multi_heap_realloc(lvSplitSram(), p, size);
+    if (q)
+      return q;
+  } else if (!lvSplitOwns(p) && large) {
+    uint8_t *b = (uint8_t *)p - LV_SPLIT_HEADER;
+    uint32_t old = *(uint32_t *)b;
+    b = (uint8_t *)heap_caps_realloc(b, size + LV_SPLIT_HEADER,
+                                     MALLOC_CAP_SPIRAM);
+    if (b) {
+      *(uint32_t *)b = size;
+      lvSplitPsram += size - old;
+      return b + LV_SPLIT_HEADER;
+    }
+  }
+  void *q = lv_split_alloc(size);
+  if (!q)
+    return NULL;
+  uint32_t old = lvSplitSize(p);
+  memcpy(q, p, old < size ? old : size);
+  lv_split_free(p);
+  return q;
+}
+
+void lvMemReport(LvMemReport &r) {
+  multi_heap_info_t info;
+  multi_heap_get_info(lvSplitSram(), &info);
+  r.free = info.total_free_bytes;
+  r.used = info.total_allocated_bytes;
+  r.size = r.free + r.used; // Less the heap's own overhead
+  r.biggest = info.largest_free_block;
+  r.usedPct = r.size ? r.used * 100 / r.size : 0;
+  r.fragPct = r.free ? 100 - r.biggest * 100 / r.free : 0;
+  r.psram = lvSplitPsram;
+  r.spilled = lvSplitSpilled;
+  r.failed = lvSplitFailed;
+}
+#else
+void lvMemReport(LvMemReport &r) {
+  lv_mem_monitor_t mon;
+  lv_mem_monitor(&mon);
+  r.size = mon.total_size;
+  r.free = mon.free_size;
+  r.used = mon.total_size - mon.free_size;
+  r.biggest = mon.free_biggest_size;
+  r.usedPct = mon.used_pct;
+  r.fragPct = mon.frag_pct;
+  r.psram = r.spilled = r.failed = 0;
+}
+#endif
+#endif
+
+#endif
+
+#endif
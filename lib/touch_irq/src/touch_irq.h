@@ -0,0 +1,215 @@
+#ifndef TOUCH_IRQ_H
+#define TOUCH_IRQ_H
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#include <lvgl.h>
+#endif
+#include <stdint.h>
+
+// Touch sampling driven by the controller's interrupt line. A small task
+// sleeps until the line falls, then reads the controller every
+// TOUCH_ACTIVE_MS while a finger is down and goes back to sleep on the
+// release, so an untouched screen costs no I2C traffic. Changes reach
+// LVGL as timestamped TouchEvents through a queue that the indev read
+// callback drains (TouchIrq::read()).
+//
+// The line is trusted once it has produced an edge; until then the task
+// polls every TOUCH_POLL_MS. A touch found by polling with no edge means
+// the line is not wired, and so does a line held low for TOUCH_STUCK_MS
+// while idle: both switch to polling for good, as does intPin -1.
+//
+// TouchSampler holds the decisions and no hardware, so a recorded trace
+// of edges and reads can be replayed through it off the board (pio test
+// -e native); TouchIrq, the task around it, only builds on the device.
+
+#define TOUCH_ACTIVE_MS 10  // Reads while touched
+#define TOUCH_POLL_MS 20    // Reads without a usable interrupt line
+#define TOUCH_STUCK_MS 1000 // Line low while idle before giving up on it
+#define TOUCH_QUEUE_LEN 16
+
+struct TouchEvent {
+  uint32_t us; // Interrupt edge, or the read for later samples
+  uint16_t x;
+  uint16_t y;
+  bool pressed;
+};
+
+// Result of a controller read: 1 touched (x, y set), 0 no touch, -1 error
+typedef int8_t (*TouchReadFn)(uint16_t &x, uint16_t &y);
+
+enum TouchMode : uint8_t { TOUCH_PROBE, TOUCH_IRQ, TOUCH_POLL };
+
+class TouchSampler {
+public:
+  void begin(bool irq) {
+    _mode = irq ? TOUCH_PROBE : TOUCH_POLL;
+    _active = true;
+  }
+
+  // A falling edge at `us`; the next read is timestamped with it.
+  void edge(uint32_t us) {
+    if (!_edge)
+      _edgeUs = us;
+    _edge = true;
+    _active = true;
+    if (_mode == TOUCH_PROBE)
+      _mode = TOUCH_IRQ;
+  }
+
+  // Feeds a read done at `now`. True with `ev` set when the touch went
+  // down, moved or went up. A bus error changes nothing.
+  bool sample(uint32_t now, int8_t res, uint16_t x, uint16_t y,
+              TouchEvent &ev) {
+    uint32_t t = _edge ? _edgeUs : now;
+    _edge = false;
+    if (res < 0)
+      return false;
+    bool down = res > 0;
+    if (down && _mode == TOUCH_PROBE)
+      _mode = TOUCH_POLL; // Touched and no edge: the line is not wired
+    if (!down && _mode == TOUCH_IRQ)
+      _active = false; // Back to waiting for the line
+    if (down == _down && (!down || (x == _x && y == _y)))
+      return false;
+    _down = down;
+    if (down) {
+      _x = x;
+      _y = y;
+    }
+    ev = {t, _x, _y, down};
+    return true;
+  }
+
+  void poll() {
+    _mode = TOUCH_POLL;
+    _active = true;
+  }
+
+  // ms until the next read, 0 to wait for an edge
+  uint32_t wait() const {
+    if (_mode != TOUCH_IRQ)
+      return TOUCH_POLL_MS;
+    return _active ? TOUCH_ACTIVE_MS : 0;
+  }
+
+  TouchMode mode() const { return _mode; }
+
+private:
+  TouchMode _mode = TOUCH_POLL;
+  bool _active = true;
+  bool _edge = false;
+  uint32_t _edgeUs = 0;
+  bool _down = false;
+  uint16_t _x = 0;
+  uint16_t _y = 0;
+};
+
+#ifdef ARDUINO
+class TouchIrq {
+public:
+  // `intPin` < 0 polls. Call after the controller is reset and Wire set up.
+  void begin(TouchReadFn read, int8_t intPin) {
+    _read = read;
+    _pin = intPin;
+    _events = xQueueCreate(TOUCH_QUEUE_LEN, sizeof(TouchEvent));
+    _sampler.begin(intPin >= 0);
+    xTaskCreatePinnedToCore(task, "touch", 3072, this, 2, &_task, 1);
+    if (intPin >= 0) {
+      pinMode(intPin, INPUT_PULLUP);
+      attachInterruptArg(intPin, onEdge, this, FALLING);
+    }
+  }
+
+  // From the LVGL indev read callback
+  void read(lv_indev_data_t *data) {
+    TouchEvent ev;
+    if (xQueueReceive(_events, &ev, 0) == pdTRUE) {
+      _last = ev;
+      data->continue_reading = uxQueueMessagesWaiting(_events) > 0;
+    }
+    data->state = _last.pressed ? LV_INDEV_STATE_PR : LV_INDEV_STATE_REL;
+    data->point.x = _last.x;
+    data->point.y = _last.y;
+  }
+
+  TouchMode mode() const { return _sampler.mode(); }
+  // Event last handed to LVGL
+  const TouchEvent &last() const { return _last; }
+  // I2C reads so far, and events dropped with a full queue
+  uint32_t reads() const { return _reads; }
+  uint32_t dropped() const { return _dropped; }
+
+private:
+  static void IRAM_ATTR onEdge(void *arg) {
+    TouchIrq *self = (TouchIrq *)arg;
+    self->_edgeUs = micros();
+    BaseType_t woken = pdFALSE;
+    vTaskNotifyGiveFromISR(self->_task, &woken);
+    if (woken)
+      portYIELD_FROM_ISR();
+  }
+
+  static void task(void *arg) { ((TouchIrq *)arg)->run(); }
+
+  void run() {
+    uint32_t lowSince = 0;
+    for (;;) {
+      uint32_t ms = _sampler.wait();
+      uint32_t wait = ms ? ms : TOUCH_STUCK_MS / 2;
+      if (ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(wait))) {
+        bool probing = _sampler.mode() == TOUCH_PROBE;
+        _sampler.edge(_edgeUs);
+        if (probing)
+          Serial.printf("Touch: interrupt on pin %d\n", _pin);
+      } else if (!ms) {
+        // Idle on the line: only its level is checked, no I2C
+        if (digitalRead(_pin) == HIGH)
+          lowSince = 0;
+        else if (!lowSince)
+          lowSince = millis() | 1;
+        else if (millis() - lowSince >= TOUCH_STUCK_MS)
+          polling("stuck low");
+        continue;
+      }
+      uint16_t x = 0, y = 0;
+      int8_t res = _read(x, y);
+      _reads++;
+      TouchMode was = _sampler.mode();
+      TouchEvent ev;
+      if (_sampler.sample(micros(), res, x, y, ev))
+        push(ev);
+      if (was == TOUCH_PROBE && _sampler.mode() == TOUCH_POLL)
+        polling("touch without an edge");
+    }
+  }
+
+  void polling(const char *why) {
+    detachInterrupt(_pin);
+    _sampler.poll();
+    Serial.printf("Touch: INT pin %d %s, polling\n", _pin, why);
+  }
+
+  // The oldest event goes when the UI falls behind
+  void push(const TouchEvent &ev) {
+    if (xQueueSend(_events, &ev, 0) != pdTRUE) {
+      TouchEvent old;
+      xQueueReceive(_events, &old, 0);
+      xQueueSend(_events, &ev, 0);
+      _dropped++;
+    }
+  }
+
+  TouchReadFn _read = NULL;
+  int8_t _pin = -1;
+  TouchSampler _sampler;
+  QueueHandle_t _events = NULL;
+  TaskHandle_t _task = NULL;
+  volatile uint32_t _edgeUs = 0;
+  TouchEvent _last = {0, 0, 0, false};
+  volatile uint32_t _reads = 0;
+  uint32_t _dropped = 0;
+};
+#endif
+
+#endif
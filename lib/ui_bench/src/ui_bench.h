@@ -0,0 +1,112 @@
+#ifndef UI_BENCH_H
+#define UI_BENCH_H
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#define UI_BENCH_PRINTF Serial.printf
+#else
+#include <chrono>
+#include <stdio.h>
+#define UI_BENCH_PRINTF printf
+#endif
+#include <lvgl.h>
+
+// Scripted render benchmark, built into the firmware with -DUI_BENCH=1
+// (env "bench"). After the UI is created each case repeats one action
+// (tab switch, label update, ...) UI_BENCH_ROUNDS times and renders it at
+// once with lv_refr_now(), so no touch or HA is needed. One JSON line per
+// case goes to serial:
+//
+//   BENCH {"ui":"ha_control","case":"tab_switch","frames":20,
+//          "step_us":850,"mean_us":5200,"max_us":9100,"px":102400,
+//          "flushes":7}
+//
+// step_us is the action itself (building a page, formatting a label),
+// mean_us and max_us the frame: layout, render and my_disp_flush() into
+// the canvas, not the transfer to the panel. px and flushes are per frame.
+// "BENCH end" closes the run; tools/ui_bench.py collects and compares runs.
+//
+// The same cases also run on the host against a memory-backed display
+// (sunton_ha_control, pio test -e native -f test_ui_bench), printing to
+// stdout.
+
+#define UI_BENCH_ROUNDS 20
+
+typedef void (*UiBenchStep)(uint16_t round);
+
+// One case, as printed
+struct UiBenchCase {
+  uint32_t stepUs;
+  uint32_t meanUs;
+  uint32_t maxUs;
+  uint32_t px;
+  uint32_t flushes;
+};
+
+class UiBench {
+public:
+  void begin(const char *ui) {
+    _ui = ui;
+    lv_refr_now(NULL); // Leave the start-up frame out
+  }
+
+  // From the display flush callback
+  void flushed(const lv_area_t *area) {
+    _px += lv_area_get_size(area);
+    _flushes++;
+  }
+
+  void run(const char *name, UiBenchStep step,
+           uint16_t rounds = UI_BENCH_ROUNDS) {
+    uint32_t stepUs = 0, frameUs = 0, worst = 0;
+    uint64_t px = 0, flushes = 0;
+    for (uint16_t i = 0; i < rounds; i++) {
+      uint32_t t0 = now();
+      step(i);
+      uint32_t t1 = now();
+      _px = _flushes = 0;
+      lv_refr_now(NULL);
+      uint32_t dt = now() - t1;
+      stepUs += t1 - t0;
+      frameUs += dt;
+      worst = dt > worst ? dt : worst;
+      px += _px;
+      flushes += _flushes;
+    }
+    _last.stepUs = stepUs / rounds;
+    _last.meanUs = frameUs / rounds;
+    _last.maxUs = worst;
+    _last.px = px / rounds;
+    _last.flushes = flushes / rounds;
+    UI_BENCH_PRINTF("BENCH {\"ui\":\"%s\",\"case\":\"%s\",\"frames\":%u,"
+                    "\"step_us\":%lu,\"mean_us\":%lu,\"max_us\":%lu,"
+                    "\"px\":%lu,\"flushes\":%lu}\n",
+                    _ui, name, rounds, (unsigned long)_last.stepUs,
+                    (unsigned long)_last.meanUs, (unsigned long)_last.maxUs,
+                    (unsigned long)_last.px, (unsigned long)_last.flushes);
+  }
+
+  void end() { UI_BENCH_PRINTF("BENCH end\n"); }
+
+  // The case run last
+  const UiBenchCase &last() const { return _last; }
+
+private:
+  static uint32_t now() {
+#ifdef ARDUINO
+    return micros();
+#else
+    using namespace std::chrono;
+    return (uint32_t)duration_cast<microseconds>(
+               steady_clock::now().time_since_epoch())
+        .count();
+#endif
+  }
+
+  const char *_ui = "";
+  uint32_t _px = 0;
+  uint32_t _flushes = 0;
+  UiBenchCase _last = {0, 0, 0, 0, 0};
+};
+
+#endif
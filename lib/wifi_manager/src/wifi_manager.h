@@ -0,0 +1,189 @@
+#ifndef WIFI_MANAGER_H
+#define WIFI_MANAGER_H
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#include <WiFi.h>
+#endif
+#include <stdint.h>
+#include <string.h>
+
+// Non-blocking WiFi station. loop() runs a small state machine driven by
+// the WiFi events (which only set flags, since they arrive on the event
+// task), so nothing ever waits for the link and the UI keeps rendering.
+//
+// The BSSID and channel of the last successful connection are kept, and a
+// reconnect goes straight to that AP without scanning. Failed attempts back
+// off from WIFI_BACKOFF_MIN to WIFI_BACKOFF_MAX; after WIFI_CACHE_TRIES of
+// them the cache is dropped and the next attempt scans again.
+//
+// The state machine is WifiLink, which drives a Radio:
+//
+//   void begin(const char *ssid, const char *pass);  // Scan
+//   void begin(const char *ssid, const char *pass, int32_t channel,
+//              const uint8_t *bssid);                // Cached AP
+//   void disconnect();
+//   const uint8_t *bssid();
+//   int32_t channel();
+//
+// WifiManager wires it to the ESP32 WiFi driver and millis(); the host
+// tests drive it with a simulated radio and clock.
+
+#define WIFI_CONNECT_TIMEOUT 10000
+#define WIFI_BACKOFF_MIN 1000
+#define WIFI_BACKOFF_MAX 30000
+#define WIFI_CACHE_TRIES 2
+
+#ifdef ARDUINO
+#define WIFI_LOG(...) Serial.printf(__VA_ARGS__)
+#else
+#define WIFI_LOG(...)
+#endif
+
+enum WifiState : uint8_t { WIFI_OFFLINE, WIFI_CONNECTING, WIFI_ONLINE };
+
+// Called from loop() when the link goes up or down.
+typedef void (*WifiStateCallback)(bool online);
+
+template <class Radio> class WifiLink {
+public:
+  void begin(const char *ssid, const char *pass, WifiStateCallback cb,
+             uint32_t now) {
+    _ssid = ssid;
+    _pass = pass;
+    _cb = cb;
+    _downAt = now;
+    connect(now);
+  }
+
+  // From the WiFi event task
+  void gotIp() { _gotIp = true; }
+  void lost() { _lost = true; }
+
+  void loop(uint32_t now) {
+    if (_gotIp) {
+      _gotIp = false;
+      if (_state != WIFI_ONLINE)
+        online(now);
+    }
+    if (_lost) {
+      _lost = false;
+      if (_state == WIFI_ONLINE) {
+        WIFI_LOG("WiFi: link lost\n");
+        _state = WIFI_OFFLINE;
+        _downAt = now;
+        if (_cb)
+          _cb(false);
+        connect(now); // Straight back to the cached AP
+      } else if (_state == WIFI_CONNECTING) {
+        failed(now);
+      }
+    }
+    if (_state == WIFI_CONNECTING && now - _attemptAt > WIFI_CONNECT_TIMEOUT) {
+      radio.disconnect();
+      _lost = false;
+      failed(now);
+    } else if (_state == WIFI_OFFLINE && now - _failedAt >= _retryIn) {
+      connect(now);
+    }
+  }
+
+  bool connected() const { return _state == WIFI_ONLINE; }
+  WifiState state() const { return _state; }
+  uint32_t reconnects() const { return _reconnects; }
+  // Time from losing the link (or from begin()) to the last got-IP, in ms
+  uint32_t lastOutage() const { return _lastOutage; }
+
+  Radio radio;
+
+private:
+  void connect(uint32_t now) {
+    _state = WIFI_CONNECTING;
+    _attemptAt = now;
+    if (_cached)
+      radio.begin(_ssid, _pass, _channel, _bssid);
+    else
+      radio.begin(_ssid, _pass);
+  }
+
+  void failed(uint32_t now) {
+    _state = WIFI_OFFLINE;
+    _failedAt = now;
+    if (++_failures >= WIFI_CACHE_TRIES)
+      _cached = false; // The AP may have moved; scan next time
+    _retryIn = _backoff;
+    WIFI_LOG("WiFi: attempt failed, retry in %lu ms\n",
+             (unsigned long)_retryIn);
+    _backoff = _backoff * 2 < WIFI_BACKOFF_MAX ? _backoff * 2
+                                               : WIFI_BACKOFF_MAX;
+  }
+
+  void online(uint32_t now) {
+    _state = WIFI_ONLINE;
+    _lastOutage = now - _downAt;
+    _backoff = WIFI_BACKOFF_MIN;
+    _failures = 0;
+    if (_everOnline)
+      _reconnects++;
+    _everOnline = true;
+    memcpy(_bssid, radio.bssid(), sizeof(_bssid));
+    _channel = radio.channel();
+    WIFI_LOG("WiFi: online in %lu ms (%s, ch %ld)\n",
+             (unsigned long)_lastOutage, _cached ? "cached AP" : "scan",
+             (long)_channel);
+    _cached = true;
+    if (_cb)
+      _cb(true);
+  }
+
+  const char *_ssid = NULL;
+  const char *_pass = NULL;
+  WifiStateCallback _cb = NULL;
+  volatile bool _gotIp = false; // Set by the event task
+  volatile bool _lost = false;
+  WifiState _state = WIFI_OFFLINE;
+  uint32_t _attemptAt = 0;
+  uint32_t _failedAt = 0;
+  uint32_t _downAt = 0;
+  uint32_t _backoff = WIFI_BACKOFF_MIN; // Wait after the next failure
+  uint32_t _retryIn = 0;                // Wait after the last one
+  uint8_t _failures = 0;
+  bool _cached = false;
+  bool _everOnline = false;
+  uint8_t _bssid[6];
+  int32_t _channel = 0;
+  uint32_t _reconnects = 0;
+  uint32_t _lastOutage = 0;
+};
+
+#ifdef ARDUINO
+struct EspWifiRadio {
+  void begin(const char *ssid, const char *pass) { WiFi.begin(ssid, pass); }
+  void begin(const char *ssid, const char *pass, int32_t channel,
+             const uint8_t *bssid) {
+    WiFi.begin(ssid, pass, channel, bssid);
+  }
+  void disconnect() { WiFi.disconnect(); }
+  const uint8_t *bssid() { return WiFi.BSSID(); }
+  int32_t channel() { return WiFi.channel(); }
+};
+
+class WifiManager : public WifiLink<EspWifiRadio> {
+public:
+  void begin(const char *ssid, const char *pass, WifiStateCallback cb = NULL) {
+    WiFi.mode(WIFI_STA);
+    WiFi.setAutoReconnect(false); // Retries are paced here
+    WiFi.onEvent([this](arduino_event_id_t event, arduino_event_info_t info) {
+      if (event == ARDUINO_EVENT_WIFI_STA_GOT_IP)
+        gotIp();
+      else if (event == ARDUINO_EVENT_WIFI_STA_DISCONNECTED)
+        lost();
+    });
+    WifiLink::begin(ssid, pass, cb, millis());
+  }
+
+  void loop() { WifiLink::loop(millis()); }
+};
+#endif
+
+#endif
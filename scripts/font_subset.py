@@ -0,0 +1,879 @@
+#!/usr/bin/env python3
+"""Generates the UI fonts as subsets of Montserrat with only the glyphs shown.
+
+The firmware's strings are scanned (string literals in src/ and include/,
+string values in data/*.json, LV_SYMBOL_* names) and every code point found
+is added to printable ASCII and the Spanish letters (tildes, eñe, diéresis,
+¡ ¿ and °), which text from Home Assistant or SD files may bring at run
+time. Glyphs are 4 bpp with kerning from the font's GPOS table.
+
+One copy serves every project; run it from the project folder (or pass
+--project):
+
+  font_subset.py lvgl 14 20   src/ui_font_NN.c for LVGL, RLE compressed,
+                              and include/ui_fonts.h (default is the first)
+  font_subset.py gfx 12 20    include/ui_glyphs.h, atlases for gfx_font.h
+  font_subset.py scan         lists the glyphs found beyond ASCII
+
+Each run prints the flash size of every font next to the full Montserrat
+of the same size that LVGL would otherwise compile in. As a PlatformIO
+pre-script (extra_scripts = pre:../scripts/font_subset.py, with the
+arguments in custom_ui_fonts) it regenerates before a build only when the
+set of glyphs changed, and stops the build when the tools are missing.
+Rendering needs Pillow and fontTools (pip install pillow fonttools) and
+the fonts LVGL ships in scripts/built_in_font, found in any project's
+.pio/libdeps or given with --font-dir.
+"""
+import argparse
+import glob
+import json
+import os
+import re
+import sys
+
+ASCII = range(0x20, 0x7F)
+SPANISH = "¡¿ÁÉÍÑÓÚÜáéíñóúü°"
+TEXT_FONT = "Montserrat-Medium.ttf"
+SYMBOL_FONT = "FontAwesome5-Solid+Brands+Regular.woff"
+GENERATED = ("ui_font_", "ui_fonts.h", "ui_glyphs.h")
+
+# lv_symbol_def.h of LVGL 8.3
+SYMBOLS = {
+    "BULLET": 0x2022, "AUDIO": 0xF001, "VIDEO": 0xF008, "LIST": 0xF00B,
+    "OK": 0xF00C, "CLOSE": 0xF00D, "POWER": 0xF011, "SETTINGS": 0xF013,
+    "HOME": 0xF015, "DOWNLOAD": 0xF019, "DRIVE": 0xF01C, "REFRESH": 0xF021,
+    "MUTE": 0xF026, "VOLUME_MID": 0xF027, "VOLUME_MAX": 0xF028,
+    "IMAGE": 0xF03E, "TINT": 0xF043, "PREV": 0xF048, "PLAY": 0xF04B,
+    "PAUSE": 0xF04C, "STOP": 0xF04D, "NEXT": 0xF051, "EJECT": 0xF052,
+    "LEFT": 0xF053, "RIGHT": 0xF054, "PLUS": 0xF067, "MINUS": 0xF068,
+    "EYE_OPEN": 0xF06E, "EYE_CLOSE": 0xF070, "WARNING": 0xF071,
+    "SHUFFLE": 0xF074, "UP": 0xF077, "DOWN": 0xF078, "LOOP": 0xF079,
+    "DIRECTORY": 0xF07B, "UPLOAD": 0xF093, "CALL": 0xF095, "CUT": 0xF0C4,
+    "COPY": 0xF0C5, "SAVE": 0xF0C7, "BARS": 0xF0C9, "ENVELOPE": 0xF0E0,
+    "CHARGE": 0xF0E7, "PASTE": 0xF0EA, "BELL": 0xF0F3, "KEYBOARD": 0xF11C,
+    "GPS": 0xF124, "FILE": 0xF158, "WIFI": 0xF1EB, "BATTERY_FULL": 0xF240,
+    "BATTERY_3": 0xF241, "BATTERY_2": 0xF242, "BATTERY_1": 0xF243,
+    "BATTERY_EMPTY": 0xF244, "USB": 0xF287, "BLUETOOTH": 0xF293,
+    "TRASH": 0xF2ED, "EDIT": 0xF304, "BACKSPACE": 0xF55A,
+    "SD_CARD": 0xF7C2, "NEW_LINE": 0xF8A2,
+}
+
+# Widgets that draw LVGL symbols of their own
+WIDGET_SYMBOLS = {
+    "lv_checkbox_create": ["OK"],
+    "lv_dropdown_create": ["DOWN"],
+    "lv_msgbox_create": ["CLOSE"],
+    "lv_calendar_header_arrow_create": ["LEFT", "RIGHT"],
+    "lv_keyboard_create": ["BACKSPACE", "NEW_LINE", "OK", "CLOSE", "LEFT",
+                           "RIGHT", "KEYBOARD"],
+}
+
+# ---------------------------------------------------------------- scanning
+
+
+def c_strings(text):
+    """String literals of C/C++ source, comments skipped, escapes decoded."""
+    out = []
+    i, n = 0, len(text)
+    while i < n:
+        c = text[i]
+        if text.startswith("//", i):
+            i = text.find("\n", i)
+            i = n if i < 0 else i
+        elif text.startswith("/*", i):
+            i = text.find("*/", i + 2)
+            i = n if i < 0 else i + 2
+        elif c == "'":
+            i = text.find("'", i + 2 if text[i + 1:i + 2] == "\\" else i + 1)
+            i = n if i < 0 else i + 1
+        elif c == '"':
+            j = i + 1
+            raw = bytearray()
+            while j < n and text[j] != '"':
+                if text[j] == "\\" and j + 1 < n:
+                    m = re.match(r"x([0-9a-fA-F]{1,2})|([0-7]{1,3})|(.)",
+                                 text[j + 1:], re.S)
+                    if m.group(1):
+                        raw.append(int(m.group(1), 16))
+                    elif m.group(2):
+                        raw.append(int(m.group(2), 8) & 0xFF)
+                    else:
+                        raw += {"n": b"\n", "t": b"\t"}.get(
+                            m.group(3), m.group(3).encode())
+                    j += 1 + m.end()
+                else:
+                    raw += text[j].encode()
+                    j += 1
+            out.append(raw.decode("utf-8", "ignore"))
+            i = j + 1
+        else:
+            i += 1
+    return out
+
+
+def json_strings(value):
+    if isinstance(value, str):
+        yield value
+    elif isinstance(value, dict):
+        for v in value.values():
+            yield from json_strings(v)
+    elif isinstance(value, list):
+        for v in value:
+            yield from json_strings(v)
+
+
+def source_files(project):
+    for pattern in ("src/**/*.c", "src/**/*.cpp", "src/**/*.h",
+                    "include/**/*.h", "data/**/*.json"):
+        for path in sorted(glob.glob(os.path.join(project, pattern),
+                                     recursive=True)):
+            if not os.path.basename(path).startswith(GENERATED):
+                yield path
+
+
+def scan(project, symbols=True):
+    """Code points the UI may show: {code point: first file seen in}."""
+    found = {cp: None for cp in ASCII}
+    found.update((ord(c), None) for c in SPANISH)
+    for path in source_files(project):
+        with open(path, encoding="utf-8", errors="replace") as f:
+            text = f.read()
+        rel = os.path.relpath(path, project)
+        if path.endswith(".json"):
+            try:
+                strings = list(json_strings(json.loads(text)))
+            except ValueError:
+                continue
+        else:
+            strings = c_strings(text)
+            if symbols:
+                names = set(re.findall(r"\bLV_SYMBOL_(\w+)", text))
+                for widget, syms in WIDGET_SYMBOLS.items():
+                    if widget in text:
+                        names.update(syms)
+                strings += [chr(SYMBOLS[s]) for s in names if s in SYMBOLS]
+        for s in strings:
+            for c in s:
+                if ord(c) >= 0x20 and ord(c) not in found:
+                    found[ord(c)] = rel
+    return found
+
+
+def ranges(cps):
+    """Code points as "0x20-0x7E,0xB0", the signature of a generated font."""
+    runs = []
+    for cp in sorted(cps):
+        if runs and cp == runs[-1][1] + 1:
+            runs[-1][1] = cp
+        else:
+            runs.append([cp, cp])
+    return ",".join("0x%X" % a if a == b else "0x%X-0x%X" % (a, b)
+                    for a, b in runs)
+
+# --------------------------------------------------------------- rendering
+
+
+def find_font_dir(project, font_dir=None):
+    dirs = [font_dir] if font_dir else []
+    dirs += glob.glob(os.path.join(project, ".pio/libdeps/*/lvgl/scripts/"
+                                   "built_in_font"))
+    dirs += glob.glob(os.path.join(project, "../*/.pio/libdeps/*/lvgl/"
+                                   "scripts/built_in_font"))
+    for d in dirs:
+        if os.path.isfile(os.path.join(d, TEXT_FONT)):
+            return d
+    return None
+
+
+class Glyph:
+    def __init__(self, cp, adv16, w, h, x, top, px):
+        self.cp = cp
+        self.adv16 = adv16  # Advance in 1/16 px
+        self.w, self.h = w, h
+        self.x = x          # Box left from the pen
+        self.top = top      # Box top from the baseline, negative above
+        self.px = px        # w * h values 0..15, row by row
+
+
+class Face:
+    """One font size rendered with FreeType through Pillow."""
+
+    def __init__(self, font_dir, size):
+        from PIL import ImageFont
+        from fontTools.ttLib import TTFont
+        self.size = size
+        text = os.path.join(font_dir, TEXT_FONT)
+        self.text = ImageFont.truetype(text, size)
+        self.text16 = ImageFont.truetype(text, size * 16)
+        sym = os.path.join(font_dir, SYMBOL_FONT)
+        self.sym = ImageFont.truetype(sym, size)
+        self.sym16 = ImageFont.truetype(sym, size * 16)
+        self.tt = TTFont(text)
+        self.cmap = self.tt.getBestCmap()
+
+    def glyph(self, cp):
+        from PIL import Image, ImageDraw
+        font, font16 = (self.text, self.text16)
+        if cp not in self.cmap:
+            font, font16 = (self.sym, self.sym16)
+        ch = chr(cp)
+        adv16 = int(round(font16.getlength(ch)))
+        left, top, right, bottom = font.getbbox(ch, anchor="ls")
+        w, h = right - left, bottom - top
+        if w <= 0 or h <= 0:
+            return Glyph(cp, adv16, 0, 0, 0, 0, [])
+        im = Image.new("L", (w, h))
+        ImageDraw.Draw(im).text((-left, -top), ch, font=font, fill=255,
+                                anchor="ls")
+        im = im.point(lambda v: (v * 15 + 127) // 255 * 17)
+        box = im.getbbox()
+        if not box:
+            return Glyph(cp, adv16, 0, 0, 0, 0, [])
+        im = im.crop(box)
+        px = [v // 17 for v in im.tobytes()]
+        return Glyph(cp, adv16, im.width, im.height, left + box[0],
+                     top + box[1], px)
+
+    def kerning(self, cps):
+        """{(left cp, right cp): 1/16 px} from the GPOS kern lookups."""
+        gpos = self.tt["GPOS"].table if "GPOS" in self.tt else None
+        if not gpos:
+            return {}
+        names = {cp: self.cmap[cp] for cp in cps if cp in self.cmap}
+        lookups = sorted({i for f in gpos.FeatureList.FeatureRecord
+                          if f.FeatureTag == "kern"
+                          for i in f.Feature.LookupListIndex})
+        scale = self.size * 16.0 / self.tt["head"].unitsPerEm
+        pairs = {}
+        for li in lookups:
+            lookup = gpos.LookupList.Lookup[li]
+            if lookup.LookupType != 2:
+                continue
+            for lcp, lname in names.items():
+                for rcp, rname in names.items():
+                    v = pair_value(lookup.SubTable, lname, rname)
+                    if v:
+                        pairs[(lcp, rcp)] = pairs.get((lcp, rcp), 0) + v
+        out = {}
+        for k, v in pairs.items():
+            v = int(round(v * scale))
+            if v:
+                out[k] = max(-128, min(127, v))
+        return out
+
+
+def pair_value(subtables, left, right):
+    """XAdvance of the first PairPos subtable that covers the pair."""
+    for st in subtables:
+        if left not in st.Coverage.glyphs:
+            continue
+        if st.Format == 1:
+            pset = st.PairSet[st.Coverage.glyphs.index(left)]
+            for rec in pset.PairValueRecord:
+                if rec.SecondGlyph == right:
+                    return getattr(rec.Value1, "XAdvance", 0) or 0
+        else:
+            c1 = st.ClassDef1.classDefs.get(left, 0)
+            c2 = st.ClassDef2.classDefs.get(right, 0)
+            rec = st.Class1Record[c1].Class2Record[c2]
+            return getattr(rec.Value1, "XAdvance", 0) or 0
+    return 0
+
+
+def render(font_dir, size, cps):
+    face = Face(font_dir, size)
+    glyphs = [face.glyph(cp) for cp in sorted(cps)]
+    ascent = max([-g.top for g in glyphs if g.h] + [0])
+    descent = max([g.top + g.h for g in glyphs if g.h] + [0])
+    return glyphs, ascent + descent, descent, face.kerning(cps)
+
+# ----------------------------------------------------- LVGL font encoding
+
+
+class Bits:
+    def __init__(self):
+        self.out = bytearray()
+        self.n = 0
+
+    def put(self, value, bits):
+        for i in range(bits - 1, -1, -1):
+            if self.n % 8 == 0:
+                self.out.append(0)
+            if (value >> i) & 1:
+                self.out[-1] |= 0x80 >> (self.n % 8)
+            self.n += 1
+
+
+def rle_encode(values, bpp):
+    """Inverse of rle_next() in LVGL's lv_font_fmt_txt.c."""
+    b = Bits()
+    i, n = 0, len(values)
+    prev, repeat, cnt = None, False, 0
+    while i < n:
+        v = values[i]
+        if not repeat:
+            b.put(v, bpp)
+            repeat = i > 0 and v == prev
+            cnt = 0
+            prev = v
+            i += 1
+            continue
+        cnt += 1
+        if v != prev:
+            b.put(0, 1)
+            b.put(v, bpp)
+            prev, repeat = v, False
+            i += 1
+            continue
+        b.put(1, 1)
+        i += 1
+        if cnt == 11:
+            run = 0
+            while i + run < n and values[i + run] == prev and run < 62:
+                run += 1
+            b.put(run + 1, 6)  # run more repeats, then a raw value
+            i += run
+            if i < n:
+                b.put(values[i], bpp)
+                prev = values[i]
+                i += 1
+            repeat = False
+    return bytes(b.out)
+
+
+def rle_decode(data, count, bpp):
+    """rle_next() of LVGL, to check every encoded glyph."""
+    def bits(pos, length):
+        v = 0
+        for k in range(length):
+            byte = data[(pos + k) // 8] if (pos + k) // 8 < len(data) else 0
+            v = (v << 1) | ((byte >> (7 - (pos + k) % 8)) & 1)
+        return v
+    out, rdp, state, prev, cnt = [], 0, 0, 0, 0
+    for _ in range(count):
+        if state == 0:
+            ret = bits(rdp, bpp)
+            if rdp and prev == ret:
+                cnt, state = 0, 1
+            prev = ret
+            rdp += bpp
+        elif state == 1:
+            v = bits(rdp, 1)
+            cnt += 1
+            rdp += 1
+            if v:
+                ret = prev
+                if cnt == 11:
+                    cnt = bits(rdp, 6)
+                    rdp += 6
+                    if cnt:
+                        state = 2
+                    else:
+                        ret = prev = bits(rdp, bpp)
+                        rdp += bpp
+                        state = 0
+            else:
+                ret = prev = bits(rdp, bpp)
+                rdp += bpp
+                state = 0
+        else:
+            ret = prev
+            cnt -= 1
+            if cnt == 0:
+                ret = prev = bits(rdp, bpp)
+                rdp += bpp
+                state = 0
+        out.append(ret)
+    return out
+
+
+def xor_rows(g):
+    """Each row XORed with the one above, LVGL's compression prefilter."""
+    px = list(g.px)
+    for y in range(g.h - 1, 0, -1):
+        for x in range(g.w):
+            px[y * g.w + x] ^= px[(y - 1) * g.w + x]
+    return px
+
+
+def pack4(px):
+    px = list(px) + [0] * (len(px) % 2)
+    return bytes((px[i] << 4) | px[i + 1] for i in range(0, len(px), 2))
+
+
+def encode_bitmaps(glyphs, fmt):
+    """(bitmap bytes, offsets) for LVGL bitmap_format 0, 1 or 2."""
+    data = bytearray()
+    offsets = []
+    for g in glyphs:
+        offsets.append(len(data))
+        if fmt == 0:
+            data += pack4(g.px)
+        elif g.px:
+            src = xor_rows(g) if fmt == 1 else g.px
+            enc = rle_encode(src, 4)
+            assert rle_decode(enc, len(src), 4) == src, hex(g.cp)
+            data += enc
+    if fmt:
+        data.append(0)  # The decoder may read one byte past the last glyph
+    return bytes(data), offsets
+
+
+def kern_tables(glyphs, kern):
+    """Smallest of LVGL's kerning forms: ("pairs", ids, values) or
+    ("classes", left map, right map, values, left count, right count)."""
+    gid = {g.cp: i + 1 for i, g in enumerate(glyphs)}
+    items = sorted((gid[l], gid[r], v) for (l, r), v in kern.items())
+    pairs = ("pairs", [x for l, r, _ in items for x in (l, r)],
+             [v for _, _, v in items])
+    n = len(glyphs) + 1
+    rows = [tuple(kern.get((glyphs[a - 1].cp, glyphs[b - 1].cp), 0)
+                  for b in range(1, n)) if a else () for a in range(n)]
+    cols = [tuple(rows[a][b - 1] for a in range(1, n)) if b else ()
+            for b in range(n)]
+
+    def classes(vectors):
+        ids, mapping = {}, [0] * n
+        for i in range(1, n):
+            if any(vectors[i]):
+                mapping[i] = ids.setdefault(vectors[i], len(ids) + 1)
+        return mapping, ids
+    lmap, lids = classes(rows)
+    rmap, rids = classes(cols)
+    if len(lids) > 255 or len(rids) > 255:
+        return pairs
+    lrep = {c: i for i, c in reversed(list(enumerate(lmap))) if c}
+    rrep = {c: i for i, c in reversed(list(enumerate(rmap))) if c}
+    values = [rows[lrep[a]][rrep[b] - 1] for a in range(1, len(lids) + 1)
+              for b in range(1, len(rids) + 1)]
+    cls = ("classes", lmap, rmap, values, len(lids), len(rids))
+    return cls if len(values) + 2 * n < 3 * len(items) else pairs
+
+
+def array(values, fmt="%d", per_line=16, indent="    "):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append(indent + ", ".join(fmt % v for v in
+                                        values[i:i + per_line]))
+    return ",\n".join(lines)
+
+
+def glyph_label(cp):
+    if cp in SYMBOLS.values() and cp != 0x2022:
+        return "U+%04X" % cp
+    ch = chr(cp)
+    return 'U+%04X "%s"' % (cp, {"\\": "\\\\", '"': '\\"'}.get(ch, ch))
+
+
+def lvgl_font(name, size, glyphs, line_height, base_line, kern, fmt, sig):
+    """C source of an LVGL 8 font in the format lv_font_conv writes."""
+    data, offsets = encode_bitmaps(glyphs, fmt)
+    ascii_n = sum(1 for g in glyphs if 0x20 <= g.cp < 0x7F)
+    rest = [g.cp for g in glyphs[ascii_n:]]
+    o = []
+    o.append("/" + "*" * 79)
+    o.append(" * Size: %d px" % size)
+    o.append(" * Bpp: 4")
+    o.append(" * Opts: scripts/font_subset.py, %s, %s" % (
+        TEXT_FONT, ["plain", "compressed", "compressed, no prefilter"][fmt]))
+    o.append(" * Glyphs: %s" % sig)
+    o.append(" " + "*" * 78 + "/")
+    o.append("")
+    o.append("// Generated by scripts/font_subset.py, do not edit.")
+    o.append("")
+    o.append("#ifdef LV_LVGL_H_INCLUDE_SIMPLE")
+    o.append('#include "lvgl.h"')
+    o.append("#else")
+    o.append('#include "lvgl/lvgl.h"')
+    o.append("#endif")
+    o.append("")
+    if fmt:
+        o.append("#if !LV_USE_FONT_COMPRESSED")
+        o.append("#error \"%s is compressed: build with "
+                 "-DLV_USE_FONT_COMPRESSED=1\"" % name)
+        o.append("#endif")
+        o.append("")
+    o.append("/*-----------------")
+    o.append(" *    BITMAPS")
+    o.append(" *----------------*/")
+    o.append("")
+    o.append("/*Store the image of the glyphs*/")
+    o.append("static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] "
+             "= {")
+    for i, g in enumerate(glyphs):
+        end = offsets[i + 1] if i + 1 < len(glyphs) else len(data)
+        o.append("    /* %s */" % glyph_label(g.cp))
+        if end > offsets[i]:
+            o.append(array(data[offsets[i]:end], "0x%x", 8) + ",")
+        o.append("")
+    o[-1] = "};"
+    o.append("")
+    o.append("")
+    o.append("/*---------------------")
+    o.append(" *  GLYPH DESCRIPTION")
+    o.append(" *--------------------*/")
+    o.append("")
+    o.append("static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {")
+    dsc = ["    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, "
+           ".ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */"]
+    for i, g in enumerate(glyphs):
+        dsc.append("    {.bitmap_index = %d, .adv_w = %d, .box_w = %d, "
+                   ".box_h = %d, .ofs_x = %d, .ofs_y = %d}" % (
+                       offsets[i], g.adv16, g.w, g.h, g.x,
+                       -(g.top + g.h) if g.h else 0))
+    o.append(",\n".join(dsc))
+    o.append("};")
+    o.append("")
+    o.append("/*---------------------")
+    o.append(" *  CHARACTER MAPPING")
+    o.append(" *--------------------*/")
+    o.append("")
+    cmaps = ["    {\n        .range_start = 32, .range_length = %d, "
+             ".glyph_id_start = 1,\n        .unicode_list = NULL, "
+             ".glyph_id_ofs_list = NULL, .list_length = 0, "
+             ".type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY\n    }" % ascii_n]
+    if rest:
+        o.append("static const uint16_t unicode_list_1[] = {")
+        o.append(array([cp - rest[0] for cp in rest], "0x%x", 8))
+        o.append("};")
+        o.append("")
+        cmaps.append("    {\n        .range_start = %d, .range_length = %d, "
+                     ".glyph_id_start = %d,\n        .unicode_list = "
+                     "unicode_list_1, .glyph_id_ofs_list = NULL, "
+                     ".list_length = %d, .type = "
+                     "LV_FONT_FMT_TXT_CMAP_SPARSE_TINY\n    }" % (
+                         rest[0], rest[-1] - rest[0] + 1, ascii_n + 1,
+                         len(rest)))
+    o.append("/*Collect the unicode lists and glyph_id offsets*/")
+    o.append("static const lv_font_fmt_txt_cmap_t cmaps[] =")
+    o.append("{")
+    o.append(",\n".join(cmaps))
+    o.append("};")
+    o.append("")
+    kt = kern_tables(glyphs, kern) if kern else None
+    kern_size = 0
+    if kt:
+        o.append("/*-----------------")
+        o.append(" *    KERNING")
+        o.append(" *----------------*/")
+        o.append("")
+    if kt and kt[0] == "pairs":
+        _, ids, values = kt
+        kern_size = len(ids) + len(values)
+        o.append("/*Pair left and right glyphs for kerning*/")
+        o.append("static const uint8_t kern_pair_glyph_ids[] =")
+        o.append("{")
+        o.append(array(ids, "%d", 16))
+        o.append("};")
+        o.append("")
+        o.append("/* Kerning between the respective left and right glyphs")
+        o.append(" * 4.4 format which needs to scaled with `kern_scale`*/")
+        o.append("static const int8_t kern_pair_values[] =")
+        o.append("{")
+        o.append(array(values, "%d", 16))
+        o.append("};")
+        o.append("")
+        o.append("/*Collect the kern pair's data in one place*/")
+        o.append("static const lv_font_fmt_txt_kern_pair_t kern_pairs =")
+        o.append("{")
+        o.append("    .glyph_ids = kern_pair_glyph_ids,")
+        o.append("    .values = kern_pair_values,")
+        o.append("    .pair_cnt = %d," % len(values))
+        o.append("    .glyph_ids_size = 0")
+        o.append("};")
+        o.append("")
+    elif kt:
+        _, lmap, rmap, values, lcnt, rcnt = kt
+        kern_size = len(lmap) + len(rmap) + len(values)
+        o.append("/*Map glyph_ids to kern left classes*/")
+        o.append("static const uint8_t kern_left_class_mapping[] =")
+        o.append("{")
+        o.append(array(lmap, "%d", 16))
+        o.append("};")
+        o.append("")
+        o.append("/*Map glyph_ids to kern right classes*/")
+        o.append("static const uint8_t kern_right_class_mapping[] =")
+        o.append("{")
+        o.append(array(rmap, "%d", 16))
+        o.append("};")
+        o.append("")
+        o.append("/*Kern values between classes*/")
+        o.append("static const int8_t kern_class_values[] =")
+        o.append("{")
+        o.append(array(values, "%d", 16))
+        o.append("};")
+        o.append("")
+        o.append("/*Collect the kern class' data in one place*/")
+        o.append("static const lv_font_fmt_txt_kern_classes_t kern_classes "
+                 "= {")
+        o.append("    .class_pair_values   = kern_class_values,")
+        o.append("    .left_class_mapping  = kern_left_class_mapping,")
+        o.append("    .right_class_mapping = kern_right_class_mapping,")
+        o.append("    .left_class_cnt      = %d," % lcnt)
+        o.append("    .right_class_cnt     = %d," % rcnt)
+        o.append("};")
+        o.append("")
+    o.append("/*--------------------")
+    o.append(" *  ALL CUSTOM DATA")
+    o.append(" *--------------------*/")
+    o.append("")
+    o.append("/*Store all the custom data of the font*/")
+    o.append("static lv_font_fmt_txt_glyph_cache_t cache;")
+    o.append("static const lv_font_fmt_txt_dsc_t font_dsc = {")
+    o.append("    .glyph_bitmap = glyph_bitmap,")
+    o.append("    .glyph_dsc = glyph_dsc,")
+    o.append("    .cmaps = cmaps,")
+    o.append("    .kern_dsc = %s," % (
+        "NULL" if not kt else
+        "&kern_pairs" if kt[0] == "pairs" else "&kern_classes"))
+    o.append("    .kern_scale = 16,")
+    o.append("    .cmap_num = %d," % len(cmaps))
+    o.append("    .bpp = 4,")
+    o.append("    .kern_classes = %d," % (1 if kt and kt[0] != "pairs" else 0))
+    o.append("    .bitmap_format = %d," % fmt)
+    o.append("    .cache = &cache")
+    o.append("};")
+    o.append("")
+    o.append("")
+    o.append("/*-----------------")
+    o.append(" *  PUBLIC FONT")
+    o.append(" *----------------*/")
+    o.append("")
+    o.append("/*Initialize a public general font descriptor*/")
+    o.append("const lv_font_t %s = {" % name)
+    o.append("    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    "
+             "/*Function pointer to get glyph's data*/")
+    o.append("    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    "
+             "/*Function pointer to get glyph's bitmap*/")
+    o.append("    .line_height = %d,          /*The maximum line height "
+             "required by the font*/" % line_height)
+    o.append("    .base_line = %d,             /*Baseline measured from the "
+             "bottom of the line*/" % base_line)
+    o.append("    .subpx = LV_FONT_SUBPX_NONE,")
+    o.append("    .underline_position = -1,")
+    o.append("    .underline_thickness = 1,")
+    o.append("    .dsc = &font_dsc           /*The custom font data. Will be "
+             "accessed by `get_glyph_bitmap/dsc` */")
+    o.append("};")
+    o.append("")
+    size_b = (len(data) + 8 * (len(glyphs) + 1) + 2 * len(rest) +
+              16 * len(cmaps) + kern_size + 24)
+    return "\n".join(o), size_b
+
+
+def lvgl_sizes(glyphs, line_height, base_line, kern):
+    """Flash bytes of the font as plain, prefiltered and plain RLE."""
+    return [lvgl_font("f", 0, glyphs, line_height, base_line, kern, f,
+                      "")[1] for f in (0, 1, 2)]
+
+
+def missing(font_dir):
+    """What rendering lacks, None when nothing."""
+    try:
+        import PIL  # noqa: F401
+        import fontTools  # noqa: F401
+    except ImportError:
+        return "generating them needs: pip install pillow fonttools"
+    if not font_dir:
+        return ("%s was not found: install LVGL (pio pkg install) or pass "
+                "--font-dir" % TEXT_FONT)
+    return None
+
+# ---------------------------------------------------------------- outputs
+
+
+def read_signature(path):
+    try:
+        with open(path, encoding="utf-8") as f:
+            for line in f:
+                m = re.match(r"\W*Glyphs: (\S+)", line)
+                if m:
+                    return m.group(1)
+    except OSError:
+        pass
+    return None
+
+
+def outputs(project, kind, sizes):
+    if kind == "lvgl":
+        return [os.path.join(project, "src", "ui_font_%d.c" % s)
+                for s in sizes] + [os.path.join(project, "include",
+                                                "ui_fonts.h")]
+    return [os.path.join(project, "include", "ui_glyphs.h")]
+
+
+def builtin_set(size):
+    """Glyphs of LVGL's built-in lv_font_montserrat_NN."""
+    cps = set(ASCII) | {0xB0, 0x2022}
+    return cps | {v for k, v in SYMBOLS.items() if k != "BULLET"}
+
+
+def write_lvgl(project, sizes, cps, sig, font_dir, compress, report):
+    for size in sizes:
+        glyphs, lh, bl, kern = render(font_dir, size, cps)
+        plain, pre, nopre = lvgl_sizes(glyphs, lh, bl, kern)
+        fmt = 0
+        if compress:
+            fmt = 1 if pre <= nopre else 2
+        src, flash = lvgl_font("ui_font_%d" % size, size, glyphs, lh, bl,
+                               kern, fmt, sig)
+        path = os.path.join(project, "src", "ui_font_%d.c" % size)
+        with open(path, "w", encoding="utf-8") as f:
+            f.write(src)
+        full = builtin_set(size)
+        fg, flh, fbl, fkern = render(font_dir, size, full)
+        full_b = lvgl_sizes(fg, flh, fbl, fkern)[0]
+        biggest = max((g.w * g.h + 1) // 2 for g in glyphs)
+        widest = max(g.w for g in glyphs)
+        report("%s: %d glyphs, line %d px, %d B flash (plain %d B); "
+               "full Montserrat %d: %d glyphs, %d B, %.0f%% saved" % (
+                   os.path.relpath(path, project), len(glyphs), lh, flash,
+                   plain, size, len(full), full_b,
+                   100.0 * (full_b - flash) / full_b))
+        if fmt:
+            report("  RAM: all data in flash; drawing a glyph borrows up to "
+                   "%d + 2 x %d B from the LVGL heap to decompress it" % (
+                       biggest, widest))
+    names = " ".join("LV_FONT_DECLARE(ui_font_%d)" % s for s in sizes)
+    header = """\
+// Generated by scripts/font_subset.py, do not edit.
+// Glyphs: {sig}
+//
+// Forced into every file, LVGL's own included (-include in
+// platformio.ini), so the subset fonts replace Montserrat as the default
+// and are declared wherever lvgl.h is.
+
+#ifndef UI_FONTS_H
+#define UI_FONTS_H
+
+#define LV_FONT_DEFAULT &ui_font_{first}
+#define LV_FONT_CUSTOM_DECLARE {names}
+
+#endif
+""".format(sig=sig, first=sizes[0], names=names)
+    with open(os.path.join(project, "include", "ui_fonts.h"), "w",
+              encoding="utf-8") as f:
+        f.write(header)
+
+
+def write_gfx(project, sizes, cps, sig, font_dir, report):
+    cps = [cp for cp in cps if cp < 0xF000]  # No symbol font on this path
+    o = ["// Generated by scripts/font_subset.py, do not edit.",
+         "// Glyphs: %s" % sig,
+         "//",
+         "// 4 bpp glyph atlases of Montserrat Medium for gfx_font.h.",
+         "",
+         "#ifndef UI_GLYPHS_H",
+         "#define UI_GLYPHS_H",
+         "",
+         '#include "gfx_font.h"',
+         ""]
+    for size in sizes:
+        glyphs, lh, bl, _ = render(font_dir, size, cps)
+        data = bytearray()
+        rows = []
+        for g in glyphs:
+            rows.append("    {0x%04X, %d, %d, %d, %d, %d, %d}, // %s" % (
+                g.cp, len(data), g.w, g.h, g.x, g.top,
+                (g.adv16 + 8) // 16, glyph_label(g.cp)))
+            data += pack4(g.px)
+        assert len(data) < 1 << 16
+        o.append("static const uint8_t ui_font_%d_bitmap[] = {" % size)
+        o.append(array(data, "0x%02x", 12, "    ") + ",")
+        o.append("};")
+        o.append("")
+        o.append("static const GfxGlyph ui_font_%d_glyphs[] = {" % size)
+        o += rows
+        o.append("};")
+        o.append("")
+        o.append("static const GfxFont ui_font_%d = {ui_font_%d_bitmap, "
+                 "ui_font_%d_glyphs, %d, %d, %d};" % (
+                     size, size, size, len(glyphs), lh, bl))
+        o.append("")
+        flash = len(data) + 10 * len(glyphs) + 12
+        report("ui_font_%d: %d glyphs, line %d px, %d B flash, no RAM" % (
+            size, len(glyphs), lh, flash))
+    o.append("#endif")
+    with open(os.path.join(project, "include", "ui_glyphs.h"), "w",
+              encoding="utf-8") as f:
+        f.write("\n".join(o) + "\n")
+
+
+def update(project, kind, sizes, font_dir=None, compress=True, force=False,
+           report=print):
+    """Regenerates when the glyph set changed; False when it could not."""
+    found = scan(project, symbols=kind == "lvgl")
+    sig = ranges(found)
+    paths = outputs(project, kind, sizes)
+    if not force and all(read_signature(p) == sig for p in paths):
+        return True
+    extra = sorted(cp for cp, where in found.items() if where)
+    for cp in extra:
+        report("  %s from %s" % (glyph_label(cp), found[cp]))
+    font_dir = find_font_dir(project, font_dir)
+    error = missing(font_dir)
+    if error:
+        report("fonts out of date, and " + error)
+        return False
+    if kind == "lvgl":
+        write_lvgl(project, sizes, found, sig, font_dir, compress, report)
+    else:
+        write_gfx(project, sizes, found, sig, font_dir, report)
+    return True
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    ap.add_argument("kind", choices=["lvgl", "gfx", "scan"])
+    ap.add_argument("sizes", type=int, nargs="*", help="pixel sizes")
+    ap.add_argument("--project", default=os.getcwd(),
+                    help="project folder, default the current one")
+    ap.add_argument("--font-dir", help="folder with %s and %s" % (
+        TEXT_FONT, SYMBOL_FONT))
+    ap.add_argument("--no-compress", action="store_true",
+                    help="plain LVGL bitmaps, faster to draw")
+    ap.add_argument("--force", action="store_true",
+                    help="regenerate even if the glyphs did not change")
+    args = ap.parse_args()
+    project = os.path.normpath(args.project)
+    if args.kind == "scan":
+        found = scan(project)
+        for cp in sorted(found):
+            if found[cp] or cp >= 0x7F:
+                print("%-12s %s" % (glyph_label(cp), found[cp] or "always"))
+        print("Glyphs: %s" % ranges(found))
+        return
+    if not args.sizes:
+        ap.error("give at least one size")
+    if not update(project, args.kind, args.sizes, args.font_dir,
+                  not args.no_compress, args.force):
+        sys.exit(1)
+
+
+def pio_prebuild(env):
+    opt = env.GetProjectOption("custom_ui_fonts", "").split()
+    if not opt:
+        return
+    project = env.subst("$PROJECT_DIR")
+
+    def report(s):
+        print("font_subset: " + s)
+
+    # A build without the tools would keep fonts that may lack glyphs
+    error = missing(find_font_dir(project))
+    if error:
+        report(error)
+        env.Exit(1)
+    if not update(project, opt[0], [int(s) for s in opt[1:]],
+                  report=report):
+        env.Exit(1)
+
+
+try:
+    Import  # noqa: F821  Defined when PlatformIO runs this as a pre-script
+except NameError:
+    if __name__ == "__main__":
+        main()
+else:
+    Import("env")  # noqa: F821
+    pio_prebuild(env)  # noqa: F821
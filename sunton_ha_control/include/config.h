@@ -5,11 +5,56 @@
 #define HA_UPDATE_INTERVAL 5000
 #define LVGL_BUFFER_SIZE (480 * 20)
 
+// Sondeo REST (sin transporte push): la pestaña visible cada 5 s, el resto
+// cada minuto; sin tocar la pantalla 2 min, todo un paso más lento
+#define POLL_VISIBLE_MS HA_UPDATE_INTERVAL
+#define POLL_HIDDEN_MS 60000
+#define POLL_IDLE_MS 300000
+#define POLL_IDLE_AFTER_MS 120000
+
+// Páginas de zona: se construyen al visitarlas y se liberan las menos
+// recientes cuando el heap de LVGL baja de esta reserva
+#define ZONE_PAGE_RESERVE 12288
+#define ENTITY_MAX 96  // Entidades vigiladas (luces y sensores)
+#define BINDING_MAX 96 // Widgets enlazados en las páginas construidas
+
+// Sliders de LED y persianas: mientras se arrastran, como mucho una llamada
+// a HA por entidad cada VALUE_STREAM_MS; el valor final siempre se envía
+#define VALUE_STREAM_MS 250
+
+// Heap de LVGL (con lv_mem_split.h en platformio.ini): bloques pequeños en
+// SRAM interna, los de LV_SPLIT_LARGE o más en PSRAM
+#define LV_SPLIT_SRAM_SIZE (48 * 1024)
+#define LV_SPLIT_LARGE 1024
+
+// Histórico de sensores: hora por NTP, ~1 KB por sensor
+#define NTP_SERVER "pool.ntp.org"
+#define HISTORY_MAX_SENSORS 10
+#define HISTORY_VALID_TIME 1700000000 // Antes de esto el reloj no está en hora
+
+// Benchmark de render al arrancar (entorno "bench"), ver ui_bench.h
+#ifndef UI_BENCH
+#define UI_BENCH 0
+#endif
+
+// Latencia toque-pantalla y fps por serie y en pantalla (entorno "trace"),
+// ver latency_trace.h. Sin él no se compila nada.
+#ifndef LATENCY_TRACE
+#define LATENCY_TRACE 0
+#endif
+
+// Transporte HA: 0 = REST + WebSocket, 1 = MQTT (entorno "mqtt")
+#ifndef HA_TRANSPORT_MQTT
+#define HA_TRANSPORT_MQTT 0
+#endif
+#define HA_MQTT_STATE_PREFIX "homeassistant/statestream"
+#define HA_MQTT_CMD_PREFIX "delfin/cmd"
+
 // Nombres de Zonas (Shorter for Tab Bar)
 #define NAME_HABITACION1 "Hab 1"
 #define NAME_HABITACION2 "Hab 2"
 #define NAME_HABITACION3 "Hab 3"
-#define NAME_SALON "Salon"
+#define NAME_SALON "Salón"
 #define NAME_PASILLO "Pasillo"
 
 // Entidades Habitación 1
@@ -0,0 +1,116 @@
+#ifndef HA_STATES_H
+#define HA_STATES_H
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+
+// Reads watched entities with a single request. POST /api/template
+// renders the ids passed in its "ids" variable as
+//
+//   {"sensor.x": {"state": "21.5", "last_changed": "2024-..."}, ...}
+//
+// so one fixed template serves any subset of the entities (see
+// poll_scheduler.h). The response is deserialized straight from the HTTP
+// stream through a filter built from the same ids, so no body String is
+// ever allocated and any extra attribute HA adds is dropped while parsing.
+
+#define HA_STATE_LEN 24
+#define HA_CHANGED_LEN 33 // "2024-01-01T00:00:00.000000+00:00"
+
+struct HaEntityState {
+  const char *id;
+  char state[HA_STATE_LEN];
+  char lastChanged[HA_CHANGED_LEN];
+  bool valid;
+};
+
+class HaStateBatch {
+public:
+  // `entities` must outlive the batch; their ids are referenced, not copied.
+  void begin(HaEntityState *entities, uint8_t count) {
+    _e = entities;
+    _n = count;
+
+    size_t idBytes = 0;
+    for (uint8_t i = 0; i < _n; i++)
+      idBytes += strlen(_e[i].id) + 1;
+    const char *tmpl =
+        "{ {%- for s in expand(ids) %}\"{{ s.entity_id }}\":"
+        "{\"state\":{{ s.state|tojson }},"
+        "\"last_changed\":\"{{ s.last_changed.isoformat() }}\"}"
+        "{{ ',' if not loop.last }}{%- endfor %} }";
+    StaticJsonDocument<64> req;
+    req["template"] = tmpl;
+    _prefix = "";
+    serializeJson(req, _prefix);
+    _prefix.remove(_prefix.length() - 1); // Reopen the object
+    // Room for every id, so building a body never reallocates
+    _body.reserve(_prefix.length() + idBytes + 3 * _n + 32);
+    _want = NULL;
+
+    // Keys are const char * and stored by reference
+    size_t objects = JSON_OBJECT_SIZE(_n) + _n * JSON_OBJECT_SIZE(2);
+    _filter = new DynamicJsonDocument(objects);
+    for (uint8_t i = 0; i < _n; i++) {
+      JsonObject f = _filter->createNestedObject(_e[i].id);
+      f["state"] = true;
+      f["last_changed"] = true;
+    }
+    _doc = new DynamicJsonDocument(
+        objects + idBytes + _n * (sizeof("state") + sizeof("last_changed") +
+                                  HA_STATE_LEN + HA_CHANGED_LEN));
+  }
+
+  // Request body for the entities with want[i] set, or for all of them.
+  const String &body(const bool *want = NULL) {
+    _want = want;
+    _body = _prefix;
+    _body += ",\"variables\":{\"ids\":[";
+    bool first = true;
+    for (uint8_t i = 0; i < _n; i++) {
+      if (want && !want[i])
+        continue;
+      if (!first)
+        _body += ',';
+      _body += '"';
+      _body += _e[i].id;
+      _body += '"';
+      first = false;
+    }
+    _body += "]}}";
+    return _body;
+  }
+
+  // Returns false if the response is not valid JSON; requested entities
+  // missing from a valid response are marked invalid, the others are left
+  // untouched.
+  template <class TInput> bool parse(TInput &input) {
+    DeserializationError err = deserializeJson(
+        *_doc, input, DeserializationOption::Filter(*_filter));
+    if (err) {
+      Serial.printf("HA states: %s\n", err.c_str());
+      return false;
+    }
+    for (uint8_t i = 0; i < _n; i++) {
+      if (_want && !_want[i])
+        continue;
+      JsonObjectConst o = (*_doc)[_e[i].id];
+      _e[i].valid = !o.isNull();
+      strlcpy(_e[i].state, o["state"] | "", HA_STATE_LEN);
+      strlcpy(_e[i].lastChanged, o["last_changed"] | "", HA_CHANGED_LEN);
+    }
+    _doc->clear();
+    return true;
+  }
+
+private:
+  HaEntityState *_e = NULL;
+  uint8_t _n = 0;
+  String _prefix; // {"template":"..."  without the closing brace
+  String _body;
+  const bool *_want = NULL; // Entities of the last body()
+  DynamicJsonDocument *_filter = NULL;
+  DynamicJsonDocument *_doc = NULL;
+};
+
+#endif
@@ -0,0 +1,148 @@
+#ifndef HISTORY_CHART_H
+#define HISTORY_CHART_H
+
+#include "lttb.h"
+#include "sensor_history.h"
+#include <lvgl.h>
+
+// Sparklines of SensorHistory rings on lv_chart series. Every
+// HISTORY_GROUP buckets become one chart point through LTTB, so the chart
+// shows the last HISTORY_POINTS complete groups (about 24 h). refresh()
+// appends the groups completed since the last call with
+// lv_chart_set_next_value() on a shift-mode chart, and only the first draw
+// (or one after a long pause) downsamples the whole ring. Series are
+// dropped when their chart is deleted; a new one draws the whole ring.
+
+#define HISTORY_GROUP 4 // Buckets per chart point: 12 min
+#define HISTORY_POINTS (HISTORY_SAMPLES / HISTORY_GROUP - 1)
+#define HISTORY_SERIES_MAX 16
+
+struct HistorySeries {
+  lv_obj_t *chart;
+  lv_chart_series_t *ser;
+  lv_chart_axis_t axis;
+  const SensorHistory *h;
+  uint32_t groups; // Groups drawn so far (all before this number)
+  LttbPoint last;  // Last point drawn, x in buckets
+};
+
+class HistoryCharts {
+public:
+  // Sets up `chart` as a borderless sparkline; call once per chart.
+  static void style(lv_obj_t *chart) {
+    lv_chart_set_type(chart, LV_CHART_TYPE_LINE);
+    lv_chart_set_point_count(chart, HISTORY_POINTS);
+    lv_chart_set_update_mode(chart, LV_CHART_UPDATE_MODE_SHIFT);
+    lv_chart_set_div_line_count(chart, 0, 0);
+    lv_obj_set_style_bg_opa(chart, 0, 0);
+    lv_obj_set_style_border_width(chart, 0, 0);
+    lv_obj_set_style_pad_all(chart, 2, 0);
+    lv_obj_set_style_line_width(chart, 2, LV_PART_ITEMS);
+    lv_obj_set_style_size(chart, 0, LV_PART_INDICATOR); // No point markers
+  }
+
+  // One series per axis and chart, so each gets its own scale.
+  bool add(lv_obj_t *chart, lv_color_t color, lv_chart_axis_t axis,
+           const SensorHistory *h) {
+    if (!chart || !h || _count >= HISTORY_SERIES_MAX)
+      return false;
+    lv_chart_series_t *ser = lv_chart_add_series(chart, color, axis);
+    if (!ser)
+      return false;
+    lv_chart_set_all_value(chart, ser, LV_CHART_POINT_NONE);
+    _series[_count++] = {chart, ser, axis, h, 0, {0, LTTB_NONE}};
+    lv_obj_add_event_cb(chart, onDelete, LV_EVENT_DELETE, this);
+    return true;
+  }
+
+  // Returns the number of series that got new points.
+  uint8_t refresh() {
+    uint8_t changed = 0;
+    for (uint8_t i = 0; i < _count; i++) {
+      HistorySeries &s = _series[i];
+      uint32_t done = s.h->bucket() / HISTORY_GROUP;
+      if (done == s.groups)
+        continue;
+      if (s.groups == 0 || done - s.groups >= HISTORY_POINTS)
+        redraw(s, done);
+      else
+        while (s.groups < done)
+          append(s, done);
+      rescale(s);
+      changed++;
+    }
+    return changed;
+  }
+
+private:
+  static void onDelete(lv_event_t *e) {
+    HistoryCharts *self = (HistoryCharts *)lv_event_get_user_data(e);
+    lv_obj_t *chart = lv_event_get_target(e);
+    uint8_t n = 0;
+    for (uint8_t i = 0; i < self->_count; i++)
+      if (self->_series[i].chart != chart)
+        self->_series[n++] = self->_series[i];
+    self->_count = n;
+  }
+
+  void append(HistorySeries &s, uint32_t done) {
+    int16_t group[HISTORY_GROUP];
+    int16_t next[HISTORY_GROUP];
+    uint32_t b = s.groups * HISTORY_GROUP;
+    for (uint8_t i = 0; i < HISTORY_GROUP; i++) {
+      group[i] = s.h->at(b + i);
+      next[i] = s.h->at(b + HISTORY_GROUP + i);
+    }
+    LttbPoint c = s.groups + 1 < done
+                      ? lttbMean(next, HISTORY_GROUP, b + HISTORY_GROUP)
+                      : LttbPoint{(float)(b + HISTORY_GROUP), s.h->held()};
+    LttbPoint p = lttbPick(group, HISTORY_GROUP, b, s.last, c);
+    push(s, p.y);
+    if (p.y != LTTB_NONE)
+      s.last = p;
+    s.groups++;
+  }
+
+  void redraw(HistorySeries &s, uint32_t done) {
+    static int16_t samples[HISTORY_POINTS * HISTORY_GROUP];
+    int16_t points[HISTORY_POINTS];
+    uint32_t first = done - HISTORY_POINTS;
+    for (uint16_t i = 0; i < HISTORY_POINTS * HISTORY_GROUP; i++)
+      samples[i] = s.h->at(first * HISTORY_GROUP + i);
+    s.last = lttbDownsample(samples, HISTORY_POINTS, HISTORY_GROUP,
+                            s.h->held(), points);
+    s.last.x += first * HISTORY_GROUP;
+    for (uint16_t i = 0; i < HISTORY_POINTS; i++)
+      push(s, points[i]);
+    s.groups = done;
+  }
+
+  static void push(HistorySeries &s, int16_t y) {
+    // LV_CHART_POINT_NONE is LV_COORD_MAX; keep real values below it
+    lv_coord_t v = y == LTTB_NONE ? LV_CHART_POINT_NONE
+                                  : LV_CLAMP(-LV_COORD_MAX + 1, y,
+                                             LV_COORD_MAX - 1);
+    lv_chart_set_next_value(s.chart, s.ser, v);
+  }
+
+  // Fits the axis to the values on screen
+  static void rescale(HistorySeries &s) {
+    lv_coord_t *y = lv_chart_get_y_array(s.chart, s.ser);
+    lv_coord_t lo = LV_COORD_MAX, hi = -LV_COORD_MAX;
+    for (uint16_t i = 0; i < HISTORY_POINTS; i++) {
+      if (y[i] == LV_CHART_POINT_NONE)
+        continue;
+      lo = LV_MIN(lo, y[i]);
+      hi = LV_MAX(hi, y[i]);
+    }
+    if (lo > hi)
+      return;
+    lv_coord_t pad = LV_MAX((hi - lo) / 8, HISTORY_SCALE / 2);
+    lv_chart_set_range(s.chart, s.axis, lo - pad, hi + pad);
+  }
+
+  HistorySeries _series[HISTORY_SERIES_MAX];
+  uint8_t _count = 0;
+};
+
+#endif
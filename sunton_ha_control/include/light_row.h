@@ -0,0 +1,151 @@
+#ifndef LIGHT_ROW_H
+#define LIGHT_ROW_H
+
+#include <lvgl.h>
+#include <stdio.h>
+#include <string.h>
+
+// A light row (background, name and on/off toggle) as one LVGL object
+// instead of a container, a label and an lv_switch. The row draws itself
+// in LV_EVENT_DRAW_MAIN with fixed descriptors, so it has no styles to
+// resolve and nothing to lay out, and only the toggle end takes clicks.
+//
+// It behaves like the switch it replaces: LV_STATE_CHECKED is the light
+// state, and a click toggles it and sends LV_EVENT_VALUE_CHANGED, so
+// EntityBinder::toggle() and the command rollback work on the row.
+
+#define LIGHT_ROW_WIDTH 220
+#define LIGHT_ROW_HEIGHT 38
+#define LIGHT_ROW_RADIUS 8
+#define LIGHT_ROW_PAD 20 // Text inset and toggle margin
+#define LIGHT_ROW_TOGGLE_W 45
+#define LIGHT_ROW_TOGGLE_H 23
+#define LIGHT_ROW_KNOB_INSET 3
+#define LIGHT_ROW_TEXT_LEN 16
+#ifndef LIGHT_ROW_BG
+#define LIGHT_ROW_BG 0x1F222D
+#endif
+#ifndef LIGHT_ROW_TEXT
+#define LIGHT_ROW_TEXT 0x8C92AC
+#endif
+
+struct LightRow {
+  lv_obj_t obj; // First, as LVGL widgets do
+  char text[LIGHT_ROW_TEXT_LEN];
+};
+
+// Toggle area of `obj`, in screen coordinates
+inline void lightRowToggle(const lv_obj_t *obj, lv_area_t *a) {
+  a->x2 = obj->coords.x2 - LIGHT_ROW_PAD;
+  a->x1 = a->x2 - LIGHT_ROW_TOGGLE_W + 1;
+  a->y1 = obj->coords.y1 + (lv_area_get_height(&obj->coords) -
+                            LIGHT_ROW_TOGGLE_H) / 2;
+  a->y2 = a->y1 + LIGHT_ROW_TOGGLE_H - 1;
+}
+
+inline void lightRowDraw(lv_obj_t *obj, lv_draw_ctx_t *ctx) {
+  const LightRow *row = (const LightRow *)obj;
+  lv_draw_rect_dsc_t rect;
+  lv_draw_rect_dsc_init(&rect);
+  rect.radius = LIGHT_ROW_RADIUS;
+  rect.bg_color = lv_color_hex(LIGHT_ROW_BG);
+  lv_draw_rect(ctx, &rect, &obj->coords);
+
+  lv_area_t toggle;
+  lightRowToggle(obj, &toggle);
+
+  lv_draw_label_dsc_t label;
+  lv_draw_label_dsc_init(&label);
+  label.font = &ui_font_14;
+  label.color = lv_color_hex(LIGHT_ROW_TEXT);
+  lv_coord_t h = lv_font_get_line_height(label.font);
+  lv_area_t text;
+  text.x1 = obj->coords.x1 + LIGHT_ROW_PAD;
+  text.x2 = toggle.x1 - 1;
+  text.y1 = obj->coords.y1 + (lv_area_get_height(&obj->coords) - h) / 2;
+  text.y2 = text.y1 + h - 1;
+  lv_draw_label(ctx, &label, &text, row->text, NULL);
+
+  // Colours of lv_switch under the default theme
+  bool on = lv_obj_has_state(obj, LV_STATE_CHECKED);
+  rect.radius = LV_RADIUS_CIRCLE;
+  rect.bg_color = on ? lv_obj_get_style_bg_color(obj, LV_PART_INDICATOR)
+                     : lv_palette_lighten(LV_PALETTE_GREY, 2);
+  lv_draw_rect(ctx, &rect, &toggle);
+
+  lv_area_t knob;
+  knob.x1 = on ? toggle.x2 - LIGHT_ROW_TOGGLE_H + 1 : toggle.x1;
+  knob.x2 = knob.x1 + LIGHT_ROW_TOGGLE_H - 1;
+  knob.y1 = toggle.y1;
+  knob.y2 = toggle.y2;
+  lv_area_increase(&knob, -LIGHT_ROW_KNOB_INSET, -LIGHT_ROW_KNOB_INSET);
+  rect.bg_color = lv_color_white();
+  lv_draw_rect(ctx, &rect, &knob);
+}
+
+inline void lightRowEvent(const lv_obj_class_t *cls, lv_event_t *e) {
+  lv_event_code_t code = lv_event_get_code(e);
+  lv_obj_t *obj = lv_event_get_target(e);
+  if (code == LV_EVENT_DRAW_MAIN) {
+    lightRowDraw(obj, lv_event_get_draw_ctx(e));
+  } else if (code == LV_EVENT_COVER_CHECK) {
+    lv_event_set_cover_res(e, LV_COVER_RES_NOT_COVER); // Rounded corners
+  } else if (code == LV_EVENT_HIT_TEST) {
+    // The toggle and its margins, over the full height of the row
+    lv_hit_test_info_t *info = (lv_hit_test_info_t *)lv_event_get_param(e);
+    lv_area_t hit;
+    lightRowToggle(obj, &hit);
+    hit.x1 -= LIGHT_ROW_PAD / 2;
+    hit.x2 = obj->coords.x2;
+    hit.y1 = obj->coords.y1;
+    hit.y2 = obj->coords.y2;
+    info->res = _lv_area_is_point_on(&hit, info->point, 0);
+  } else if (code != LV_EVENT_DRAW_POST) { // No scrollbar or outline
+    lv_obj_event_base(cls, e);
+  }
+}
+
+inline void lightRowConstructor(const lv_obj_class_t *cls, lv_obj_t *obj) {
+  LV_UNUSED(cls);
+  // The only style: a state change must differ in some style for LVGL to
+  // redraw the object, and it carries the toggle colour when on
+  static lv_style_t checked;
+  static bool ready = false;
+  if (!ready) {
+    lv_style_init(&checked);
+    lv_style_set_bg_color(&checked, lv_theme_get_color_primary(obj));
+    ready = true;
+  }
+  lv_obj_add_style(obj, &checked, LV_PART_INDICATOR | LV_STATE_CHECKED);
+  lv_obj_clear_flag(obj, LV_OBJ_FLAG_SCROLLABLE);
+  lv_obj_add_flag(obj, LV_OBJ_FLAG_CHECKABLE | LV_OBJ_FLAG_ADV_HITTEST);
+  ((LightRow *)obj)->text[0] = '\0';
+}
+
+inline const lv_obj_class_t *lightRowClass() {
+  static lv_obj_class_t cls;
+  if (!cls.base_class) {
+    cls.base_class = &lv_obj_class;
+    cls.constructor_cb = lightRowConstructor;
+    cls.event_cb = lightRowEvent;
+    cls.width_def = LIGHT_ROW_WIDTH;
+    cls.height_def = LIGHT_ROW_HEIGHT;
+    cls.instance_size = sizeof(LightRow);
+  }
+  return &cls;
+}
+
+inline void lightRowSetText(lv_obj_t *obj, const char *text) {
+  LightRow *row = (LightRow *)obj;
+  snprintf(row->text, sizeof(row->text), "%s", text);
+  lv_obj_invalidate(obj);
+}
+
+inline lv_obj_t *lightRowCreate(lv_obj_t *parent, const char *text) {
+  lv_obj_t *obj = lv_obj_class_create_obj(lightRowClass(), parent);
+  lv_obj_class_init_obj(obj);
+  lightRowSetText(obj, text);
+  return obj;
+}
+
+#endif
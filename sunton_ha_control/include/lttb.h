@@ -0,0 +1,85 @@
+#ifndef LTTB_H
+#define LTTB_H
+
+#include <math.h>
+#include <stdint.h>
+
+// Largest-Triangle-Three-Buckets downsampling (Steinarsson, 2013) over
+// groups of a fixed size: group g of the input becomes output point g, the
+// sample that makes the largest triangle with the point picked for the
+// previous group and the mean of the next group. Unlike classic LTTB the
+// groups do not depend on the length of the series, so a complete group
+// keeps its point and a chart can append new points without redrawing the
+// old ones. LTTB_NONE samples (unknown) are skipped.
+
+#define LTTB_NONE INT16_MIN
+
+struct LttbPoint {
+  float x; // Sample index, from the start of the series
+  int16_t y;
+};
+
+// Picks from the group y[0..size), which starts at index `x0`, given the
+// previous pick `a` and the next group's mean `c`. Without `a` the first
+// known sample is picked, without `c` the last, as classic LTTB does at
+// both ends. Returns y = LTTB_NONE for a group with no known sample.
+inline LttbPoint lttbPick(const int16_t *y, uint16_t size, float x0,
+                          LttbPoint a, LttbPoint c) {
+  LttbPoint best = {x0, LTTB_NONE};
+  float bestArea = -1;
+  for (uint16_t i = 0; i < size; i++) {
+    if (y[i] == LTTB_NONE)
+      continue;
+    float x = x0 + i;
+    if (a.y == LTTB_NONE && best.y != LTTB_NONE)
+      break; // First known sample
+    // Twice the triangle area; the constant factor does not matter
+    float area = (a.y == LTTB_NONE || c.y == LTTB_NONE)
+                     ? 0
+                     : fabsf((a.x - c.x) * (y[i] - a.y) -
+                             (a.x - x) * (c.y - a.y));
+    if (area >= bestArea) {
+      bestArea = area;
+      best = {x, y[i]};
+    }
+  }
+  return best;
+}
+
+// Mean of the known samples of a group, y = LTTB_NONE if there are none.
+inline LttbPoint lttbMean(const int16_t *y, uint16_t size, float x0) {
+  float sx = 0, sy = 0;
+  uint16_t n = 0;
+  for (uint16_t i = 0; i < size; i++) {
+    if (y[i] != LTTB_NONE) {
+      sx += x0 + i;
+      sy += y[i];
+      n++;
+    }
+  }
+  if (n == 0)
+    return {x0, LTTB_NONE};
+  return {sx / n, (int16_t)lroundf(sy / n)};
+}
+
+// Downsamples groups * size samples of `y` to `groups` points in `out`.
+// `next` is the sample that will follow the series (the latest reading),
+// used as the right-hand point of the last group. Returns the last pick,
+// to continue the series with lttbPick() as groups complete.
+inline LttbPoint lttbDownsample(const int16_t *y, uint16_t groups,
+                                uint16_t size, int16_t next, int16_t *out) {
+  LttbPoint a = {0, LTTB_NONE};
+  for (uint16_t g = 0; g < groups; g++) {
+    const int16_t *group = y + g * size;
+    float x0 = (float)g * size;
+    LttbPoint c = g + 1 < groups ? lttbMean(group + size, size, x0 + size)
+                                 : LttbPoint{x0 + size, next};
+    LttbPoint p = lttbPick(group, size, x0, a, c);
+    out[g] = p.y;
+    if (p.y != LTTB_NONE)
+      a = p;
+  }
+  return a;
+}
+
+#endif
@@ -0,0 +1,108 @@
+#ifndef POLL_SCHEDULER_H
+#define POLL_SCHEDULER_H
+
+#include <stdint.h>
+#include <string.h>
+
+// Decides which watched entities each REST poll asks for. Entities with a
+// widget on the active tab are refreshed every POLL_VISIBLE_MS and the rest
+// every POLL_HIDDEN_MS; while the screen is idle (no touch) everything
+// backs off one step, visible entities to POLL_HIDDEN_MS and hidden ones to
+// POLL_IDLE_MS. When something is due, entities past half their interval
+// ride along in the same request instead of costing one of their own.
+//
+// An entity that becomes visible, and the visible ones when the screen
+// wakes up, are due at once so the user never looks at an old value.
+
+#ifndef POLL_VISIBLE_MS
+#define POLL_VISIBLE_MS 5000
+#endif
+#ifndef POLL_HIDDEN_MS
+#define POLL_HIDDEN_MS 60000
+#endif
+#ifndef POLL_IDLE_MS
+#define POLL_IDLE_MS 300000
+#endif
+#define POLL_MAX_ENTITIES 128
+#define POLL_RATE_WINDOW 60000
+
+class PollScheduler {
+public:
+  void begin(uint8_t count) {
+    _n = count < POLL_MAX_ENTITIES ? count : POLL_MAX_ENTITIES;
+    memset(_visible, 0, sizeof(_visible));
+    stale();
+  }
+
+  void setVisible(uint8_t i, bool visible) {
+    if (visible && !_visible[i])
+      _stale[i] = true;
+    _visible[i] = visible;
+  }
+
+  // Everything is due on the next check, e.g. after a reconnect
+  void stale() { memset(_stale, 1, sizeof(_stale)); }
+
+  // Sets want[i] for the entities to request now; returns how many.
+  uint8_t due(uint32_t now, bool idle, bool *want) {
+    if (_idle && !idle)
+      for (uint8_t i = 0; i < _n; i++)
+        _stale[i] |= _visible[i];
+    _idle = idle;
+    bool any = false;
+    for (uint8_t i = 0; i < _n; i++) {
+      want[i] = _stale[i] || now - _last[i] >= interval(i);
+      any |= want[i];
+    }
+    if (!any)
+      return 0;
+    uint8_t count = 0;
+    for (uint8_t i = 0; i < _n; i++) {
+      want[i] |= now - _last[i] >= interval(i) / 2;
+      count += want[i];
+    }
+    return count;
+  }
+
+  // After a request for `want`, whether it succeeded or not; failed
+  // entities are retried on their normal interval.
+  void polled(const bool *want, uint32_t now) {
+    for (uint8_t i = 0; i < _n; i++) {
+      if (want[i]) {
+        _last[i] = now;
+        _stale[i] = false;
+        _entities++;
+      }
+    }
+    _requests++;
+  }
+
+  // True once per POLL_RATE_WINDOW, with the counts of that window.
+  bool window(uint32_t now, uint32_t &requests, uint32_t &entities) {
+    if (now - _windowStart < POLL_RATE_WINDOW)
+      return false;
+    requests = _requests;
+    entities = _entities;
+    _requests = _entities = 0;
+    _windowStart = now;
+    return true;
+  }
+
+private:
+  uint32_t interval(uint8_t i) const {
+    if (_visible[i])
+      return _idle ? POLL_HIDDEN_MS : POLL_VISIBLE_MS;
+    return _idle ? POLL_IDLE_MS : POLL_HIDDEN_MS;
+  }
+
+  uint8_t _n = 0;
+  bool _visible[POLL_MAX_ENTITIES];
+  bool _stale[POLL_MAX_ENTITIES];
+  uint32_t _last[POLL_MAX_ENTITIES] = {0};
+  bool _idle = false;
+  uint32_t _windowStart = 0;
+  uint32_t _requests = 0;
+  uint32_t _entities = 0;
+};
+
+#endif
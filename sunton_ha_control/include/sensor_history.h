@@ -0,0 +1,194 @@
+#ifndef SENSOR_HISTORY_H
+#define SENSOR_HISTORY_H
+
+#include <ArduinoJson.h>
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Last 24 h of a numeric sensor in HISTORY_SAMPLES fixed-point slots, one
+// per HISTORY_PERIOD_S bucket of wall-clock time: 960 bytes of samples per
+// sensor, no timestamps stored. HA only reports a sensor when it changes,
+// so a bucket holds the value the sensor had when the bucket closed.
+//
+// The ring is seeded once from /api/history (historySeed()) and then
+// extended with live readings from the entity store; nothing is fetched
+// again after boot.
+
+#define HISTORY_SAMPLES 480
+#define HISTORY_PERIOD_S 180 // 480 x 3 min = 24 h
+#define HISTORY_SCALE 10     // Stored as tenths: 21.5 C -> 215
+#define HISTORY_NONE INT16_MIN
+
+class SensorHistory {
+public:
+  SensorHistory() { clear(); }
+
+  void clear() {
+    for (uint16_t i = 0; i < HISTORY_SAMPLES; i++)
+      _samples[i] = HISTORY_NONE;
+    _bucket = 0;
+    _held = HISTORY_NONE;
+  }
+
+  // A reading at `t` (unix seconds). Readings older than the open bucket
+  // are ignored; NaN (e.g. "unavailable") keeps the previous value.
+  void add(uint32_t t, float value) {
+    tick(t);
+    if (t / HISTORY_PERIOD_S < _bucket || isnan(value))
+      return;
+    long v = lroundf(value * HISTORY_SCALE);
+    _held = (int16_t)(v < -32767 ? -32767 : v > 32767 ? 32767 : v);
+  }
+
+  // Closes the buckets that ended before `t`.
+  void tick(uint32_t t) {
+    uint32_t b = t / HISTORY_PERIOD_S;
+    if (_bucket == 0)
+      _bucket = b;
+    if (b <= _bucket)
+      return;
+    // After a long gap only the last HISTORY_SAMPLES buckets matter
+    uint32_t from = b - _bucket > HISTORY_SAMPLES ? b - HISTORY_SAMPLES
+                                                  : _bucket;
+    for (uint32_t k = from; k < b; k++)
+      _samples[k % HISTORY_SAMPLES] = _held;
+    _bucket = b;
+  }
+
+  // Number of the open bucket; the ones before it are complete.
+  uint32_t bucket() const { return _bucket; }
+  // Value of complete bucket `b`, HISTORY_NONE if unknown or out of range.
+  int16_t at(uint32_t b) const {
+    if (b >= _bucket || _bucket - b > HISTORY_SAMPLES)
+      return HISTORY_NONE;
+    return _samples[b % HISTORY_SAMPLES];
+  }
+  // Latest reading, which the open bucket will close with.
+  int16_t held() const { return _held; }
+
+private:
+  int16_t _samples[HISTORY_SAMPLES];
+  uint32_t _bucket;
+  int16_t _held;
+};
+
+// "2024-05-01T12:34:56.123456+00:00" to unix seconds; 0 if malformed.
+inline uint32_t historyParseTime(const char *s) {
+  int y, mo, d, h, mi, sec;
+  if (!s ||
+      sscanf(s, "%4d-%2d-%2dT%2d:%2d:%2d", &y, &mo, &d, &h, &mi, &sec) != 6)
+    return 0;
+  // Days from civil (proleptic Gregorian), as in H. Hinnant's algorithm
+  y -= mo <= 2;
+  int era = (y >= 0 ? y : y - 399) / 400;
+  unsigned yoe = (unsigned)(y - era * 400);
+  unsigned doy = (153 * (mo + (mo > 2 ? -3 : 9)) + 2) / 5 + d - 1;
+  unsigned doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+  long days = era * 146097L + (long)doe - 719468;
+  long t = days * 86400 + h * 3600 + mi * 60 + sec;
+  // UTC offset after the seconds and their fraction
+  const char *tz = s + 19;
+  while (*tz == '.' || (*tz >= '0' && *tz <= '9'))
+    tz++;
+  if ((*tz == '+' || *tz == '-') && strlen(tz) >= 6) {
+    long off = atol(tz + 1) * 3600 + atol(tz + 4) * 60;
+    t -= *tz == '+' ? off : -off;
+  }
+  return t > 0 ? (uint32_t)t : 0;
+}
+
+// Next character that is not whitespace, -1 at the end of the stream.
+template <class TStream> int historyNextChar(TStream &in) {
+  int c;
+  do
+    c = in.read();
+  while (c == ' ' || c == '\n' || c == '\r' || c == '\t');
+  return c;
+}
+
+// Feeds a /api/history/period response for one entity, requested with
+// minimal_response and no_attributes, into a SensorHistory:
+//
+//   [[{"entity_id": "...", "state": "21.5", "last_changed": "..."},
+//     {"state": "21.6", "last_changed": "..."}, ...]]
+//
+// The array is read one state at a time straight from the stream, so a
+// day of frequent changes never has to fit in memory, and step() stops
+// after a few states so a long response can be read in slices.
+class HistorySeed {
+public:
+  void begin(SensorHistory &h, uint32_t now) {
+    _h = &h;
+    _now = now;
+    _n = 0;
+    _open = false;
+    _filter.clear();
+    _filter["state"] = true;
+    _filter["last_changed"] = true;
+  }
+
+  // Reads up to `max` states; true while there are more.
+  template <class TStream> bool step(TStream &in, uint16_t max) {
+    if (!_open) {
+      _open = true;
+      if (historyNextChar(in) != '[')
+        return fail();
+      int c = historyNextChar(in);
+      if (c == ']')
+        return false; // No history for the entity
+      if (c != '[')
+        return fail();
+    }
+    for (uint16_t i = 0; i < max; i++) {
+      if (deserializeJson(_doc, in, DeserializationOption::Filter(_filter)))
+        return _n ? false : fail();
+      uint32_t t = historyParseTime(_doc["last_changed"] | "");
+      const char *state = _doc["state"] | "";
+      char *end;
+      float v = strtof(state, &end);
+      if (t && t <= _now)
+        _h->add(t, end == state ? NAN : v);
+      _n++;
+      if (historyNextChar(in) != ',')
+        return false; // "]" ends the array; anything else cuts it short
+    }
+    return true;
+  }
+
+  // States read so far, -1 if the response is malformed.
+  int states() const { return _n; }
+
+  // Closes the buckets up to `now`; call once step() is done.
+  void finish() { _h->tick(_now); }
+
+private:
+  bool fail() {
+    _n = -1;
+    return false;
+  }
+
+  SensorHistory *_h = NULL;
+  uint32_t _now = 0;
+  int _n = 0;
+  bool _open = false;
+  StaticJsonDocument<64> _filter;
+  StaticJsonDocument<192> _doc;
+};
+
+// Reads a whole response in one go. Returns the number of states read, or
+// -1 if the response is malformed.
+template <class TStream>
+int historySeed(TStream &in, SensorHistory &h, uint32_t now) {
+  HistorySeed seed;
+  seed.begin(h, now);
+  while (seed.step(in, 32)) {
+  }
+  if (seed.states() >= 0)
+    seed.finish();
+  return seed.states();
+}
+
+#endif
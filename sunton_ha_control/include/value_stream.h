@@ -0,0 +1,110 @@
+#ifndef VALUE_STREAM_H
+#define VALUE_STREAM_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Continuous controls (dimmer and cover sliders) as a stream of service
+// calls that HA can keep up with. The widget sets a target on every
+// event and shows it straight away; next() hands out what to send, with
+// these rules per key (entity):
+//
+// - one call in flight at most: targets set meanwhile replace each other
+//   and only the newest goes out after done()
+// - while the finger is down, one call per VALUE_STREAM_MS at most
+// - the value at release goes out as soon as nothing is in flight, and no
+//   target is left unsent, held or not
+//
+// A failed call is not retried; the next target goes out as usual. The
+// last target of each key stays for target(), so a rebuilt page shows it.
+// ValueStream holds no hardware or network, so the host can replay drags
+// against a simulated HA latency.
+
+#ifndef VALUE_STREAM_SLOTS
+#define VALUE_STREAM_SLOTS 16
+#endif
+#ifndef VALUE_STREAM_MS
+#define VALUE_STREAM_MS 250
+#endif
+
+class ValueStream {
+public:
+  // From the widget; `held` while the finger is still on it. False when
+  // every slot is taken by other keys.
+  bool set(uint8_t key, int16_t value, bool held) {
+    Slot *s = find(key);
+    if (!s) {
+      if (_count >= VALUE_STREAM_SLOTS)
+        return false;
+      s = &_slots[_count++];
+      *s = {key, value, -1, 0, 0, false, false};
+    }
+    s->target = value;
+    s->held = held;
+    return true;
+  }
+
+  // A target due at `now`, marked in flight; false when none is.
+  bool next(uint32_t now, uint8_t &key, int16_t &value) {
+    for (uint8_t i = 0; i < _count; i++) {
+      Slot &s = _slots[i];
+      if (s.busy || s.target == s.sent ||
+          (s.held && s.at && now - s.at < VALUE_STREAM_MS))
+        continue;
+      s.busy = true;
+      s.sending = s.target;
+      s.at = now | 1;
+      key = s.key;
+      value = s.target;
+      return true;
+    }
+    return false;
+  }
+
+  // The call for `key` ended, ok or not. `sent` false when it never left
+  // (command queue full): the target is due again at once.
+  void done(uint8_t key, bool sent = true) {
+    Slot *s = find(key);
+    if (!s || !s->busy)
+      return;
+    s->busy = false;
+    if (sent)
+      s->sent = s->sending;
+    else
+      s->at = 0;
+  }
+
+  // Last target set for `key`; false before the first
+  bool target(uint8_t key, int16_t &value) const {
+    for (uint8_t i = 0; i < _count; i++) {
+      if (_slots[i].key == key) {
+        value = _slots[i].target;
+        return true;
+      }
+    }
+    return false;
+  }
+
+private:
+  struct Slot {
+    uint8_t key;
+    int16_t target;
+    int16_t sent; // Last value handed to HA, -1 for none
+    int16_t sending;
+    uint32_t at; // When the last call went out, 0 for never
+    bool held;
+    bool busy;
+  };
+
+  Slot *find(uint8_t key) {
+    for (uint8_t i = 0; i < _count; i++)
+      if (_slots[i].key == key)
+        return &_slots[i];
+    return NULL;
+  }
+
+  Slot _slots[VALUE_STREAM_SLOTS];
+  uint8_t _count = 0;
+};
+
+#endif
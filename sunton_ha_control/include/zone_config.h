@@ -0,0 +1,211 @@
+#ifndef ZONE_CONFIG_H
+#define ZONE_CONFIG_H
+
+#include "entity_store.h"
+#include <ArduinoJson.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Zones, entities and scenes read once at boot from /zones.json on LittleFS:
+//
+// {"zones": [
+//   {"name": "Hab 1", "nav": "H1",
+//    "lights": ["light.hab1_primaria", "light.hab1_secundaria"],
+//    "led": "light.hab1_led", "covers": ["cover.persiana_hab1"],
+//    "temp": "sensor.hab1_temperatura", "hum": "sensor.hab1_humedad"}
+//  ],
+//  "scenes": [{"name": "CINE", "id": "scene.modo_cine", "color": "3D5AFE"}]}
+//
+// Every entity id is interned once into ZoneConfig::entities, with its
+// service domain split off, and zones and scenes refer to entities by
+// index. All strings live in one pool inside the config, so nothing is
+// allocated or concatenated after boot. Without the file the panel falls
+// back to the ids compiled in from config.h.
+
+#define ZONE_MAX_ZONES 24
+#define ZONE_MAX_SCENES 8
+#define ZONE_MAX_ENTITIES 128
+#define ZONE_MAX_LIGHTS 3
+#define ZONE_MAX_COVERS 2
+#define ZONE_POOL_LEN 4096
+#define ZONE_NONE 0xFF
+#define ZONE_SCENE_COLOR 0x3D5AFE
+
+struct ZoneEntity {
+  const char *id;     // "light.salon_primaria"
+  const char *domain; // "light", for service calls
+  EntityType type;
+  bool watched; // Polled / subscribed and shown on screen
+  int16_t slot; // EntityStore handle, set by the panel; -1 if unwatched
+};
+
+struct Zone {
+  const char *name; // Tab title
+  const char *nav;  // Nav bar button
+  uint8_t lights[ZONE_MAX_LIGHTS]; // Indexes into ZoneConfig::entities
+  uint8_t numLights;
+  uint8_t led;
+  uint8_t covers[ZONE_MAX_COVERS];
+  uint8_t numCovers;
+  uint8_t temp; // ZONE_NONE without sensors
+  uint8_t hum;
+};
+
+struct Scene {
+  const char *name;
+  uint8_t entity;
+  uint32_t color;
+};
+
+struct ZoneConfig {
+  Zone zones[ZONE_MAX_ZONES];
+  uint8_t zoneCount;
+  Scene scenes[ZONE_MAX_SCENES];
+  uint8_t sceneCount;
+  ZoneEntity entities[ZONE_MAX_ENTITIES];
+  uint8_t entityCount;
+  char pool[ZONE_POOL_LEN];
+  uint16_t poolUsed;
+};
+
+inline void zoneConfigClear(ZoneConfig &cfg) { memset(&cfg, 0, sizeof(cfg)); }
+
+// Copies `len` bytes of `s` into the pool; NULL when it is full.
+inline const char *zoneConfigString(ZoneConfig &cfg, const char *s,
+                                    size_t len) {
+  if (cfg.poolUsed + len + 1 > ZONE_POOL_LEN)
+    return NULL;
+  char *p = cfg.pool + cfg.poolUsed;
+  memcpy(p, s, len);
+  p[len] = '\0';
+  cfg.poolUsed += len + 1;
+  return p;
+}
+
+// Index of `id`, added on first use; ZONE_NONE for "" or when full. An id
+// used in several roles keeps its first type and is watched if any is.
+inline uint8_t zoneConfigIntern(ZoneConfig &cfg, const char *id,
+                                EntityType type, bool watched) {
+  const char *dot = id ? strchr(id, '.') : NULL;
+  if (!dot || dot == id)
+    return ZONE_NONE;
+  for (uint8_t i = 0; i < cfg.entityCount; i++) {
+    if (strcmp(cfg.entities[i].id, id) == 0) {
+      cfg.entities[i].watched |= watched;
+      return i;
+    }
+  }
+  if (cfg.entityCount >= ZONE_MAX_ENTITIES)
+    return ZONE_NONE;
+  ZoneEntity &e = cfg.entities[cfg.entityCount];
+  size_t domainLen = dot - id;
+  e.domain = NULL;
+  for (uint8_t i = 0; i < cfg.entityCount && !e.domain; i++) {
+    const char *d = cfg.entities[i].domain;
+    if (strncmp(d, id, domainLen) == 0 && d[domainLen] == '\0')
+      e.domain = d;
+  }
+  if (!e.domain)
+    e.domain = zoneConfigString(cfg, id, domainLen);
+  e.id = zoneConfigString(cfg, id, strlen(id));
+  if (!e.domain || !e.id)
+    return ZONE_NONE;
+  e.type = type;
+  e.watched = watched;
+  e.slot = -1;
+  return cfg.entityCount++;
+}
+
+// Ids may be "" for none. `nav` defaults to the name.
+inline bool zoneConfigAddZone(ZoneConfig &cfg, const char *name,
+                              const char *nav, const char *const *lights,
+                              uint8_t numLights, const char *led,
+                              const char *const *covers, uint8_t numCovers,
+                              const char *temp, const char *hum) {
+  if (cfg.zoneCount >= ZONE_MAX_ZONES)
+    return false;
+  Zone &z = cfg.zones[cfg.zoneCount];
+  z.name = zoneConfigString(cfg, name, strlen(name));
+  z.nav = *nav ? zoneConfigString(cfg, nav, strlen(nav)) : z.name;
+  if (!z.name || !z.nav)
+    return false;
+  z.numLights = 0;
+  for (uint8_t i = 0; i < numLights && z.numLights < ZONE_MAX_LIGHTS; i++) {
+    uint8_t e = zoneConfigIntern(cfg, lights[i], ENTITY_BOOL, true);
+    if (e != ZONE_NONE)
+      z.lights[z.numLights++] = e;
+  }
+  z.led = zoneConfigIntern(cfg, led, ENTITY_BOOL, false);
+  z.numCovers = 0;
+  for (uint8_t i = 0; i < numCovers && z.numCovers < ZONE_MAX_COVERS; i++) {
+    uint8_t e = zoneConfigIntern(cfg, covers[i], ENTITY_TEXT, false);
+    if (e != ZONE_NONE)
+      z.covers[z.numCovers++] = e;
+  }
+  z.temp = zoneConfigIntern(cfg, temp, ENTITY_NUMBER, true);
+  z.hum = zoneConfigIntern(cfg, hum, ENTITY_NUMBER, true);
+  cfg.zoneCount++;
+  return true;
+}
+
+inline bool zoneConfigAddScene(ZoneConfig &cfg, const char *name,
+                               const char *id, uint32_t color) {
+  if (cfg.sceneCount >= ZONE_MAX_SCENES)
+    return false;
+  Scene &s = cfg.scenes[cfg.sceneCount];
+  s.name = zoneConfigString(cfg, name, strlen(name));
+  s.entity = zoneConfigIntern(cfg, id, ENTITY_TEXT, false);
+  s.color = color;
+  if (!s.name || s.entity == ZONE_NONE)
+    return false;
+  cfg.sceneCount++;
+  return true;
+}
+
+// True if entity `e` has a widget on the page of `z`
+inline bool zoneUses(const Zone &z, uint8_t e) {
+  for (uint8_t i = 0; i < z.numLights; i++)
+    if (z.lights[i] == e)
+      return true;
+  return z.temp == e || z.hum == e;
+}
+
+// Up to `max` strings of a JSON array
+inline uint8_t zoneConfigIds(JsonArrayConst a, const char **out, uint8_t max) {
+  uint8_t n = 0;
+  for (JsonVariantConst v : a)
+    if (n < max)
+      out[n++] = v | "";
+  return n;
+}
+
+// Fills `cfg` from a JSON document (File, Stream or char buffer). Invalid
+// entries are skipped; returns the number of zones loaded, or -1 if the
+// document cannot be parsed.
+template <class TInput>
+int zoneConfigLoad(TInput &input, size_t docSize, ZoneConfig &cfg) {
+  DynamicJsonDocument doc(docSize);
+  if (deserializeJson(doc, input))
+    return -1;
+  zoneConfigClear(cfg);
+  for (JsonObjectConst z : doc["zones"].as<JsonArrayConst>()) {
+    const char *lights[ZONE_MAX_LIGHTS];
+    const char *covers[ZONE_MAX_COVERS];
+    uint8_t numLights = zoneConfigIds(z["lights"], lights, ZONE_MAX_LIGHTS);
+    uint8_t numCovers = zoneConfigIds(z["covers"], covers, ZONE_MAX_COVERS);
+    zoneConfigAddZone(cfg, z["name"] | "?", z["nav"] | "", lights, numLights,
+                      z["led"] | "", covers, numCovers, z["temp"] | "",
+                      z["hum"] | "");
+  }
+  for (JsonObjectConst s : doc["scenes"].as<JsonArrayConst>()) {
+    const char *color = s["color"] | "";
+    if (*color == '#')
+      color++;
+    zoneConfigAddScene(cfg, s["name"] | "?", s["id"] | "",
+                       *color ? strtoul(color, NULL, 16) : ZONE_SCENE_COLOR);
+  }
+  return cfg.zoneCount;
+}
+
+#endif
@@ -0,0 +1,53 @@
+#ifndef ZONE_PAGES_H
+#define ZONE_PAGES_H
+
+#include "zone_config.h"
+#include <stdint.h>
+#include <string.h>
+
+// Which zone pages are built. A page is built on its first visit; while
+// LVGL's heap is short, built pages are emptied again, the least recently
+// shown first and never the one being visited. Only the bookkeeping:
+// showZonePage() in main.cpp creates and cleans the LVGL objects.
+
+class ZonePages {
+public:
+  void begin(uint8_t count) {
+    _count = count < ZONE_MAX_ZONES ? count : ZONE_MAX_ZONES;
+    memset(_shown, 0, sizeof(_shown));
+  }
+
+  // A visit to page `idx` at `now`; true when it has to be built first.
+  bool visit(uint8_t idx, uint32_t now) {
+    bool build = _shown[idx] == 0;
+    _shown[idx] = now | 1;
+    return build;
+  }
+
+  // Marks the least recently shown built page other than `keep` as empty
+  // and returns it, or -1 when there is none left to empty.
+  int8_t evict(uint8_t keep) {
+    int8_t lru = -1;
+    for (uint8_t i = 0; i < _count; i++)
+      if (i != keep && _shown[i] && (lru < 0 || _shown[i] < _shown[lru]))
+        lru = i;
+    if (lru >= 0)
+      _shown[lru] = 0;
+    return lru;
+  }
+
+  bool built(uint8_t idx) const { return _shown[idx] != 0; }
+
+  uint8_t builtCount() const {
+    uint8_t n = 0;
+    for (uint8_t i = 0; i < _count; i++)
+      n += _shown[i] != 0;
+    return n;
+  }
+
+private:
+  uint32_t _shown[ZONE_MAX_ZONES]; // Last visit, 0 while not built
+  uint8_t _count = 0;
+};
+
+#endif
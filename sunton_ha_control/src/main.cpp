@@ -1,21 +1,47 @@
+#include "axs_touch.h"
+#include "boot_seq.h"
 #include "config.h"
+#include "entity_bindings.h"
+#include "entity_store.h"
+#include "ha_client.h"
+#include "ha_commands.h"
+#include "ha_states.h"
+#include "history_chart.h"
+#include "latency_trace.h"
+#include "light_row.h"
+#define LV_SPLIT_IMPLEMENTATION
+#include "lv_mem_split.h"
+#include "poll_scheduler.h"
 #include "secrets.h"
+#include "value_stream.h"
+#include "wifi_manager.h"
+#include "zone_config.h"
+#include "zone_pages.h"
 #include <Arduino.h>
 #include <ArduinoJson.h>
 #include <Arduino_GFX_Library.h>
-#include <HTTPClient.h>
+#include <LittleFS.h>
 #include <WiFi.h>
 #include <Wire.h>
 #include <lvgl.h>
+#include <time.h>
+#if HA_TRANSPORT_MQTT
+#include "ha_mqtt.h"
+#else
+#include "ha_ws.h"
+#endif
+#if UI_BENCH
+#include "ui_bench.h"
+#endif
 
 // Pins Sunton 3.5"
 #define GFX_BL 1
-#define TOUCH_ADDR 0x3B
 #define TOUCH_SDA 4
 #define TOUCH_SCL 8
 #define TOUCH_I2C_CLOCK 400000
 #define TOUCH_RST_PIN 12
-#define AXS_MAX_TOUCH_NUMBER 1
+
+#define SLIDER_ROW_H 40 // Dimmer and blind rows on the zone pages
 
 // GFX Setup
 Arduino_ESP32QSPI *bus = new Arduino_ESP32QSPI(45, 47, 21, 48, 40, 39);
@@ -28,67 +54,60 @@ static const uint32_t screenHeight = 320;
 static lv_disp_draw_buf_t draw_buf;
 static lv_color_t buf[screenWidth * 30];
 
-WiFiClient client;
-HTTPClient http;
 unsigned long lastUpdate = 0;
 
-struct Zone {
-  String name;
+// Compiled-in configuration, used when there is no /zones.json
+struct ZoneDefault {
+  const char *name;
+  const char *nav;
   const char *lights[2];
-  uint8_t numLights;
   const char *led;
   const char *covers[2];
-  uint8_t numCovers;
-  const char *tempSensor;
-  const char *humSensor;
+  const char *temp;
+  const char *hum;
 };
 
-Zone zones[] = {{NAME_HABITACION1,
-                 {LIGHT_HAB1_LUZ1, LIGHT_HAB1_LUZ2},
-                 2,
-                 LED_HAB1,
-                 {COVER_HABITACION1, ""},
-                 1,
-                 SENSOR_TEMP_HABITACION1,
-                 SENSOR_HUM_HABITACION1},
-                {NAME_HABITACION2,
-                 {LIGHT_HAB2_LUZ1, LIGHT_HAB2_LUZ2},
-                 2,
-                 LED_HAB2,
-                 {COVER_HABITACION2, ""},
-                 1,
-                 SENSOR_TEMP_HABITACION2,
-                 SENSOR_HUM_HABITACION2},
-                {NAME_HABITACION3,
-                 {LIGHT_HAB3_LUZ1, LIGHT_HAB3_LUZ2},
-                 2,
-                 LED_HAB3,
-                 {COVER_HABITACION3, ""},
-                 1,
-                 SENSOR_TEMP_HABITACION3,
-                 SENSOR_HUM_HABITACION3},
-                {NAME_SALON,
-                 {LIGHT_SALON_LUZ1, LIGHT_SALON_LUZ2},
-                 2,
-                 LED_SALON,
-                 {COVER_SALON_1, COVER_SALON_2},
-                 2,
-                 SENSOR_TEMP_SALON,
-                 SENSOR_HUM_SALON},
-                {NAME_PASILLO,
-                 {LIGHT_PASILLO_LUZ1, LIGHT_PASILLO_LUZ2},
-                 2,
-                 LED_PASILLO,
-                 {"", ""},
-                 0,
-                 "",
-                 ""}};
-
-const uint8_t NUM_ZONES = 5;
+const ZoneDefault zoneDefaults[] = {
+    {NAME_HABITACION1, "H1", {LIGHT_HAB1_LUZ1, LIGHT_HAB1_LUZ2}, LED_HAB1,
+     {COVER_HABITACION1, ""}, SENSOR_TEMP_HABITACION1, SENSOR_HUM_HABITACION1},
+    {NAME_HABITACION2, "H2", {LIGHT_HAB2_LUZ1, LIGHT_HAB2_LUZ2}, LED_HAB2,
+     {COVER_HABITACION2, ""}, SENSOR_TEMP_HABITACION2, SENSOR_HUM_HABITACION2},
+    {NAME_HABITACION3, "H3", {LIGHT_HAB3_LUZ1, LIGHT_HAB3_LUZ2}, LED_HAB3,
+     {COVER_HABITACION3, ""}, SENSOR_TEMP_HABITACION3, SENSOR_HUM_HABITACION3},
+    {NAME_SALON, "SALÓN", {LIGHT_SALON_LUZ1, LIGHT_SALON_LUZ2}, LED_SALON,
+     {COVER_SALON_1, COVER_SALON_2}, SENSOR_TEMP_SALON, SENSOR_HUM_SALON},
+    {NAME_PASILLO, "PASILLO", {LIGHT_PASILLO_LUZ1, LIGHT_PASILLO_LUZ2},
+     LED_PASILLO, {"", ""}, "", ""}};
+
+ZoneConfig zoneCfg;
+
+void loadZoneConfig() {
+  File f;
+  if (LittleFS.begin())
+    f = LittleFS.open("/zones.json");
+  if (f) {
+    int n = zoneConfigLoad(f, f.size() * 2 + 1024, zoneCfg);
+    f.close();
+    if (n > 0) {
+      Serial.printf("Zones: %d, %d entities, %u pool bytes\n", n,
+                    zoneCfg.entityCount, zoneCfg.poolUsed);
+      return;
+    }
+    Serial.println("Zones: /zones.json invalid, using defaults");
+  }
+  zoneConfigClear(zoneCfg);
+  for (const ZoneDefault &d : zoneDefaults)
+    zoneConfigAddZone(zoneCfg, d.name, d.nav, d.lights, 2, d.led, d.covers, 2,
+                      d.temp, d.hum);
+  zoneConfigAddScene(zoneCfg, "CINE", SCENE_CINE, 0x3D5AFE);
+  zoneConfigAddScene(zoneCfg, "NOCHE", SCENE_DORMIR, 0x311B92);
+  zoneConfigAddScene(zoneCfg, "DÍA", SCENE_BUENOS_DIAS, 0xFFB300);
+  zoneConfigAddScene(zoneCfg, "SALIR", SCENE_SALIR_CASA, 0x43A047);
+}
+
 lv_obj_t *tabview;
+lv_obj_t *navbar; // One button per tab, index for index
 lv_obj_t *statusLabel;
-lv_obj_t *zoneTempLabels[5];
-lv_obj_t *zoneHumLabels[5];
 
 static lv_style_t style_screen;
 static lv_style_t style_card;
@@ -110,11 +129,11 @@ void initPremiumStyles() {
   lv_style_set_pad_all(&style_card, 10);
 
   lv_style_init(&style_title);
-  lv_style_set_text_font(&style_title, &lv_font_montserrat_14);
+  lv_style_set_text_font(&style_title, &ui_font_14);
   lv_style_set_text_color(&style_title, lv_color_hex(0x8C92AC));
 
   lv_style_init(&style_value);
-  lv_style_set_text_font(&style_value, &lv_font_montserrat_20);
+  lv_style_set_text_font(&style_value, &ui_font_20);
   lv_style_set_text_color(&style_value, lv_color_hex(0xFFFFFF));
 
   lv_style_init(&style_navbar);
@@ -131,39 +150,265 @@ void initPremiumStyles() {
 }
 
 // HA Comms
-String getEntityState(const char *entity_id) {
-  if (WiFi.status() != WL_CONNECTED || strlen(entity_id) == 0)
-    return "err";
-  String url = String(HA_URL) + "/api/states/" + String(entity_id);
-  if (http.begin(client, url)) {
-    http.addHeader("Authorization", "Bearer " + String(HA_TOKEN));
-    int code = http.GET();
-    if (code == 200) {
-      DynamicJsonDocument doc(1024);
-      deserializeJson(doc, http.getString());
-      http.end();
-      return doc["state"].as<String>();
+// Sensors and lights of every zone, read in batches of the due ones
+HaEntityState watched[ZONE_MAX_ENTITIES];
+const char *watchedIds[ZONE_MAX_ENTITIES];
+uint8_t watchedEntity[ZONE_MAX_ENTITIES]; // Index into zoneCfg.entities
+uint8_t watchedCount = 0;
+PollScheduler poller;
+bool pollWant[ZONE_MAX_ENTITIES];
+EntityStore store;
+EntityBinder bindings;
+HaClient ha;          // Polls from loop()
+HaClient haCmdClient; // Used by the command worker task only
+HaClient haHistory;   // History seeds, also on the worker task
+HaCommandWorker haCmd;
+HaStateBatch haBatch; // REST fallback while the push transport is down
+#if HA_TRANSPORT_MQTT
+HaMqtt haPush;
+#else
+HaWebSocket haPush;
+#endif
+
+// Boot phases, see boot_seq.h. The UI is up once display, ha and ui have
+// run; wifi and sync are only timed, the UI works without them, and sync
+// is skipped when wifi failed. Same order as the boot.add() calls in
+// setup().
+enum {
+  PHASE_DISPLAY,
+  PHASE_TOUCH,
+  PHASE_CONFIG,
+  PHASE_HA,
+  PHASE_UI,
+  PHASE_WIFI,
+  PHASE_SYNC,
+};
+BootSeq boot;
+
+// First states from HA, by push or by polling
+void bootSynced() {
+  if (boot.running(PHASE_SYNC))
+    boot.complete(PHASE_SYNC);
+}
+
+void onHaState(const char *id, const char *state) {
+  store.set(id, state);
+  bootSynced();
+}
+
+// Day-long trends of the zone sensors, seeded once from HA's history
+struct SensorTrend {
+  uint8_t entity; // Index into zoneCfg.entities
+  uint32_t seen;  // Store version last recorded
+  uint8_t seedTries;
+  bool seeded;
+  SensorHistory history;
+};
+SensorTrend trends[HISTORY_MAX_SENSORS];
+uint8_t trendCount = 0;
+HistoryCharts charts;
+
+SensorHistory *trendFor(uint8_t entity) {
+  for (uint8_t i = 0; i < trendCount; i++)
+    if (trends[i].entity == entity)
+      return &trends[i].history;
+  if (trendCount >= HISTORY_MAX_SENSORS || zoneCfg.entities[entity].slot < 0)
+    return NULL;
+  trends[trendCount].entity = entity;
+  return &trends[trendCount++].history;
+}
+
+// One trend seeded at a time on the command worker: the response can run
+// to a megabyte, so it is parsed there in slices of HISTORY_SEED_SLICE
+// states, into a copy that loop() takes over once it is complete.
+#define HISTORY_SEED_SLICE 32
+struct TrendSeed {
+  SensorTrend *trend;
+  uint32_t now;
+  uint32_t t0;
+  bool started;
+  bool failed; // No response
+  HistorySeed parser;
+  SensorHistory history;
+};
+TrendSeed trendSeed;
+bool trendSeeding = false;
+
+bool seedStep(void *) {
+  TrendSeed &s = trendSeed;
+  if (!s.started) {
+    char path[160];
+    snprintf(path, sizeof(path),
+             "/api/history/period?filter_entity_id=%s&minimal_response"
+             "&no_attributes",
+             zoneCfg.entities[s.trend->entity].id);
+    s.started = true;
+    s.parser.begin(s.history, s.now);
+    if (WiFi.status() != WL_CONNECTED || haHistory.get(path) != 200) {
+      haHistory.end();
+      s.failed = true;
+      return false;
     }
-    http.end();
   }
-  return "err";
+  if (s.parser.step(haHistory.body(), HISTORY_SEED_SLICE))
+    return true;
+  haHistory.end();
+  return false;
 }
 
-void callService(const char *domain, const char *service,
-                 const char *entity_id) {
-  if (WiFi.status() != WL_CONNECTED || strlen(entity_id) == 0)
+// Back on loop()
+void seedDone(void *) {
+  TrendSeed &s = trendSeed;
+  SensorTrend &t = *s.trend;
+  int n = s.failed ? -1 : s.parser.states();
+  Serial.printf("History: %s, %d states in %lu ms\n",
+                zoneCfg.entities[t.entity].id, n, millis() - s.t0);
+  if (n >= 0) {
+    s.parser.finish();
+    t.history = s.history;
+  }
+  t.seeded = n >= 0 || ++t.seedTries >= 3;
+  trendSeeding = false;
+}
+
+// Seeds one trend per call until all are, then records new readings
+void recordTrends() {
+  static uint32_t lastRun = 0;
+  if (millis() - lastRun < 1000)
     return;
-  String url = String(HA_URL) + "/api/services/" + String(domain) + "/" +
-               String(service);
-  if (http.begin(client, url)) {
-    http.addHeader("Authorization", "Bearer " + String(HA_TOKEN));
-    http.addHeader("Content-Type", "application/json");
-    http.POST("{\"entity_id\":\"" + String(entity_id) + "\"}");
-    http.end();
+  lastRun = millis();
+  time_t now = time(NULL);
+  if (now < HISTORY_VALID_TIME)
+    return; // No NTP time yet
+  for (uint8_t i = 0; i < trendCount; i++) {
+    SensorTrend &t = trends[i];
+    if (!t.seeded) {
+      if (trendSeeding || WiFi.status() != WL_CONNECTED)
+        return;
+      trendSeed.trend = &t;
+      trendSeed.now = now;
+      trendSeed.t0 = millis();
+      trendSeed.started = false;
+      trendSeed.failed = false;
+      trendSeed.history.clear();
+      trendSeeding = haCmd.job(seedStep, seedDone, NULL);
+      return;
+    }
+    const Entity &e = store.get(zoneCfg.entities[t.entity].slot);
+    if (e.valid && e.version != t.seen) {
+      t.seen = e.version;
+      t.history.add(now, e.type == ENTITY_NUMBER ? e.number : NAN);
+    } else {
+      t.history.tick(now);
+    }
+  }
+  charts.refresh();
+}
+
+void initWatchedEntities() {
+  uint8_t n = 0;
+  for (uint8_t i = 0; i < zoneCfg.entityCount; i++) {
+    ZoneEntity &e = zoneCfg.entities[i];
+    if (!e.watched || (e.slot = store.intern(e.id, e.type)) < 0)
+      continue;
+    watched[n].id = e.id;
+    watchedEntity[n] = i;
+    watchedIds[n++] = e.id;
   }
+  watchedCount = n;
+  haBatch.begin(watched, n);
+  poller.begin(n);
+#if HA_TRANSPORT_MQTT
+  haPush.begin(MQTT_SERVER, MQTT_USER, MQTT_PASS, watchedIds, n, onHaState);
+#else
+  haPush.begin(HA_URL, HA_TOKEN, watchedIds, n, onHaState);
+#endif
+}
+
+bool fetchStates(const bool *want) {
+  if (WiFi.status() != WL_CONNECTED)
+    return false;
+  const String &body = haBatch.body(want);
+  bool ok = ha.post("/api/template", body.c_str(), body.length()) == 200 &&
+            haBatch.parse(ha.body());
+  ha.end();
+  for (uint8_t i = 0; ok && i < watchedCount; i++)
+    if (want[i] && watched[i].valid)
+      store.set(watched[i].id, watched[i].state);
+  return ok;
 }
 
+// Runs on the command worker task, so it has its own connection
+int callService(const char *domain, const char *service,
+                const char *entity_id, const char *field = NULL,
+                int value = 0) {
+  if (WiFi.status() != WL_CONNECTED || strlen(entity_id) == 0)
+    return -1;
+  return haCmdClient.callService(domain, service, entity_id, field, value);
+}
+
+WifiManager wifi;
+
+int execCommand(const HaCommand &cmd) {
+#if HA_TRANSPORT_MQTT
+  // The MQTT payload has no room for service data: slider values use REST
+  if (!cmd.field && haPush.command(cmd.domain, cmd.service, cmd.entity))
+    return 200; // Taken by the broker
+#endif
+  return callService(cmd.domain, cmd.service, cmd.entity, cmd.field,
+                     cmd.value);
+}
+
+// Dimmer and cover sliders, keyed by the index of the entity in zoneCfg
+ValueStream sliders;
+
+// Hands the slider targets that are due to the command worker
+void sendSliders() {
+  uint8_t key;
+  int16_t value;
+  while (sliders.next(millis(), key, value)) {
+    const ZoneEntity &e = zoneCfg.entities[key];
+    bool cover = strcmp(e.domain, "cover") == 0;
+    if (!haCmd.post(e.domain, cover ? "set_cover_position" : "turn_on", e.id,
+                    -1, 0, cover ? "position" : "brightness_pct", value)) {
+      sliders.done(key, false);
+      return;
+    }
+  }
+}
+
+uint8_t entityIndex(const char *id) {
+  for (uint8_t i = 0; i < zoneCfg.entityCount; i++)
+    if (strcmp(zoneCfg.entities[i].id, id) == 0)
+      return i;
+  return ZONE_NONE;
+}
+
+// Through the store, not the widget: its page may have been evicted while
+// the call waited. The bindings redraw the row if it is built.
+void onCommandDone(const HaResult &r) {
+  if (r.cmd.field)
+    sliders.done(entityIndex(r.cmd.entity));
+  if (r.code >= 200 && r.code < 300)
+    return;
+  Serial.printf("HA %s.%s %s failed: %d\n", r.cmd.domain, r.cmd.service,
+                r.cmd.entity, r.code);
+  lv_label_set_text(statusLabel, "Error al enviar a HA");
+  if (r.cmd.handle >= 0 && !r.superseded)
+    store.restore(r.cmd.handle, r.cmd.rollback);
+}
+
+#if UI_BENCH
+UiBench uiBench;
+#endif
+#if LATENCY_TRACE
+LatencyTrace latTrace;
+#endif
+
 // GFX Flush - ARREGLO NITIDEZ
+uint32_t flushAreas = 0; // Since the last status line
+bool frameDone = false;   // The last area of a refresh went to the canvas
+
 void my_disp_flush(lv_disp_drv_t *disp, const lv_area_t *area,
                    lv_color_t *color_p) {
   uint32_t w = (area->x2 - area->x1 + 1);
@@ -171,68 +416,107 @@ void my_disp_flush(lv_disp_drv_t *disp, const lv_area_t *area,
   // Revertimos a draw16bitRGBBitmap para máxima nitidez (validado en test
   // previo)
   gfx->draw16bitRGBBitmap(area->x1, area->y1, (uint16_t *)&color_p->full, w, h);
+  flushAreas++;
+#if UI_BENCH
+  uiBench.flushed(area);
+#endif
+  LAT_FLUSHED(disp);
+  frameDone |= lv_disp_flush_is_last(disp);
   lv_disp_flush_ready(disp);
 }
 
 // Touch Handling
-bool getTouchPoint(uint16_t &x, uint16_t &y) {
-  uint8_t data[8] = {0};
-  const uint8_t cmd[11] = {0xb5, 0xab, 0xa5, 0x5a, 0x00, 0x00,
-                           0x00, 0x08, 0x00, 0x00, 0x00};
-  Wire.beginTransmission(TOUCH_ADDR);
-  Wire.write(cmd, 11);
-  if (Wire.endTransmission() != 0)
-    return false;
-  if (Wire.requestFrom((uint16_t)TOUCH_ADDR, (uint8_t)8) != 8)
-    return false;
-  for (int i = 0; i < 8; i++)
-    data[i] = Wire.read();
-  if (data[1] > 0 && data[1] <= 10) {
-    uint16_t rx = ((data[2] & 0x0F) << 8) | data[3];
-    uint16_t ry = ((data[4] & 0x0F) << 8) | data[5];
-    if (rx > 320 || ry > 480)
-      return false;
-    y = map(rx, 0, 320, 320, 0);
-    x = ry;
-    return true;
-  }
-  return false;
-}
+AxsTouch axs;
+TouchGestures gestures;
+void swipeTab(int8_t dir);
+
+volatile bool touchReady = false; // Set by bootTouch() after the reset
 
 void my_touchpad_read(lv_indev_drv_t *drv, lv_indev_data_t *data) {
-  uint16_t tx, ty;
-  if (getTouchPoint(tx, ty)) {
-    data->state = LV_INDEV_STATE_PR;
-    data->point.x = tx;
-    data->point.y = ty;
-  } else {
-    data->state = LV_INDEV_STATE_REL;
+  if (!touchReady)
+    return;
+  static AxsPoint last = {0, 0, 0};
+  static uint8_t points = 0;
+  AxsPoint pts[AXS_MAX_POINTS];
+  int8_t n = axs.read(pts);
+  if (n >= 0)
+    points = n; // A bus error keeps the touch as it was
+  if (n > 0)
+    last = pts[0];
+  lv_obj_t *obj = lv_indev_get_act()->proc.types.pointer.act_obj;
+  // Sideways drags on a slider or the nav bar move them, not the tab
+  if (points > 0 && obj &&
+      (lv_obj_check_type(obj, &lv_slider_class) || obj == navbar ||
+       lv_obj_get_parent(obj) == navbar))
+    gestures.cancel();
+  TouchGesture g = gestures.feed(millis(), points, last.x, last.y);
+  if (g == GESTURE_SWIPE_LEFT || g == GESTURE_SWIPE_RIGHT) {
+    lv_indev_reset(lv_indev_get_act(), NULL); // No click where it started
+    swipeTab(g == GESTURE_SWIPE_LEFT ? 1 : -1);
   }
+  bool down = points > 0 && !gestures.swiped();
+  LAT_TOUCH(micros(), down);
+  data->state = down ? LV_INDEV_STATE_PR : LV_INDEV_STATE_REL;
+  data->point.x = last.x;
+  data->point.y = last.y;
 }
 
 // UI Callbacks
-void nav_event(lv_event_t *e) {
-  uint8_t idx = (uint8_t)(uintptr_t)lv_event_get_user_data(e);
+void showZonePage(uint16_t tab);
+uint32_t switchAt = 0; // Tab switch waiting for its first frame
+
+void showTab(uint16_t idx) {
+  switchAt = millis() | 1;
+  showZonePage(idx);
   lv_tabview_set_act(tabview, idx, LV_ANIM_OFF);
+  // A swipe may land on a tab whose button is scrolled out of the bar
+  lv_obj_scroll_to_view(lv_obj_get_child(navbar, idx), LV_ANIM_ON);
 }
 
-struct LEvent {
-  uint8_t z;
-  uint8_t l;
-};
-static LEvent levs[5][2];
+void nav_event(lv_event_t *e) {
+  showTab((uint16_t)(uintptr_t)lv_event_get_user_data(e));
+}
+
+// From the touch gestures; stops at the first and last tab
+void swipeTab(int8_t dir) {
+  int16_t idx = lv_tabview_get_tab_act(tabview) + dir;
+  if (idx >= 0 && idx <= zoneCfg.zoneCount)
+    showTab(idx);
+}
 
+// User data of both is the index of the entity in zoneCfg
 void light_event(lv_event_t *e) {
-  LEvent *d = (LEvent *)lv_event_get_user_data(e);
-  if (lv_obj_has_state(lv_event_get_target(e), LV_STATE_CHECKED))
-    callService("light", "turn_on", zones[d->z].lights[d->l]);
-  else
-    callService("light", "turn_off", zones[d->z].lights[d->l]);
+  const ZoneEntity &l = zoneCfg.entities[(uintptr_t)lv_event_get_user_data(e)];
+  lv_obj_t *sw = lv_event_get_target(e);
+  bool on = lv_obj_has_state(sw, LV_STATE_CHECKED);
+  if (!haCmd.post(l.domain, on ? "turn_on" : "turn_off", l.id, l.slot, !on))
+    store.restore(l.slot, !on);
 }
 
 void scene_event(lv_event_t *e) {
-  const char *sid = (const char *)lv_event_get_user_data(e);
-  callService("scene", "turn_on", sid);
+  const ZoneEntity &s = zoneCfg.entities[(uintptr_t)lv_event_get_user_data(e)];
+  haCmd.post(s.domain, "turn_on", s.id);
+}
+
+// Percentage in the label created just after the slider
+void showSliderValue(lv_obj_t *slider, int16_t value) {
+  lv_obj_t *label =
+      lv_obj_get_child(lv_obj_get_parent(slider), lv_obj_get_index(slider) + 1);
+  lv_label_set_text_fmt(label, "%d%%", value);
+}
+
+// Every move sets the target, shown at once; sendSliders() decides what
+// reaches HA (value_stream.h)
+void slider_event(lv_event_t *e) {
+  lv_event_code_t code = lv_event_get_code(e);
+  if (code != LV_EVENT_VALUE_CHANGED && code != LV_EVENT_RELEASED &&
+      code != LV_EVENT_PRESS_LOST)
+    return;
+  uint8_t key = (uintptr_t)lv_event_get_user_data(e);
+  lv_obj_t *slider = lv_event_get_target(e);
+  int16_t value = lv_slider_get_value(slider);
+  sliders.set(key, value, code == LV_EVENT_VALUE_CHANGED);
+  showSliderValue(slider, value);
 }
 
 // UI Builder
@@ -260,31 +544,28 @@ void createHomePage() {
   lv_obj_set_style_pad_gap(sg, 12, 0);
 
   // ELIMINADOS EMOJIS (Cauasaban cuadrados)
-  const char *sn[] = {"CINE", "NOCHE", "DIA", "SALIR"};
-  const char *si[] = {SCENE_CINE, SCENE_DORMIR, SCENE_BUENOS_DIAS,
-                      SCENE_SALIR_CASA};
-  for (int i = 0; i < 4; i++) {
+  for (uint8_t i = 0; i < zoneCfg.sceneCount; i++) {
+    const Scene &s = zoneCfg.scenes[i];
     lv_obj_t *b = lv_btn_create(sg);
     lv_obj_set_size(b, 130, 45);
     lv_obj_add_style(b, &style_btn_scene, 0);
-    if (i == 1)
-      lv_obj_set_style_bg_color(b, lv_color_hex(0x311B92), 0);
-    if (i == 2)
-      lv_obj_set_style_bg_color(b, lv_color_hex(0xFFB300), 0);
-    if (i == 3)
-      lv_obj_set_style_bg_color(b, lv_color_hex(0x43A047), 0);
-    lv_obj_add_event_cb(b, scene_event, LV_EVENT_CLICKED, (void *)si[i]);
+    if (s.color != ZONE_SCENE_COLOR)
+      lv_obj_set_style_bg_color(b, lv_color_hex(s.color), 0);
+    lv_obj_add_event_cb(b, scene_event, LV_EVENT_CLICKED,
+                        (void *)(uintptr_t)s.entity);
     lv_obj_t *l = lv_label_create(b);
-    lv_label_set_text(l, sn[i]);
+    lv_label_set_text(l, s.name);
     lv_obj_center(l);
   }
 }
 
+// Zone tabs are empty until first shown; showZonePage() fills them
+lv_obj_t *zoneTabs[ZONE_MAX_ZONES];
+ZonePages zonePages;
+
 void createZonePage(uint8_t idx) {
-  Zone *z = &zones[idx];
-  lv_obj_t *t = lv_tabview_add_tab(tabview, z->name.c_str());
-  lv_obj_set_style_pad_all(t, 12, 0);
-  lv_obj_set_flex_flow(t, LV_FLEX_FLOW_COLUMN);
+  const Zone &z = zoneCfg.zones[idx];
+  lv_obj_t *t = zoneTabs[idx];
 
   lv_obj_t *c = lv_obj_create(t);
   lv_obj_set_size(c, 456, 170);
@@ -295,41 +576,88 @@ void createZonePage(uint8_t idx) {
   lv_obj_set_style_bg_opa(sl, 0, 0);
   lv_obj_set_style_border_width(sl, 0, 0);
   lv_obj_set_flex_flow(sl, LV_FLEX_FLOW_COLUMN);
+  lv_obj_set_style_pad_all(sl, 0, 0);
+  lv_obj_set_style_pad_gap(sl, 4, 0);
+
+  if (z.temp != ZONE_NONE) {
+    lv_obj_t *temp = lv_label_create(sl);
+    lv_label_set_text(temp, "--C");
+    lv_obj_add_style(temp, &style_value, 0);
+    bindings.label(zoneCfg.entities[z.temp].slot, temp, "%sC");
+  }
+  if (z.hum != ZONE_NONE) {
+    lv_obj_t *hum = lv_label_create(sl);
+    lv_label_set_text(hum, "Hum: --%");
+    lv_obj_add_style(hum, &style_title, 0);
+    bindings.label(zoneCfg.entities[z.hum].slot, hum, "Hum: %s%%");
+  }
+  if (z.temp != ZONE_NONE || z.hum != ZONE_NONE) {
+    lv_obj_t *chart = lv_chart_create(sl);
+    lv_obj_set_size(chart, 176, 60);
+    HistoryCharts::style(chart);
+    if (z.temp != ZONE_NONE)
+      charts.add(chart, lv_color_hex(0xFF9100), LV_CHART_AXIS_PRIMARY_Y,
+                 trendFor(z.temp));
+    if (z.hum != ZONE_NONE)
+      charts.add(chart, lv_color_hex(0x00B0FF), LV_CHART_AXIS_SECONDARY_Y,
+                 trendFor(z.hum));
+  }
 
-  if (strlen(z->tempSensor) > 0) {
-    zoneTempLabels[idx] = lv_label_create(sl);
-    lv_label_set_text(zoneTempLabels[idx], "--C");
-    lv_obj_add_style(zoneTempLabels[idx], &style_value, 0);
-    zoneHumLabels[idx] = lv_label_create(sl);
-    lv_label_set_text(zoneHumLabels[idx], "Hum: --%");
-    lv_obj_add_style(zoneHumLabels[idx], &style_title, 0);
+  // Light rows straight on the card, in the right-hand column
+  for (int i = 0; i < z.numLights; i++) {
+    char name[LIGHT_ROW_TEXT_LEN];
+    snprintf(name, sizeof(name), "Luz %d", i + 1);
+    lv_obj_t *row = lightRowCreate(c, name);
+    lv_obj_set_pos(row, 214, 14 + i * (LIGHT_ROW_HEIGHT + 10));
+    lv_obj_add_event_cb(row, light_event, LV_EVENT_VALUE_CHANGED,
+                        (void *)(uintptr_t)z.lights[i]);
+    bindings.toggle(zoneCfg.entities[z.lights[i]].slot, row);
   }
 
-  lv_obj_t *cl = lv_obj_create(c);
-  lv_obj_set_size(cl, 230, 140);
-  lv_obj_align(cl, LV_ALIGN_RIGHT_MID, 0, 0);
-  lv_obj_set_style_bg_opa(cl, 0, 0);
-  lv_obj_set_style_border_width(cl, 0, 0);
-  lv_obj_set_flex_flow(cl, LV_FLEX_FLOW_COLUMN);
-  lv_obj_set_style_pad_gap(cl, 10, 0);
-
-  for (int i = 0; i < z->numLights; i++) {
-    lv_obj_t *row = lv_obj_create(cl);
-    lv_obj_set_size(row, 220, 38);
-    lv_obj_set_style_bg_color(row, lv_color_hex(0x1F222D), 0);
-    lv_obj_set_style_radius(row, 8, 0);
-    lv_obj_set_style_border_width(row, 0, 0);
-
-    lv_obj_t *lbl = lv_label_create(row);
-    lv_label_set_text_fmt(lbl, "Luz %d", i + 1);
-    lv_obj_add_style(lbl, &style_title, 0);
-    lv_obj_align(lbl, LV_ALIGN_LEFT_MID, 10, 0);
-
-    lv_obj_t *sw = lv_switch_create(row);
-    lv_obj_set_size(sw, 45, 23);
-    lv_obj_align(sw, LV_ALIGN_RIGHT_MID, -10, 0);
-    levs[idx][i] = {(uint8_t)idx, (uint8_t)i};
-    lv_obj_add_event_cb(sw, light_event, LV_EVENT_VALUE_CHANGED, &levs[idx][i]);
+  // LED dimmer and blinds on a second card, below
+  uint8_t keys[1 + ZONE_MAX_COVERS];
+  uint8_t n = 0;
+  if (z.led != ZONE_NONE)
+    keys[n++] = z.led;
+  for (uint8_t i = 0; i < z.numCovers; i++)
+    keys[n++] = z.covers[i];
+  if (n == 0)
+    return;
+  lv_obj_t *sc = lv_obj_create(t);
+  lv_obj_set_size(sc, 456, 20 + n * SLIDER_ROW_H);
+  lv_obj_add_style(sc, &style_card, 0);
+  lv_obj_clear_flag(sc, LV_OBJ_FLAG_SCROLLABLE);
+  for (uint8_t i = 0; i < n; i++) {
+    char name[16];
+    if (keys[i] == z.led)
+      snprintf(name, sizeof(name), "LED");
+    else if (z.numCovers > 1)
+      snprintf(name, sizeof(name), "Persiana %d", i - (z.led != ZONE_NONE) + 1);
+    else
+      snprintf(name, sizeof(name), "Persiana");
+    lv_coord_t y = i * SLIDER_ROW_H + SLIDER_ROW_H / 2;
+    lv_obj_t *l = lv_label_create(sc);
+    lv_label_set_text(l, name);
+    lv_obj_add_style(l, &style_title, 0);
+    lv_obj_align(l, LV_ALIGN_TOP_LEFT, 4, y - 8);
+
+    lv_obj_t *sl = lv_slider_create(sc);
+    lv_obj_set_size(sl, 250, 10);
+    lv_obj_align(sl, LV_ALIGN_TOP_LEFT, 110, y - 5);
+    lv_obj_set_ext_click_area(sl, SLIDER_ROW_H / 2 - 5);
+    lv_obj_add_event_cb(sl, slider_event, LV_EVENT_ALL,
+                        (void *)(uintptr_t)keys[i]);
+
+    lv_obj_t *v = lv_label_create(sc);
+    lv_label_set_text(v, "--");
+    lv_obj_add_style(v, &style_title, 0);
+    lv_obj_align(v, LV_ALIGN_TOP_RIGHT, -4, y - 8);
+    // The last target sent from here; HA's own value is not read back
+    int16_t target;
+    if (sliders.target(keys[i], target)) {
+      lv_slider_set_value(sl, target, LV_ANIM_OFF);
+      showSliderValue(sl, target);
+    }
   }
 }
 
@@ -340,45 +668,160 @@ void createUI() {
   tabview = lv_tabview_create(scr, LV_DIR_TOP, 0);
   lv_obj_set_size(tabview, 480, 260);
   lv_obj_set_pos(tabview, 0, 60);
+  // Swipes switch tabs at once (swipeTab) instead of scrolling the pages
+  lv_obj_clear_flag(lv_tabview_get_content(tabview), LV_OBJ_FLAG_SCROLLABLE);
 
   createHomePage();
-  for (int i = 0; i < NUM_ZONES; i++)
-    createZonePage(i);
+  for (uint8_t i = 0; i < zoneCfg.zoneCount; i++) {
+    lv_obj_t *t = lv_tabview_add_tab(tabview, zoneCfg.zones[i].name);
+    lv_obj_set_style_pad_all(t, 12, 0);
+    lv_obj_set_flex_flow(t, LV_FLEX_FLOW_COLUMN);
+    zoneTabs[i] = t;
+  }
+  zonePages.begin(zoneCfg.zoneCount);
 
+  // Home and every zone. Five buttons fit; with more zones the bar
+  // scrolls sideways, starting at HOME.
+  uint8_t tabs = zoneCfg.zoneCount + 1;
   lv_obj_t *nv = lv_obj_create(scr);
+  navbar = nv;
   lv_obj_set_size(nv, 480, 60);
   lv_obj_add_style(nv, &style_navbar, 0);
   lv_obj_set_flex_flow(nv, LV_FLEX_FLOW_ROW);
-  lv_obj_set_flex_align(nv, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER,
-                        LV_FLEX_ALIGN_CENTER);
+  lv_obj_set_flex_align(nv, tabs > 5 ? LV_FLEX_ALIGN_START
+                                     : LV_FLEX_ALIGN_CENTER,
+                        LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
   lv_obj_set_style_pad_gap(nv, 6, 0);
+  lv_obj_set_scroll_dir(nv, LV_DIR_HOR);
+  lv_obj_set_scrollbar_mode(nv, LV_SCROLLBAR_MODE_OFF);
+  if (tabs <= 5)
+    lv_obj_clear_flag(nv, LV_OBJ_FLAG_SCROLLABLE);
 
-  const char *bn[] = {"HOME", "H1", "H2", "H3", "SALON"};
-  for (int i = 0; i < 5; i++) {
+  for (uint8_t i = 0; i < tabs; i++) {
     lv_obj_t *b = lv_btn_create(nv);
     lv_obj_set_size(b, 85, 48);
     lv_obj_add_style(b, &style_btn_nav, 0);
     lv_obj_add_event_cb(b, nav_event, LV_EVENT_CLICKED, (void *)(uintptr_t)i);
     lv_obj_t *l = lv_label_create(b);
-    lv_label_set_text(l, bn[i]);
+    lv_label_set_text(l, i == 0 ? "HOME" : zoneCfg.zones[i - 1].nav);
     lv_obj_center(l);
   }
 }
 
-void setup() {
-  Serial.begin(115200);
-  delay(1000);
-  Serial.println(">>> V3.1 SHARP & FIX FONTS <<<");
+// Objects under `obj`, itself included
+uint32_t objCount(lv_obj_t *obj) {
+  uint32_t n = 1;
+  for (uint32_t i = 0; i < lv_obj_get_child_cnt(obj); i++)
+    n += objCount(lv_obj_get_child(obj, i));
+  return n;
+}
 
-  if (!gfx->begin())
+// Builds the page of `tab` if needed. While the LVGL heap is short of
+// ZONE_PAGE_RESERVE, the least recently shown pages are emptied first;
+// their bindings and charts go with them, and a rebuilt page takes its
+// values from the entity store and the sensor history.
+void showZonePage(uint16_t tab) {
+  if (tab == 0 || tab > zoneCfg.zoneCount)
+    return;
+  uint8_t idx = tab - 1;
+  if (!zonePages.visit(idx, millis()))
+    return;
+  uint32_t t0 = millis();
+  LvMemReport mem;
+  for (;;) {
+    lvMemReport(mem);
+    if (mem.biggest >= ZONE_PAGE_RESERVE)
+      break;
+    int8_t lru = zonePages.evict(idx);
+    if (lru < 0)
+      break;
+    lv_obj_clean(zoneTabs[lru]);
+    Serial.printf("UI: zone %d evicted\n", lru + 1);
+  }
+  createZonePage(idx);
+  charts.refresh(); // Draw the new charts now, not on the next tick
+  uint32_t t1 = micros();
+  lv_obj_update_layout(zoneTabs[idx]);
+  uint32_t layoutUs = micros() - t1;
+  lvMemReport(mem);
+  Serial.printf("UI: zone %u built in %lu ms (%lu objects, layout %lu us), "
+                "LVGL heap %u%% used\n",
+                tab, millis() - t0, (unsigned long)objCount(zoneTabs[idx]),
+                (unsigned long)layoutUs, mem.usedPct);
+}
+
+// From wifi.loop() on every link change
+void onWifi(bool online) {
+  haCmd.online(online); // Commands wait in the queue while offline
+  lv_label_set_text(statusLabel, online ? "Sistema Online" : "Reconectando...");
+  if (online) {
+    if (boot.running(PHASE_WIFI))
+      boot.complete(PHASE_WIFI);
+    poller.stale(); // Poll everything right away
+    static bool clockSet = false;
+    if (!clockSet)
+      configTime(0, 0, NTP_SERVER); // UTC, as HA's timestamps
+    clockSet = true;
+  }
+}
+
+#if UI_BENCH
+void updateVisibility();
+
+// Zone 1 on screen, as the toggle and label cases need
+void benchZone1() {
+  lv_tabview_set_act(tabview, 1, LV_ANIM_OFF);
+  updateVisibility();
+  lv_refr_now(NULL);
+}
+
+void runUiBench() {
+  uiBench.begin("ha_control");
+  uiBench.run("full_invalidate",
+              [](uint16_t) { lv_obj_invalidate(lv_scr_act()); });
+  uiBench.run("tab_switch", [](uint16_t i) {
+    lv_tabview_set_act(tabview, (i + 1) % (zoneCfg.zoneCount + 1),
+                       LV_ANIM_OFF);
+    updateVisibility();
+  });
+  const Zone &z = zoneCfg.zones[0];
+  if (zoneCfg.zoneCount && z.numLights) {
+    benchZone1();
+    uiBench.run("switch_toggle", [](uint16_t i) {
+      int16_t slot = zoneCfg.entities[zoneCfg.zones[0].lights[0]].slot;
+      store.set(slot, i & 1 ? "off" : "on");
+      bindings.refresh(store);
+    });
+  }
+  if (zoneCfg.zoneCount && z.temp != ZONE_NONE) {
+    benchZone1();
+    uiBench.run("label_update", [](uint16_t i) {
+      char t[8];
+      snprintf(t, sizeof(t), "%u.%u", 20 + i % 5, i % 10);
+      store.set(zoneCfg.entities[zoneCfg.zones[0].temp].slot, t);
+      bindings.refresh(store);
+    });
+  }
+  uiBench.end();
+  lv_tabview_set_act(tabview, 0, LV_ANIM_OFF);
+}
+#endif
+
+bool bootDisplay() {
+  if (!gfx->begin()) {
     Serial.println("Gfx FAIL");
+    return false;
+  }
   gfx->setRotation(1);
   gfx->fillScreen(0x0000);
   gfx->flush();
 
   pinMode(GFX_BL, OUTPUT);
   digitalWrite(GFX_BL, HIGH);
+  return true;
+}
 
+bool bootTouch() {
   pinMode(TOUCH_RST_PIN, OUTPUT);
   digitalWrite(TOUCH_RST_PIN, LOW);
   delay(100);
@@ -386,7 +829,28 @@ void setup() {
   delay(100);
 
   Wire.begin(TOUCH_SDA, TOUCH_SCL);
+  axs.begin(axsCal(1, 480, 320));
+  touchReady = true;
+  return true;
+}
+
+bool bootConfig() {
+  loadZoneConfig();
+  return true;
+}
 
+bool bootHa() {
+  wifi.begin(WIFI_SSID, WIFI_PASS, onWifi); // Connects from loop()
+  ha.begin(HA_URL, HA_TOKEN);
+  haCmdClient.begin(HA_URL, HA_TOKEN);
+  haHistory.begin(HA_URL, HA_TOKEN);
+  initWatchedEntities();
+  haCmd.begin(execCommand, onCommandDone);
+  haCmd.online(false);
+  return true;
+}
+
+bool bootUi() {
   lv_init();
   initPremiumStyles();
   lv_disp_draw_buf_init(&draw_buf, buf, NULL, screenWidth * 30);
@@ -403,29 +867,130 @@ void setup() {
   lv_indev_drv_init(&i_drv);
   i_drv.type = LV_INDEV_TYPE_POINTER;
   i_drv.read_cb = my_touchpad_read;
+  LAT_INDEV(i_drv);
   lv_indev_drv_register(&i_drv);
 
-  WiFi.begin(WIFI_SSID, WIFI_PASS);
+  uint32_t t0 = millis();
   createUI();
+  LvMemReport mem;
+  lvMemReport(mem);
+  Serial.printf("UI: built in %lu ms, LVGL heap %lu B used\n", millis() - t0,
+                (unsigned long)mem.used);
+#if UI_BENCH
+  runUiBench();
+#endif
+  LAT_BEGIN("ha_control");
+  lv_refr_now(NULL);
+  gfx->flush();
+  return true;
+}
+
+void setup() {
+  Serial.begin(115200);
+  Serial.println(">>> V3.1 SHARP & FIX FONTS <<<");
+  boot.add("display", BOOT_MAIN, bootDisplay);
+  boot.add("touch", BOOT_TASK, bootTouch);
+  boot.add("config", BOOT_TASK, bootConfig);
+  boot.add("ha", BOOT_MAIN, bootHa, BOOT_BIT(PHASE_CONFIG));
+  boot.add("ui", BOOT_MAIN, bootUi,
+           BOOT_BIT(PHASE_DISPLAY) | BOOT_BIT(PHASE_HA));
+  boot.add("wifi", BOOT_EXTERNAL, NULL, BOOT_BIT(PHASE_HA));
+  boot.add("sync", BOOT_EXTERNAL, NULL, 0, BOOT_BIT(PHASE_WIFI));
+  // Main phases wait here for the config task, so the loop below never
+  // runs without a UI
+  while (!boot.ended(PHASE_UI)) {
+    boot.poll();
+    delay(1);
+  }
+}
+
+// Entities of the zone on screen poll fast, the rest slowly
+void updateVisibility() {
+  static uint16_t shown = 0xFFFF;
+  uint16_t tab = lv_tabview_get_tab_act(tabview);
+  if (tab == shown)
+    return;
+  shown = tab;
+  showZonePage(tab); // Already built when reached through showTab()
+  for (uint8_t i = 0; i < watchedCount; i++)
+    poller.setVisible(i, tab > 0 && zoneUses(zoneCfg.zones[tab - 1],
+                                             watchedEntity[i]));
 }
 
+// REST polling, only while the push transport is down
+void pollStates() {
+  if (!wifi.connected() || haPush.ready())
+    return;
+  bool idle = lv_disp_get_inactive_time(NULL) > POLL_IDLE_AFTER_MS;
+  uint8_t n = poller.due(millis(), idle, pollWant);
+  if (n == 0)
+    return;
+  uint32_t t0 = millis();
+  bool ok = fetchStates(pollWant);
+  poller.polled(pollWant, millis());
+  Serial.printf("HA poll: %u/%u entities %s in %lu ms, min heap %u\n", n,
+                watchedCount, ok ? "ok" : "fail", millis() - t0,
+                ESP.getMinFreeHeap());
+  if (ok)
+    bootSynced();
+}
+
+uint32_t widgetUpdates = 0; // Since the last status line
+uint32_t loopMaxMs = 0;     // Longest loop() iteration, same period
+
 void loop() {
+  static uint32_t lastLoop = millis();
+  uint32_t now = millis();
+  loopMaxMs = max(loopMaxMs, now - lastLoop);
+  lastLoop = now;
+
+  boot.poll();
+  wifi.loop();
   lv_timer_handler();
   gfx->flush();
-  if (millis() - lastUpdate > 5000) {
+  LAT_PRESENTED();
+  if (switchAt && frameDone) {
+    LvMemReport mem;
+    lvMemReport(mem);
+    Serial.printf("UI: tab switch %lu ms, LVGL heap %lu B used\n",
+                  millis() - switchAt, (unsigned long)mem.used);
+    switchAt = 0;
+  }
+  frameDone = false;
+  if (wifi.connected())
+    haPush.loop();
+  haCmd.poll();
+  sendSliders();
+  widgetUpdates += bindings.refresh(store);
+  updateVisibility();
+  pollStates();
+  recordTrends();
+  uint32_t requests, entities;
+  if (poller.window(millis(), requests, entities))
+    Serial.printf("HA poll: %lu req/min, %lu entities/min\n",
+                  (unsigned long)requests, (unsigned long)entities);
+  if (millis() - lastUpdate > HA_UPDATE_INTERVAL) {
     lastUpdate = millis();
-    if (WiFi.status() == WL_CONNECTED) {
-      lv_label_set_text(statusLabel, "Sistema Online");
-      for (int i = 0; i < NUM_ZONES; i++) {
-        if (strlen(zones[i].tempSensor) > 0) {
-          String s = getEntityState(zones[i].tempSensor);
-          if (s != "err")
-            lv_label_set_text_fmt(zoneTempLabels[i], "%sC", s.c_str());
-          String hum = getEntityState(zones[i].humSensor);
-          if (hum != "err")
-            lv_label_set_text_fmt(zoneHumLabels[i], "Hum: %s%%", hum.c_str());
-        }
-      }
+    Serial.printf("UI: %lu widget updates, %lu flushed areas, "
+                  "max loop %lu ms\n",
+                  (unsigned long)widgetUpdates, (unsigned long)flushAreas,
+                  (unsigned long)loopMaxMs);
+    widgetUpdates = flushAreas = loopMaxMs = 0;
+    LvMemReport mem;
+    lvMemReport(mem);
+    Serial.printf("LVGL heap: %lu/%lu B (%u%%), biggest free %lu B, "
+                  "frag %u%%, PSRAM %lu B, %lu spilled, %lu failed\n",
+                  (unsigned long)mem.used, (unsigned long)mem.size,
+                  mem.usedPct, (unsigned long)mem.biggest, mem.fragPct,
+                  (unsigned long)mem.psram, (unsigned long)mem.spilled,
+                  (unsigned long)mem.failed);
+    if (wifi.connected()) {
+      lv_label_set_text_fmt(statusLabel, "Online - heap %u%% frag %u%%",
+                            mem.usedPct, mem.fragPct);
+      if (haPush.ready())
+        Serial.printf("HA push: %lu updates, %llu B/h\n",
+                      (unsigned long)haPush.updates(),
+                      (uint64_t)haPush.bytesReceived() * 3600000 / millis());
     }
   }
 }
@@ -0,0 +1,1430 @@
+/*******************************************************************************
+ * Size: 20 px
+ * Bpp: 4
+ * Opts: scripts/font_subset.py, Montserrat-Medium.ttf, compressed
+ * Glyphs: 0x20-0x7E,0xA1,0xB0,0xBF,0xC1,0xC9,0xCD,0xD1,0xD3,0xDA,0xDC,0xE1,0xE9,0xED,0xF1,0xF3,0xFA,0xFC
+ ******************************************************************************/
+
+// Generated by scripts/font_subset.py, do not edit.
+
+#ifdef LV_LVGL_H_INCLUDE_SIMPLE
+#include "lvgl.h"
+#else
+#include "lvgl/lvgl.h"
+#endif
+
+#if !LV_USE_FONT_COMPRESSED
+#error "ui_font_20 is compressed: build with -DLV_USE_FONT_COMPRESSED=1"
+#endif
+
+/*-----------------
+ *    BITMAPS
+ *----------------*/
+
+/*Store the image of the glyphs*/
+static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
+    /* U+0020 " " */
+
+    /* U+0021 "!" */
+    0x6f, 0xc0, 0x3, 0x98, 0x6, 0x11, 0x0, 0x63,
+    0x70, 0xc, 0x22, 0xf, 0x30, 0x0, 0xfb, 0x9e,
+    0x3d, 0x1c, 0xe8, 0xb8,
+
+    /* U+0022 "\"" */
+    0xbe, 0x2, 0xf8, 0x3, 0x3, 0x0, 0x8, 0x6,
+    0xf0, 0xf, 0x84, 0x4, 0x0,
+
+    /* U+0023 "#" */
+    0x0, 0xcf, 0xc0, 0x12, 0x79, 0x0, 0x7b, 0x88,
+    0x2, 0x30, 0x20, 0xf, 0x2b, 0x0, 0x5c, 0x40,
+    0x1b, 0x3f, 0xc6, 0xbf, 0xf3, 0x17, 0xfa, 0x1,
+    0x51, 0x0, 0x68, 0x90, 0x92, 0x23, 0x82, 0x6e,
+    0x42, 0x6e, 0xe0, 0xab, 0xb3, 0x0, 0x42, 0xc,
+    0x0, 0x11, 0x80, 0x3c, 0xc0, 0x40, 0x3, 0x2,
+    0x0, 0xf1, 0x8, 0x80, 0xc, 0xc, 0x1, 0x3f,
+    0xfa, 0x7, 0xfe, 0xb0, 0xdf, 0xd0, 0x24, 0x40,
+    0x89, 0x12, 0x20, 0x44, 0x81, 0x6e, 0xc4, 0xf7,
+    0x72, 0x1d, 0xda, 0x40, 0x31, 0x70, 0x4, 0x4c,
+    0x1, 0xe1, 0x11, 0x0, 0x4c, 0x40, 0x18,
+
+    /* U+0024 "$" */
+    0x0, 0xe5, 0xe0, 0xf, 0xfe, 0x98, 0xbe, 0x50,
+    0xf6, 0x41, 0x0, 0x7, 0x60, 0x8c, 0x8, 0x8f,
+    0xe0, 0x9, 0x34, 0xf9, 0x1c, 0xe9, 0xa0, 0x2,
+    0x4, 0x8, 0x6, 0x67, 0x0, 0x38, 0x30, 0x7,
+    0xf6, 0x5, 0xb1, 0x80, 0x7c, 0xec, 0x33, 0x21,
+    0x84, 0x0, 0xe9, 0xd8, 0x30, 0x7b, 0xd4, 0x0,
+    0xc4, 0xf2, 0x34, 0x85, 0x64, 0x1, 0xf2, 0xdb,
+    0x2, 0x80, 0x80, 0x7d, 0xe1, 0xe1, 0xb2, 0x40,
+    0x18, 0xac, 0x34, 0x41, 0xb7, 0x52, 0x39, 0xa4,
+    0xaa, 0x1c, 0xa5, 0x3, 0x3, 0x34, 0xd0, 0x4,
+    0xb5, 0xb4, 0x3f, 0x8c, 0x1, 0xff, 0xc7, 0x79,
+    0x0, 0xe0,
+
+    /* U+0025 "%" */
+    0x1, 0x9e, 0xe4, 0x88, 0x6, 0x1d, 0xa0, 0xd,
+    0x65, 0x98, 0x2b, 0x0, 0xd0, 0x16, 0x1, 0xa,
+    0xc1, 0x12, 0x14, 0x40, 0x8, 0xd2, 0x20, 0x11,
+    0x1, 0x0, 0x8, 0x8, 0x6, 0x59, 0x0, 0x30,
+    0x81, 0x0, 0x8, 0x8, 0x2c, 0x20, 0x3, 0x89,
+    0x20, 0x89, 0x8, 0x2a, 0xa9, 0x10, 0xf, 0x4b,
+    0xee, 0x9e, 0x46, 0xdd, 0x6b, 0xb9, 0x0, 0x11,
+    0x67, 0x73, 0xa, 0xca, 0x2d, 0xaa, 0xd9, 0x80,
+    0x18, 0x44, 0xc, 0xbe, 0x4b, 0xe8, 0xb3, 0x60,
+    0x1e, 0x28, 0x81, 0xb8, 0x18, 0x0, 0xc8, 0x40,
+    0x3a, 0x49, 0xc0, 0x2, 0x1, 0x38, 0x7, 0x99,
+    0x38, 0x0, 0xe2, 0x40, 0x5, 0x21, 0x0, 0x8a,
+    0x20, 0x40, 0x2, 0x58, 0x13, 0xbb, 0x0, 0x6e,
+    0x57, 0x0, 0xd6, 0x1f, 0xaa, 0xc0,
+
+    /* U+0026 "&" */
+    0x0, 0x86, 0x77, 0xb5, 0xc0, 0x3f, 0x63, 0x2,
+    0x9c, 0x38, 0x7, 0x90, 0x93, 0x6f, 0xc6, 0xc0,
+    0x3c, 0x21, 0x80, 0x1, 0x20, 0xf, 0x90, 0x2c,
+    0x42, 0xe, 0x80, 0x3c, 0x30, 0x75, 0x8f, 0xc,
+    0x1, 0xf2, 0xa, 0x1d, 0xb8, 0x7, 0xcd, 0x86,
+    0xc1, 0x2, 0x0, 0x62, 0x0, 0x34, 0xae, 0xcc,
+    0x8f, 0x8, 0x66, 0xc0, 0x10, 0x34, 0x0, 0x6a,
+    0x2f, 0x80, 0xd0, 0x11, 0x18, 0x6, 0x5b, 0x36,
+    0x44, 0x0, 0x91, 0x1c, 0x3, 0x10, 0x1, 0x50,
+    0x1, 0x21, 0x1d, 0x97, 0xd2, 0x74, 0x14, 0x60,
+    0x9a, 0xc6, 0x65, 0x28, 0xd5, 0xd4, 0x30,
+
+    /* U+0027 "'" */
+    0xbe, 0x3, 0x10, 0xc, 0x20,
+
+    /* U+0028 "(" */
+    0x0, 0xf, 0x68, 0x1, 0x86, 0xc0, 0x14, 0x2c,
+    0x6, 0x48, 0x0, 0xb0, 0xf0, 0x1, 0x83, 0x80,
+    0x18, 0x8, 0x0, 0x44, 0x0, 0x8, 0x7, 0x84,
+    0x3, 0x8, 0x0, 0x40, 0x38, 0x88, 0x1, 0x30,
+    0x10, 0x0, 0xc1, 0xc0, 0x16, 0x1e, 0x0, 0x32,
+    0x40, 0xa, 0x85, 0x80, 0xc, 0x36,
+
+    /* U+0029 ")" */
+    0x2f, 0xb0, 0x1, 0x2a, 0x20, 0x1, 0x21, 0xc0,
+    0x3, 0x24, 0x0, 0x90, 0x50, 0x1, 0xe0, 0x60,
+    0x5, 0xd, 0x0, 0x8, 0x8, 0x0, 0xc1, 0xc0,
+    0x2, 0x2, 0x0, 0x10, 0x10, 0x1, 0x83, 0x80,
+    0x4, 0x4, 0x0, 0xa1, 0xa0, 0xf, 0x3, 0x0,
+    0x20, 0xa0, 0x19, 0x20, 0x2, 0x42, 0x40, 0x95,
+    0xc, 0x0,
+
+    /* U+002A "*" */
+    0x0, 0xa6, 0x40, 0x10, 0xa0, 0x6, 0x41, 0x7b,
+    0x93, 0x34, 0xdb, 0xb5, 0xa2, 0xa9, 0x2d, 0x81,
+    0xc4, 0x0, 0x2e, 0xd, 0x8c, 0xaa, 0x6c, 0x64,
+    0xaa, 0x19, 0xaa, 0x8e, 0x4a, 0x1, 0x94, 0x40,
+
+    /* U+002B "+" */
+    0x0, 0xdf, 0x40, 0x1f, 0xfd, 0x6a, 0xff, 0x81,
+    0x7f, 0xe4, 0xd4, 0x48, 0x5, 0x12, 0x77, 0x5d,
+    0xc0, 0x97, 0x71, 0x80, 0x7f, 0xf2, 0x0,
+
+    /* U+002C "," */
+    0xae, 0x45, 0x1c, 0x60, 0xec, 0x4, 0xc3, 0x25,
+    0xb0,
+
+    /* U+002D "-" */
+    0x9b, 0xbc, 0xc8, 0x9d, 0xc0,
+
+    /* U+002E "." */
+    0x8c, 0x37, 0x3b, 0x51, 0xc0,
+
+    /* U+002F "/" */
+    0x0, 0xf9, 0xd4, 0x3, 0xc9, 0x4, 0x1, 0xee,
+    0x5, 0x0, 0xf2, 0x19, 0x0, 0x72, 0x8d, 0x0,
+    0x7b, 0xc1, 0xc0, 0x38, 0x51, 0x2, 0x1, 0xc8,
+    0x3a, 0x1, 0xef, 0x7, 0x0, 0xe1, 0x44, 0x8,
+    0x7, 0x20, 0xe8, 0x7, 0xbc, 0x1c, 0x3, 0x85,
+    0x50, 0x40, 0x39, 0x3, 0x40, 0x3d, 0xc0, 0xe0,
+    0x1c, 0x28, 0x81, 0x0, 0xe7, 0xd, 0x0, 0xf6,
+    0x83, 0x80, 0x70, 0xa2, 0x88, 0x7, 0x38, 0x78,
+    0x7, 0x80,
+
+    /* U+0030 "0" */
+    0x0, 0xc, 0x6f, 0x6d, 0x18, 0x6, 0x2c, 0x73,
+    0x50, 0x5c, 0x60, 0xb, 0x89, 0xfa, 0xf6, 0xc6,
+    0x4c, 0x18, 0xd2, 0x0, 0x24, 0x80, 0x80, 0xd0,
+    0xf0, 0xe, 0x61, 0x41, 0x50, 0x50, 0xf, 0x28,
+    0x28, 0x80, 0x80, 0x78, 0x40, 0x40, 0x3f, 0xf0,
+    0x80, 0x80, 0x78, 0x40, 0x54, 0x14, 0x3, 0xca,
+    0xb, 0xa1, 0xe0, 0x1c, 0xc2, 0x82, 0xc6, 0x90,
+    0x1, 0x24, 0x4, 0x0, 0x38, 0x9f, 0xaf, 0x6c,
+    0x64, 0xc0, 0x5, 0x8e, 0x6a, 0xb, 0x8c, 0x0,
+
+    /* U+0031 "1" */
+    0xdf, 0xfc, 0x89, 0x84, 0x1, 0x37, 0x64, 0x0,
+    0xff, 0xfc, 0x0,
+
+    /* U+0032 "2" */
+    0x0, 0x35, 0xf7, 0xf5, 0x18, 0x0, 0xb6, 0x50,
+    0x90, 0x17, 0x14, 0x1c, 0x9f, 0xb2, 0xfa, 0x2,
+    0xc1, 0x76, 0x4, 0x2, 0x71, 0x11, 0x1, 0x0,
+    0x78, 0xc0, 0x3f, 0x8c, 0x8a, 0x0, 0xf0, 0xf0,
+    0x40, 0x7, 0x87, 0x49, 0xd4, 0x3, 0x87, 0x4d,
+    0xa0, 0x3, 0x8b, 0xd, 0xe4, 0x3, 0x8b, 0xca,
+    0x20, 0x1, 0xc5, 0xe5, 0xe, 0x1, 0xc5, 0x84,
+    0x39, 0x77, 0xd2, 0xc2, 0x2, 0x89, 0xe5,
+
+    /* U+0033 "3" */
+    0x4f, 0xff, 0xe0, 0x74, 0x4f, 0x10, 0x18, 0x1d,
+    0xdf, 0x41, 0x8f, 0x0, 0x78, 0x78, 0x68, 0x80,
+    0x3d, 0xa5, 0x28, 0x1, 0xe9, 0x35, 0x60, 0xf,
+    0xb, 0x2, 0xeb, 0x80, 0x70, 0xcc, 0x31, 0xc5,
+    0x80, 0x73, 0x3c, 0xf9, 0x22, 0x80, 0x7c, 0x2a,
+    0x1a, 0x1, 0xf8, 0x43, 0xdb, 0x10, 0x3, 0x2b,
+    0x2, 0xf1, 0xdf, 0x65, 0xed, 0x4, 0x94, 0x63,
+    0x11, 0x10, 0x17, 0x18, 0x0,
+
+    /* U+0034 "4" */
+    0x0, 0xf9, 0xfe, 0x80, 0x3f, 0xc9, 0x5, 0x60,
+    0x1f, 0xc3, 0x41, 0xc2, 0x1, 0xfd, 0x43, 0x26,
+    0x1, 0xfd, 0x8, 0xac, 0x1, 0xfc, 0xae, 0x56,
+    0x2, 0x42, 0x1, 0xc5, 0x63, 0xe2, 0xf, 0xac,
+    0x1, 0xdc, 0x36, 0x40, 0x1f, 0xd2, 0x6c, 0xa0,
+    0x1f, 0xc6, 0xc0, 0xdf, 0xfa, 0x42, 0x3f, 0xc4,
+    0x6, 0x7f, 0x10, 0x11, 0x98, 0xf, 0x33, 0xea,
+    0xa, 0xcc, 0x10, 0x7, 0xff, 0x40,
+
+    /* U+0035 "5" */
+    0x0, 0x77, 0xff, 0xc0, 0x1, 0x19, 0x13, 0xc0,
+    0x2, 0x4, 0xbb, 0xf0, 0x1, 0xc0, 0xc0, 0x3f,
+    0x10, 0x70, 0x7, 0xe1, 0xa, 0xba, 0x96, 0x10,
+    0xb, 0x80, 0x91, 0x5a, 0x7d, 0x80, 0x13, 0xff,
+    0x76, 0x38, 0xca, 0x0, 0x70, 0x9c, 0x38, 0x70,
+    0x7, 0xec, 0x1, 0x1, 0x0, 0xf1, 0x0, 0x9f,
+    0xb0, 0x80, 0x47, 0x1, 0xec, 0x33, 0xd9, 0x7b,
+    0x82, 0xca, 0xad, 0x73, 0x24, 0x34, 0xa9, 0x0,
+
+    /* U+0036 "6" */
+    0x0, 0x96, 0xb7, 0xf6, 0xd8, 0x0, 0x35, 0x45,
+    0x4, 0x15, 0xd0, 0x5, 0xaa, 0x6e, 0xaf, 0x3e,
+    0x41, 0x15, 0x2c, 0x80, 0x21, 0x20, 0xe0, 0xf0,
+    0xf, 0xce, 0xa, 0xd9, 0xdc, 0xc6, 0x0, 0x10,
+    0x44, 0x92, 0x99, 0xa6, 0x80, 0x26, 0x8e, 0xbd,
+    0xc1, 0x55, 0x8, 0x2b, 0x80, 0x47, 0x61, 0xe4,
+    0x1a, 0x1, 0xcc, 0x3, 0x61, 0xa0, 0x1c, 0xc0,
+    0x2c, 0x2a, 0xe0, 0x11, 0xd8, 0x70, 0xd0, 0xc7,
+    0x5e, 0x60, 0x5d, 0x1, 0x31, 0x8d, 0x9, 0x2a,
+    0x0,
+
+    /* U+0037 "7" */
+    0x6f, 0xff, 0xf1, 0x0, 0x9, 0x13, 0xc0, 0x3,
+    0x0, 0x2d, 0xdf, 0x60, 0x28, 0x80, 0x7e, 0xa0,
+    0x90, 0x7c, 0xa0, 0xc, 0xa4, 0x86, 0x2, 0x64,
+    0x1, 0xa4, 0x3c, 0x3, 0xf2, 0x19, 0x20, 0x7,
+    0xee, 0xb, 0x0, 0xfc, 0x4a, 0x2e, 0x1, 0xfa,
+    0xc1, 0x84, 0x3, 0xe1, 0x70, 0x90, 0xf, 0xcc,
+    0x2c, 0x20, 0x1f, 0xa4, 0x28, 0x3, 0xf3, 0xa,
+    0x18, 0x7,
+
+    /* U+0038 "8" */
+    0x0, 0xb, 0xe7, 0x7f, 0x5b, 0x0, 0x43, 0xb0,
+    0x64, 0x86, 0x93, 0x60, 0x6, 0x33, 0x6e, 0x5e,
+    0xe8, 0x91, 0x43, 0x82, 0x88, 0x2, 0x25, 0x2,
+    0xc, 0xa, 0x10, 0x8, 0x94, 0x10, 0x15, 0xcf,
+    0xb2, 0xf3, 0x4a, 0xc, 0x1, 0xe2, 0x6, 0x86,
+    0x2, 0x40, 0x7, 0x80, 0x9d, 0xfd, 0x80, 0xa5,
+    0x9, 0xd, 0x62, 0x2, 0x7b, 0x9, 0x11, 0x8c,
+    0x3, 0x90, 0x8, 0x40, 0x44, 0x1, 0xc4, 0x6,
+    0xa, 0x14, 0x40, 0x11, 0xf0, 0x28, 0x59, 0x26,
+    0xe5, 0xee, 0x12, 0x48, 0xe, 0xc2, 0x12, 0x1a,
+    0x4d, 0x88,
+
+    /* U+0039 "9" */
+    0x0, 0x1d, 0x77, 0xf5, 0x20, 0x6, 0x6c, 0x53,
+    0x42, 0x5b, 0x80, 0x0, 0xc8, 0x56, 0xde, 0x69,
+    0xba, 0x82, 0x3, 0x28, 0x4, 0x5e, 0x12, 0x6,
+    0x1, 0xfc, 0x64, 0x80, 0xca, 0x1, 0x17, 0x80,
+    0x18, 0x9c, 0x2b, 0x6f, 0x34, 0x90, 0x4, 0x22,
+    0x90, 0xd0, 0x5b, 0xc4, 0x3, 0x2d, 0xf7, 0xec,
+    0x8b, 0x3, 0x0, 0x7e, 0x23, 0x13, 0x0, 0xfd,
+    0x0, 0xe0, 0x11, 0x80, 0x43, 0x2a, 0x30, 0x0,
+    0x6c, 0xdb, 0xce, 0x62, 0xd1, 0x0, 0x12, 0x82,
+    0x11, 0xc6, 0x18, 0x0,
+
+    /* U+003A ":" */
+    0x8c, 0x37, 0x3b, 0x51, 0xca, 0xe4, 0x0, 0xff,
+    0xd1, 0x86, 0xe7, 0x6a, 0x38,
+
+    /* U+003B ";" */
+    0x8c, 0x37, 0x3b, 0x51, 0xca, 0xe4, 0x0, 0xff,
+    0xd5, 0xc8, 0xa3, 0x8c, 0x1d, 0x80, 0x98, 0x64,
+    0xb6, 0x0,
+
+    /* U+003C "<" */
+    0x0, 0xfc, 0x44, 0x0, 0xf2, 0x56, 0xb0, 0x4,
+    0x51, 0xb6, 0x8c, 0xa0, 0xb7, 0xae, 0xd5, 0xd2,
+    0x33, 0x4c, 0xfb, 0x6a, 0x1, 0xef, 0x0, 0xf4,
+    0xd3, 0x46, 0xda, 0x80, 0x65, 0xbd, 0x76, 0xae,
+    0x91, 0x0, 0x8a, 0x36, 0x91, 0x94, 0x3, 0xcb,
+    0x5a, 0xc0,
+
+    /* U+003D "=" */
+    0xaf, 0xff, 0xc9, 0xa8, 0x9f, 0x9d, 0xd7, 0x7f,
+    0x8c, 0x3, 0xff, 0x91, 0x5f, 0xff, 0x93, 0x51,
+    0x3f, 0x38,
+
+    /* U+003E ">" */
+    0x30, 0xf, 0xe9, 0xe8, 0x20, 0xf, 0x72, 0xbe,
+    0xda, 0x80, 0x64, 0xbd, 0x86, 0xae, 0x93, 0x0,
+    0x89, 0xf6, 0xd1, 0xf1, 0x0, 0x3c, 0x60, 0x1c,
+    0x4f, 0xb6, 0xee, 0xc4, 0x45, 0xec, 0x35, 0x74,
+    0x98, 0x72, 0xbe, 0xda, 0x80, 0x69, 0xe8, 0x20,
+    0xf,
+
+    /* U+003F "?" */
+    0x1, 0x7c, 0xef, 0xda, 0x30, 0x1, 0x64, 0x11,
+    0x10, 0xd7, 0x18, 0x10, 0x9f, 0xf2, 0xf9, 0xc2,
+    0x1, 0xba, 0x4, 0x2, 0x80, 0x11, 0x0, 0x80,
+    0x71, 0x1, 0x8, 0x7, 0x87, 0x82, 0x0, 0x3c,
+    0x58, 0x72, 0xa0, 0x1e, 0xf2, 0x96, 0x0, 0xf2,
+    0x92, 0x30, 0x7, 0xcf, 0x72, 0x1, 0xf8, 0x90,
+    0x80, 0x3f, 0x26, 0x28, 0x7, 0xee, 0x39, 0x0,
+    0xfd, 0xe3, 0x60, 0x18,
+
+    /* U+0040 "@" */
+    0x0, 0xe4, 0x9c, 0xef, 0xec, 0x83, 0x0, 0xfc,
+    0x79, 0x6c, 0x44, 0x43, 0x27, 0xcb, 0x10, 0xe,
+    0x5c, 0x37, 0xce, 0xcb, 0xde, 0xb6, 0x4f, 0x30,
+    0x8, 0xe8, 0xf2, 0x9, 0xea, 0x8c, 0x20, 0x4e,
+    0x7a, 0x40, 0xe, 0x1e, 0x34, 0xf8, 0x55, 0x4e,
+    0x1a, 0x6f, 0x4, 0x83, 0x15, 0x91, 0x28, 0x63,
+    0xb9, 0x63, 0x0, 0x3, 0x94, 0x2d, 0x25, 0xa,
+    0x18, 0x71, 0x12, 0x68, 0x80, 0x4c, 0x2a, 0xa4,
+    0x0, 0x20, 0x30, 0x6, 0x16, 0x0, 0x84, 0xb4,
+    0x78, 0x0, 0x44, 0x10, 0xe, 0xe0, 0xc, 0xc2,
+    0x1, 0x8c, 0xc0, 0x1e, 0x10, 0xc, 0x23, 0x70,
+    0x1, 0xc5, 0x0, 0x3b, 0x0, 0x33, 0x12, 0xa0,
+    0x2, 0x42, 0x4, 0x2, 0x74, 0x2, 0x3, 0x2c,
+    0xd2, 0x40, 0x38, 0x3f, 0xa9, 0xc8, 0x80, 0x4c,
+    0xb4, 0xd1, 0x8a, 0x44, 0x1e, 0x95, 0x1d, 0xd6,
+    0xf2, 0x6e, 0x9a, 0x0, 0xe2, 0xd2, 0x5, 0xbe,
+    0xe5, 0xa0, 0x36, 0xf5, 0x8, 0x0, 0xe8, 0xf2,
+    0xc, 0x3, 0x90, 0x80, 0x3e, 0x5c, 0x37, 0xce,
+    0xcb, 0xce, 0xb5, 0x0, 0xfc, 0x7b, 0x4a, 0x64,
+    0x84, 0xb2, 0xe0, 0x1c,
+
+    /* U+0041 "A" */
+    0x0, 0xf6, 0xfc, 0x0, 0x7f, 0xcc, 0x40, 0xc2,
+    0x1, 0xfe, 0xa0, 0x61, 0x70, 0xf, 0xe4, 0x35,
+    0x80, 0xb0, 0xf, 0xef, 0xe, 0x15, 0x25, 0x0,
+    0xf8, 0xd0, 0xd0, 0x24, 0x24, 0x3, 0xea, 0x9,
+    0x0, 0x19, 0xc8, 0x1, 0xc4, 0xc2, 0xa0, 0x14,
+    0x87, 0x80, 0x75, 0x4, 0x80, 0x65, 0x24, 0x20,
+    0x8, 0x58, 0x23, 0xff, 0x88, 0x2c, 0x2, 0x61,
+    0x35, 0x5f, 0x81, 0x84, 0x1, 0x41, 0xf5, 0x5f,
+    0x30, 0x48, 0x29, 0x21, 0x80, 0x7d, 0x60, 0xc3,
+    0x21, 0xe0, 0x1f, 0x89, 0x45, 0xc0,
+
+    /* U+0042 "B" */
+    0xef, 0xff, 0x75, 0xb0, 0x7, 0x22, 0x71, 0xa4,
+    0xd0, 0x6, 0xab, 0xbd, 0xb4, 0xa, 0x60, 0x1f,
+    0xca, 0xa0, 0x50, 0xf, 0xf0, 0x81, 0x0, 0x7e,
+    0x29, 0x43, 0x40, 0xb, 0xbf, 0xf6, 0xb1, 0x70,
+    0x6, 0x44, 0xe3, 0x12, 0xe2, 0x0, 0xaa, 0xef,
+    0x67, 0xb1, 0xc8, 0x7, 0xf0, 0xc8, 0x20, 0x80,
+    0x7f, 0x84, 0xc, 0x3, 0xfa, 0x4, 0x88, 0x0,
+    0xab, 0xbd, 0x9c, 0xe1, 0x0, 0x12, 0x27, 0x19,
+    0x9b, 0x14, 0x0,
+
+    /* U+0043 "C" */
+    0x0, 0x85, 0xf3, 0xbf, 0xad, 0x80, 0x32, 0xfc,
+    0x19, 0x90, 0xd2, 0x70, 0x81, 0x68, 0x5f, 0xb6,
+    0xf7, 0x4a, 0x6e, 0x54, 0x15, 0x2, 0x1, 0x15,
+    0x6a, 0xd0, 0x32, 0x80, 0x7c, 0x40, 0xa1, 0x40,
+    0x1f, 0xe2, 0x3, 0x0, 0xff, 0xe5, 0x90, 0x18,
+    0x7, 0xf9, 0x42, 0x80, 0x3f, 0xd4, 0xc, 0xa0,
+    0x1f, 0x10, 0x15, 0x5, 0x40, 0x80, 0x45, 0x5a,
+    0xa0, 0xb4, 0x2f, 0xd9, 0x79, 0xaa, 0x6e, 0x0,
+    0x5f, 0x83, 0x24, 0x24, 0xac, 0x20,
+
+    /* U+0044 "D" */
+    0xef, 0xfe, 0xed, 0x94, 0x0, 0xf2, 0x26, 0x23,
+    0x6b, 0xb0, 0x80, 0x6a, 0xbb, 0xb3, 0xac, 0xd3,
+    0x4, 0x3, 0xf9, 0x31, 0xa, 0xc0, 0x3f, 0xea,
+    0x5, 0x20, 0xf, 0xf0, 0xa8, 0x20, 0x7, 0xfd,
+    0xa1, 0xc0, 0x1f, 0xf7, 0x87, 0x80, 0x7f, 0xc4,
+    0x2, 0x1, 0xfe, 0x14, 0x4, 0x0, 0xff, 0x50,
+    0xa9, 0x0, 0x7e, 0x4c, 0x42, 0xb0, 0xa, 0xae,
+    0xec, 0xeb, 0x34, 0xf1, 0x0, 0x91, 0x31, 0x1a,
+    0xdd, 0x88, 0x0,
+
+    /* U+0045 "E" */
+    0xef, 0xff, 0xe0, 0x9, 0x13, 0xf0, 0x5, 0x57,
+    0x7f, 0x0, 0x7f, 0xf6, 0x3b, 0xff, 0xc4, 0x1,
+    0x22, 0x7c, 0x60, 0x15, 0x5d, 0xf8, 0x40, 0x3f,
+    0xfb, 0x15, 0x77, 0xf1, 0x80, 0x11, 0x3f, 0x38,
+
+    /* U+0046 "F" */
+    0xef, 0xff, 0xe0, 0x2, 0x27, 0xe0, 0x5, 0x5d,
+    0xfc, 0x1, 0xff, 0xd4, 0xab, 0xbf, 0x8, 0x1,
+    0x13, 0xe3, 0x0, 0x77, 0xff, 0x88, 0x3, 0xff,
+    0xcc,
+
+    /* U+0047 "G" */
+    0x0, 0x85, 0xaf, 0x7f, 0xad, 0xc4, 0x2, 0x5f,
+    0x94, 0x4, 0x24, 0x8f, 0x40, 0x5a, 0x17, 0xdd,
+    0x5e, 0x73, 0x89, 0x12, 0xc2, 0xa0, 0x80, 0x21,
+    0x8e, 0x6a, 0x16, 0x50, 0xf, 0x84, 0x14, 0x28,
+    0x3, 0xfc, 0x40, 0x60, 0x1f, 0x84, 0x40, 0x1f,
+    0xe3, 0xea, 0x20, 0x30, 0xf, 0xf2, 0x85, 0x0,
+    0x7f, 0xa8, 0x59, 0x40, 0x3f, 0x8a, 0xc2, 0xa0,
+    0x40, 0x21, 0xb0, 0x9, 0x68, 0x5f, 0xb6, 0xf7,
+    0x9c, 0x74, 0x0, 0xbf, 0x8, 0x68, 0x69, 0x1e,
+    0xc0,
+
+    /* U+0048 "H" */
+    0xef, 0x10, 0xf, 0xb7, 0xc8, 0x3, 0xff, 0xef,
+    0xdf, 0xff, 0x10, 0x6, 0x44, 0xfc, 0x20, 0x1a,
+    0xae, 0xfe, 0x30, 0xf, 0xff, 0xb8,
+
+    /* U+0049 "I" */
+    0xef, 0x10, 0xf, 0xfe, 0xd8,
+
+    /* U+004A "J" */
+    0xc, 0xff, 0xf2, 0x2, 0x27, 0x8, 0x5, 0x17,
+    0x79, 0x40, 0x3f, 0xfe, 0xa2, 0x20, 0xc, 0xc0,
+    0xf5, 0x41, 0x0, 0x29, 0x9, 0x8a, 0x76, 0x62,
+    0x82, 0x2, 0xa4, 0xc8, 0x87, 0x4c, 0x0,
+
+    /* U+004B "K" */
+    0xef, 0x10, 0xe, 0x1b, 0xf8, 0x0, 0xfe, 0xa4,
+    0x68, 0x0, 0xfd, 0x48, 0xd2, 0x1, 0xfa, 0x95,
+    0x52, 0x1, 0xfa, 0x95, 0x28, 0x3, 0xf4, 0xaa,
+    0x50, 0x7, 0xe9, 0x60, 0x81, 0x0, 0xfa, 0xd8,
+    0x43, 0x84, 0x3, 0xe5, 0x2c, 0x42, 0xa0, 0xf,
+    0x8b, 0xca, 0x8d, 0x24, 0x3, 0xdc, 0x40, 0x3c,
+    0x4c, 0xe0, 0x1c, 0x40, 0x11, 0x70, 0xc2, 0x0,
+    0x7f, 0x1d, 0x5, 0x10, 0x7, 0xf2, 0x48, 0xf8,
+    0x80,
+
+    /* U+004C "L" */
+    0xef, 0x10, 0xf, 0xff, 0xf8, 0x7, 0xff, 0x83,
+    0x73, 0x3d, 0x0, 0x3, 0x3f, 0x88,
+
+    /* U+004D "M" */
+    0xee, 0x8, 0x7, 0xf0, 0xf7, 0x80, 0xc0, 0x7,
+    0xf4, 0x88, 0x4, 0xc6, 0x1, 0xf1, 0x38, 0x7,
+    0x78, 0x7, 0xd2, 0x1, 0xca, 0x6c, 0x1, 0xc8,
+    0x85, 0x10, 0xa, 0xc6, 0x4, 0x3, 0x48, 0xc0,
+    0x6, 0x18, 0x18, 0x0, 0x9c, 0xa4, 0x80, 0x39,
+    0x8d, 0x8c, 0x6, 0x49, 0xc0, 0x3e, 0xf0, 0xf0,
+    0xb1, 0x90, 0xf, 0xc6, 0xc7, 0x2a, 0xa4, 0x0,
+    0xfe, 0x81, 0x61, 0x80, 0xf, 0xf0, 0xc0, 0x49,
+    0x0, 0x7f, 0xcd, 0x6e, 0x1, 0xff, 0xc1, 0x40,
+    0xf, 0x80,
+
+    /* U+004E "N" */
+    0xee, 0x18, 0x7, 0xdb, 0xe4, 0x3, 0xc2, 0x1,
+    0xff, 0x15, 0x0, 0x7f, 0xc2, 0x90, 0x1, 0xfe,
+    0xb0, 0x75, 0x0, 0xfe, 0x49, 0xb, 0x30, 0xf,
+    0xe6, 0x60, 0xf0, 0x80, 0x7f, 0x4a, 0x15, 0x0,
+    0x7f, 0xa8, 0x92, 0x40, 0x3f, 0x87, 0x85, 0x98,
+    0x1, 0xfc, 0x76, 0x12, 0x60, 0x1f, 0xca, 0xe0,
+    0x20, 0x1f, 0xe8, 0x40, 0xf, 0xfd, 0x44, 0x0,
+
+    /* U+004F "O" */
+    0x0, 0x85, 0xef, 0x7f, 0x6d, 0x44, 0x3, 0x97,
+    0xe1, 0x5, 0x1, 0x2b, 0xc, 0x2, 0x5a, 0x17,
+    0xec, 0xbd, 0xd2, 0x96, 0x98, 0x15, 0x85, 0x40,
+    0x80, 0x45, 0x4e, 0x3c, 0x14, 0x2c, 0xa0, 0x1f,
+    0x41, 0x92, 0xa8, 0x28, 0x3, 0xfa, 0x83, 0xc8,
+    0xc, 0x3, 0xf9, 0x41, 0x80, 0x3f, 0xf8, 0x64,
+    0x6, 0x1, 0xfc, 0xa0, 0xca, 0x14, 0x1, 0xfd,
+    0x41, 0xf4, 0x2c, 0xa0, 0x1f, 0x41, 0x92, 0x95,
+    0x85, 0x40, 0x80, 0x45, 0x4e, 0x3c, 0x0, 0x5a,
+    0x17, 0xec, 0xbd, 0xd2, 0x96, 0x98, 0x4, 0xbf,
+    0x8, 0x48, 0x9, 0x38, 0x60, 0x0,
+
+    /* U+0050 "P" */
+    0xef, 0xfe, 0xec, 0x71, 0x0, 0xc8, 0x98, 0xcd,
+    0x18, 0x40, 0x15, 0x5d, 0xdb, 0xa5, 0x2e, 0x0,
+    0xfc, 0x56, 0x46, 0x60, 0xf, 0xc2, 0xe0, 0xa0,
+    0x1f, 0xc2, 0x6, 0x1, 0xf8, 0x94, 0x1c, 0x3,
+    0xc4, 0xde, 0x2a, 0x40, 0xe, 0xff, 0xb6, 0x49,
+    0x68, 0x2, 0x44, 0xca, 0xf9, 0x40, 0x1a, 0xae,
+    0xea, 0x83, 0x0, 0xff, 0xed, 0x80,
+
+    /* U+0051 "Q" */
+    0x0, 0x85, 0xaf, 0x7f, 0x6d, 0x40, 0x3e, 0x4f,
+    0x94, 0x14, 0x4, 0xad, 0x30, 0xc, 0xb6, 0x2f,
+    0xd9, 0x7b, 0xa5, 0x2d, 0x30, 0x1, 0x58, 0x54,
+    0x8, 0x4, 0x54, 0xe3, 0xc0, 0xa, 0x16, 0x50,
+    0xf, 0xa0, 0xc9, 0x41, 0x42, 0x80, 0x3f, 0xa8,
+    0x3c, 0x8, 0xc, 0x3, 0xf9, 0x41, 0x80, 0x3f,
+    0xf8, 0xa4, 0x6, 0x1, 0xfc, 0xa0, 0xc0, 0x81,
+    0x40, 0x1f, 0xd4, 0x18, 0x16, 0xc, 0xa0, 0x1f,
+    0x41, 0x93, 0x81, 0x40, 0x54, 0x8, 0x4, 0x54,
+    0xe1, 0x22, 0x0, 0x79, 0x7, 0xec, 0xbd, 0xd2,
+    0x8d, 0xa0, 0x6, 0x6d, 0x73, 0x24, 0x22, 0x47,
+    0xa0, 0x7, 0x8a, 0x33, 0x98, 0x0, 0x82, 0x5,
+    0x42, 0x1, 0xf4, 0xb9, 0x66, 0x5a, 0xaa, 0x0,
+    0xfd, 0x16, 0x84, 0x44, 0xc4,
+
+    /* U+0052 "R" */
+    0xef, 0xfe, 0xec, 0x71, 0x0, 0xc8, 0x98, 0xcd,
+    0x18, 0x40, 0x15, 0x5d, 0xdb, 0xa5, 0x2e, 0x0,
+    0xfc, 0x56, 0x46, 0x60, 0xf, 0xc2, 0xe0, 0xa0,
+    0x1f, 0xc2, 0x6, 0x1, 0xf8, 0x94, 0x1c, 0x3,
+    0xc4, 0xde, 0x2c, 0x40, 0xe, 0xff, 0xb6, 0x49,
+    0xa4, 0x2, 0x44, 0xc4, 0xd, 0x20, 0x1a, 0xae,
+    0xec, 0x16, 0x30, 0xf, 0xc3, 0x41, 0xc2, 0x1,
+    0xf9, 0x18, 0xa0, 0x3, 0xfa, 0x9, 0x90,
+
+    /* U+0053 "S" */
+    0x0, 0x9a, 0xfb, 0xfa, 0xdc, 0x40, 0x3, 0x92,
+    0x84, 0x84, 0x91, 0x80, 0x9, 0x33, 0x6e, 0x5e,
+    0x74, 0xd8, 0x1, 0x3, 0xc8, 0x2, 0x16, 0x60,
+    0x1, 0xc1, 0xc0, 0x3f, 0xb4, 0x29, 0xc4, 0x3,
+    0xe6, 0x71, 0x8e, 0xd9, 0x40, 0xe, 0x8d, 0x94,
+    0x36, 0xbd, 0x40, 0xc, 0x4d, 0x7d, 0x8a, 0x56,
+    0x40, 0x1f, 0x1d, 0x38, 0x28, 0x8, 0x7, 0xde,
+    0x1e, 0x1b, 0x46, 0x1, 0x8e, 0x83, 0x5, 0xd7,
+    0x3b, 0x2f, 0x70, 0x99, 0x6, 0xec, 0xc6, 0x48,
+    0xb, 0x72, 0x0,
+
+    /* U+0054 "T" */
+    0xef, 0xff, 0xf5, 0x22, 0x70, 0xa, 0x26, 0xda,
+    0xbb, 0xa4, 0xe, 0xef, 0x38, 0x7, 0xff, 0xfc,
+    0x3, 0xff, 0xda,
+
+    /* U+0055 "U" */
+    0xff, 0x0, 0x7c, 0x5f, 0x80, 0x1f, 0xff, 0xf0,
+    0xf, 0xfe, 0x30, 0x80, 0x8, 0xc, 0x3, 0xcc,
+    0xc, 0x81, 0x60, 0x1e, 0xe0, 0xcb, 0x7, 0x60,
+    0xd, 0x8, 0x4e, 0x54, 0x13, 0xd7, 0x6e, 0x71,
+    0xe1, 0x5, 0xd6, 0x34, 0x52, 0x7f, 0x30,
+
+    /* U+0056 "V" */
+    0xcf, 0x50, 0xf, 0xee, 0xf1, 0x90, 0x90, 0xf,
+    0xcc, 0x2c, 0x2a, 0x46, 0x80, 0x1f, 0x58, 0x50,
+    0x2, 0x83, 0x80, 0x3c, 0x84, 0x86, 0x0, 0x61,
+    0x52, 0x0, 0xef, 0xf, 0x0, 0x85, 0xc2, 0x80,
+    0x31, 0x21, 0x20, 0x6, 0xb0, 0x61, 0x0, 0xac,
+    0x2c, 0x3, 0x89, 0x5, 0xc0, 0x2, 0xe2, 0xe0,
+    0x1e, 0xf0, 0xb0, 0x3, 0xb, 0x8, 0x7, 0x90,
+    0x88, 0xa1, 0x21, 0x40, 0x1f, 0xac, 0x39, 0x45,
+    0x48, 0x3, 0xf3, 0x8a, 0x40, 0x48, 0x7, 0xf0,
+    0xb0, 0x11, 0x98, 0x3, 0xfd, 0x40, 0x9, 0x0,
+    0xf0,
+
+    /* U+0057 "W" */
+    0x3f, 0xd0, 0xf, 0xaf, 0xd8, 0x3, 0xc7, 0xf6,
+    0x64, 0x43, 0x0, 0xe2, 0x40, 0xa0, 0xf, 0x58,
+    0x68, 0x28, 0x58, 0x7, 0x28, 0x0, 0xc8, 0x3,
+    0x94, 0x1c, 0x2c, 0x14, 0x3, 0xac, 0x18, 0x14,
+    0x3, 0x19, 0x20, 0x81, 0x91, 0xc, 0x2, 0x23,
+    0x4b, 0xb, 0x0, 0xd6, 0x1a, 0x1, 0x28, 0x58,
+    0x4, 0xa1, 0xa4, 0x66, 0x20, 0x9, 0x41, 0xc0,
+    0x2b, 0x5, 0x0, 0xac, 0x1c, 0x2c, 0x14, 0x0,
+    0x64, 0x82, 0x1, 0x19, 0x10, 0xc0, 0xcc, 0xa2,
+    0xa, 0x16, 0x0, 0xb0, 0xd0, 0xe, 0x50, 0xb0,
+    0xb0, 0xf0, 0x1, 0x19, 0x88, 0x14, 0x1c, 0x3,
+    0xac, 0x14, 0x14, 0x50, 0x2, 0xb0, 0x53, 0x24,
+    0x10, 0xe, 0x32, 0x23, 0x12, 0x8, 0x4, 0xa1,
+    0x76, 0xd, 0x0, 0xf9, 0x42, 0x3, 0xc0, 0x31,
+    0x19, 0x98, 0x1c, 0x3, 0xeb, 0x1, 0x12, 0x80,
+    0x75, 0x0, 0xa0, 0x80, 0x7c, 0x64, 0xe, 0x1,
+    0xe7, 0x0, 0x68, 0x6,
+
+    /* U+0058 "X" */
+    0x2e, 0xf3, 0x0, 0xf5, 0xfb, 0x95, 0x87, 0x8,
+    0x6, 0x64, 0x43, 0x82, 0xb1, 0x58, 0x4, 0x50,
+    0x32, 0x1, 0x41, 0x2b, 0x0, 0x38, 0x6c, 0x80,
+    0x21, 0xe0, 0x82, 0x83, 0x65, 0x0, 0xe3, 0x81,
+    0xf7, 0x39, 0x0, 0xf9, 0xd0, 0x83, 0xc0, 0x3f,
+    0xb, 0x0, 0x14, 0x3, 0xf5, 0x92, 0x8c, 0x98,
+    0x7, 0x99, 0x4e, 0xa0, 0x38, 0x40, 0x31, 0xc8,
+    0xf0, 0x32, 0x94, 0x0, 0x43, 0xc1, 0x64, 0x0,
+    0xb2, 0x65, 0x0, 0x59, 0x2a, 0x80, 0x21, 0xe0,
+    0xb2, 0x55, 0x15, 0x80, 0x71, 0xc0, 0xf0,
+
+    /* U+0059 "Y" */
+    0xcf, 0x50, 0xf, 0x93, 0xef, 0xc2, 0xc4, 0x3,
+    0xd2, 0x12, 0x6e, 0x30, 0x1, 0xce, 0x4e, 0x41,
+    0x24, 0xc6, 0x1, 0x14, 0x94, 0x0, 0x6, 0x3,
+    0xc0, 0x28, 0x19, 0x0, 0xca, 0x86, 0xc0, 0x8a,
+    0xa4, 0x0, 0xe9, 0x8, 0x29, 0x18, 0x0, 0xf1,
+    0x38, 0xf9, 0x49, 0x0, 0x7d, 0x24, 0x53, 0x80,
+    0x7e, 0x15, 0xa, 0x0, 0xff, 0xf6, 0x80,
+
+    /* U+005A "Z" */
+    0xf, 0xff, 0xf9, 0x1, 0x13, 0xf1, 0x0, 0x18,
+    0x2e, 0xfe, 0xa0, 0x4, 0x90, 0x7, 0xea, 0x26,
+    0x60, 0x7, 0xe9, 0x44, 0x48, 0x7, 0xe6, 0x61,
+    0x50, 0x7, 0xe3, 0x90, 0xe1, 0x0, 0xf8, 0x78,
+    0x24, 0xc0, 0x3f, 0x69, 0x33, 0x0, 0x3f, 0x49,
+    0xa4, 0x80, 0x7e, 0x66, 0x15, 0x0, 0x7e, 0x39,
+    0xe, 0x10, 0xf, 0x87, 0x40, 0x62, 0xef, 0xe6,
+    0x31, 0x1, 0x44, 0xfd, 0xc0,
+
+    /* U+005B "[" */
+    0xef, 0xf9, 0x0, 0x8, 0x87, 0x0, 0x5d, 0x8c,
+    0x3, 0xff, 0xf9, 0x76, 0x30, 0x2, 0x21, 0xc0,
+
+    /* U+005C "\\" */
+    0x57, 0x0, 0xf8, 0xe1, 0x40, 0x3c, 0xe1, 0xe0,
+    0x1e, 0x14, 0x40, 0x80, 0x7b, 0x45, 0x0, 0x3c,
+    0xe1, 0xe0, 0x1e, 0x14, 0x40, 0x80, 0x7b, 0x45,
+    0x0, 0x3c, 0xe1, 0xe0, 0x1e, 0x14, 0x51, 0x0,
+    0xf6, 0x82, 0x0, 0x79, 0xc3, 0x80, 0x3c, 0x28,
+    0x81, 0x0, 0xf7, 0x3, 0x80, 0x79, 0x3, 0x40,
+    0x3c, 0x2a, 0x82, 0x1, 0xef, 0x7, 0x0, 0xf2,
+    0xe, 0x80, 0x78, 0x51, 0x2, 0x1, 0xef, 0x7,
+
+    /* U+005D "]" */
+    0x9f, 0xfa, 0x39, 0xc, 0x0, 0xf7, 0x20, 0x1f,
+    0xff, 0xc7, 0xb9, 0x0, 0x72, 0x18, 0x0,
+
+    /* U+005E "^" */
+    0x0, 0xce, 0xc0, 0x1e, 0x68, 0x91, 0x0, 0xea,
+    0x30, 0x60, 0xc, 0x66, 0x96, 0xa0, 0xd, 0x44,
+    0xb4, 0x48, 0x0, 0x16, 0xa0, 0x33, 0x78, 0x1,
+    0x81, 0x80, 0x14, 0x84, 0x14, 0xa2, 0x0, 0x71,
+    0xa4, 0x2e, 0x0, 0x85, 0xd8,
+
+    /* U+005F "_" */
+    0xbb, 0xff, 0x22, 0x7f, 0x80,
+
+    /* U+0060 "`" */
+    0x27, 0x70, 0x80, 0x8, 0x93, 0xa2, 0x0, 0x5c,
+    0xc, 0x20,
+
+    /* U+0061 "a" */
+    0x4, 0xad, 0xfe, 0xb4, 0x0, 0x3d, 0xa8, 0xa1,
+    0xa5, 0xa8, 0x2c, 0x76, 0x5e, 0xd0, 0x40, 0x13,
+    0x88, 0x4, 0xa6, 0x44, 0x2, 0x8a, 0xbb, 0x88,
+    0x5, 0x35, 0xd5, 0x12, 0x10, 0x4, 0x3, 0xf7,
+    0xfc, 0x80, 0x3, 0x18, 0x10, 0x9, 0xc0, 0x4,
+    0x28, 0x1, 0x39, 0x80, 0x2c, 0x2f, 0x2f, 0xa0,
+    0xc0, 0xd, 0x46, 0x4a, 0xac, 0x50, 0x0,
+
+    /* U+0062 "b" */
+    0x3f, 0xb0, 0xf, 0xff, 0x20, 0xce, 0xfe, 0xc9,
+    0x0, 0x66, 0xc6, 0x14, 0x36, 0xc4, 0x0, 0x88,
+    0x33, 0x17, 0xce, 0x34, 0x20, 0x17, 0x18, 0x5,
+    0xa, 0x2c, 0x0, 0x23, 0x0, 0xee, 0xd, 0x0,
+    0x30, 0x7, 0x9c, 0x18, 0x0, 0xc0, 0x1e, 0x70,
+    0x60, 0x1, 0x18, 0x7, 0x70, 0x68, 0x5, 0xc6,
+    0x1, 0x42, 0x8b, 0x0, 0xc, 0xd9, 0x8b, 0xe7,
+    0x1a, 0x10, 0x3, 0x7b, 0xa, 0x1b, 0x62, 0x0,
+
+    /* U+0063 "c" */
+    0x0, 0x8e, 0xb7, 0xf6, 0x48, 0x2, 0x7c, 0x50,
+    0x43, 0x6c, 0x30, 0x48, 0x1b, 0xdb, 0xe8, 0x15,
+    0x8, 0xb, 0x40, 0x9, 0xf9, 0x84, 0xc5, 0x40,
+    0x38, 0x40, 0xc0, 0x80, 0x3f, 0x18, 0x10, 0x7,
+    0xe1, 0x31, 0x50, 0xe, 0x10, 0x4, 0x5, 0xa0,
+    0x4, 0xde, 0xc0, 0x90, 0x37, 0xb7, 0xb2, 0xa,
+    0x0, 0x7c, 0x50, 0x40, 0x6c, 0x30,
+
+    /* U+0064 "d" */
+    0x0, 0xfe, 0x1f, 0xc0, 0xf, 0xfe, 0xda, 0xdf,
+    0x73, 0x18, 0xc0, 0x34, 0x52, 0x1a, 0x94, 0xc8,
+    0x2, 0x57, 0x1b, 0xdb, 0xe8, 0x40, 0xa, 0x42,
+    0xd0, 0x2, 0x76, 0x0, 0x9, 0x8a, 0x80, 0x75,
+    0x0, 0xc, 0x8, 0x3, 0xc2, 0x0, 0x30, 0x20,
+    0xf, 0x8, 0x0, 0x4c, 0x54, 0x3, 0xa8, 0x2,
+    0x90, 0xb4, 0x0, 0x9d, 0x80, 0x25, 0x71, 0xbd,
+    0xbe, 0x85, 0x0, 0xd1, 0x48, 0x68, 0x53, 0x40,
+    0x0,
+
+    /* U+0065 "e" */
+    0x0, 0x92, 0xfb, 0x98, 0xe0, 0x1d, 0x16, 0x84,
+    0x54, 0x60, 0x80, 0x15, 0xd3, 0x73, 0x1e, 0xe7,
+    0x0, 0x9, 0xa, 0x20, 0x0, 0xc2, 0x30, 0x88,
+    0xc6, 0xae, 0xf9, 0x81, 0xc, 0x5, 0x13, 0xc4,
+    0x6, 0x60, 0x1f, 0xff, 0xcc, 0x26, 0x2a, 0x1,
+    0xfd, 0x21, 0x6a, 0x1, 0x1e, 0x10, 0x1, 0x60,
+    0x6b, 0x6f, 0x30, 0x68, 0x1, 0x3e, 0x28, 0x21,
+    0x2d, 0xb0, 0x0,
+
+    /* U+0066 "f" */
+    0x0, 0x9b, 0x7b, 0x58, 0x0, 0xf2, 0x6a, 0x2,
+    0x0, 0xb0, 0xdb, 0xd7, 0x0, 0x10, 0x18, 0x5,
+    0x7e, 0x21, 0xff, 0x9, 0xa0, 0x1, 0x12, 0x8,
+    0xb1, 0xb, 0xb8, 0x40, 0x3f, 0xfe, 0x80,
+
+    /* U+0067 "g" */
+    0x0, 0x92, 0xfb, 0xf1, 0xc3, 0x78, 0x1, 0x16,
+    0x86, 0x83, 0x18, 0x1, 0x2b, 0x8d, 0xed, 0xed,
+    0x11, 0x0, 0x12, 0x14, 0x80, 0x12, 0xc0, 0x0,
+    0x4c, 0x50, 0x3, 0x9c, 0x0, 0x60, 0x40, 0x1e,
+    0x11, 0x1, 0x81, 0x0, 0x78, 0x44, 0x2, 0x62,
+    0xa0, 0x1c, 0xc0, 0x14, 0x85, 0xa0, 0x4, 0xb0,
+    0x1, 0x2b, 0x8d, 0xed, 0xed, 0x18, 0x6, 0x8b,
+    0x43, 0x40, 0x8d, 0x3, 0x0, 0x92, 0xfb, 0xf5,
+    0xd4, 0x1c, 0x6, 0x90, 0x3, 0x1c, 0x87, 0x82,
+    0x2d, 0xf6, 0x5e, 0xe1, 0x2a, 0x81, 0x75, 0xc8,
+    0x88, 0x69, 0x34, 0x0,
+
+    /* U+0068 "h" */
+    0x3f, 0xb0, 0xf, 0xff, 0x1, 0x4e, 0xfe, 0xc8,
+    0x80, 0x4d, 0x8c, 0x26, 0x66, 0xc1, 0x0, 0x11,
+    0x37, 0x32, 0x32, 0x60, 0xb, 0x88, 0x0, 0x50,
+    0x18, 0x0, 0x22, 0x0, 0x66, 0x6, 0x0, 0x30,
+    0x7, 0x18, 0x7, 0xff, 0xb4,
+
+    /* U+0069 "i" */
+    0x3e, 0xa0, 0x41, 0x51, 0x54, 0x71, 0x2b, 0x80,
+    0x3f, 0xb0, 0xf, 0xfe, 0xe8,
+
+    /* U+006A "j" */
+    0x0, 0x8b, 0x6c, 0x3, 0x21, 0x21, 0x0, 0x4e,
+    0x8c, 0x40, 0x10, 0xdc, 0x80, 0x61, 0xfd, 0x0,
+    0xff, 0xff, 0x80, 0x80, 0x64, 0x6, 0x7, 0xdb,
+    0xa0, 0xe0, 0x9, 0x4e, 0x90, 0x0,
+
+    /* U+006B "k" */
+    0x3f, 0xb0, 0xf, 0xff, 0x41, 0x6f, 0xa8, 0x7,
+    0xc5, 0xe5, 0x2a, 0x1, 0xe3, 0xc2, 0x96, 0x0,
+    0xf1, 0xe8, 0xc3, 0x0, 0x78, 0xf4, 0x59, 0xc0,
+    0x3c, 0xda, 0x20, 0xe4, 0x1, 0xe2, 0x19, 0x51,
+    0xe0, 0xf, 0xa9, 0xac, 0xcd, 0x20, 0x1c, 0x8a,
+    0x3, 0xc2, 0xca, 0x1, 0xf8, 0xa8, 0x2c, 0xc0,
+    0x3f, 0x24, 0xf, 0x8,
+
+    /* U+006C "l" */
+    0x3f, 0xb0, 0xf, 0xfe, 0xf0,
+
+    /* U+006D "m" */
+    0x3f, 0xa2, 0xae, 0xfd, 0x70, 0x2, 0xdf, 0x73,
+    0x14, 0x3, 0x36, 0x29, 0x19, 0x44, 0xc5, 0x29,
+    0x19, 0xa9, 0xc0, 0x23, 0x2e, 0xcc, 0x58, 0x33,
+    0xaf, 0xe6, 0xd0, 0x48, 0x80, 0x5c, 0x20, 0x4,
+    0x60, 0x1b, 0x10, 0x2, 0xa0, 0xa0, 0x0, 0x88,
+    0x1, 0xbc, 0x10, 0x40, 0x31, 0x81, 0x80, 0x18,
+    0x3, 0x8c, 0xc, 0x3, 0xff, 0xfe, 0x1, 0xff,
+    0xd0,
+
+    /* U+006E "n" */
+    0x3f, 0xa2, 0xae, 0xfd, 0x91, 0x0, 0x9b, 0x14,
+    0x8c, 0xcd, 0x82, 0x0, 0x32, 0xdc, 0xc8, 0xc9,
+    0x80, 0x2e, 0x20, 0x1, 0x40, 0x60, 0x0, 0x88,
+    0x1, 0x98, 0x18, 0x0, 0xc0, 0x1c, 0x60, 0x1f,
+    0xfe, 0xd0,
+
+    /* U+006F "o" */
+    0x0, 0x92, 0xbb, 0xf6, 0x48, 0x3, 0x3d, 0xa9,
+    0xa1, 0xb6, 0x20, 0x1, 0x60, 0x6f, 0x6f, 0xa0,
+    0x68, 0x42, 0x42, 0xd0, 0x2, 0x76, 0x16, 0x13,
+    0x15, 0x0, 0xea, 0xc, 0x30, 0x20, 0xf, 0x8,
+    0x39, 0x81, 0x0, 0x78, 0x41, 0xc4, 0xc5, 0x40,
+    0x3a, 0x83, 0x2, 0x42, 0xd0, 0x2, 0x76, 0x16,
+    0x5, 0x81, 0xbd, 0xbe, 0x81, 0xa1, 0x0, 0x3d,
+    0xa9, 0xa1, 0xb6, 0x20, 0x0,
+
+    /* U+0070 "p" */
+    0x3f, 0xa1, 0x9d, 0xfd, 0x92, 0x0, 0xcd, 0xec,
+    0x8, 0x6d, 0x88, 0x1, 0x19, 0xb3, 0x6f, 0x9c,
+    0x68, 0x40, 0x29, 0x30, 0xa, 0x14, 0x58, 0x0,
+    0x48, 0x1, 0xdc, 0x1a, 0x0, 0x60, 0xf, 0x38,
+    0x30, 0x1, 0x80, 0x3c, 0xe0, 0xc0, 0x2, 0x30,
+    0xe, 0xe0, 0xd0, 0xb, 0x8c, 0x2, 0x85, 0x16,
+    0x0, 0x10, 0x66, 0x2f, 0x9c, 0x68, 0x40, 0xd,
+    0x8c, 0x28, 0x6d, 0x88, 0x1, 0x86, 0x77, 0xf6,
+    0x48, 0x3, 0xff, 0xb4,
+
+    /* U+0071 "q" */
+    0x0, 0x96, 0xfb, 0x98, 0xc1, 0xf8, 0x0, 0x8a,
+    0x43, 0x52, 0x9a, 0x0, 0x95, 0xc6, 0xf6, 0xfa,
+    0x14, 0x2, 0x90, 0xb4, 0x0, 0x9d, 0x80, 0x2,
+    0x62, 0xa0, 0x1d, 0x40, 0x3, 0x2, 0x0, 0xf0,
+    0x80, 0xc, 0x8, 0x3, 0xc2, 0x0, 0x13, 0x15,
+    0x0, 0xea, 0x0, 0xa4, 0x2d, 0x0, 0x27, 0x60,
+    0x9, 0x5c, 0x6f, 0x6f, 0xa1, 0x0, 0x34, 0x52,
+    0x1a, 0x14, 0xc8, 0x3, 0x96, 0xfb, 0xf1, 0x8c,
+    0x3, 0xff, 0xb4,
+
+    /* U+0072 "r" */
+    0x3f, 0xa2, 0xae, 0x80, 0x3, 0x62, 0x97, 0x0,
+    0xc, 0xb7, 0x18, 0x2, 0xf2, 0x0, 0xc4, 0x60,
+    0x1c, 0xc0, 0x1f, 0xfd, 0xb0,
+
+    /* U+0073 "s" */
+    0x0, 0x2d, 0xf7, 0xed, 0x20, 0x2, 0x69, 0x9,
+    0xd, 0x64, 0x5, 0x87, 0x72, 0xfa, 0xe4, 0xc,
+    0x8, 0x80, 0x12, 0x20, 0x8, 0x87, 0x6c, 0x60,
+    0x1d, 0xe8, 0x89, 0xcf, 0xb3, 0x0, 0x15, 0xf5,
+    0xc2, 0x23, 0x48, 0x2, 0x14, 0x7b, 0x61, 0x40,
+    0x93, 0x0, 0xc4, 0x6, 0xad, 0x9d, 0x76, 0xe4,
+    0x35, 0x55, 0x29, 0xa2, 0x94, 0x68, 0x0,
+
+    /* U+0074 "t" */
+    0x0, 0x3c, 0x0, 0x7a, 0x5c, 0x3, 0xff, 0x5f,
+    0x88, 0x7f, 0xc2, 0x68, 0x0, 0x44, 0x82, 0x2c,
+    0x42, 0xee, 0x10, 0xf, 0xfe, 0xb1, 0x80, 0x7c,
+    0x20, 0x80, 0x1d, 0x41, 0x54, 0xc7, 0x0, 0x34,
+    0x1a, 0x9, 0x0,
+
+    /* U+0075 "u" */
+    0x4f, 0xa0, 0xe, 0x3f, 0xb0, 0xf, 0xff, 0x9b,
+    0x0, 0x18, 0x1c, 0x3, 0xb0, 0x0, 0x45, 0x40,
+    0x4, 0xcc, 0x0, 0xa0, 0x1f, 0x6f, 0x65, 0x0,
+    0x25, 0xc4, 0x34, 0x19, 0x90, 0x0,
+
+    /* U+0076 "v" */
+    0xdf, 0x20, 0xf, 0x6f, 0xd, 0x85, 0x80, 0x72,
+    0x93, 0x8b, 0x8b, 0x88, 0x6, 0xe0, 0xb0, 0x17,
+    0x17, 0x0, 0x89, 0x10, 0x40, 0xb, 0xa, 0x0,
+    0xac, 0x38, 0x2, 0x24, 0x33, 0x0, 0xb9, 0x28,
+    0x6, 0xe0, 0xa0, 0x71, 0xa0, 0xe, 0x52, 0x71,
+    0xb1, 0x60, 0xf, 0x50, 0xd9, 0x38, 0x80, 0x79,
+    0x81, 0x42, 0x80, 0x3e, 0x16, 0x3, 0x30, 0x6,
+
+    /* U+0077 "w" */
+    0xbf, 0x20, 0xe, 0xee, 0x8, 0x6, 0x1f, 0xae,
+    0x5, 0x0, 0xca, 0x22, 0x70, 0xc, 0xe1, 0xe8,
+    0x36, 0x1, 0xbc, 0x1, 0xa0, 0x1b, 0x45, 0x45,
+    0xcc, 0x80, 0x2, 0xa8, 0x90, 0x80, 0x9, 0x1c,
+    0x1, 0xa1, 0x40, 0x7, 0xe, 0xe0, 0x30, 0x1,
+    0x43, 0x40, 0x8, 0x4a, 0x0, 0xa1, 0x54, 0x1b,
+    0x0, 0x59, 0x20, 0x4, 0xa4, 0x64, 0x6e, 0x2,
+    0xe6, 0x46, 0x65, 0x0, 0xd6, 0x17, 0x41, 0x40,
+    0xd, 0xa, 0xb0, 0xa0, 0xc, 0x64, 0xca, 0x46,
+    0x0, 0x42, 0x55, 0x19, 0x0, 0x75, 0x9, 0x50,
+    0x6, 0xa2, 0x25, 0x80, 0x79, 0x40, 0xa, 0x1,
+    0x94, 0x0, 0xc0, 0x10,
+
+    /* U+0078 "x" */
+    0x3f, 0xe1, 0x0, 0x87, 0x7c, 0xcd, 0x23, 0x40,
+    0x15, 0x94, 0x18, 0x32, 0xa3, 0x82, 0xa9, 0x1c,
+    0x2, 0xb2, 0x85, 0xb2, 0xa0, 0xc, 0x32, 0x14,
+    0x32, 0x20, 0x1c, 0x88, 0x4, 0x40, 0x7, 0x95,
+    0x1, 0x14, 0x3, 0x8a, 0xc7, 0x6, 0xc8, 0x3,
+    0x70, 0xd1, 0xd0, 0xf0, 0x80, 0x24, 0xdd, 0x1,
+    0x1c, 0xe0, 0x15, 0x8e, 0x0, 0x28, 0x36, 0x60,
+
+    /* U+0079 "y" */
+    0xc, 0xf2, 0x0, 0xf6, 0xf0, 0x85, 0x5, 0x80,
+    0x72, 0x93, 0x8, 0x38, 0xb8, 0x80, 0x6e, 0xa,
+    0x0, 0xb, 0xb, 0x0, 0x44, 0x88, 0x20, 0xa,
+    0x82, 0x80, 0x2b, 0xf, 0x0, 0xc4, 0xa4, 0x80,
+    0x2e, 0x48, 0x1, 0xdc, 0x1e, 0xe, 0x36, 0x1,
+    0xe4, 0x34, 0x2a, 0x17, 0x0, 0xfa, 0x83, 0x8d,
+    0x84, 0x3, 0xe7, 0x13, 0xa, 0x0, 0xfc, 0x2c,
+    0xa, 0x40, 0x1f, 0xc4, 0x1c, 0x1, 0xe4, 0x0,
+    0x1a, 0x9a, 0x0, 0x71, 0xde, 0xde, 0x7, 0x80,
+    0x78, 0x98, 0x14, 0xec, 0xc0, 0x3c,
+
+    /* U+007A "z" */
+    0x1f, 0xff, 0xd0, 0x8, 0x9e, 0x0, 0x68, 0xdd,
+    0xf1, 0x83, 0x28, 0x7, 0x2b, 0x9c, 0x80, 0x71,
+    0xd8, 0xf0, 0x7, 0xf, 0xd, 0x10, 0x7, 0x51,
+    0x42, 0x0, 0x74, 0x22, 0xb8, 0x7, 0x23, 0x95,
+    0x80, 0x70, 0xd0, 0xd, 0x5d, 0xe7, 0x21, 0x3,
+    0x44, 0xed,
+
+    /* U+007B "{" */
+    0x0, 0x1e, 0x75, 0x0, 0xe9, 0x9b, 0x40, 0x84,
+    0xf5, 0xc1, 0xc1, 0x80, 0x3f, 0xf9, 0x22, 0x1,
+    0xa6, 0xc3, 0x0, 0x8, 0x22, 0x50, 0x6, 0xc0,
+    0xd0, 0x4, 0x60, 0x60, 0x1f, 0xfc, 0xf7, 0x7,
+    0x0, 0x8c, 0x89, 0xae, 0x0, 0xe3, 0x36, 0x80,
+
+    /* U+007C "|" */
+    0xed, 0x0, 0xff, 0xec, 0x0,
+
+    /* U+007D "}" */
+    0x9e, 0xc4, 0x0, 0x71, 0x9a, 0x84, 0x1f, 0x4c,
+    0x54, 0x2, 0x50, 0xf, 0xfe, 0x69, 0x0, 0x58,
+    0x11, 0x20, 0x6, 0x11, 0x20, 0x2, 0xc6, 0x34,
+    0x0, 0x20, 0x60, 0x1f, 0xfc, 0x93, 0x0, 0xe6,
+    0x7, 0x7, 0xd3, 0x12, 0xe, 0x33, 0x68, 0x80,
+
+    /* U+007E "~" */
+    0x4, 0xa9, 0x20, 0xa, 0x54, 0xed, 0x5b, 0x14,
+    0x9, 0x82, 0x8b, 0x70, 0xeb, 0x30, 0x28, 0xb4,
+    0x47, 0x8c, 0x47, 0x42,
+
+    /* U+00A1 "¡" */
+    0x4e, 0x9d, 0x17, 0xa3, 0x93, 0xc7, 0x0, 0x8b,
+    0xdc, 0x2, 0x10, 0xf0, 0x0, 0xb8, 0x0, 0x40,
+    0xc0, 0x2, 0x60, 0x19, 0xc0,
+
+    /* U+00B0 "°" */
+    0x0, 0x3e, 0xf5, 0x8, 0x1, 0xef, 0xbc, 0xf4,
+    0x1, 0x3e, 0x63, 0x22, 0xa2, 0x22, 0x0, 0x9c,
+    0x84, 0x44, 0x1, 0x39, 0x4, 0xf9, 0x8c, 0x8a,
+    0x83, 0xdf, 0x79, 0xf0, 0x0,
+
+    /* U+00BF "¿" */
+    0x0, 0x8b, 0x70, 0x3, 0xf3, 0x91, 0x90, 0x7,
+    0xc8, 0x86, 0x20, 0xf, 0x86, 0xe4, 0x3, 0xf8,
+    0x44, 0x1, 0xf8, 0xfb, 0x0, 0x3f, 0x48, 0x28,
+    0x7, 0xd2, 0xa7, 0x20, 0x1e, 0x96, 0x3d, 0x10,
+    0xe, 0x36, 0x2d, 0x10, 0xf, 0x58, 0x50, 0x80,
+    0x7c, 0x21, 0xe0, 0x1c, 0xa6, 0x18, 0xe, 0xc2,
+    0x5, 0x15, 0xa2, 0xac, 0x13, 0xdf, 0xae, 0x54,
+    0x21, 0x38, 0xea, 0x8d, 0x58, 0x80,
+
+    /* U+00C1 "Á" */
+    0x0, 0xfc, 0xd0, 0xa0, 0x1f, 0xf4, 0x48, 0xa8,
+    0x7, 0xfa, 0x5a, 0xa4, 0x3, 0xfe, 0x9e, 0x50,
+    0xf, 0xfe, 0x7e, 0xfc, 0x0, 0x7f, 0xcc, 0x40,
+    0xc2, 0x1, 0xfe, 0xa0, 0x61, 0x70, 0xf, 0xe4,
+    0x35, 0x80, 0xb0, 0xf, 0xef, 0xe, 0x15, 0x25,
+    0x0, 0xf8, 0xd0, 0xd0, 0x24, 0x24, 0x3, 0xea,
+    0x9, 0x0, 0x19, 0xc8, 0x1, 0xc4, 0xc2, 0xa0,
+    0x14, 0x87, 0x80, 0x75, 0x4, 0x80, 0x65, 0x24,
+    0x20, 0x8, 0x58, 0x23, 0xff, 0x88, 0x2c, 0x2,
+    0x61, 0x35, 0x5f, 0x81, 0x84, 0x1, 0x41, 0xf5,
+    0x5f, 0x30, 0x48, 0x29, 0x21, 0x80, 0x7d, 0x60,
+    0xc3, 0x21, 0xe0, 0x1f, 0x89, 0x45, 0xc0,
+
+    /* U+00C9 "É" */
+    0x0, 0xf3, 0xc1, 0x80, 0x78, 0x6e, 0x38, 0xc0,
+    0x38, 0x75, 0xb1, 0x80, 0x3c, 0x39, 0xa6, 0x1,
+    0xff, 0xc3, 0xef, 0xff, 0xe0, 0x9, 0x13, 0xf0,
+    0x5, 0x57, 0x7f, 0x0, 0x7f, 0xf6, 0x3b, 0xff,
+    0xc4, 0x1, 0x22, 0x7c, 0x60, 0x15, 0x5d, 0xf8,
+    0x40, 0x3f, 0xfb, 0x15, 0x77, 0xf1, 0x80, 0x11,
+    0x3f, 0x38,
+
+    /* U+00CD "Í" */
+    0x0, 0x9e, 0xc, 0x6, 0xe3, 0x8c, 0x75, 0xb1,
+    0x80, 0x73, 0x4c, 0x3, 0xfb, 0xbc, 0x40, 0x3f,
+    0xff, 0xe0, 0x1c,
+
+    /* U+00D1 "Ñ" */
+    0x0, 0xa3, 0xb1, 0x47, 0x14, 0x3, 0x89, 0xb2,
+    0x3b, 0xd9, 0x40, 0x38, 0xb8, 0x92, 0xfa, 0x80,
+    0x3f, 0xf8, 0xbd, 0xc3, 0x0, 0xfb, 0x7c, 0x80,
+    0x78, 0x40, 0x3f, 0xe2, 0xa0, 0xf, 0xf8, 0x52,
+    0x0, 0x3f, 0xd6, 0xe, 0xa0, 0x1f, 0xc9, 0x21,
+    0x66, 0x1, 0xfc, 0xcc, 0x1e, 0x10, 0xf, 0xe9,
+    0x42, 0xa0, 0xf, 0xf5, 0x12, 0x48, 0x7, 0xf0,
+    0xf0, 0xb3, 0x0, 0x3f, 0x8e, 0xc2, 0x4c, 0x3,
+    0xf9, 0x5c, 0x4, 0x3, 0xfd, 0x8, 0x1, 0xff,
+    0xa8, 0x80, 0x0,
+
+    /* U+00D3 "Ó" */
+    0x0, 0xfc, 0xb0, 0xc0, 0x1f, 0xf3, 0xd1, 0x38,
+    0x7, 0xfa, 0x21, 0x34, 0x20, 0x1f, 0xe8, 0xf6,
+    0x0, 0xff, 0xe6, 0xb, 0xde, 0xfe, 0xda, 0x88,
+    0x7, 0x2f, 0xc2, 0xa, 0x2, 0x56, 0x18, 0x4,
+    0xb4, 0x2f, 0xd9, 0x7b, 0xa5, 0x2d, 0x30, 0x2b,
+    0xa, 0x81, 0x0, 0x8a, 0x9c, 0x78, 0x28, 0x59,
+    0x40, 0x3e, 0x83, 0x25, 0x50, 0x50, 0x7, 0xf5,
+    0x7, 0x90, 0x18, 0x7, 0xf2, 0x83, 0x0, 0x7f,
+    0xf0, 0xc8, 0xc, 0x3, 0xf9, 0x41, 0x94, 0x28,
+    0x3, 0xfa, 0x83, 0xe8, 0x59, 0x40, 0x3e, 0x83,
+    0x25, 0x2b, 0xa, 0x81, 0x0, 0x8a, 0x9c, 0x78,
+    0x0, 0xb4, 0x2f, 0xd9, 0x7b, 0xa5, 0x2d, 0x30,
+    0x9, 0x7e, 0x10, 0x90, 0x12, 0x70, 0xc0, 0x0,
+
+    /* U+00DA "Ú" */
+    0x0, 0xf0, 0xbb, 0x88, 0x3, 0xe2, 0xc9, 0x22,
+    0x0, 0x78, 0xbc, 0x71, 0x40, 0x3e, 0x2d, 0xc2,
+    0x0, 0xff, 0xe2, 0x7f, 0x80, 0x3e, 0x2f, 0xc0,
+    0xf, 0xff, 0xf8, 0x7, 0xff, 0x18, 0x40, 0x4,
+    0x6, 0x1, 0xe6, 0x6, 0x40, 0xb0, 0xf, 0x70,
+    0x65, 0x83, 0xb0, 0x6, 0x84, 0x27, 0x2a, 0x9,
+    0xeb, 0xb7, 0x38, 0xf0, 0x82, 0xeb, 0x1a, 0x29,
+    0x3f, 0x98, 0x0,
+
+    /* U+00DC "Ü" */
+    0x0, 0x9e, 0x0, 0x65, 0x40, 0x3d, 0x8a, 0x6,
+    0x98, 0x1, 0xeb, 0xd0, 0x2d, 0x90, 0xf, 0xfe,
+    0x1f, 0xf8, 0x3, 0xe2, 0xfc, 0x0, 0xff, 0xff,
+    0x80, 0x7f, 0xf1, 0x84, 0x0, 0x40, 0x60, 0x1e,
+    0x60, 0x64, 0xb, 0x0, 0xf7, 0x6, 0x58, 0x3b,
+    0x0, 0x68, 0x42, 0x72, 0xa0, 0x9e, 0xbb, 0x73,
+    0x8f, 0x8, 0x2e, 0xb1, 0xa2, 0x93, 0xf9, 0x80,
+
+    /* U+00E1 "á" */
+    0x0, 0xe2, 0x77, 0x8, 0x7, 0x17, 0xd1, 0x88,
+    0x6, 0x3c, 0x6c, 0x40, 0xe, 0x3e, 0xb1, 0x0,
+    0xc9, 0x5b, 0xfd, 0x68, 0x0, 0x7b, 0x51, 0x43,
+    0x4b, 0x50, 0x58, 0xec, 0xbd, 0xa0, 0x80, 0x27,
+    0x10, 0x9, 0x4c, 0x88, 0x5, 0x15, 0x77, 0x10,
+    0xa, 0x6b, 0xaa, 0x24, 0x20, 0x8, 0x7, 0xef,
+    0xf9, 0x0, 0x6, 0x30, 0x20, 0x13, 0x80, 0x8,
+    0x50, 0x2, 0x73, 0x0, 0x58, 0x5e, 0x5f, 0x41,
+    0x80, 0x1a, 0x8c, 0x95, 0x58, 0xa0, 0x0,
+
+    /* U+00E9 "é" */
+    0x0, 0xf9, 0xe0, 0xc0, 0x3f, 0x54, 0x79, 0x80,
+    0x78, 0x6d, 0xf1, 0xc0, 0x3e, 0x1b, 0xd3, 0x0,
+    0xf9, 0x2f, 0xb9, 0x8e, 0x1, 0xd1, 0x68, 0x45,
+    0x46, 0x8, 0x1, 0x5d, 0x37, 0x31, 0xee, 0x70,
+    0x0, 0x90, 0xa2, 0x0, 0xc, 0x23, 0x8, 0x8c,
+    0x6a, 0xef, 0x98, 0x10, 0xc0, 0x51, 0x3c, 0x40,
+    0x66, 0x1, 0xff, 0xfc, 0xc2, 0x62, 0xa0, 0x1f,
+    0xd2, 0x16, 0xa0, 0x11, 0xe1, 0x0, 0x16, 0x6,
+    0xb6, 0xf3, 0x6, 0x80, 0x13, 0xe2, 0x82, 0x12,
+    0xdb, 0x0,
+
+    /* U+00ED "í" */
+    0x0, 0x14, 0x38, 0x81, 0xe2, 0xa0, 0xa6, 0xa6,
+    0x18, 0x27, 0x50, 0x80, 0xf, 0xec, 0x3, 0xff,
+    0xe6,
+
+    /* U+00F1 "ñ" */
+    0x0, 0xd, 0xf5, 0x99, 0x71, 0x0, 0x4e, 0x1f,
+    0xdc, 0xc9, 0x20, 0x9, 0xac, 0x57, 0x79, 0xc0,
+    0x3f, 0xf8, 0x27, 0xf4, 0x55, 0xdf, 0xb2, 0x20,
+    0x13, 0x62, 0x91, 0x99, 0xb0, 0x40, 0x6, 0x5b,
+    0x99, 0x19, 0x30, 0x5, 0xc4, 0x0, 0x28, 0xc,
+    0x0, 0x11, 0x0, 0x33, 0x3, 0x0, 0x18, 0x3,
+    0x8c, 0x3, 0xff, 0xda,
+
+    /* U+00F3 "ó" */
+    0x0, 0xf9, 0x61, 0x40, 0x3f, 0x45, 0xa, 0x0,
+    0x7d, 0x2d, 0x52, 0x20, 0x1f, 0x4f, 0x28, 0x7,
+    0xc9, 0x5d, 0xfb, 0x24, 0x1, 0x9e, 0xd4, 0xd0,
+    0xdb, 0x10, 0x0, 0xb0, 0x37, 0xb7, 0xd0, 0x34,
+    0x21, 0x21, 0x68, 0x1, 0x3b, 0xb, 0x9, 0x8a,
+    0x80, 0x75, 0x6, 0x18, 0x10, 0x7, 0x84, 0x1c,
+    0xc0, 0x80, 0x3c, 0x20, 0xe2, 0x62, 0xa0, 0x1d,
+    0x41, 0x81, 0x21, 0x68, 0x1, 0x3b, 0xb, 0x2,
+    0xc0, 0xde, 0xdf, 0x40, 0xd0, 0x80, 0x1e, 0xd4,
+    0xd0, 0xdb, 0x10, 0x0,
+
+    /* U+00FA "ú" */
+    0x0, 0xf1, 0xc3, 0x88, 0x7, 0x8f, 0x55, 0x4,
+    0x3, 0x93, 0x53, 0xc, 0x3, 0xc9, 0xd4, 0x20,
+    0x12, 0x7d, 0x0, 0x71, 0xfd, 0x80, 0x7f, 0xfc,
+    0xd8, 0x0, 0xc0, 0xe0, 0x1d, 0x80, 0x2, 0x2a,
+    0x0, 0x26, 0x60, 0x5, 0x0, 0xfb, 0x7b, 0x28,
+    0x1, 0x2e, 0x21, 0xa0, 0xcc, 0x80, 0x0,
+
+    /* U+00FC "ü" */
+    0x0, 0xa5, 0x80, 0xa4, 0xc0, 0x30, 0xa6, 0x3,
+    0x3a, 0x80, 0x61, 0xda, 0x4, 0xe6, 0x0, 0xff,
+    0xe0, 0xa7, 0xd0, 0x7, 0x1f, 0xd8, 0x7, 0xff,
+    0xcd, 0x80, 0xc, 0xe, 0x1, 0xd8, 0x0, 0x22,
+    0xa0, 0x2, 0x66, 0x0, 0x50, 0xf, 0xb7, 0xb2,
+    0x80, 0x12, 0xe2, 0x1a, 0xc, 0xc8, 0x0, 0x0,
+};
+
+
+/*---------------------
+ *  GLYPH DESCRIPTION
+ *--------------------*/
+
+static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
+    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
+    {.bitmap_index = 0, .adv_w = 86, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 0, .adv_w = 86, .box_w = 3, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 20, .adv_w = 125, .box_w = 6, .box_h = 5, .ofs_x = 1, .ofs_y = 9},
+    {.bitmap_index = 33, .adv_w = 225, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 120, .adv_w = 199, .box_w = 12, .box_h = 20, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 210, .adv_w = 270, .box_w = 17, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 320, .adv_w = 220, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 407, .adv_w = 67, .box_w = 2, .box_h = 5, .ofs_x = 1, .ofs_y = 9},
+    {.bitmap_index = 412, .adv_w = 108, .box_w = 5, .box_h = 19, .ofs_x = 1, .ofs_y = -4},
+    {.bitmap_index = 458, .adv_w = 108, .box_w = 5, .box_h = 19, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 508, .adv_w = 128, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 7},
+    {.bitmap_index = 540, .adv_w = 186, .box_w = 10, .box_h = 9, .ofs_x = 1, .ofs_y = 3},
+    {.bitmap_index = 563, .adv_w = 73, .box_w = 3, .box_h = 6, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 572, .adv_w = 123, .box_w = 6, .box_h = 2, .ofs_x = 1, .ofs_y = 5},
+    {.bitmap_index = 577, .adv_w = 73, .box_w = 3, .box_h = 3, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 582, .adv_w = 113, .box_w = 9, .box_h = 20, .ofs_x = -1, .ofs_y = -2},
+    {.bitmap_index = 648, .adv_w = 213, .box_w = 12, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 720, .adv_w = 118, .box_w = 6, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 731, .adv_w = 184, .box_w = 11, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 794, .adv_w = 183, .box_w = 11, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 855, .adv_w = 214, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 917, .adv_w = 184, .box_w = 11, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 981, .adv_w = 197, .box_w = 11, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1054, .adv_w = 191, .box_w = 12, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1112, .adv_w = 206, .box_w = 12, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1194, .adv_w = 197, .box_w = 12, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1270, .adv_w = 73, .box_w = 3, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1283, .adv_w = 73, .box_w = 3, .box_h = 14, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 1301, .adv_w = 186, .box_w = 10, .box_h = 10, .ofs_x = 1, .ofs_y = 2},
+    {.bitmap_index = 1343, .adv_w = 186, .box_w = 10, .box_h = 7, .ofs_x = 1, .ofs_y = 4},
+    {.bitmap_index = 1361, .adv_w = 186, .box_w = 10, .box_h = 10, .ofs_x = 1, .ofs_y = 2},
+    {.bitmap_index = 1402, .adv_w = 183, .box_w = 11, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1462, .adv_w = 331, .box_w = 19, .box_h = 18, .ofs_x = 1, .ofs_y = -4},
+    {.bitmap_index = 1618, .adv_w = 234, .box_w = 15, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1696, .adv_w = 242, .box_w = 13, .box_h = 14, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 1763, .adv_w = 231, .box_w = 13, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1833, .adv_w = 264, .box_w = 14, .box_h = 14, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 1900, .adv_w = 214, .box_w = 11, .box_h = 14, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 1932, .adv_w = 203, .box_w = 10, .box_h = 14, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 1957, .adv_w = 247, .box_w = 13, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2030, .adv_w = 260, .box_w = 13, .box_h = 14, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 2052, .adv_w = 99, .box_w = 3, .box_h = 14, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 2057, .adv_w = 164, .box_w = 9, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2088, .adv_w = 230, .box_w = 13, .box_h = 14, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 2153, .adv_w = 190, .box_w = 10, .box_h = 14, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 2167, .adv_w = 306, .box_w = 15, .box_h = 14, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 2241, .adv_w = 260, .box_w = 13, .box_h = 14, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 2297, .adv_w = 269, .box_w = 15, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2383, .adv_w = 231, .box_w = 12, .box_h = 14, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 2437, .adv_w = 269, .box_w = 16, .box_h = 17, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 2546, .adv_w = 233, .box_w = 12, .box_h = 14, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 2609, .adv_w = 199, .box_w = 12, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2684, .adv_w = 188, .box_w = 12, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2703, .adv_w = 253, .box_w = 12, .box_h = 14, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 2742, .adv_w = 228, .box_w = 15, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2823, .adv_w = 360, .box_w = 22, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2955, .adv_w = 215, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3034, .adv_w = 207, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3089, .adv_w = 210, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3150, .adv_w = 107, .box_w = 5, .box_h = 19, .ofs_x = 2, .ofs_y = -4},
+    {.bitmap_index = 3166, .adv_w = 113, .box_w = 9, .box_h = 20, .ofs_x = -1, .ofs_y = -2},
+    {.bitmap_index = 3230, .adv_w = 107, .box_w = 5, .box_h = 19, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 3245, .adv_w = 187, .box_w = 9, .box_h = 9, .ofs_x = 1, .ofs_y = 3},
+    {.bitmap_index = 3282, .adv_w = 160, .box_w = 10, .box_h = 2, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 3287, .adv_w = 192, .box_w = 6, .box_h = 3, .ofs_x = 2, .ofs_y = 12},
+    {.bitmap_index = 3297, .adv_w = 191, .box_w = 10, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3352, .adv_w = 218, .box_w = 12, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3416, .adv_w = 183, .box_w = 11, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3470, .adv_w = 218, .box_w = 12, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3535, .adv_w = 196, .box_w = 12, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3594, .adv_w = 113, .box_w = 8, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3625, .adv_w = 221, .box_w = 12, .box_h = 15, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 3709, .adv_w = 218, .box_w = 11, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3746, .adv_w = 89, .box_w = 4, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3759, .adv_w = 91, .box_w = 7, .box_h = 19, .ofs_x = -2, .ofs_y = -4},
+    {.bitmap_index = 3789, .adv_w = 197, .box_w = 12, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3841, .adv_w = 89, .box_w = 3, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3846, .adv_w = 338, .box_w = 19, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3903, .adv_w = 218, .box_w = 11, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3937, .adv_w = 203, .box_w = 12, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3998, .adv_w = 218, .box_w = 12, .box_h = 15, .ofs_x = 1, .ofs_y = -4},
+    {.bitmap_index = 4066, .adv_w = 218, .box_w = 12, .box_h = 15, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 4133, .adv_w = 131, .box_w = 7, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4154, .adv_w = 160, .box_w = 10, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4209, .adv_w = 132, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4244, .adv_w = 217, .box_w = 11, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4274, .adv_w = 179, .box_w = 12, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4330, .adv_w = 288, .box_w = 18, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4422, .adv_w = 177, .box_w = 11, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4478, .adv_w = 179, .box_w = 13, .box_h = 15, .ofs_x = -1, .ofs_y = -4},
+    {.bitmap_index = 4556, .adv_w = 167, .box_w = 10, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4598, .adv_w = 112, .box_w = 6, .box_h = 19, .ofs_x = 1, .ofs_y = -4},
+    {.bitmap_index = 4638, .adv_w = 96, .box_w = 2, .box_h = 19, .ofs_x = 2, .ofs_y = -4},
+    {.bitmap_index = 4643, .adv_w = 112, .box_w = 6, .box_h = 19, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 4683, .adv_w = 186, .box_w = 10, .box_h = 4, .ofs_x = 1, .ofs_y = 6},
+    {.bitmap_index = 4703, .adv_w = 86, .box_w = 3, .box_h = 14, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 4724, .adv_w = 134, .box_w = 8, .box_h = 7, .ofs_x = 0, .ofs_y = 8},
+    {.bitmap_index = 4753, .adv_w = 183, .box_w = 11, .box_h = 15, .ofs_x = 1, .ofs_y = -4},
+    {.bitmap_index = 4815, .adv_w = 234, .box_w = 15, .box_h = 19, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4910, .adv_w = 214, .box_w = 11, .box_h = 19, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 4960, .adv_w = 99, .box_w = 6, .box_h = 19, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4979, .adv_w = 260, .box_w = 13, .box_h = 18, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 5054, .adv_w = 269, .box_w = 15, .box_h = 19, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 5158, .adv_w = 253, .box_w = 12, .box_h = 19, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 5217, .adv_w = 253, .box_w = 12, .box_h = 18, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 5273, .adv_w = 191, .box_w = 10, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 5344, .adv_w = 196, .box_w = 12, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5418, .adv_w = 89, .box_w = 6, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 5435, .adv_w = 218, .box_w = 11, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 5487, .adv_w = 203, .box_w = 12, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5563, .adv_w = 217, .box_w = 11, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 5610, .adv_w = 217, .box_w = 11, .box_h = 15, .ofs_x = 1, .ofs_y = 0}
+};
+
+/*---------------------
+ *  CHARACTER MAPPING
+ *--------------------*/
+
+static const uint16_t unicode_list_1[] = {
+    0x0, 0xf, 0x1e, 0x20, 0x28, 0x2c, 0x30, 0x32,
+    0x39, 0x3b, 0x40, 0x48, 0x4c, 0x50, 0x52, 0x59,
+    0x5b
+};
+
+/*Collect the unicode lists and glyph_id offsets*/
+static const lv_font_fmt_txt_cmap_t cmaps[] =
+{
+    {
+        .range_start = 32, .range_length = 95, .glyph_id_start = 1,
+        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+    },
+    {
+        .range_start = 161, .range_length = 92, .glyph_id_start = 96,
+        .unicode_list = unicode_list_1, .glyph_id_ofs_list = NULL, .list_length = 17, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
+    }
+};
+
+/*-----------------
+ *    KERNING
+ *----------------*/
+
+/*Map glyph_ids to kern left classes*/
+static const uint8_t kern_left_class_mapping[] =
+{
+    0, 0, 1, 2, 0, 3, 4, 5, 2, 6, 7, 8, 9, 10, 9, 10,
+    11, 12, 0, 13, 14, 15, 16, 17, 18, 19, 12, 20, 20, 0, 0, 0,
+    21, 22, 23, 24, 25, 22, 26, 27, 28, 29, 29, 30, 31, 32, 29, 29,
+    22, 33, 34, 35, 3, 36, 30, 37, 37, 38, 39, 40, 41, 42, 43, 0,
+    44, 0, 45, 46, 47, 48, 49, 50, 51, 45, 52, 52, 53, 48, 45, 45,
+    46, 46, 54, 55, 56, 57, 51, 58, 58, 59, 58, 60, 41, 0, 0, 9,
+    61, 62, 63, 23, 26, 29, 29, 22, 30, 30, 45, 49, 51, 45, 46, 51,
+    51
+};
+
+/*Map glyph_ids to kern right classes*/
+static const uint8_t kern_right_class_mapping[] =
+{
+    0, 0, 1, 2, 0, 3, 4, 5, 2, 6, 7, 8, 9, 10, 9, 10,
+    11, 12, 13, 14, 15, 16, 17, 12, 18, 19, 20, 21, 21, 0, 0, 0,
+    22, 23, 24, 25, 23, 25, 25, 25, 23, 25, 25, 26, 25, 25, 25, 25,
+    23, 25, 23, 25, 3, 27, 28, 29, 29, 30, 31, 32, 33, 34, 35, 0,
+    36, 0, 37, 38, 39, 39, 39, 0, 39, 38, 40, 41, 38, 38, 42, 42,
+    39, 42, 39, 42, 43, 44, 45, 46, 46, 47, 48, 49, 0, 0, 35, 9,
+    50, 51, 52, 24, 25, 25, 25, 23, 28, 28, 37, 39, 42, 42, 39, 45,
+    45
+};
+
+/*Kern values between classes*/
+static const int8_t kern_class_values[] =
+{
+    0, 1, 0, 0, 0, 0, 0, 2, 0, 1, 0, 0, 3, 0, 0, 0,
+    0, 2, 0, 0, 0, 0, 0, 0, 0, 7, 6, 0, 3, 0, 6, 0,
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 14, 0, 9, -7, 0, 0, 6, 0, -18, -19, 2,
+    15, 7, 5, -13, 2, 16, 1, 13, 3, 10, 0, -14, 0, 0, 3, 0,
+    0, 0, 0, 0, 0, 19, 3, -2, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 6, -14, 0, -10, 0, 0, 0, 0, 0, -6,
+    5, 6, 0, 0, -3, 0, -2, 3, 0, -3, 0, -3, -2, -6, 0, 0,
+    0, 0, -3, 0, 0, -4, -5, 0, 0, -3, 0, -6, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -3, -3, -3, 0, -1, -5, -3, 0, -9, 0, -39,
+    0, 0, -6, -16, 6, 10, 0, 0, -6, 3, 3, 11, 6, -5, 6, 0,
+    0, -18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12, 0, 0,
+    4, 0, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9, 0,
+    -4, -16, 0, -13, -2, 0, 0, -10, 0, 1, 12, 0, -10, -3, -1, 1,
+    0, -5, 0, 0, -2, -24, 0, 4, 0, 10, -9, 0, -6, 0, -13, 4,
+    0, -26, -3, 12, 3, 0, 0, 0, 0, 0, 0, 3, 0, -4, -1, -4,
+    0, -3, -13, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 11, 0,
+    3, 0, 0, -6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0,
+    0, 0, 0, 0, 0, 12, 3, 1, 0, 0, 0, 0, 28, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 6, 3, 10,
+    -3, 0, 0, 6, -3, -11, -44, 2, 9, 6, 1, -4, 0, 12, 0, 10,
+    0, 10, 0, -30, 0, -4, 10, 0, 11, -3, 6, 3, 0, 0, 1, -3,
+    0, 0, -5, 26, 0, 26, 0, 10, 0, 13, 4, 13, 5, 0, 10, -26,
+    0, 0, -5, -12, 0, 0, 0, -3, 1, -2, 0, 2, -6, -4, -6, 2,
+    0, -3, 0, 0, 0, -13, 2, -6, 0, -6, -11, 0, -7, -6, -10, 0,
+    0, -21, 0, 0, 0, 0, 3, 0, 0, 0, 0, 3, 0, -4, -7, -4,
+    -4, 0, 0, 0, 1, -18, 3, -20, 0, 0, 0, -11, -2, 0, 32, -4,
+    -4, 3, 3, -3, 0, -4, 3, 0, 0, -17, -6, 11, 0, 18, -10, -3,
+    -12, 0, -12, 5, 0, -31, 0, 3, 3, 0, -4, 0, 3, 0, 0, -2,
+    -4, -11, 0, -11, 0, 1, -20, 3, 0, 19, -6, 0, -12, 0, 11, 0,
+    -22, -31, -22, -6, 10, 0, 0, -21, 0, 4, -7, 0, -5, 0, -6, -13,
+    0, -3, 10, 0, 10, 0, 10, 0, 0, 8, 10, -39, -21, 0, -21, 3,
+    1, -21, -21, -9, -21, -10, -19, -10, -21, -21, 15, -24, 0, 2, 0, 0,
+    0, 0, 0, 2, 2, -4, -6, 0, -1, -1, -3, 0, 0, -2, 0, 0,
+    0, -6, 0, -3, 0, -7, -6, 0, -8, -11, -11, -6, 0, -6, 0, -6,
+    0, 0, 0, 0, -3, 0, 0, 3, 0, 2, -3, 2, 0, 0, 1, -10,
+    0, 0, 0, 3, -2, 0, 0, 0, -2, 3, 3, -1, 0, 0, 0, -6,
+    0, -1, 0, 0, 0, 0, 0, 1, 0, 4, -2, 0, -4, 0, -5, 0,
+    0, -2, 0, 10, 0, 0, -3, 0, 0, 0, 0, 0, -1, 1, -2, 1,
+    -2, 0, 0, 0, 0, -3, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, -2, 0, -3, -4, 0, 0, 0, 0, 0, 1, 0, 0, -2, 0,
+    -3, -3, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0,
+    0, -2, -4, -2, 0, 0, -5, 0, 0, -10, -2, -10, 6, 0, 0, -6,
+    3, 6, 9, 0, -8, -1, -4, 0, -1, -15, 3, -2, 2, -17, 3, 0,
+    0, 1, -17, 0, -17, -3, -28, -2, 0, -16, 0, 6, 9, 0, 4, 0,
+    0, 0, 0, 1, 0, -6, -4, -6, 0, 0, -10, 3, 0, 0, 0, -3,
+    0, 0, 0, -3, 0, 0, 0, 0, 0, -2, -2, 0, -2, -4, 0, 0,
+    0, 0, 0, 0, 0, -3, -3, 0, -2, -4, -3, 0, 0, -3, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -3, -3, -3, 0, 0, -4, 0,
+    0, -2, 0, -6, 3, 0, 0, -4, 2, 3, 3, 0, 0, 0, 0, 0,
+    0, -2, 0, 0, 0, 0, 0, 2, 0, 0, -3, 0, -3, -2, -4, 0,
+    0, 0, 0, 0, 0, 0, 3, 0, -3, 0, 0, 0, 0, -4, -5, -4,
+    0, 0, -6, 0, 0, 10, -2, 1, -10, 0, 0, 9, -16, -17, -13, -6,
+    3, 0, -3, -21, -6, 0, -6, 0, -6, 5, -6, -20, 0, -9, 0, 0,
+    2, -1, 3, -2, 0, 3, 0, -10, -12, 0, -16, -8, -7, -8, -10, -4,
+    -9, -1, -6, -1, -9, -9, 2, -20, 0, 1, 0, -3, 0, 0, 0, 2,
+    0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, -2,
+    0, -1, -3, 0, -5, -7, -7, -1, 0, -10, 0, 0, 0, 0, 0, 0,
+    -3, 0, 0, 0, 0, 1, -2, 1, 0, 0, 0, -6, 0, 3, 0, 0,
+    0, 0, 0, 0, 0, 0, 15, 0, 0, 0, 0, 0, 0, 2, 0, 0,
+    0, -3, 0, 3, 0, 12, -3, 0, -7, -2, -12, 0, 0, -6, 0, 3,
+    0, 0, 0, 0, 0, 0, 0, 3, 0, 2, -3, 2, 0, 0, 0, 0,
+    -2, 0, 0, 0, -6, 0, 0, 4, 0, -16, -10, 0, 0, 0, -5, -16,
+    0, 0, -3, 3, 0, -9, -1, -14, 0, -9, 0, 0, -4, -6, -4, -3,
+    -5, 0, 0, -6, 0, 0, -3, 0, 0, 0, 0, 0, 0, 3, 0, 3,
+    0, -2, 3, -34, 0, -6, 0, 0, 0, 0, 4, 0, 2, -6, -6, 0,
+    -3, -3, -4, 0, 0, 0, 0, 0, 0, -10, 0, -3, 0, -5, -3, 0,
+    -7, -8, -10, -3, 0, -6, 0, -10, 0, 0, 0, 0, 26, 0, 0, 2,
+    0, 0, -4, 0, 0, 0, 3, -6, 0, -14, 0, 0, 0, 0, 0, -30,
+    -6, 11, 10, -3, -13, 0, 3, -5, 0, -16, -2, -4, 3, -22, -3, 4,
+    0, 5, -11, -5, -12, -11, -13, 0, 0, -19, 0, 18, 0, 0, -2, 0,
+    0, 0, -2, -2, -3, -9, -11, -9, -1, 3, -30, 6, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -3, 0, -2, -3, -5, 0, 0, -6, 0, -3,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, -6, 0, 0, 6, -1, 4, 0, -7, 3, -2, -1, -8,
+    -3, 0, -4, -3, -2, 0, -5, -5, 0, 0, -3, -1, -2, -5, -4, 0,
+    0, -3, 0, 3, -2, 0, -7, 0, 0, 0, -6, 0, -5, 0, -5, 0,
+    -5, -3, 3, -4, 0, 0, 0, 0, 0, 0, 0, 0, -6, 3, 0, -4,
+    0, -2, -4, -10, -2, -2, -2, -1, -2, -4, -1, 0, 0, 0, 0, 0,
+    -3, -3, -3, 0, 0, 0, 0, 4, -2, 0, -2, 0, 0, 0, -2, -4,
+    -2, -3, -4, -3, -3, -2, 0, 0, 3, 13, -1, 0, -9, 0, -2, 6,
+    0, -3, -13, -4, 5, 0, 0, -15, -5, 3, -5, 2, 0, -2, -3, -10,
+    0, -5, 2, 0, 0, -5, 0, 0, 0, 3, 3, -6, -6, 0, -5, -3,
+    -5, -3, -3, 0, -5, 2, -6, 2, -5, -3, 10, -15, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -5, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, -3, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -5, 0, 0, -4, 0,
+    0, -3, -3, 0, 0, 0, 0, -3, 0, 0, 0, 0, -2, 0, 0, 0,
+    0, 0, -2, 0, 0, 0, 0, -2, 0, 0, -5, 0, -6, 0, 0, 0,
+    -11, 0, 2, -7, 6, 1, -2, -15, 0, 0, -7, -3, 0, -13, -8, -9,
+    0, 0, -14, -3, -13, -12, -15, 0, -8, 0, 3, 21, -4, 0, -7, -3,
+    -1, -3, -5, -9, -6, -12, -13, -12, -7, 0, -3, 0, 0, 0, -2, 0,
+    1, 0, 0, -22, -3, 10, 7, -7, -12, 0, 1, -10, 0, -16, -2, -3,
+    6, -29, -4, 1, 0, 0, -21, -4, -17, -3, -23, 0, 0, -22, 0, 19,
+    1, 0, -2, 0, 0, 0, 0, -2, -2, -12, -2, -12, 0, 0, -21, 0,
+    0, 0, 0, 0, -10, 0, -3, 0, -1, -9, -15, 0, 0, -2, -5, -10,
+    -3, 0, -2, 0, 0, 0, 0, -14, -3, -11, -10, -3, -5, -8, -3, -5,
+    0, -6, -3, -11, -5, 0, -4, -6, -3, -6, 0, 2, 0, -2, -11, -2,
+    0, 0, 6, -17, 0, -6, 0, 0, 0, 0, 4, 0, 2, -6, 13, 0,
+    -3, -3, -4, 0, 0, 0, 0, 0, 0, -10, 0, -3, 0, -5, -3, 0,
+    -7, -8, -10, -3, 0, -6, 3, 13, 0, 0, 0, 0, 26, 0, 0, 2,
+    0, 0, -4, 0, 0, 0, 3, -6, 0, 0, 0, 0, 0, 0, 0, 0,
+    -1, 0, 0, 0, 0, 0, -2, -6, 0, 0, 0, 0, 0, -2, 0, 0,
+    0, -3, -3, 0, 0, -6, -3, 0, 0, -6, 0, 5, -2, 0, 0, 0,
+    0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 5, -3, 6, 3, -3, 0,
+    -10, -5, 0, 10, -11, -10, -6, -6, 13, 6, 3, -28, -2, 6, -3, 0,
+    -3, 4, -3, -11, 0, -3, 3, -4, -3, -10, -3, 0, 0, 10, 6, 0,
+    -9, 0, -18, -4, 9, -4, -12, 1, -4, -11, -11, -11, -3, -6, 13, -18,
+    3, 0, -5, 0, -9, 0, 3, 11, -7, -12, -13, -8, 10, 0, 1, -23,
+    -3, 3, -5, -2, -7, 0, -7, -12, -5, -5, -3, 0, 0, -7, -7, -3,
+    0, 10, 7, -3, -18, 0, -18, -4, 0, -11, -19, -1, -10, -5, -11, -5,
+    -9, -10, 9, -23, 0, 0, -4, 0, -6, -3, 0, -3, -6, 0, 5, -11,
+    3, 0, 0, -17, 0, -3, -7, -5, -2, -10, -8, -11, -7, 0, -10, -3,
+    -7, -6, -10, -3, 0, 0, 1, 15, -5, 0, -10, -3, 0, -3, -6, -7,
+    -9, -9, -12, -9, -4, -3, -6, 1, 6, 0, -5, 0, -16, -4, 2, 6,
+    -10, -12, -6, -11, 11, -3, 2, -30, -6, 6, -7, -5, -12, 0, -10, -13,
+    -4, -3, -3, -3, -7, -10, -1, 0, 0, 10, 9, -2, -21, 0, -19, -7,
+    8, -12, -22, -6, -11, -13, -16, -13, -11, -13, 6, -26, 0, 0, 0, 0,
+    -4, 0, 0, 3, -4, 6, 2, -6, 6, 0, 0, -10, -1, 0, -1, 0,
+    1, 1, -3, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 3, 10,
+    1, 0, -4, 0, 0, 0, 0, -2, -2, -4, 0, -4, 0, 1, 0, 0,
+    1, 3, 0, 0, 0, 0, 3, 1, -3, 0, 12, 0, 6, 1, 1, -4,
+    0, 6, 0, 0, 0, 3, 0, 0, 0, 0, 6, 0, 7, 1, 9, 0,
+    0, 10, 0, 9, -3, 0, 0, 0, 32, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, -19, 0, -3, 5, 0, 10, -44, 0, 32, 4, -6,
+    -6, 3, 3, -2, 1, -16, 0, 0, 15, -19, -6, 10, 0, 10, -6, -3,
+    -13, 6, -6, 0, 0, -22, 12, 45, 0, 0, 0, 0, 38, 0, 0, 0,
+    0, 6, 0, 6, 0, 13, -19, 10, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -5, 0, 0, -6, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 6, -9,
+    0, 0, 1, -3, 0, 3, 41, -6, -3, 10, 9, -9, 3, 0, 0, 3,
+    3, -4, -10, 18, 10, 26, 0, -3, -3, 15, -2, 6, 0, -42, 9, 0,
+    -3, 0, -9, 0, 35, 0, 3, -6, -9, -4, 12, 6, 8, 4, 0, 0,
+    0, 0, 0, -9, 0, 0, 0, -9, 0, 0, 0, 0, -7, -2, 0, 0,
+    0, -7, 0, -4, 0, -15, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -21, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, -3, 0, -3,
+    0, 0, -6, 0, 0, -5, 0, -9, 0, 0, 0, -5, 3, -4, 0, 0,
+    -9, -3, -7, 0, 0, -9, 0, -3, 0, -15, 0, -4, 0, 0, -26, -6,
+    -13, -4, -12, 0, 0, -21, 0, -9, -2, 0, 0, 0, 0, 0, 0, 0,
+    0, -5, -6, -5, -3, 0, -5, -3, 0, 0, 0, 0, -7, 0, -7, 4,
+    -4, 6, 0, -2, -7, -2, -5, -6, 0, -4, -2, -2, 2, -9, -1, 0,
+    0, 0, -28, -3, -4, 0, -7, 0, -2, -15, -3, 0, 0, -2, -3, 0,
+    0, 0, 0, 2, 0, -2, -5, -2, -2, 0, 5, -2, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -7, 0, -2, 0, 0, 0, -6, 3, 0, 0, 0, -9, -3, -6, 0,
+    0, -9, 0, -3, 0, -15, 0, 0, 0, 0, -31, 0, -6, -12, -16, 0,
+    0, -21, 0, -2, -5, 0, 0, 0, 0, 0, 0, 0, 0, -3, -5, -3,
+    -2, 0, -5, -3, 1, 0, 0, 5, -4, 0, 10, 16, -3, -3, -10, 4,
+    16, 5, 7, -9, 4, 13, 4, 9, 7, 9, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 20, 15, -6, -3, 0, -3, 26, 14, 26, 0, 0,
+    0, 3, 0, 3, 0, 0, 12, -4, 0, 0, -5, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0,
+    0, 0, -27, -4, -3, -13, -16, 0, 0, -21, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -5, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0,
+    0, 4, 0, 0, 0, 0, -27, -4, -3, -13, -16, 0, 0, -13, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -3, 0, 0, 0, -7, 3, 0, -3, 3, 6, 3, -10,
+    0, -1, -3, 3, 0, 3, 0, 0, 0, 0, -8, 0, -3, -2, -6, 0,
+    -3, -13, 0, 20, -3, 0, -7, -2, 0, -2, -5, 0, -3, -9, -6, -9,
+    -4, 0, 0, 0, 0, 0, -5, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    -2, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, -27, -4,
+    -3, -13, -16, 0, 0, -21, 0, 0, 0, 0, 0, 0, 16, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -5, 0, -10, -4, -3, 10,
+    -3, -3, -13, 1, -2, 1, -2, -9, 1, 7, 1, 3, 1, 3, -8, -13,
+    -4, 0, -12, -6, -9, -13, -12, 0, -5, -6, -4, -4, -3, -2, -4, -2,
+    0, -2, -1, 5, 0, 5, -2, 5, 0, 0, 10, -12, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, -2, -3, -3, 0, 0, -9, 0, -2,
+    0, -5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -19, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -3, -3, -3, 0, 0, -4, 0,
+    0, 0, 0, 0, -3, 0, 0, -5, -3, 3, 0, -5, -6, -2, 0, -9,
+    -2, -7, -2, -4, 0, -5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -21, 0, 10, 0, 0, -6, 0, 0, 0, 0, -4, 0, -3, 0, -3,
+    0, 0, -2, 0, 0, 0, -2, 0, -7, 0, 0, 13, -4, -11, -10, 2,
+    4, 4, -1, -9, 2, 5, 2, 10, 2, 11, -2, -9, 0, 0, -13, 0,
+    0, -10, -9, 0, 0, -6, 0, -4, -5, 0, -5, 0, -5, 0, -2, 5,
+    0, -3, -10, -3, -3, 0, 12, -11, 0, 0, -3, 0, -6, 0, 0, 4,
+    -7, 0, 3, -3, 3, 0, 0, -11, 0, -2, -1, 0, -3, 4, -3, 0,
+    0, 0, -13, -4, -7, 0, -10, 0, 0, -15, 0, 12, -3, 0, -6, 0,
+    2, 0, -3, 0, -3, -10, 0, -10, -3, 0, 3, 0, 0, 0, 0, 0,
+    -2, 0, 0, 3, -4, 1, 0, 0, -4, -2, 0, -4, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -20, 0, 7,
+    0, 0, -3, 0, 0, 0, 0, 1, 0, -3, -3, -3, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 13, 0, -6, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, 0, 3, 0, 3, -6, 0, -10, -3, -13, 0,
+    0, -18, 1, 4, 0, 0, 0, 0, 22, 0, 0, 2, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 6, 6, 7, 0, 0, 0, 10, 0, -20, -18, 1,
+    14, 10, 5, -13, 2, 13, 0, 12, 0, 6, 3, -30, 0, -3, 13, 0,
+    9, -6, 6, 0, 0, 17, 0, 0, 0, 0, -5, 0, 0, 0, -1, 6,
+    0, 12, 3, 12, 0, 0, 0, -20, -1, -11, 0, -19, -5, 0, 0, -27,
+    -13, 1, 13, -15, -14, 0, 0, -14, 0, -14, -14, 0, -1, -43, -17, 4,
+    0, 0, -19, -11, -22, 3, -25, 0, 0, -30, 3, 16, -5, 0, -11, -4,
+    22, -4, -2, -4, -16, -15, 3, -7, 0, 0, -19, -8
+};
+
+/*Collect the kern class' data in one place*/
+static const lv_font_fmt_txt_kern_classes_t kern_classes = {
+    .class_pair_values   = kern_class_values,
+    .left_class_mapping  = kern_left_class_mapping,
+    .right_class_mapping = kern_right_class_mapping,
+    .left_class_cnt      = 63,
+    .right_class_cnt     = 52,
+};
+
+/*--------------------
+ *  ALL CUSTOM DATA
+ *--------------------*/
+
+/*Store all the custom data of the font*/
+static lv_font_fmt_txt_glyph_cache_t cache;
+static const lv_font_fmt_txt_dsc_t font_dsc = {
+    .glyph_bitmap = glyph_bitmap,
+    .glyph_dsc = glyph_dsc,
+    .cmaps = cmaps,
+    .kern_dsc = &kern_classes,
+    .kern_scale = 16,
+    .cmap_num = 2,
+    .bpp = 4,
+    .kern_classes = 1,
+    .bitmap_format = 1,
+    .cache = &cache
+};
+
+
+/*-----------------
+ *  PUBLIC FONT
+ *----------------*/
+
+/*Initialize a public general font descriptor*/
+const lv_font_t ui_font_20 = {
+    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/
+    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
+    .line_height = 23,          /*The maximum line height required by the font*/
+    .base_line = 4,             /*Baseline measured from the bottom of the line*/
+    .subpx = LV_FONT_SUBPX_NONE,
+    .underline_position = -1,
+    .underline_thickness = 1,
+    .dsc = &font_dsc           /*The custom font data. Will be accessed by `get_glyph_bitmap/dsc` */
+};
@@ -0,0 +1,208 @@
+// axsParse() on recorded AXS15231B frames and TouchGestures on touch
+// traces (lib/axs_touch): pio test -e native -f test_axs_touch
+#include "axs_touch.h"
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include <unity.h>
+
+// A frame as the controller sends it: point count in byte 1, then per
+// point the event and x high nibble, x low, id and y high nibble, y low
+// and two bytes of weight and area
+static void frame(uint8_t *f, uint8_t n, const uint16_t (*raw)[2]) {
+  memset(f, 0, AXS_FRAME_LEN);
+  f[1] = n;
+  for (uint8_t i = 0; i < n && i < AXS_MAX_POINTS; i++) {
+    uint8_t *p = f + 2 + i * 6;
+    p[0] = 0x80 | (raw[i][0] >> 8); // Event bits above x
+    p[1] = raw[i][0] & 0xFF;
+    p[2] = (uint8_t)(i << 4) | (raw[i][1] >> 8);
+    p[3] = raw[i][1] & 0xFF;
+    p[4] = 0x20;
+    p[5] = 0x11;
+  }
+}
+
+void setUp() {}
+void tearDown() {}
+
+// A frame captured on a landscape panel (rotation 1, 480 x 320): one
+// finger at raw (100, 200) near the left edge
+static void test_parse_recorded_frame() {
+  const uint8_t rec[AXS_FRAME_LEN] = {0x00, 0x01, 0x80, 0x64, 0x00, 0xC8,
+                                      0x20, 0x11};
+  AxsPoint pts[AXS_MAX_POINTS];
+  AxsCal cal = axsCal(1, 480, 320);
+  TEST_ASSERT_EQUAL_UINT8(1, axsParse(rec, cal, pts));
+  TEST_ASSERT_EQUAL_UINT16(200, pts[0].x); // x = ry
+  TEST_ASSERT_EQUAL_UINT16(220, pts[0].y); // y = 320 - rx
+  TEST_ASSERT_EQUAL_UINT8(0, pts[0].id);
+}
+
+// The four rotations put the raw corners on the matching screen corners
+static void test_rotations_map_corners() {
+  const uint16_t raw[1][2] = {{10, 20}}; // Near raw (0, 0)
+  const uint16_t want[4][2] = {{10, 20}, {20, 309}, {309, 459}, {459, 10}};
+  uint8_t f[AXS_FRAME_LEN];
+  frame(f, 1, raw);
+  for (uint8_t r = 0; r < 4; r++) {
+    bool land = r & 1;
+    AxsCal cal = axsCal(r, land ? 480 : 320, land ? 320 : 480);
+    AxsPoint p;
+    TEST_ASSERT_EQUAL_UINT8(1, axsParse(f, cal, &p));
+    TEST_ASSERT_UINT32_WITHIN(1, want[r][0], p.x);
+    TEST_ASSERT_UINT32_WITHIN(1, want[r][1], p.y);
+  }
+}
+
+static void test_multi_touch_keeps_ids() {
+  const uint16_t raw[3][2] = {{40, 40}, {160, 240}, {300, 460}};
+  uint8_t f[AXS_FRAME_LEN];
+  frame(f, 3, raw);
+  AxsPoint pts[AXS_MAX_POINTS];
+  TEST_ASSERT_EQUAL_UINT8(3, axsParse(f, axsCal(0, 320, 480), pts));
+  for (uint8_t i = 0; i < 3; i++) {
+    TEST_ASSERT_EQUAL_UINT8(i, pts[i].id);
+    TEST_ASSERT_EQUAL_UINT16(raw[i][0], pts[i].x);
+    TEST_ASSERT_EQUAL_UINT16(raw[i][1], pts[i].y);
+  }
+}
+
+// Idle frames (0xFF count) and points past the raw range are dropped;
+// points at the edge are clamped onto the screen
+static void test_garbage_and_edges() {
+  uint8_t f[AXS_FRAME_LEN];
+  memset(f, 0xFF, sizeof(f));
+  AxsPoint pts[AXS_MAX_POINTS];
+  TEST_ASSERT_EQUAL_UINT8(0, axsParse(f, axsCal(1, 480, 320), pts));
+  const uint16_t raw[3][2] = {{3000, 100}, {320, 480}, {0, 0}};
+  frame(f, 3, raw);
+  TEST_ASSERT_EQUAL_UINT8(2, axsParse(f, axsCal(1, 480, 320), pts));
+  TEST_ASSERT_EQUAL_UINT16(479, pts[0].x);
+  TEST_ASSERT_EQUAL_UINT16(0, pts[0].y);
+  TEST_ASSERT_EQUAL_UINT16(0, pts[1].x);
+  TEST_ASSERT_EQUAL_UINT16(319, pts[1].y);
+}
+
+// Narrowed raw ranges, as measured on a panel, stretch onto the screen
+static void test_calibrated_range() {
+  AxsCal cal = axsCal(0, 320, 480, 10, 310, 20, 460);
+  const uint16_t raw[2][2] = {{10, 20}, {160, 240}};
+  uint8_t f[AXS_FRAME_LEN];
+  frame(f, 2, raw);
+  AxsPoint pts[2];
+  TEST_ASSERT_EQUAL_UINT8(2, axsParse(f, cal, pts));
+  TEST_ASSERT_EQUAL_UINT16(0, pts[0].x);
+  TEST_ASSERT_EQUAL_UINT16(0, pts[0].y);
+  TEST_ASSERT_UINT32_WITHIN(1, 160, pts[1].x);
+  TEST_ASSERT_UINT32_WITHIN(1, 240, pts[1].y);
+}
+
+// Replays a touch trace, one "ms points x y" line per read, and returns
+// the gestures as "G@ms" (T tap, L long press, < > swipes), space
+// separated
+static std::string gestures(const char *trace, TouchGestures &g) {
+  std::string out;
+  const char *p = trace;
+  while (*p) {
+    unsigned long ms;
+    unsigned n, x, y;
+    int used = 0;
+    if (sscanf(p, "%lu %u %u %u%n", &ms, &n, &x, &y, &used) != 4)
+      break;
+    p += used;
+    while (*p == '\n' || *p == ' ')
+      p++;
+    TouchGesture e = g.feed(ms, n, x, y);
+    if (e == GESTURE_NONE)
+      continue;
+    char buf[16];
+    snprintf(buf, sizeof(buf), "%s%c@%lu", out.empty() ? "" : " ",
+             "-TL<>"[e], ms);
+    out += buf;
+  }
+  return out;
+}
+
+static std::string replay(const char *trace) {
+  TouchGestures g;
+  return gestures(trace, g);
+}
+
+static void test_tap() {
+  std::string r = replay("0 1 100 100\n20 1 103 98\n40 1 104 99\n"
+                         "60 0 104 99\n");
+  TEST_ASSERT_EQUAL_STRING("T@60", r.c_str());
+}
+
+// Reported at the threshold, while still held; no tap on release
+static void test_long_press() {
+  std::string r = replay("0 1 200 150\n250 1 204 150\n500 1 205 151\n"
+                         "900 1 205 151\n950 0 205 151\n");
+  TEST_ASSERT_EQUAL_STRING("L@500", r.c_str());
+}
+
+// Reported mid-swipe, once, as soon as the travel is reached
+static void test_swipes() {
+  std::string l = replay("0 1 400 160\n30 1 370 162\n60 1 330 165\n"
+                         "90 1 280 166\n120 1 240 166\n150 0 240 166\n");
+  TEST_ASSERT_EQUAL_STRING("<@60", l.c_str()); // 70 px in
+  std::string r = replay("0 1 50 100\n40 1 90 104\n80 1 130 108\n"
+                         "110 0 130 108\n");
+  TEST_ASSERT_EQUAL_STRING(">@80", r.c_str());
+}
+
+// Too slow, or mostly vertical: a drag or scroll, no gesture
+static void test_drags_are_not_gestures() {
+  std::string slow = replay("0 1 100 100\n300 1 130 100\n500 1 150 100\n"
+                            "700 1 170 100\n720 0 170 100\n");
+  TEST_ASSERT_EQUAL_STRING("", slow.c_str());
+  std::string vertical = replay("0 1 100 50\n50 1 130 120\n100 1 170 200\n"
+                                "120 0 170 200\n");
+  TEST_ASSERT_EQUAL_STRING("", vertical.c_str());
+}
+
+// A second finger ends the gestures of the touch
+static void test_second_finger_cancels() {
+  std::string r = replay("0 1 100 100\n20 2 100 100\n40 1 100 100\n"
+                         "60 0 100 100\n");
+  TEST_ASSERT_EQUAL_STRING("", r.c_str());
+}
+
+// After a swipe the UI should not see the touch; the next one is new
+static void test_swiped_and_next_touch() {
+  TouchGestures g;
+  std::string r = gestures("0 1 300 100\n40 1 230 100\n", g);
+  TEST_ASSERT_EQUAL_STRING("<@40", r.c_str());
+  TEST_ASSERT_TRUE(g.swiped());
+  r = gestures("60 0 230 100\n", g);
+  TEST_ASSERT_FALSE(g.swiped());
+  r = gestures("500 1 50 50\n520 0 50 50\n", g);
+  TEST_ASSERT_EQUAL_STRING("T@520", r.c_str());
+}
+
+// cancel(), e.g. on a slider, drops the rest of the touch
+static void test_cancel() {
+  TouchGestures g;
+  g.feed(0, 1, 100, 100);
+  g.cancel();
+  std::string r = gestures("40 1 200 100\n60 0 200 100\n", g);
+  TEST_ASSERT_EQUAL_STRING("", r.c_str());
+}
+
+int main(int, char **) {
+  UNITY_BEGIN();
+  RUN_TEST(test_parse_recorded_frame);
+  RUN_TEST(test_rotations_map_corners);
+  RUN_TEST(test_multi_touch_keeps_ids);
+  RUN_TEST(test_garbage_and_edges);
+  RUN_TEST(test_calibrated_range);
+  RUN_TEST(test_tap);
+  RUN_TEST(test_long_press);
+  RUN_TEST(test_swipes);
+  RUN_TEST(test_drags_are_not_gestures);
+  RUN_TEST(test_second_finger_cancels);
+  RUN_TEST(test_swiped_and_next_touch);
+  RUN_TEST(test_cancel);
+  return UNITY_END();
+}
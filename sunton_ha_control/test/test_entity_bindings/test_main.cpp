@@ -0,0 +1,163 @@
+// EntityBinder against a host LVGL display: widgets are only invalidated
+// when their entity changed. pio test -e native -f test_entity_bindings
+#include "entity_bindings.h"
+#include <unity.h>
+
+#define HOR 480
+#define VER 320
+
+static lv_color_t buf[HOR * 20];
+static lv_disp_draw_buf_t drawBuf;
+static lv_disp_drv_t drv;
+static uint32_t flushed; // Areas sent to the panel
+
+static void flush(lv_disp_drv_t *d, const lv_area_t *, lv_color_t *) {
+  flushed++;
+  lv_disp_flush_ready(d);
+}
+
+static EntityStore store;
+static EntityBinder binder;
+static lv_obj_t *home;   // Default screen, shown between tests
+static lv_obj_t *screen; // Rebuilt for every test
+static int16_t temp, power, light;
+static lv_obj_t *tempLabel, *powerLabel, *lightSwitch;
+
+// Invalidated areas still waiting for the next refresh
+static uint16_t pending() { return lv_disp_get_default()->inv_p; }
+
+// One panel update cycle: refresh the bindings, then draw what changed.
+// Returns the widgets updated.
+static uint8_t cycle() {
+  uint8_t n = binder.refresh(store);
+  lv_refr_now(NULL);
+  return n;
+}
+
+void setUp() {
+  store = EntityStore();
+  binder = EntityBinder();
+  screen = lv_obj_create(NULL);
+  lv_scr_load(screen);
+  temp = store.intern("sensor.temperatura", ENTITY_NUMBER);
+  power = store.intern("sensor.potencia", ENTITY_NUMBER);
+  light = store.intern("light.salon", ENTITY_BOOL);
+  tempLabel = lv_label_create(screen);
+  powerLabel = lv_label_create(screen);
+  lv_obj_set_pos(powerLabel, 0, 100);
+  lightSwitch = lv_switch_create(screen);
+  lv_obj_set_pos(lightSwitch, 0, 200);
+  binder.label(temp, tempLabel, "%s °C");
+  binder.label(power, powerLabel, "%s W");
+  binder.toggle(light, lightSwitch);
+  store.set(temp, "21.5");
+  store.set(power, "350");
+  store.set(light, "off");
+  lv_refr_now(NULL);
+  flushed = 0;
+}
+
+void tearDown() {
+  lv_scr_load(home);
+  lv_obj_del(screen);
+  lv_refr_now(NULL);
+}
+
+static void test_first_refresh_shows_every_value() {
+  TEST_ASSERT_EQUAL(3, cycle());
+  TEST_ASSERT_EQUAL_STRING("21.5 °C", lv_label_get_text(tempLabel));
+  TEST_ASSERT_EQUAL_STRING("350 W", lv_label_get_text(powerLabel));
+  TEST_ASSERT_FALSE(lv_obj_has_state(lightSwitch, LV_STATE_CHECKED));
+}
+
+static void test_unchanged_poll_invalidates_nothing() {
+  cycle();
+  flushed = 0;
+  // A poll that brings the same states back
+  store.set(temp, "21.5");
+  store.set(power, "350");
+  store.set(light, "off");
+  TEST_ASSERT_EQUAL(0, binder.refresh(store));
+  TEST_ASSERT_EQUAL(0, pending());
+  lv_refr_now(NULL);
+  TEST_ASSERT_EQUAL(0, flushed);
+}
+
+static void test_one_change_redraws_one_widget() {
+  cycle();
+  lv_area_t area;
+  lv_obj_get_coords(powerLabel, &area);
+  store.set(temp, "21.5");
+  store.set(power, "420");
+  TEST_ASSERT_EQUAL(1, binder.refresh(store));
+  TEST_ASSERT_EQUAL_STRING("420 W", lv_label_get_text(powerLabel));
+  // The label's old area; the new text is as wide, so nothing else
+  TEST_ASSERT_EQUAL(1, pending());
+  lv_area_t inv = lv_disp_get_default()->inv_areas[0];
+  TEST_ASSERT_TRUE(inv.y1 <= area.y1 && inv.y2 >= area.y2);
+  TEST_ASSERT_TRUE(inv.y2 < 200); // Not the switch
+  lv_refr_now(NULL);
+  TEST_ASSERT_TRUE(flushed > 0);
+}
+
+static void test_switch_follows_the_bool_state() {
+  cycle();
+  store.set(light, "on");
+  TEST_ASSERT_EQUAL(1, cycle());
+  TEST_ASSERT_TRUE(lv_obj_has_state(lightSwitch, LV_STATE_CHECKED));
+  store.set(light, "off");
+  TEST_ASSERT_EQUAL(1, cycle());
+  TEST_ASSERT_FALSE(lv_obj_has_state(lightSwitch, LV_STATE_CHECKED));
+}
+
+static void test_deleted_widget_drops_its_binding() {
+  cycle();
+  lv_obj_del(powerLabel);
+  store.set(power, "500");
+  store.set(temp, "22.0");
+  TEST_ASSERT_EQUAL(1, cycle());
+  TEST_ASSERT_EQUAL_STRING("22.0 °C", lv_label_get_text(tempLabel));
+}
+
+static void test_rebuilt_widget_shows_the_stored_value() {
+  cycle();
+  lv_obj_del(powerLabel);
+  powerLabel = lv_label_create(screen);
+  TEST_ASSERT_TRUE(binder.label(power, powerLabel, "%s W"));
+  TEST_ASSERT_EQUAL(1, cycle()); // Nothing changed in the store
+  TEST_ASSERT_EQUAL_STRING("350 W", lv_label_get_text(powerLabel));
+}
+
+static void test_many_idle_cycles_stay_idle() {
+  cycle();
+  flushed = 0;
+  for (int i = 0; i < 100; i++) {
+    store.set(temp, "21.5");
+    store.set(power, "350");
+    store.set(light, "off");
+    TEST_ASSERT_EQUAL(0, cycle());
+  }
+  TEST_ASSERT_EQUAL(0, flushed);
+}
+
+int main(int, char **) {
+  lv_init();
+  lv_disp_draw_buf_init(&drawBuf, buf, NULL, HOR * 20);
+  lv_disp_drv_init(&drv);
+  drv.hor_res = HOR;
+  drv.ver_res = VER;
+  drv.flush_cb = flush;
+  drv.draw_buf = &drawBuf;
+  lv_disp_drv_register(&drv);
+  home = lv_scr_act();
+
+  UNITY_BEGIN();
+  RUN_TEST(test_first_refresh_shows_every_value);
+  RUN_TEST(test_unchanged_poll_invalidates_nothing);
+  RUN_TEST(test_one_change_redraws_one_widget);
+  RUN_TEST(test_switch_follows_the_bool_state);
+  RUN_TEST(test_deleted_widget_drops_its_binding);
+  RUN_TEST(test_rebuilt_widget_shows_the_stored_value);
+  RUN_TEST(test_many_idle_cycles_stay_idle);
+  return UNITY_END();
+}
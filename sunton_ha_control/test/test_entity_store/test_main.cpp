@@ -0,0 +1,133 @@
+// EntityStore interning, typed values and versions: pio test -e native
+#include "entity_store.h"
+#include <stdio.h>
+#include <string>
+#include <unity.h>
+
+static EntityStore store;
+
+void setUp() { store = EntityStore(); }
+void tearDown() {}
+
+static void test_intern_returns_one_handle_per_id() {
+  int16_t a = store.intern("sensor.temp", ENTITY_NUMBER);
+  int16_t b = store.intern("light.salon", ENTITY_BOOL);
+  TEST_ASSERT_EQUAL(0, a);
+  TEST_ASSERT_EQUAL(1, b);
+  std::string copy = "sensor.temp"; // Same text, other pointer
+  TEST_ASSERT_EQUAL(a, store.intern(copy.c_str()));
+  TEST_ASSERT_EQUAL(a, store.find(copy.c_str()));
+  TEST_ASSERT_EQUAL(-1, store.find("sensor.other"));
+  TEST_ASSERT_EQUAL(2, store.size());
+  TEST_ASSERT_EQUAL(ENTITY_NUMBER, store.get(a).type);
+}
+
+static void test_intern_refuses_past_entity_max() {
+  static char ids[ENTITY_MAX + 1][16];
+  for (int i = 0; i < ENTITY_MAX; i++) {
+    snprintf(ids[i], sizeof(ids[i]), "sensor.s%d", i);
+    TEST_ASSERT_EQUAL(i, store.intern(ids[i]));
+  }
+  TEST_ASSERT_EQUAL(-1, store.intern("sensor.extra"));
+  TEST_ASSERT_EQUAL(3, store.intern("sensor.s3")); // Known ids still map
+}
+
+static void test_new_values_bump_the_version() {
+  int16_t h = store.intern("sensor.temp");
+  TEST_ASSERT_FALSE(store.get(h).valid);
+  TEST_ASSERT_TRUE(store.set(h, "21.5"));
+  TEST_ASSERT_TRUE(store.get(h).valid);
+  TEST_ASSERT_EQUAL(1, store.version());
+  TEST_ASSERT_EQUAL(1, store.get(h).version);
+  TEST_ASSERT_TRUE(store.set(h, "21.6"));
+  TEST_ASSERT_EQUAL(2, store.get(h).version);
+  TEST_ASSERT_EQUAL_STRING("21.6", store.get(h).text);
+}
+
+static void test_repeated_value_changes_nothing() {
+  int16_t a = store.intern("sensor.a");
+  int16_t b = store.intern("sensor.b");
+  store.set(a, "on");
+  store.set(b, "12");
+  TEST_ASSERT_FALSE(store.set(a, "on"));
+  TEST_ASSERT_FALSE(store.set("sensor.b", "12"));
+  TEST_ASSERT_EQUAL(2, store.version());
+  TEST_ASSERT_EQUAL(1, store.get(a).version);
+}
+
+static void test_typed_values() {
+  int16_t n = store.intern("sensor.power", ENTITY_NUMBER);
+  int16_t l = store.intern("light.salon", ENTITY_BOOL);
+  int16_t c = store.intern("cover.persiana", ENTITY_BOOL);
+  store.set(n, "1234.5");
+  TEST_ASSERT_FLOAT_WITHIN(0.01f, 1234.5f, store.get(n).number);
+  store.set(l, "on");
+  TEST_ASSERT_TRUE(store.get(l).on);
+  store.set(l, "off");
+  TEST_ASSERT_FALSE(store.get(l).on);
+  store.set(c, "open");
+  TEST_ASSERT_TRUE(store.get(c).on);
+  store.set(c, "unavailable");
+  TEST_ASSERT_FALSE(store.get(c).on);
+}
+
+static void test_long_states_are_truncated() {
+  int16_t h = store.intern("sensor.text");
+  std::string s(40, 'x');
+  TEST_ASSERT_TRUE(store.set(h, s.c_str()));
+  TEST_ASSERT_EQUAL(ENTITY_STATE_LEN - 1, strlen(store.get(h).text));
+  s[30] = 'y'; // Past what is stored: no change
+  TEST_ASSERT_FALSE(store.set(h, s.c_str()));
+}
+
+static void test_bad_handles_are_ignored() {
+  store.intern("sensor.a");
+  TEST_ASSERT_FALSE(store.set(-1, "1"));
+  TEST_ASSERT_FALSE(store.set(5, "1"));
+  TEST_ASSERT_FALSE(store.set((int16_t)0, NULL));
+  TEST_ASSERT_FALSE(store.set("sensor.unknown", "1"));
+  TEST_ASSERT_EQUAL(0, store.version());
+}
+
+static void test_touch_bumps_only_known_values() {
+  int16_t a = store.intern("light.salon", ENTITY_BOOL);
+  store.touch(a); // Nothing stored yet: nothing to show again
+  TEST_ASSERT_EQUAL(0, store.version());
+  store.set(a, "on");
+  uint32_t v = store.version();
+  store.touch(a);
+  TEST_ASSERT_EQUAL(v + 1, store.version());
+  TEST_ASSERT_EQUAL(v + 1, store.get(a).version);
+  TEST_ASSERT_EQUAL_STRING("on", store.get(a).text);
+  store.touch(-1);
+  store.touch(ENTITY_MAX);
+  TEST_ASSERT_EQUAL(v + 1, store.version());
+}
+
+// Both ways the switch is redrawn: the old value comes back, or it was
+// never replaced and only the user's flip has to go
+static void test_restore_always_bumps() {
+  int16_t a = store.intern("light.salon", ENTITY_BOOL);
+  store.set(a, "on");
+  uint32_t v = store.version();
+  store.restore(a, false);
+  TEST_ASSERT_FALSE(store.get(a).on);
+  TEST_ASSERT_EQUAL(v + 1, store.get(a).version);
+  store.restore(a, false);
+  TEST_ASSERT_FALSE(store.get(a).on);
+  TEST_ASSERT_EQUAL(v + 2, store.get(a).version);
+}
+
+int main(int, char **) {
+  UNITY_BEGIN();
+  RUN_TEST(test_intern_returns_one_handle_per_id);
+  RUN_TEST(test_intern_refuses_past_entity_max);
+  RUN_TEST(test_new_values_bump_the_version);
+  RUN_TEST(test_repeated_value_changes_nothing);
+  RUN_TEST(test_typed_values);
+  RUN_TEST(test_long_states_are_truncated);
+  RUN_TEST(test_bad_handles_are_ignored);
+  RUN_TEST(test_touch_bumps_only_known_values);
+  RUN_TEST(test_restore_always_bumps);
+  return UNITY_END();
+}
@@ -0,0 +1,154 @@
+// HaCommandQueue coalescing, ordering and rollback: pio test -e native
+#include "ha_commands.h"
+#include <stdio.h>
+#include <string>
+#include <unity.h>
+
+static HaCommandQueue queue;
+#define A 0 // Entity handles, as from EntityStore
+#define B 1
+
+// Takes and finishes every queued command; "entity:service" in order
+static std::string drain() {
+  std::string log;
+  HaCommand c;
+  while (queue.take(c)) {
+    log += std::string(c.entity) + ":" + c.service + " ";
+    queue.finish();
+  }
+  return log;
+}
+
+void setUp() {
+  drain();
+  queue.finish();
+}
+
+void tearDown() {}
+
+static void test_entities_go_out_in_first_posted_order() {
+  queue.post("light", "turn_on", "light.a", -1, 0);
+  queue.post("switch", "turn_off", "switch.b", -1, 0);
+  queue.post("light", "turn_on", "light.c", -1, 0);
+  TEST_ASSERT_EQUAL(3, queue.size());
+  std::string log = drain();
+  TEST_ASSERT_EQUAL_STRING("light.a:turn_on switch.b:turn_off "
+                           "light.c:turn_on ",
+                           log.c_str());
+}
+
+static void test_last_writer_wins_and_keeps_its_place() {
+  queue.post("light", "turn_on", "light.a", A, 0);
+  queue.post("light", "turn_on", "light.b", B, 0);
+  queue.post("light", "turn_off", "light.a", B, 1);
+  TEST_ASSERT_EQUAL(2, queue.size());
+  HaCommand c;
+  TEST_ASSERT_TRUE(queue.take(c));
+  TEST_ASSERT_EQUAL_STRING("light.a", c.entity);
+  TEST_ASSERT_EQUAL_STRING("turn_off", c.service);
+  // Handle and rollback stay those of the first post
+  TEST_ASSERT_EQUAL(A, c.handle);
+  TEST_ASSERT_EQUAL(0, c.rollback);
+}
+
+static void test_two_pending_toggles_cancel_out() {
+  queue.post("light", "toggle", "light.a", -1, 0);
+  queue.post("light", "toggle", "light.b", -1, 1);
+  queue.post("light", "toggle", "light.a", -1, 1);
+  TEST_ASSERT_EQUAL(1, queue.size());
+  queue.post("light", "toggle", "light.a", -1, 0); // A third one stays
+  std::string log = drain();
+  TEST_ASSERT_EQUAL_STRING("light.b:toggle light.a:toggle ", log.c_str());
+}
+
+static void test_toggle_then_explicit_service_is_replaced() {
+  queue.post("light", "toggle", "light.a", -1, 0);
+  queue.post("light", "turn_off", "light.a", -1, 1);
+  queue.post("light", "toggle", "light.a", -1, 0);
+  std::string log = drain();
+  TEST_ASSERT_EQUAL_STRING("light.a:toggle ", log.c_str());
+}
+
+static void test_coalesced_field_takes_the_newest_value() {
+  queue.post("light", "turn_on", "light.a", -1, 0, "brightness_pct", 20);
+  queue.post("light", "turn_on", "light.a", -1, 0, "brightness_pct", 65);
+  HaCommand c;
+  TEST_ASSERT_TRUE(queue.take(c));
+  TEST_ASSERT_EQUAL_STRING("brightness_pct", c.field);
+  TEST_ASSERT_EQUAL(65, c.value);
+  queue.finish();
+  queue.post("light", "turn_on", "light.a", -1, 0, "brightness_pct", 30);
+  queue.post("light", "turn_off", "light.a", -1, 0);
+  TEST_ASSERT_TRUE(queue.take(c));
+  TEST_ASSERT_NULL(c.field);
+}
+
+static void test_full_queue_refuses_new_entities_only() {
+  char id[16];
+  for (int i = 0; i < HA_CMD_SLOTS; i++) {
+    snprintf(id, sizeof(id), "light.%d", i);
+    TEST_ASSERT_TRUE(queue.post("light", "turn_on", id, -1, 0));
+  }
+  TEST_ASSERT_FALSE(queue.post("light", "turn_on", "light.new", -1, 0));
+  TEST_ASSERT_TRUE(queue.post("light", "turn_off", "light.3", -1, 0));
+  TEST_ASSERT_EQUAL(HA_CMD_SLOTS, queue.size());
+}
+
+static void test_rollback_behind_a_call_in_flight() {
+  // Widget was off (0); the user turns it on, then off again while the
+  // first call is still out
+  queue.post("light", "toggle", "light.a", A, 0);
+  HaCommand c;
+  TEST_ASSERT_TRUE(queue.take(c));
+  queue.post("light", "toggle", "light.a", A, 1);
+  TEST_ASSERT_TRUE(queue.finish()); // Superseded by the queued one
+  TEST_ASSERT_TRUE(queue.take(c));
+  // If it fails, restore what was there before the first call
+  TEST_ASSERT_EQUAL(0, c.rollback);
+  TEST_ASSERT_FALSE(queue.finish());
+}
+
+static void test_rollback_after_the_call_finished() {
+  queue.post("light", "toggle", "light.a", A, 0);
+  HaCommand c;
+  TEST_ASSERT_TRUE(queue.take(c));
+  TEST_ASSERT_FALSE(queue.finish());
+  queue.post("light", "toggle", "light.a", A, 1);
+  TEST_ASSERT_TRUE(queue.take(c));
+  TEST_ASSERT_EQUAL(1, c.rollback);
+}
+
+static void test_other_entity_in_flight_keeps_own_rollback() {
+  queue.post("light", "toggle", "light.a", A, 0);
+  HaCommand c;
+  TEST_ASSERT_TRUE(queue.take(c));
+  queue.post("light", "toggle", "light.b", B, 1);
+  TEST_ASSERT_FALSE(queue.finish());
+  TEST_ASSERT_TRUE(queue.take(c));
+  TEST_ASSERT_EQUAL(1, c.rollback);
+}
+
+static void test_long_entity_ids_are_truncated() {
+  std::string id = "sensor." + std::string(80, 'x');
+  TEST_ASSERT_TRUE(queue.post("homeassistant", "update_entity", id.c_str(),
+                              -1, 0));
+  HaCommand c;
+  TEST_ASSERT_TRUE(queue.take(c));
+  TEST_ASSERT_EQUAL(HA_CMD_ID_LEN - 1, strlen(c.entity));
+  TEST_ASSERT_EQUAL(0, id.compare(0, HA_CMD_ID_LEN - 1, c.entity));
+}
+
+int main(int, char **) {
+  UNITY_BEGIN();
+  RUN_TEST(test_entities_go_out_in_first_posted_order);
+  RUN_TEST(test_last_writer_wins_and_keeps_its_place);
+  RUN_TEST(test_two_pending_toggles_cancel_out);
+  RUN_TEST(test_toggle_then_explicit_service_is_replaced);
+  RUN_TEST(test_coalesced_field_takes_the_newest_value);
+  RUN_TEST(test_full_queue_refuses_new_entities_only);
+  RUN_TEST(test_rollback_behind_a_call_in_flight);
+  RUN_TEST(test_rollback_after_the_call_finished);
+  RUN_TEST(test_other_entity_in_flight_keeps_own_rollback);
+  RUN_TEST(test_long_entity_ids_are_truncated);
+  return UNITY_END();
+}
@@ -0,0 +1,261 @@
+// LightRow on a host LVGL display: switch behaviour, hit-testing, drawing,
+// and object count, heap and timings against the container + label +
+// lv_switch row it replaced. pio test -e native -f test_light_row
+// The subset fonts are in src/, which host tests do not build
+#define ui_font_14 lv_font_montserrat_14
+#include "light_row.h"
+#include <chrono>
+#include <unity.h>
+
+#define HOR 480
+#define VER 320
+
+static lv_color_t buf[HOR * 20];
+static lv_color_t fb[HOR * VER]; // What the panel shows
+static lv_disp_draw_buf_t drawBuf;
+static lv_disp_drv_t drv;
+static lv_indev_drv_t touchDrv;
+static lv_indev_t *touch;
+static lv_point_t touchAt;
+static bool touchDown;
+
+static void flush(lv_disp_drv_t *d, const lv_area_t *a, lv_color_t *px) {
+  for (lv_coord_t y = a->y1; y <= a->y2; y++)
+    for (lv_coord_t x = a->x1; x <= a->x2; x++)
+      fb[y * HOR + x] = *px++;
+  lv_disp_flush_ready(d);
+}
+
+static void touchRead(lv_indev_drv_t *, lv_indev_data_t *data) {
+  data->point = touchAt;
+  data->state = touchDown ? LV_INDEV_STATE_PR : LV_INDEV_STATE_REL;
+}
+
+// A tap at (x, y), read by LVGL as the panel's touch driver would be
+static void tap(lv_coord_t x, lv_coord_t y) {
+  touchAt = {x, y};
+  touchDown = true;
+  lv_indev_read_timer_cb(touch->driver->read_timer);
+  touchDown = false;
+  lv_indev_read_timer_cb(touch->driver->read_timer);
+}
+
+static uint32_t micros() {
+  using namespace std::chrono;
+  return (uint32_t)duration_cast<microseconds>(
+             steady_clock::now().time_since_epoch())
+      .count();
+}
+
+static lv_color_t pixel(lv_coord_t x, lv_coord_t y) { return fb[y * HOR + x]; }
+
+static lv_obj_t *home;
+static lv_obj_t *screen;
+static lv_obj_t *row;
+static int changed;
+
+static void onChanged(lv_event_t *) { changed++; }
+
+void setUp() {
+  screen = lv_obj_create(NULL);
+  lv_scr_load(screen);
+  row = lightRowCreate(screen, "Luz 1");
+  lv_obj_set_pos(row, 100, 100);
+  lv_obj_add_event_cb(row, onChanged, LV_EVENT_VALUE_CHANGED, NULL);
+  changed = 0;
+  lv_refr_now(NULL);
+}
+
+void tearDown() {
+  lv_scr_load(home);
+  lv_obj_del(screen);
+}
+
+static void test_one_object_of_row_size() {
+  TEST_ASSERT_EQUAL_UINT32(0, lv_obj_get_child_cnt(row));
+  TEST_ASSERT_EQUAL_INT(LIGHT_ROW_WIDTH, lv_obj_get_width(row));
+  TEST_ASSERT_EQUAL_INT(LIGHT_ROW_HEIGHT, lv_obj_get_height(row));
+  TEST_ASSERT_TRUE(lv_obj_check_type(row, lightRowClass()));
+}
+
+static void test_text_is_copied_and_cut() {
+  char name[] = "Luz temporal";
+  lightRowSetText(row, name);
+  name[0] = 'X';
+  TEST_ASSERT_EQUAL_STRING("Luz temporal", ((LightRow *)row)->text);
+  lightRowSetText(row, "Una luz con un nombre largo");
+  TEST_ASSERT_EQUAL_UINT32(LIGHT_ROW_TEXT_LEN - 1,
+                           strlen(((LightRow *)row)->text));
+}
+
+// Like the lv_switch: a tap on the toggle flips it and reports the change
+static void test_tap_on_toggle_toggles() {
+  tap(100 + LIGHT_ROW_WIDTH - LIGHT_ROW_PAD - 10, 100 + LIGHT_ROW_HEIGHT / 2);
+  TEST_ASSERT_TRUE(lv_obj_has_state(row, LV_STATE_CHECKED));
+  TEST_ASSERT_EQUAL_INT(1, changed);
+  tap(100 + LIGHT_ROW_WIDTH - 2, 100 + 2); // Margin, still the toggle end
+  TEST_ASSERT_FALSE(lv_obj_has_state(row, LV_STATE_CHECKED));
+  TEST_ASSERT_EQUAL_INT(2, changed);
+}
+
+// The name side does not take clicks: they fall through to the card
+static void test_tap_on_text_does_nothing() {
+  tap(100 + LIGHT_ROW_PAD + 5, 100 + LIGHT_ROW_HEIGHT / 2);
+  TEST_ASSERT_FALSE(lv_obj_has_state(row, LV_STATE_CHECKED));
+  TEST_ASSERT_EQUAL_INT(0, changed);
+  lv_point_t p = {100 + LIGHT_ROW_PAD + 5, 100 + LIGHT_ROW_HEIGHT / 2};
+  TEST_ASSERT_FALSE(lv_obj_hit_test(row, &p));
+}
+
+// Setting the state from code (EntityBinder, rollback) redraws the row
+// without sending a change
+static void test_state_from_code_redraws() {
+  lv_obj_add_state(row, LV_STATE_CHECKED);
+  TEST_ASSERT_GREATER_THAN(0, lv_disp_get_default()->inv_p);
+  TEST_ASSERT_EQUAL_INT(0, changed);
+}
+
+// The knob sits left when off and right when on, over the theme colour
+static void test_draws_toggle_state() {
+  lv_area_t t;
+  lightRowToggle(row, &t);
+  lv_coord_t y = (t.y1 + t.y2) / 2;
+  lv_coord_t left = t.x1 + LIGHT_ROW_TOGGLE_H / 2;
+  lv_coord_t right = t.x2 - LIGHT_ROW_TOGGLE_H / 2;
+  lv_color_t white = lv_color_white();
+  lv_color_t primary = lv_theme_get_color_primary(row);
+  TEST_ASSERT_EQUAL_HEX32(white.full, pixel(left, y).full);
+  TEST_ASSERT_NOT_EQUAL(white.full, pixel(right, y).full);
+  lv_obj_add_state(row, LV_STATE_CHECKED);
+  lv_refr_now(NULL);
+  TEST_ASSERT_EQUAL_HEX32(primary.full, pixel(left, y).full);
+  TEST_ASSERT_EQUAL_HEX32(white.full, pixel(right, y).full);
+  TEST_ASSERT_EQUAL_HEX32(lv_color_hex(LIGHT_ROW_BG).full,
+                          pixel(100 + 4, 100 + LIGHT_ROW_HEIGHT / 2).full);
+}
+
+// The row as createZonePage() built it before LightRow
+static lv_obj_t *legacyRowCreate(lv_obj_t *parent, const char *text) {
+  lv_obj_t *r = lv_obj_create(parent);
+  lv_obj_set_size(r, LIGHT_ROW_WIDTH, LIGHT_ROW_HEIGHT);
+  lv_obj_set_style_bg_color(r, lv_color_hex(LIGHT_ROW_BG), 0);
+  lv_obj_set_style_radius(r, LIGHT_ROW_RADIUS, 0);
+  lv_obj_set_style_border_width(r, 0, 0);
+  lv_obj_t *lbl = lv_label_create(r);
+  lv_label_set_text(lbl, text);
+  lv_obj_align(lbl, LV_ALIGN_LEFT_MID, 10, 0);
+  lv_obj_t *sw = lv_switch_create(r);
+  lv_obj_set_size(sw, LIGHT_ROW_TOGGLE_W, LIGHT_ROW_TOGGLE_H);
+  lv_obj_align(sw, LV_ALIGN_RIGHT_MID, -10, 0);
+  return r;
+}
+
+struct PageCost {
+  uint32_t objects;
+  uint32_t heap;
+  uint32_t buildUs;
+  uint32_t layoutUs;
+  uint32_t renderUs;
+};
+
+static uint32_t objCount(lv_obj_t *obj) {
+  uint32_t n = 1;
+  for (uint32_t i = 0; i < lv_obj_get_child_cnt(obj); i++)
+    n += objCount(lv_obj_get_child(obj, i));
+  return n;
+}
+
+static uint32_t heapUsed() {
+  lv_mem_monitor_t m;
+  lv_mem_monitor(&m);
+  return m.total_size - m.free_size;
+}
+
+// A card with three light rows, built, laid out and drawn `runs` times
+static PageCost measure(bool legacy, int runs) {
+  PageCost c = {0, 0, 0, 0, 0};
+  for (int k = 0; k < runs; k++) {
+    uint32_t before = heapUsed();
+    uint32_t t0 = micros();
+    lv_obj_t *card = lv_obj_create(screen);
+    lv_obj_set_size(card, 456, 170);
+    lv_obj_t *col = card;
+    if (legacy) { // The rows sat in a flex column
+      col = lv_obj_create(card);
+      lv_obj_set_size(col, 230, 140);
+      lv_obj_align(col, LV_ALIGN_RIGHT_MID, 0, 0);
+      lv_obj_set_flex_flow(col, LV_FLEX_FLOW_COLUMN);
+      lv_obj_set_style_pad_gap(col, 10, 0);
+    }
+    for (int i = 0; i < 3; i++) {
+      lv_obj_t *r = legacy ? legacyRowCreate(col, "Luz")
+                           : lightRowCreate(col, "Luz");
+      if (!legacy)
+        lv_obj_set_pos(r, 214, 14 + i * (LIGHT_ROW_HEIGHT + 10));
+    }
+    uint32_t t1 = micros();
+    lv_obj_update_layout(card);
+    uint32_t t2 = micros();
+    lv_refr_now(NULL);
+    uint32_t t3 = micros();
+    c.buildUs += t1 - t0;
+    c.layoutUs += t2 - t1;
+    c.renderUs += t3 - t2;
+    c.objects = objCount(card);
+    c.heap = heapUsed() - before;
+    lv_obj_del(card);
+    lv_refr_now(NULL);
+  }
+  c.buildUs /= runs;
+  c.layoutUs /= runs;
+  c.renderUs /= runs;
+  return c;
+}
+
+static void report(const char *name, const PageCost &c) {
+  char line[128];
+  snprintf(line, sizeof(line),
+           "%s: %lu objects, %lu B heap, build %lu us, layout %lu us, "
+           "render %lu us",
+           name, (unsigned long)c.objects, (unsigned long)c.heap,
+           (unsigned long)c.buildUs, (unsigned long)c.layoutUs,
+           (unsigned long)c.renderUs);
+  TEST_MESSAGE(line);
+}
+
+static void test_cheaper_than_legacy_row() {
+  lv_obj_del(row);
+  PageCost legacy = measure(true, 200);
+  PageCost light = measure(false, 200);
+  report("container + label + switch", legacy);
+  report("LightRow", light);
+  TEST_ASSERT_EQUAL_UINT32(1 + 1 + 3 * 3, legacy.objects);
+  TEST_ASSERT_EQUAL_UINT32(1 + 3, light.objects);
+  TEST_ASSERT_LESS_THAN(legacy.heap, light.heap);
+}
+
+int main(int, char **) {
+  lv_init();
+  lv_disp_draw_buf_init(&drawBuf, buf, NULL, HOR * 20);
+  lv_disp_drv_init(&drv);
+  drv.hor_res = HOR;
+  drv.ver_res = VER;
+  drv.flush_cb = flush;
+  drv.draw_buf = &drawBuf;
+  lv_disp_drv_register(&drv);
+  lv_indev_drv_init(&touchDrv);
+  touchDrv.type = LV_INDEV_TYPE_POINTER;
+  touchDrv.read_cb = touchRead;
+  touch = lv_indev_drv_register(&touchDrv);
+  home = lv_scr_act();
+
+  UNITY_BEGIN();
+  RUN_TEST(test_one_object_of_row_size);
+  RUN_TEST(test_text_is_copied_and_cut);
+  RUN_TEST(test_tap_on_toggle_toggles);
+  RUN_TEST(test_tap_on_text_does_nothing);
+  RUN_TEST(test_state_from_code_redraws);
+  RUN_TEST(test_draws_toggle_state);
+  RUN_TEST(test_cheaper_than_legacy_row);
+  return UNITY_END();
+}
@@ -0,0 +1,168 @@
+// lttbDownsample against a plain reference LTTB: pio test -e native -f
+// test_lttb
+#include "lttb.h"
+#include <stdlib.h>
+#include <unity.h>
+
+#define GROUPS 60
+#define SIZE 8
+#define N (GROUPS * SIZE)
+
+static int16_t y[N];
+static int16_t out[GROUPS];
+static int16_t ref[GROUPS];
+
+// Textbook LTTB over fixed groups, in double, with unknown samples
+// skipped: the first group keeps its first known sample and the last
+// group the sample with the largest triangle towards `next`.
+static void reference(const int16_t *s, int16_t next, int16_t *r) {
+  double ax = 0;
+  int ay = LTTB_NONE;
+  for (int g = 0; g < GROUPS; g++) {
+    double cx = (g + 1) * SIZE, cy = next;
+    bool known = next != LTTB_NONE;
+    if (g + 1 < GROUPS) {
+      double sx = 0, sy = 0;
+      int n = 0;
+      for (int i = (g + 1) * SIZE; i < (g + 2) * SIZE; i++) {
+        if (s[i] != LTTB_NONE) {
+          sx += i;
+          sy += s[i];
+          n++;
+        }
+      }
+      known = n > 0;
+      if (known) {
+        cx = sx / n;
+        cy = lround(sy / n);
+      }
+    }
+    int best = LTTB_NONE, bestX = 0;
+    double bestArea = -1;
+    for (int i = g * SIZE; i < (g + 1) * SIZE; i++) {
+      if (s[i] == LTTB_NONE)
+        continue;
+      if (ay == LTTB_NONE) {
+        best = s[i];
+        bestX = i;
+        break;
+      }
+      double area =
+          known ? fabs((ax - cx) * (s[i] - ay) - (ax - i) * (cy - ay)) : 0;
+      if (area >= bestArea) {
+        bestArea = area;
+        best = s[i];
+        bestX = i;
+      }
+    }
+    r[g] = best;
+    if (best != LTTB_NONE) {
+      ax = bestX;
+      ay = best;
+    }
+  }
+}
+
+// Random walk around 21.0 C in tenths, with `gaps` unknown runs
+static void walk(unsigned seed, int gaps) {
+  srand(seed);
+  int v = 210;
+  for (int i = 0; i < N; i++) {
+    v += rand() % 7 - 3;
+    y[i] = (int16_t)v;
+  }
+  for (int k = 0; k < gaps; k++) {
+    int at = rand() % N, len = 1 + rand() % 20;
+    for (int i = at; i < at + len && i < N; i++)
+      y[i] = LTTB_NONE;
+  }
+}
+
+void setUp() {}
+void tearDown() {}
+
+static void test_matches_reference() {
+  for (unsigned seed = 1; seed <= 50; seed++) {
+    walk(seed, 0);
+    lttbDownsample(y, GROUPS, SIZE, 215, out);
+    reference(y, 215, ref);
+    TEST_ASSERT_EQUAL_INT16_ARRAY(ref, out, GROUPS);
+  }
+}
+
+static void test_matches_reference_with_gaps() {
+  for (unsigned seed = 1; seed <= 50; seed++) {
+    walk(seed, 6);
+    lttbDownsample(y, GROUPS, SIZE, LTTB_NONE, out);
+    reference(y, LTTB_NONE, ref);
+    TEST_ASSERT_EQUAL_INT16_ARRAY(ref, out, GROUPS);
+  }
+}
+
+// Every output point is one of the samples of its group
+static void test_picks_come_from_their_group() {
+  walk(7, 4);
+  lttbDownsample(y, GROUPS, SIZE, 200, out);
+  for (int g = 0; g < GROUPS; g++) {
+    bool found = false, anyKnown = false;
+    for (int i = g * SIZE; i < (g + 1) * SIZE; i++) {
+      found |= y[i] == out[g];
+      anyKnown |= y[i] != LTTB_NONE;
+    }
+    TEST_ASSERT_TRUE(anyKnown ? found : out[g] == LTTB_NONE);
+  }
+}
+
+// A one-sample spike on a flat line survives; a mean would flatten it
+static void test_keeps_spikes() {
+  for (int i = 0; i < N; i++)
+    y[i] = 200;
+  y[123] = 260;
+  y[301] = 150;
+  lttbDownsample(y, GROUPS, SIZE, 200, out);
+  TEST_ASSERT_EQUAL_INT16(260, out[123 / SIZE]);
+  TEST_ASSERT_EQUAL_INT16(150, out[301 / SIZE]);
+}
+
+static void test_empty_group_is_none() {
+  walk(3, 0);
+  for (int i = 5 * SIZE; i < 6 * SIZE; i++)
+    y[i] = LTTB_NONE;
+  lttbDownsample(y, GROUPS, SIZE, 215, out);
+  reference(y, 215, ref);
+  TEST_ASSERT_EQUAL_INT16(LTTB_NONE, out[5]);
+  TEST_ASSERT_EQUAL_INT16_ARRAY(ref, out, GROUPS);
+}
+
+// Appending a group with lttbPick() continues the series as a full
+// downsample of the longer series would
+static void test_last_pick_continues_series() {
+  walk(11, 2);
+  LttbPoint last = lttbDownsample(y, GROUPS - 1, SIZE, LTTB_NONE, out);
+  const int16_t *g = y + (GROUPS - 1) * SIZE;
+  float x0 = (GROUPS - 1) * SIZE;
+  LttbPoint p = lttbPick(g, SIZE, x0, last, LttbPoint{x0 + SIZE, 215});
+  reference(y, 215, ref);
+  TEST_ASSERT_EQUAL_INT16(ref[GROUPS - 1], p.y);
+}
+
+static void test_mean_skips_unknown() {
+  int16_t g[4] = {10, LTTB_NONE, 20, LTTB_NONE};
+  LttbPoint m = lttbMean(g, 4, 100);
+  TEST_ASSERT_EQUAL_FLOAT(101, m.x);
+  TEST_ASSERT_EQUAL_INT16(15, m.y);
+  int16_t none[2] = {LTTB_NONE, LTTB_NONE};
+  TEST_ASSERT_EQUAL_INT16(LTTB_NONE, lttbMean(none, 2, 0).y);
+}
+
+int main(int, char **) {
+  UNITY_BEGIN();
+  RUN_TEST(test_matches_reference);
+  RUN_TEST(test_matches_reference_with_gaps);
+  RUN_TEST(test_picks_come_from_their_group);
+  RUN_TEST(test_keeps_spikes);
+  RUN_TEST(test_empty_group_is_none);
+  RUN_TEST(test_last_pick_continues_series);
+  RUN_TEST(test_mean_skips_unknown);
+  return UNITY_END();
+}
@@ -0,0 +1,162 @@
+// PollScheduler intervals, ride-along and request rates: pio test -e
+// native -f test_poll_scheduler
+#include "poll_scheduler.h"
+#include <unity.h>
+
+#define N 6
+
+static PollScheduler poller;
+static bool want[POLL_MAX_ENTITIES];
+static uint32_t polls[N]; // Times each entity was requested
+static uint32_t requests;
+
+// Runs the loop every 100 ms over [from, to), answering every due poll
+static void run(uint32_t from, uint32_t to, bool idle = false) {
+  for (uint32_t t = from; t < to; t += 100) {
+    if (!poller.due(t, idle, want))
+      continue;
+    for (uint8_t i = 0; i < N; i++)
+      polls[i] += want[i];
+    poller.polled(want, t);
+    requests++;
+  }
+}
+
+static void clearCounts() {
+  memset(polls, 0, sizeof(polls));
+  requests = 0;
+}
+
+void setUp() {
+  poller = PollScheduler();
+  poller.begin(N);
+  clearCounts();
+}
+
+void tearDown() {}
+
+static void test_everything_is_due_after_begin() {
+  TEST_ASSERT_EQUAL(N, poller.due(1000, false, want));
+  for (uint8_t i = 0; i < N; i++)
+    TEST_ASSERT_TRUE(want[i]);
+  poller.polled(want, 1000);
+  TEST_ASSERT_EQUAL(0, poller.due(1100, false, want));
+}
+
+static void test_visible_and_hidden_intervals() {
+  poller.setVisible(0, true);
+  poller.setVisible(1, true);
+  run(0, 600000); // Ten minutes
+  // Every 5 s while visible, every 60 s while hidden; hidden ones may
+  // ride along from half their interval
+  TEST_ASSERT_INT_WITHIN(2, 600000 / POLL_VISIBLE_MS, polls[0]);
+  TEST_ASSERT_INT_WITHIN(2, 600000 / POLL_VISIBLE_MS, polls[1]);
+  for (uint8_t i = 2; i < N; i++) {
+    TEST_ASSERT_GREATER_OR_EQUAL(600000 / POLL_HIDDEN_MS, polls[i]);
+    TEST_ASSERT_LESS_OR_EQUAL(2 * 600000 / POLL_HIDDEN_MS + 1, polls[i]);
+  }
+  // Hidden entities never cost a request of their own
+  TEST_ASSERT_INT_WITHIN(2, 600000 / POLL_VISIBLE_MS, requests);
+}
+
+static void test_hidden_ride_along_from_half_interval() {
+  poller.setVisible(0, true);
+  TEST_ASSERT_EQUAL(N, poller.due(0, false, want));
+  poller.polled(want, 0);
+  // Visible due at 5 s; hidden at 5 s are only 1/12 through: not asked
+  TEST_ASSERT_EQUAL(1, poller.due(5000, false, want));
+  poller.polled(want, 5000);
+  // At 30 s the hidden ones reached half of 60 s and come along
+  TEST_ASSERT_EQUAL(N, poller.due(30000, false, want));
+}
+
+static void test_nothing_due_means_no_request() {
+  run(0, 100);
+  clearCounts();
+  run(100, POLL_HIDDEN_MS - 100); // All hidden, none due yet
+  TEST_ASSERT_EQUAL(0, requests);
+}
+
+static void test_becoming_visible_is_due_at_once() {
+  run(0, 10000);
+  TEST_ASSERT_EQUAL(0, poller.due(10000, false, want));
+  poller.setVisible(3, true);
+  TEST_ASSERT_TRUE(poller.due(10000, false, want) >= 1);
+  TEST_ASSERT_TRUE(want[3]);
+  poller.polled(want, 10000);
+  poller.setVisible(3, true); // Already visible: not due again
+  TEST_ASSERT_EQUAL(0, poller.due(10100, false, want));
+}
+
+static void test_idle_backs_off_one_step() {
+  poller.setVisible(0, true);
+  run(0, 100, true);
+  clearCounts();
+  run(100, 600100, true);
+  // Visible at the hidden rate, hidden at POLL_IDLE_MS
+  TEST_ASSERT_INT_WITHIN(2, 600000 / POLL_HIDDEN_MS, polls[0]);
+  TEST_ASSERT_LESS_OR_EQUAL(2 * 600000 / POLL_IDLE_MS + 1, polls[1]);
+  TEST_ASSERT_GREATER_OR_EQUAL(600000 / POLL_IDLE_MS, polls[1]);
+}
+
+static void test_waking_up_refreshes_visible_entities() {
+  poller.setVisible(0, true);
+  run(0, 20000, true);
+  TEST_ASSERT_EQUAL(0, poller.due(20000, true, want));
+  TEST_ASSERT_TRUE(poller.due(20000, false, want) >= 1);
+  TEST_ASSERT_TRUE(want[0]);
+  TEST_ASSERT_FALSE(want[1]); // Hidden, only 20 s old
+}
+
+static void test_stale_makes_everything_due() {
+  run(0, 1000);
+  poller.stale();
+  TEST_ASSERT_EQUAL(N, poller.due(1000, false, want));
+}
+
+static void test_failed_polls_retry_on_the_normal_interval() {
+  poller.setVisible(0, true);
+  TEST_ASSERT_EQUAL(N, poller.due(0, false, want));
+  poller.polled(want, 0); // Say it failed: the caller reports it anyway
+  TEST_ASSERT_EQUAL(0, poller.due(4900, false, want));
+  TEST_ASSERT_EQUAL(1, poller.due(5000, false, want));
+}
+
+static void test_rate_window() {
+  uint32_t req, ent;
+  poller.setVisible(0, true);
+  TEST_ASSERT_FALSE(poller.window(1000, req, ent));
+  run(0, POLL_RATE_WINDOW);
+  TEST_ASSERT_TRUE(poller.window(POLL_RATE_WINDOW, req, ent));
+  TEST_ASSERT_EQUAL(requests, req);
+  uint32_t total = 0;
+  for (uint8_t i = 0; i < N; i++)
+    total += polls[i];
+  TEST_ASSERT_EQUAL(total, ent);
+  TEST_ASSERT_FALSE(poller.window(POLL_RATE_WINDOW + 100, req, ent));
+}
+
+static void test_clock_wrap() {
+  poller.setVisible(0, true);
+  uint32_t t = 0xFFFFFFFFu - 2000;
+  TEST_ASSERT_EQUAL(N, poller.due(t, false, want));
+  poller.polled(want, t);
+  TEST_ASSERT_EQUAL(0, poller.due(t + 4000, false, want));
+  TEST_ASSERT_EQUAL(1, poller.due(t + 5000, false, want)); // Wrapped
+}
+
+int main(int, char **) {
+  UNITY_BEGIN();
+  RUN_TEST(test_everything_is_due_after_begin);
+  RUN_TEST(test_visible_and_hidden_intervals);
+  RUN_TEST(test_hidden_ride_along_from_half_interval);
+  RUN_TEST(test_nothing_due_means_no_request);
+  RUN_TEST(test_becoming_visible_is_due_at_once);
+  RUN_TEST(test_idle_backs_off_one_step);
+  RUN_TEST(test_waking_up_refreshes_visible_entities);
+  RUN_TEST(test_stale_makes_everything_due);
+  RUN_TEST(test_failed_polls_retry_on_the_normal_interval);
+  RUN_TEST(test_rate_window);
+  RUN_TEST(test_clock_wrap);
+  return UNITY_END();
+}
@@ -0,0 +1,142 @@
+// SensorHistory buckets and the /api/history seed, whole and in slices:
+// pio test -e native -f test_sensor_history
+#include "sensor_history.h"
+#include <string>
+#include <unity.h>
+
+// Reads a response from memory, as HaBody does from the socket
+struct TextStream {
+  std::string text;
+  size_t pos;
+  explicit TextStream(const std::string &t) : text(t), pos(0) {}
+  int read() { return pos < text.size() ? (uint8_t)text[pos++] : -1; }
+  size_t readBytes(char *buf, size_t len) {
+    size_t n = 0;
+    while (n < len && pos < text.size())
+      buf[n++] = text[pos++];
+    return n;
+  }
+};
+
+// 2024-05-01T00:00:00+00:00
+#define DAY0 1714521600UL
+
+// `n` states, one every 5 min from DAY0, counting up from 20.0
+static std::string response(int n) {
+  std::string s = "[[";
+  char buf[160];
+  for (int i = 0; i < n; i++) {
+    uint32_t t = i * 300;
+    snprintf(buf, sizeof(buf),
+             "%s{%s\"state\": \"%.1f\", \"last_changed\": "
+             "\"2024-05-01T%02u:%02u:00.123456+00:00\"}",
+             i ? ",\n " : "",
+             i ? "" : "\"entity_id\": \"sensor.t\", ", 20 + i * 0.1,
+             (unsigned)(t / 3600), (unsigned)(t / 60 % 60));
+    s += buf;
+  }
+  return s + "]]";
+}
+
+static SensorHistory a, b;
+
+void setUp() {
+  a.clear();
+  b.clear();
+}
+void tearDown() {}
+
+static void test_parse_time() {
+  TEST_ASSERT_EQUAL_UINT32(DAY0,
+                           historyParseTime("2024-05-01T00:00:00+00:00"));
+  TEST_ASSERT_EQUAL_UINT32(DAY0 + 3600 + 2,
+                           historyParseTime("2024-05-01T03:00:02.5+02:00"));
+  TEST_ASSERT_EQUAL_UINT32(0, historyParseTime("yesterday"));
+}
+
+static void test_buckets_hold_last_value() {
+  a.add(DAY0, 20.0f);
+  a.add(DAY0 + 60, 20.4f);
+  a.add(DAY0 + HISTORY_PERIOD_S + 1, 21.0f);
+  a.tick(DAY0 + 3 * HISTORY_PERIOD_S);
+  uint32_t b0 = DAY0 / HISTORY_PERIOD_S;
+  TEST_ASSERT_EQUAL_INT16(204, a.at(b0));
+  TEST_ASSERT_EQUAL_INT16(210, a.at(b0 + 1));
+  TEST_ASSERT_EQUAL_INT16(210, a.at(b0 + 2));
+  TEST_ASSERT_EQUAL_INT16(HISTORY_NONE, a.at(b0 + 3)); // Still open
+  TEST_ASSERT_EQUAL_INT16(210, a.held());
+}
+
+static void test_seed_whole_response() {
+  TextStream in(response(100));
+  uint32_t now = DAY0 + 100 * 300;
+  TEST_ASSERT_EQUAL_INT(100, historySeed(in, a, now));
+  TEST_ASSERT_EQUAL_UINT32(now / HISTORY_PERIOD_S, a.bucket());
+  TEST_ASSERT_EQUAL_INT16(200, a.at(DAY0 / HISTORY_PERIOD_S));
+  TEST_ASSERT_EQUAL_INT16(299, a.held());
+}
+
+// Slices of any size leave the same history as one pass
+static void test_seed_in_slices_matches_whole() {
+  std::string text = response(250);
+  uint32_t now = DAY0 + 250 * 300;
+  TextStream whole(text);
+  historySeed(whole, a, now);
+  const uint16_t slices[] = {1, 7, 32, 1000};
+  for (uint16_t max : slices) {
+    b.clear();
+    TextStream in(text);
+    HistorySeed seed;
+    seed.begin(b, now);
+    int steps = 0;
+    while (seed.step(in, max))
+      steps++;
+    seed.finish();
+    TEST_ASSERT_EQUAL_INT(250, seed.states());
+    TEST_ASSERT_EQUAL_INT((250 - 1) / max, steps);
+    TEST_ASSERT_EQUAL_UINT32(a.bucket(), b.bucket());
+    for (uint32_t k = a.bucket() - HISTORY_SAMPLES; k < a.bucket(); k++)
+      TEST_ASSERT_EQUAL_INT16(a.at(k), b.at(k));
+  }
+}
+
+static void test_seed_skips_future_and_unavailable() {
+  TextStream in("[[{\"state\": \"20.0\", \"last_changed\": "
+                "\"2024-05-01T00:00:00+00:00\"},"
+                "{\"state\": \"unavailable\", \"last_changed\": "
+                "\"2024-05-01T00:10:00+00:00\"},"
+                "{\"state\": \"30.0\", \"last_changed\": "
+                "\"2024-05-02T00:00:00+00:00\"}]]");
+  TEST_ASSERT_EQUAL_INT(3, historySeed(in, a, DAY0 + 3600));
+  TEST_ASSERT_EQUAL_INT16(200, a.held());
+}
+
+static void test_seed_empty_and_malformed() {
+  TextStream empty("[]");
+  TEST_ASSERT_EQUAL_INT(0, historySeed(empty, a, DAY0));
+  TextStream html("<html>502 Bad Gateway</html>");
+  TEST_ASSERT_EQUAL_INT(-1, historySeed(html, a, DAY0));
+  TextStream cut("[[{\"state\": \"2");
+  TEST_ASSERT_EQUAL_INT(-1, historySeed(cut, a, DAY0));
+}
+
+// A response cut after some states keeps them
+static void test_seed_cut_short() {
+  std::string text = response(10);
+  TextStream in(text.substr(0, text.size() / 2));
+  int n = historySeed(in, a, DAY0 + 3000);
+  TEST_ASSERT_GREATER_THAN(0, n);
+  TEST_ASSERT_LESS_THAN(10, n);
+}
+
+int main(int, char **) {
+  UNITY_BEGIN();
+  RUN_TEST(test_parse_time);
+  RUN_TEST(test_buckets_hold_last_value);
+  RUN_TEST(test_seed_whole_response);
+  RUN_TEST(test_seed_in_slices_matches_whole);
+  RUN_TEST(test_seed_skips_future_and_unavailable);
+  RUN_TEST(test_seed_empty_and_malformed);
+  RUN_TEST(test_seed_cut_short);
+  return UNITY_END();
+}
@@ -0,0 +1,226 @@
+// The ui_bench.h cases on the host, against a memory-backed 480x320
+// display: pio test -e native -f test_ui_bench -v. The BENCH lines go to
+// stdout under the ui "ha_control_host", so a saved log feeds
+// tools/ui_bench.py capture and compare like a board's.
+//
+// createUI() lives in main.cpp with the display, touch, WiFi and HA
+// set-up, so the screen is rebuilt here from the same parts: the Home tab
+// with its scene buttons and five zone pages of sensor labels, a history
+// chart, light rows and sliders, bound to the entity store.
+// The subset fonts are in src/, which host tests do not build
+#define ui_font_14 lv_font_montserrat_14
+#include "entity_bindings.h"
+#include "history_chart.h"
+#include "light_row.h"
+#include "ui_bench.h"
+#include <unity.h>
+
+#define HOR 480
+#define VER 320
+#define ZONES 5
+
+static lv_color_t buf[HOR * 20];
+static lv_color_t fb[HOR * VER]; // The panel
+static lv_disp_draw_buf_t drawBuf;
+static lv_disp_drv_t drv;
+static UiBench uiBench;
+
+static void flush(lv_disp_drv_t *d, const lv_area_t *a, lv_color_t *px) {
+  for (lv_coord_t y = a->y1; y <= a->y2; y++)
+    for (lv_coord_t x = a->x1; x <= a->x2; x++)
+      fb[y * HOR + x] = *px++;
+  uiBench.flushed(a);
+  lv_disp_flush_ready(d);
+}
+
+static EntityStore store;
+static EntityBinder bindings;
+static HistoryCharts charts;
+static SensorHistory temps[ZONES];
+static lv_obj_t *tabview;
+static int16_t light[ZONES], temp[ZONES], hum[ZONES];
+
+static void createHomePage() {
+  lv_obj_t *t = lv_tabview_add_tab(tabview, "Home");
+  lv_obj_set_flex_flow(t, LV_FLEX_FLOW_COLUMN);
+  lv_obj_set_style_pad_all(t, 15, 0);
+  lv_obj_set_style_pad_gap(t, 15, 0);
+  lv_obj_t *sb = lv_obj_create(t);
+  lv_obj_set_size(sb, 450, 60);
+  lv_obj_t *status = lv_label_create(sb);
+  lv_label_set_text(status, "Sistema Online");
+  lv_obj_center(status);
+  lv_obj_t *sg = lv_obj_create(t);
+  lv_obj_set_size(sg, 450, 140);
+  lv_obj_set_flex_flow(sg, LV_FLEX_FLOW_ROW_WRAP);
+  lv_obj_set_style_pad_gap(sg, 12, 0);
+  const char *scenes[] = {"CINE", "CENA", "NOCHE", "TODO OFF"};
+  for (uint8_t i = 0; i < 4; i++) {
+    lv_obj_t *b = lv_btn_create(sg);
+    lv_obj_set_size(b, 130, 45);
+    lv_obj_t *l = lv_label_create(b);
+    lv_label_set_text(l, scenes[i]);
+    lv_obj_center(l);
+  }
+}
+
+static void createZonePage(uint8_t idx, lv_obj_t *t) {
+  lv_obj_t *c = lv_obj_create(t);
+  lv_obj_set_size(c, 456, 170);
+  lv_obj_t *sl = lv_obj_create(c);
+  lv_obj_set_size(sl, 180, 130);
+  lv_obj_set_flex_flow(sl, LV_FLEX_FLOW_COLUMN);
+  lv_obj_t *tl = lv_label_create(sl);
+  lv_label_set_text(tl, "--C");
+  bindings.label(temp[idx], tl, "%sC");
+  lv_obj_t *hl = lv_label_create(sl);
+  lv_label_set_text(hl, "Hum: --%");
+  bindings.label(hum[idx], hl, "Hum: %s%%");
+  lv_obj_t *chart = lv_chart_create(sl);
+  lv_obj_set_size(chart, 176, 60);
+  HistoryCharts::style(chart);
+  charts.add(chart, lv_color_hex(0xFF9100), LV_CHART_AXIS_PRIMARY_Y,
+             &temps[idx]);
+  for (int i = 0; i < 2; i++) {
+    lv_obj_t *row = lightRowCreate(c, i ? "Luz 2" : "Luz 1");
+    lv_obj_set_pos(row, 214, 14 + i * (LIGHT_ROW_HEIGHT + 10));
+    if (i == 0)
+      bindings.toggle(light[idx], row);
+  }
+  lv_obj_t *sc = lv_obj_create(t);
+  lv_obj_set_size(sc, 456, 110);
+  lv_obj_clear_flag(sc, LV_OBJ_FLAG_SCROLLABLE);
+  for (uint8_t i = 0; i < 2; i++) {
+    lv_coord_t y = i * 45 + 22;
+    lv_obj_t *l = lv_label_create(sc);
+    lv_label_set_text(l, i ? "Persiana" : "LED");
+    lv_obj_align(l, LV_ALIGN_TOP_LEFT, 4, y - 8);
+    lv_obj_t *s = lv_slider_create(sc);
+    lv_obj_set_size(s, 250, 10);
+    lv_obj_align(s, LV_ALIGN_TOP_LEFT, 110, y - 5);
+  }
+}
+
+static void createUI() {
+  lv_obj_t *scr = lv_scr_act();
+  tabview = lv_tabview_create(scr, LV_DIR_TOP, 0);
+  lv_obj_set_size(tabview, HOR, 260);
+  lv_obj_set_pos(tabview, 0, 60);
+  lv_obj_clear_flag(lv_tabview_get_content(tabview), LV_OBJ_FLAG_SCROLLABLE);
+  createHomePage();
+  for (uint8_t i = 0; i < ZONES; i++) {
+    char name[8];
+    snprintf(name, sizeof(name), "Zona %u", i + 1);
+    lv_obj_t *t = lv_tabview_add_tab(tabview, name);
+    lv_obj_set_style_pad_all(t, 12, 0);
+    lv_obj_set_flex_flow(t, LV_FLEX_FLOW_COLUMN);
+    createZonePage(i, t);
+  }
+  lv_obj_t *nv = lv_obj_create(scr);
+  lv_obj_set_size(nv, HOR, 60);
+  lv_obj_set_flex_flow(nv, LV_FLEX_FLOW_ROW);
+  lv_obj_set_style_pad_gap(nv, 6, 0);
+  lv_obj_clear_flag(nv, LV_OBJ_FLAG_SCROLLABLE);
+  for (uint8_t i = 0; i <= ZONES && i < 5; i++) {
+    lv_obj_t *b = lv_btn_create(nv);
+    lv_obj_set_size(b, 85, 48);
+    lv_obj_t *l = lv_label_create(b);
+    lv_label_set_text(l, i ? "Z" : "HOME");
+    lv_obj_center(l);
+  }
+}
+
+// Zone 1 on screen, as the toggle and label cases need
+static void benchZone1() {
+  lv_tabview_set_act(tabview, 1, LV_ANIM_OFF);
+  lv_refr_now(NULL);
+}
+
+void setUp() {}
+void tearDown() {}
+
+// The whole screen, once per frame
+static void test_full_invalidate() {
+  uiBench.run("full_invalidate",
+              [](uint16_t) { lv_obj_invalidate(lv_scr_act()); });
+  TEST_ASSERT_EQUAL_UINT32(HOR * VER, uiBench.last().px);
+  TEST_ASSERT_EQUAL_UINT32(VER / 20, uiBench.last().flushes);
+}
+
+// The tab area, not the nav bar above it
+static void test_tab_switch() {
+  uiBench.run("tab_switch", [](uint16_t i) {
+    lv_tabview_set_act(tabview, (i + 1) % (ZONES + 1), LV_ANIM_OFF);
+  });
+  TEST_ASSERT_GREATER_THAN(0, uiBench.last().px);
+  TEST_ASSERT_LESS_THAN(HOR * VER, uiBench.last().px);
+}
+
+// A light toggled in HA redraws its row (and the theme's outline margin),
+// less than a band of the screen as high as the row
+static void test_switch_toggle() {
+  benchZone1();
+  uiBench.run("switch_toggle", [](uint16_t i) {
+    store.set(light[0], i & 1 ? "off" : "on");
+    bindings.refresh(store);
+  });
+  TEST_ASSERT_GREATER_THAN(0, uiBench.last().px);
+  TEST_ASSERT_LESS_THAN(HOR * LIGHT_ROW_HEIGHT, uiBench.last().px);
+}
+
+static void test_label_update() {
+  benchZone1();
+  uiBench.run("label_update", [](uint16_t i) {
+    char t[8];
+    snprintf(t, sizeof(t), "%u.%u", 20 + i % 5, i % 10);
+    store.set(temp[0], t);
+    bindings.refresh(store);
+  });
+  TEST_ASSERT_GREATER_THAN(0, uiBench.last().px);
+  TEST_ASSERT_LESS_THAN(HOR * 40, uiBench.last().px);
+}
+
+// Nothing changed, nothing drawn
+static void test_idle_frame_draws_nothing() {
+  benchZone1();
+  uiBench.run("idle", [](uint16_t) { bindings.refresh(store); });
+  TEST_ASSERT_EQUAL_UINT32(0, uiBench.last().px);
+  TEST_ASSERT_EQUAL_UINT32(0, uiBench.last().flushes);
+}
+
+int main(int, char **) {
+  lv_init();
+  lv_disp_draw_buf_init(&drawBuf, buf, NULL, HOR * 20);
+  lv_disp_drv_init(&drv);
+  drv.hor_res = HOR;
+  drv.ver_res = VER;
+  drv.flush_cb = flush;
+  drv.draw_buf = &drawBuf;
+  lv_disp_drv_register(&drv);
+
+  for (uint8_t i = 0; i < ZONES; i++) {
+    char id[32];
+    snprintf(id, sizeof(id), "light.zona%u", i + 1);
+    light[i] = store.intern(id, ENTITY_BOOL);
+    snprintf(id, sizeof(id), "sensor.zona%u_temp", i + 1);
+    temp[i] = store.intern(id, ENTITY_NUMBER);
+    snprintf(id, sizeof(id), "sensor.zona%u_hum", i + 1);
+    hum[i] = store.intern(id, ENTITY_NUMBER);
+    store.set(light[i], "off");
+    store.set(temp[i], "21.5");
+    store.set(hum[i], "48");
+  }
+  createUI();
+  bindings.refresh(store);
+  charts.refresh();
+  uiBench.begin("ha_control_host");
+
+  UNITY_BEGIN();
+  RUN_TEST(test_full_invalidate);
+  RUN_TEST(test_tab_switch);
+  RUN_TEST(test_switch_toggle);
+  RUN_TEST(test_label_update);
+  RUN_TEST(test_idle_frame_draws_nothing);
+  uiBench.end();
+  return UNITY_END();
+}
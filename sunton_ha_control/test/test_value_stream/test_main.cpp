@@ -0,0 +1,218 @@
+// ValueStream replaying slider drags against a simulated HA that takes
+// `latency` ms per service call: pio test -e native -f test_value_stream
+#include "value_stream.h"
+#include <stdio.h>
+#include <unity.h>
+
+#define TICK_MS 5   // loop() period
+#define EVENT_MS 16 // LV_EVENT_VALUE_CHANGED rate while dragging
+#define KEYS 2
+
+static ValueStream stream;
+
+// HA side: one pending completion per key, the value it applied last
+struct Ha {
+  uint32_t latency;
+  bool fail; // Calls come back with an error (still done())
+  uint32_t calls[KEYS];
+  uint32_t lastCall[KEYS];
+  uint32_t minGap[KEYS]; // Between calls of a key
+  uint8_t maxInFlight[KEYS];
+  uint8_t inFlight[KEYS];
+  uint32_t doneAt[KEYS];
+  int16_t sending[KEYS];
+  int16_t state[KEYS]; // Applied by HA, -1 before the first call
+  uint32_t settled[KEYS]; // When state last changed
+};
+
+static Ha ha;
+
+static void resetHa(uint32_t latency) {
+  ha = Ha();
+  ha.latency = latency;
+  for (uint8_t k = 0; k < KEYS; k++) {
+    ha.minGap[k] = 0xFFFFFFFF;
+    ha.state[k] = -1;
+  }
+}
+
+// One loop() pass: finished calls first, then what the stream hands out
+static void tick(uint32_t now) {
+  for (uint8_t k = 0; k < KEYS; k++) {
+    if (ha.inFlight[k] && now >= ha.doneAt[k]) {
+      ha.inFlight[k]--;
+      if (!ha.fail) {
+        ha.state[k] = ha.sending[k];
+        ha.settled[k] = now;
+      }
+      stream.done(k);
+    }
+  }
+  uint8_t key;
+  int16_t value;
+  while (stream.next(now, key, value)) {
+    if (ha.calls[key] && now - ha.lastCall[key] < ha.minGap[key])
+      ha.minGap[key] = now - ha.lastCall[key];
+    ha.calls[key]++;
+    ha.lastCall[key] = now;
+    ha.sending[key] = value;
+    ha.doneAt[key] = now + ha.latency;
+    if (++ha.inFlight[key] > ha.maxInFlight[key])
+      ha.maxInFlight[key] = ha.inFlight[key];
+  }
+}
+
+// Drags `key` from `from` to `to` over `ms` from `start` and lifts the
+// finger there, then runs the loop until `until`. Returns the release time.
+static uint32_t drag(uint8_t key, int16_t from, int16_t to, uint32_t ms,
+                     uint32_t until, uint32_t start = 0) {
+  uint32_t release = start + ms;
+  uint32_t nextEvent = start;
+  bool held = true;
+  for (uint32_t now = start; now <= until; now += TICK_MS) {
+    if (now < release && now >= nextEvent) {
+      int16_t v = from + (int32_t)(to - from) * (int32_t)(now - start) /
+                             (int32_t)ms;
+      stream.set(key, v, true);
+      nextEvent += EVENT_MS;
+    } else if (now >= release && held) {
+      stream.set(key, to, false); // LV_EVENT_RELEASED
+      held = false;
+    }
+    tick(now);
+  }
+  return release;
+}
+
+void setUp() { stream = ValueStream(); }
+
+void tearDown() {}
+
+static void test_fast_ha_gets_one_call_per_interval() {
+  resetHa(80);
+  uint32_t release = drag(0, 0, 100, 1000, 2000);
+  // 63 events in the drag; t = 0, 250, 500, 750 while held, then release
+  TEST_ASSERT_EQUAL_UINT32(5, ha.calls[0]);
+  TEST_ASSERT_GREATER_OR_EQUAL_UINT32(VALUE_STREAM_MS - TICK_MS,
+                                      ha.minGap[0]);
+  TEST_ASSERT_EQUAL_INT16(100, ha.state[0]);
+  TEST_ASSERT_EQUAL_UINT32(release, ha.lastCall[0]); // Not held back
+  TEST_ASSERT_EQUAL_UINT32(release + 80, ha.settled[0]);
+}
+
+static void test_slow_ha_keeps_one_call_in_flight() {
+  resetHa(600);
+  uint32_t release = drag(0, 0, 100, 1000, 3000);
+  TEST_ASSERT_EQUAL_UINT8(1, ha.maxInFlight[0]);
+  // t = 0, 600 while held; the release waits for the call of 600
+  TEST_ASSERT_EQUAL_UINT32(3, ha.calls[0]);
+  TEST_ASSERT_EQUAL_UINT32(1200, ha.lastCall[0]);
+  TEST_ASSERT_EQUAL_INT16(100, ha.state[0]);
+  TEST_ASSERT_EQUAL_UINT32(1800, ha.settled[0]);
+  TEST_ASSERT_LESS_OR_EQUAL_UINT32(release + 2 * 600, ha.settled[0]);
+}
+
+// Calls per drag and release-to-HA time across latencies: the final value
+// is never more than one call behind, and the call count drops as HA
+// slows down instead of queueing up
+static void test_latency_sweep() {
+  static const uint32_t latency[] = {20, 80, 150, 300, 600, 1200};
+  uint32_t lastCalls = 0xFFFFFFFF;
+  for (uint8_t i = 0; i < sizeof(latency) / sizeof(latency[0]); i++) {
+    stream = ValueStream();
+    resetHa(latency[i]);
+    uint32_t release = drag(0, 0, 100, 2000, 6000);
+    uint32_t settle = ha.settled[0] - release;
+    printf("HA %4lu ms: %2lu calls, %4lu ms release to state\n",
+           (unsigned long)latency[i], (unsigned long)ha.calls[0],
+           (unsigned long)settle);
+    TEST_ASSERT_EQUAL_INT16(100, ha.state[0]);
+    TEST_ASSERT_EQUAL_UINT8(1, ha.maxInFlight[0]);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(2 * latency[i] + TICK_MS, settle);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(lastCalls, ha.calls[0]);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(2000 / VALUE_STREAM_MS + 2,
+                                     ha.calls[0]);
+    lastCalls = ha.calls[0];
+  }
+}
+
+static void test_two_sliders_stream_independently() {
+  resetHa(300);
+  for (uint32_t now = 0; now <= 3000; now += TICK_MS) {
+    if (now < 1000 && now % EVENT_MS == 0) {
+      stream.set(0, now / 10, true);
+      stream.set(1, 100 - now / 10, true);
+    } else if (now == 1000) {
+      stream.set(0, 100, false);
+      stream.set(1, 0, false);
+    }
+    tick(now);
+  }
+  for (uint8_t k = 0; k < KEYS; k++) {
+    TEST_ASSERT_EQUAL_UINT8(1, ha.maxInFlight[k]);
+    TEST_ASSERT_EQUAL_UINT32(5, ha.calls[k]); // 0 300 600 900, release
+  }
+  TEST_ASSERT_EQUAL_INT16(100, ha.state[0]);
+  TEST_ASSERT_EQUAL_INT16(0, ha.state[1]);
+}
+
+static void test_tap_goes_out_at_once() {
+  resetHa(300);
+  stream.set(0, 40, false);
+  tick(0);
+  TEST_ASSERT_EQUAL_UINT32(1, ha.calls[0]);
+  for (uint32_t now = TICK_MS; now <= 1000; now += TICK_MS)
+    tick(now);
+  TEST_ASSERT_EQUAL_UINT32(1, ha.calls[0]); // Nothing left unsent
+  TEST_ASSERT_EQUAL_INT16(40, ha.state[0]);
+}
+
+static void test_failed_calls_are_not_retried() {
+  resetHa(100);
+  ha.fail = true;
+  drag(0, 0, 100, 1000, 2000);
+  TEST_ASSERT_EQUAL_UINT32(5, ha.calls[0]); // Same calls as when they work
+  TEST_ASSERT_EQUAL_INT16(-1, ha.state[0]);
+}
+
+static void test_unsent_call_is_due_again() {
+  uint8_t key;
+  int16_t value;
+  stream.set(0, 30, true);
+  TEST_ASSERT_TRUE(stream.next(0, key, value));
+  stream.done(0, false); // Command queue full
+  TEST_ASSERT_TRUE(stream.next(TICK_MS, key, value)); // Held or not
+  TEST_ASSERT_EQUAL_INT16(30, value);
+  stream.done(0);
+  TEST_ASSERT_FALSE(stream.next(2 * TICK_MS, key, value));
+}
+
+static void test_target_outlives_the_calls() {
+  int16_t value;
+  TEST_ASSERT_FALSE(stream.target(0, value));
+  resetHa(300);
+  drag(0, 0, 70, 500, 1500);
+  TEST_ASSERT_TRUE(stream.target(0, value));
+  TEST_ASSERT_EQUAL_INT16(70, value); // A rebuilt page shows this
+}
+
+static void test_slots_are_bounded() {
+  for (uint8_t k = 0; k < VALUE_STREAM_SLOTS; k++)
+    TEST_ASSERT_TRUE(stream.set(k, 50, false));
+  TEST_ASSERT_FALSE(stream.set(VALUE_STREAM_SLOTS, 50, false));
+  TEST_ASSERT_TRUE(stream.set(0, 60, true)); // Known keys still update
+}
+
+int main(int, char **) {
+  UNITY_BEGIN();
+  RUN_TEST(test_fast_ha_gets_one_call_per_interval);
+  RUN_TEST(test_slow_ha_keeps_one_call_in_flight);
+  RUN_TEST(test_latency_sweep);
+  RUN_TEST(test_two_sliders_stream_independently);
+  RUN_TEST(test_tap_goes_out_at_once);
+  RUN_TEST(test_failed_calls_are_not_retried);
+  RUN_TEST(test_unsent_call_is_due_again);
+  RUN_TEST(test_target_outlives_the_calls);
+  RUN_TEST(test_slots_are_bounded);
+  return UNITY_END();
+}
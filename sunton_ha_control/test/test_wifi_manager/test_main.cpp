@@ -0,0 +1,214 @@
+// WifiLink against a simulated radio and clock: link drops, backoff and
+// the cached AP. pio test -e native -f test_wifi_manager
+#include "wifi_manager.h"
+#include <chrono>
+#include <stdio.h>
+#include <unity.h>
+
+// Records connect attempts; the test decides when they succeed
+struct FakeRadio {
+  uint32_t scans = 0;
+  uint32_t cached = 0;
+  uint32_t disconnects = 0;
+  int32_t lastChannel = -1;
+  uint8_t lastBssid[6] = {0};
+  uint8_t ap[6] = {0x24, 0x0A, 0xC4, 0x11, 0x22, 0x33};
+  int32_t apChannel = 6;
+
+  void begin(const char *, const char *) { scans++; }
+  void begin(const char *, const char *, int32_t channel,
+             const uint8_t *bssid) {
+    cached++;
+    lastChannel = channel;
+    memcpy(lastBssid, bssid, sizeof(lastBssid));
+  }
+  void disconnect() { disconnects++; }
+  const uint8_t *bssid() { return ap; }
+  int32_t channel() { return apChannel; }
+  uint32_t attempts() const { return scans + cached; }
+};
+
+static WifiLink<FakeRadio> *link;
+static uint32_t ups, downs;
+
+static void onState(bool online) { (online ? ups : downs)++; }
+
+// Runs loop() every `step` ms from `from` up to `to`
+static void run(uint32_t from, uint32_t to, uint32_t step = 5) {
+  for (uint32_t t = from; t < to; t += step)
+    link->loop(t);
+}
+
+void setUp() {
+  link = new WifiLink<FakeRadio>();
+  ups = downs = 0;
+  link->begin("casa", "clave", onState, 0);
+}
+
+void tearDown() { delete link; }
+
+static void test_boot_scans_then_goes_online() {
+  TEST_ASSERT_EQUAL(WIFI_CONNECTING, link->state());
+  TEST_ASSERT_EQUAL(1, link->radio.scans);
+  run(0, 2500);
+  link->gotIp();
+  link->loop(2500);
+  TEST_ASSERT_TRUE(link->connected());
+  TEST_ASSERT_EQUAL(2500, link->lastOutage());
+  TEST_ASSERT_EQUAL(1, ups);
+  TEST_ASSERT_EQUAL(0, link->reconnects());
+}
+
+static void test_drop_reconnects_to_the_cached_ap_at_once() {
+  link->gotIp();
+  link->loop(2000);
+  link->lost();
+  link->loop(60000);
+  TEST_ASSERT_EQUAL(1, downs);
+  TEST_ASSERT_EQUAL(WIFI_CONNECTING, link->state());
+  TEST_ASSERT_EQUAL(1, link->radio.cached);
+  TEST_ASSERT_EQUAL(6, link->radio.lastChannel);
+  TEST_ASSERT_EQUAL_MEMORY(link->radio.ap, link->radio.lastBssid, 6);
+  link->gotIp();
+  link->loop(60350);
+  TEST_ASSERT_TRUE(link->connected());
+  TEST_ASSERT_EQUAL(350, link->lastOutage());
+  TEST_ASSERT_EQUAL(1, link->reconnects());
+  TEST_ASSERT_EQUAL(2, ups);
+}
+
+static void test_failed_attempts_back_off_up_to_the_max() {
+  // Every attempt is refused straight away; log when each one starts
+  uint32_t starts[12];
+  uint8_t n = 0;
+  uint32_t seen = link->radio.attempts();
+  for (uint32_t t = 0; t < 200000 && n < 12; t += 5) {
+    if (link->radio.attempts() != seen) {
+      seen = link->radio.attempts();
+      starts[n++] = t;
+    }
+    if (link->state() == WIFI_CONNECTING)
+      link->lost();
+    link->loop(t);
+  }
+  // 1 s after the first attempt, then 2 s, 4 s ... up to WIFI_BACKOFF_MAX;
+  // each refusal is seen one 5 ms step late
+  TEST_ASSERT_UINT32_WITHIN(10, WIFI_BACKOFF_MIN, starts[0]);
+  const uint32_t gaps[] = {2000, 4000, 8000, 16000, 30000, 30000, 30000};
+  for (uint8_t i = 0; i < 7; i++)
+    TEST_ASSERT_UINT32_WITHIN(10, gaps[i], starts[i + 1] - starts[i]);
+  TEST_ASSERT_EQUAL(0, link->radio.cached); // Never online: always scans
+}
+
+static void test_timeout_disconnects_and_retries() {
+  run(0, WIFI_CONNECT_TIMEOUT + 10);
+  TEST_ASSERT_EQUAL(1, link->radio.disconnects);
+  TEST_ASSERT_EQUAL(WIFI_OFFLINE, link->state());
+  run(WIFI_CONNECT_TIMEOUT + 10, WIFI_CONNECT_TIMEOUT + WIFI_BACKOFF_MIN + 20);
+  TEST_ASSERT_EQUAL(2, link->radio.scans);
+}
+
+static void test_cache_dropped_after_failed_cached_attempts() {
+  link->gotIp();
+  link->loop(1000);
+  link->lost(); // AP moved: cached attempts fail
+  uint32_t t = 1000;
+  for (; link->radio.cached < WIFI_CACHE_TRIES; t += 5) {
+    if (link->state() == WIFI_CONNECTING)
+      link->lost();
+    link->loop(t);
+  }
+  uint32_t scans = link->radio.scans;
+  for (; link->radio.attempts() == scans + WIFI_CACHE_TRIES; t += 5) {
+    if (link->state() == WIFI_CONNECTING)
+      link->lost();
+    link->loop(t);
+  }
+  TEST_ASSERT_EQUAL(scans + 1, link->radio.scans);
+  TEST_ASSERT_EQUAL(WIFI_CACHE_TRIES, link->radio.cached);
+}
+
+static void test_success_resets_the_backoff() {
+  for (uint32_t t = 0; link->radio.attempts() < 4; t += 5) {
+    if (link->state() == WIFI_CONNECTING)
+      link->lost();
+    link->loop(t);
+  }
+  link->gotIp();
+  link->loop(100000);
+  link->lost();
+  link->loop(200000);
+  link->lost(); // The cached attempt is refused
+  link->loop(200005);
+  uint32_t attempts = link->radio.attempts();
+  run(200010, 200010 + WIFI_BACKOFF_MIN + 10);
+  TEST_ASSERT_EQUAL(attempts + 1, link->radio.attempts());
+}
+
+// A day of flaky WiFi at 200 Hz: the AP drops every 10 minutes and comes
+// back 0.5-20 s later. loop() must never wait, so the UI never stalls, and
+// a reconnect should follow the AP within one backoff step.
+static void test_simulated_drops_never_stall_the_loop() {
+  const uint32_t frame = 5;
+  uint32_t worstLatency = 0, drops = 0;
+  double worstLoopUs = 0;
+  bool apUp = true;
+  uint32_t apBackAt = 0;
+  uint32_t seen = link->radio.attempts();
+  uint32_t pendingIpAt = 0; // Association + DHCP, 300 ms after an attempt
+  for (uint32_t t = 0; t < 24u * 3600 * 1000; t += frame) {
+    if (t % 600000 == 300000 && link->connected()) {
+      apUp = false;
+      apBackAt = t + 500 + (drops * 7919) % 19500;
+      drops++;
+      link->lost();
+    }
+    if (!apUp && t >= apBackAt)
+      apUp = true;
+    if (link->radio.attempts() != seen) {
+      seen = link->radio.attempts();
+      if (apUp)
+        pendingIpAt = t + 300;
+      else
+        link->lost(); // No AP: refused
+    }
+    if (pendingIpAt && t >= pendingIpAt) {
+      pendingIpAt = 0;
+      link->gotIp();
+    }
+    bool wasOnline = link->connected();
+    std::chrono::steady_clock::time_point t0 =
+        std::chrono::steady_clock::now();
+    link->loop(t);
+    double us = std::chrono::duration<double, std::micro>(
+                    std::chrono::steady_clock::now() - t0)
+                    .count();
+    if (us > worstLoopUs)
+      worstLoopUs = us;
+    if (!wasOnline && link->connected() && drops &&
+        link->lastOutage() > worstLatency)
+      worstLatency = link->lastOutage();
+  }
+  printf("%lu drops, %lu reconnects, worst outage %lu ms, "
+         "longest loop() %.1f us\n",
+         (unsigned long)drops, (unsigned long)link->reconnects(),
+         (unsigned long)worstLatency, worstLoopUs);
+  // The old connectWiFi() blocked for up to 10 s; allow for host jitter
+  TEST_ASSERT_TRUE(worstLoopUs < 50000);
+  TEST_ASSERT_EQUAL(drops, link->reconnects());
+  // Longest outage 20 s: retries at 0, 1, 3, 7, 15 and 31 s, plus 300 ms
+  // to get an address and a frame of slack per refused attempt
+  TEST_ASSERT_TRUE(worstLatency <= 31300 + 6 * frame);
+}
+
+int main(int, char **) {
+  UNITY_BEGIN();
+  RUN_TEST(test_boot_scans_then_goes_online);
+  RUN_TEST(test_drop_reconnects_to_the_cached_ap_at_once);
+  RUN_TEST(test_failed_attempts_back_off_up_to_the_max);
+  RUN_TEST(test_timeout_disconnects_and_retries);
+  RUN_TEST(test_cache_dropped_after_failed_cached_attempts);
+  RUN_TEST(test_success_resets_the_backoff);
+  RUN_TEST(test_simulated_drops_never_stall_the_loop);
+  return UNITY_END();
+}
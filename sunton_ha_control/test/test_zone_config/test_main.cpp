@@ -0,0 +1,253 @@
+// zoneConfigLoad parsing, and allocations per poll cycle once the config
+// is loaded: pio test -e native -f test_zone_config
+#include "poll_scheduler.h"
+#include "zone_config.h"
+#include <new>
+#include <stdio.h>
+#include <string>
+#include <unity.h>
+
+// Every heap allocation made while `counting`: operator new everywhere,
+// and malloc (ArduinoJson's allocator) where glibc lets us wrap it.
+static bool counting = false;
+static uint32_t allocs = 0;
+
+#ifdef __GLIBC__
+extern "C" void *__libc_malloc(size_t);
+extern "C" void *__libc_calloc(size_t, size_t);
+extern "C" void *__libc_realloc(void *, size_t);
+extern "C" void *malloc(size_t n) {
+  allocs += counting;
+  return __libc_malloc(n);
+}
+extern "C" void *calloc(size_t n, size_t size) {
+  allocs += counting;
+  return __libc_calloc(n, size);
+}
+extern "C" void *realloc(void *p, size_t n) {
+  allocs += counting;
+  return __libc_realloc(p, n);
+}
+#define NEW_COUNTS 0 // Counted by malloc
+#else
+#define NEW_COUNTS 1
+#endif
+
+void *operator new(size_t n) {
+  allocs += counting && NEW_COUNTS;
+  void *p = malloc(n);
+  if (!p)
+    throw std::bad_alloc();
+  return p;
+}
+void *operator new[](size_t n) { return operator new(n); }
+void operator delete(void *p) noexcept { free(p); }
+void operator delete[](void *p) noexcept { free(p); }
+void operator delete(void *p, size_t) noexcept { free(p); }
+void operator delete[](void *p, size_t) noexcept { free(p); }
+
+static const char ZONES[] = R"({
+  "zones": [
+    {"name": "Hab 1", "nav": "H1",
+     "lights": ["light.hab1_primaria", "light.hab1_secundaria"],
+     "led": "light.hab1_led", "covers": ["cover.persiana_hab1"],
+     "temp": "sensor.hab1_temperatura", "hum": "sensor.hab1_humedad"},
+    {"name": "Salón",
+     "lights": ["light.salon", "light.hab1_primaria", "nodot", "light.b",
+                "light.c"],
+     "covers": ["cover.a", "cover.b", "cover.c"]},
+    {"nav": "X", "temp": "sensor.exterior"}
+  ],
+  "scenes": [
+    {"name": "CINE", "id": "scene.modo_cine", "color": "#FF0000"},
+    {"name": "NOCHE", "id": "scene.noche"},
+    {"name": "MALA", "id": ""}
+  ]
+})";
+
+static ZoneConfig cfg;
+
+static int load(const char *json) {
+  return zoneConfigLoad(json, strlen(json) * 2 + 1024, cfg);
+}
+
+static uint8_t entity(const char *id) {
+  for (uint8_t i = 0; i < cfg.entityCount; i++)
+    if (strcmp(cfg.entities[i].id, id) == 0)
+      return i;
+  return ZONE_NONE;
+}
+
+void setUp() { zoneConfigClear(cfg); }
+void tearDown() {}
+
+static void test_zones_and_their_entities() {
+  TEST_ASSERT_EQUAL(3, load(ZONES));
+  const Zone &z = cfg.zones[0];
+  TEST_ASSERT_EQUAL_STRING("Hab 1", z.name);
+  TEST_ASSERT_EQUAL_STRING("H1", z.nav);
+  TEST_ASSERT_EQUAL(2, z.numLights);
+  TEST_ASSERT_EQUAL_STRING("light.hab1_primaria",
+                           cfg.entities[z.lights[0]].id);
+  TEST_ASSERT_EQUAL_STRING("light.hab1_led", cfg.entities[z.led].id);
+  TEST_ASSERT_EQUAL(1, z.numCovers);
+  TEST_ASSERT_EQUAL_STRING("sensor.hab1_humedad", cfg.entities[z.hum].id);
+}
+
+static void test_defaults_and_limits() {
+  TEST_ASSERT_EQUAL(3, load(ZONES));
+  const Zone &salon = cfg.zones[1];
+  TEST_ASSERT_EQUAL_STRING("Salón", salon.nav); // Defaults to the name
+  // The first ZONE_MAX_LIGHTS ids are read and "nodot" is skipped
+  TEST_ASSERT_EQUAL(2, salon.numLights);
+  TEST_ASSERT_EQUAL(entity("light.salon"), salon.lights[0]);
+  TEST_ASSERT_EQUAL(ZONE_NONE, entity("light.b"));
+  TEST_ASSERT_EQUAL(ZONE_MAX_COVERS, salon.numCovers);
+  TEST_ASSERT_EQUAL(ZONE_NONE, entity("cover.c"));
+  TEST_ASSERT_EQUAL(ZONE_NONE, salon.led);
+  TEST_ASSERT_EQUAL(ZONE_NONE, salon.temp);
+  TEST_ASSERT_EQUAL_STRING("?", cfg.zones[2].name);
+}
+
+static void test_ids_are_interned_once_with_shared_domains() {
+  TEST_ASSERT_EQUAL(3, load(ZONES));
+  // hab1_primaria is in two zones
+  TEST_ASSERT_EQUAL(cfg.zones[0].lights[0], cfg.zones[1].lights[1]);
+  const ZoneEntity &a = cfg.entities[entity("light.salon")];
+  const ZoneEntity &b = cfg.entities[entity("light.hab1_led")];
+  TEST_ASSERT_EQUAL_STRING("light", a.domain);
+  TEST_ASSERT_TRUE(a.domain == b.domain);
+  TEST_ASSERT_EQUAL_STRING("cover",
+                           cfg.entities[entity("cover.persiana_hab1")].domain);
+  TEST_ASSERT_EQUAL(-1, a.slot);
+}
+
+static void test_types_and_watched_flags() {
+  TEST_ASSERT_EQUAL(3, load(ZONES));
+  const ZoneEntity &light = cfg.entities[entity("light.salon")];
+  TEST_ASSERT_EQUAL(ENTITY_BOOL, light.type);
+  TEST_ASSERT_TRUE(light.watched);
+  TEST_ASSERT_FALSE(cfg.entities[entity("light.hab1_led")].watched);
+  TEST_ASSERT_FALSE(cfg.entities[entity("cover.a")].watched);
+  const ZoneEntity &temp = cfg.entities[entity("sensor.exterior")];
+  TEST_ASSERT_EQUAL(ENTITY_NUMBER, temp.type);
+  TEST_ASSERT_TRUE(temp.watched);
+  TEST_ASSERT_FALSE(cfg.entities[entity("scene.noche")].watched);
+}
+
+static void test_scenes() {
+  TEST_ASSERT_EQUAL(3, load(ZONES));
+  TEST_ASSERT_EQUAL(2, cfg.sceneCount); // The one without an id is dropped
+  TEST_ASSERT_EQUAL_STRING("CINE", cfg.scenes[0].name);
+  TEST_ASSERT_EQUAL(0xFF0000, cfg.scenes[0].color);
+  TEST_ASSERT_EQUAL(ZONE_SCENE_COLOR, cfg.scenes[1].color);
+  TEST_ASSERT_EQUAL_STRING("scene.noche",
+                           cfg.entities[cfg.scenes[1].entity].id);
+}
+
+static void test_zone_uses() {
+  TEST_ASSERT_EQUAL(3, load(ZONES));
+  TEST_ASSERT_TRUE(zoneUses(cfg.zones[0], entity("light.hab1_primaria")));
+  TEST_ASSERT_TRUE(zoneUses(cfg.zones[0], entity("sensor.hab1_humedad")));
+  TEST_ASSERT_FALSE(zoneUses(cfg.zones[0], entity("light.hab1_led")));
+  TEST_ASSERT_FALSE(zoneUses(cfg.zones[2], entity("light.salon")));
+}
+
+static void test_bad_json_keeps_nothing() {
+  TEST_ASSERT_EQUAL(-1, load("{\"zones\": [ {\"name\": "));
+  TEST_ASSERT_EQUAL(0, load("{}"));
+  TEST_ASSERT_EQUAL(0, cfg.entityCount);
+}
+
+static void test_full_pool_refuses_zones() {
+  std::string name(200, 'n');
+  uint8_t added = 0;
+  for (int i = 0; i < ZONE_MAX_ZONES; i++)
+    added += zoneConfigAddZone(cfg, name.c_str(), "", NULL, 0, "", NULL, 0,
+                               "", "");
+  TEST_ASSERT_EQUAL(ZONE_POOL_LEN / (name.size() + 1), added);
+  TEST_ASSERT_TRUE(cfg.poolUsed <= ZONE_POOL_LEN);
+}
+
+static void test_load_allocates_only_its_document() {
+  counting = true;
+  allocs = 0;
+  load(ZONES);
+  counting = false;
+#ifdef __GLIBC__
+  TEST_ASSERT_EQUAL(1, allocs); // The DynamicJsonDocument
+#else
+  TEST_ASSERT_EQUAL(0, allocs);
+#endif
+}
+
+// The REST poll as main.cpp runs it: the scheduler picks entities, the
+// /api/template reply is parsed through a filter into a document sized
+// once at boot (HaStateBatch), and states go to the store by the handles
+// interned at boot.
+static void test_poll_cycle_allocates_nothing() {
+  TEST_ASSERT_EQUAL(3, load(ZONES));
+  EntityStore store;
+  uint8_t watched[ZONE_MAX_ENTITIES];
+  uint8_t n = 0;
+  for (uint8_t i = 0; i < cfg.entityCount; i++) {
+    ZoneEntity &e = cfg.entities[i];
+    if (e.watched && (e.slot = store.intern(e.id, e.type)) >= 0)
+      watched[n++] = i;
+  }
+  TEST_ASSERT_EQUAL(6, n);
+
+  DynamicJsonDocument filter(2048), doc(4096);
+  std::string reply = "{";
+  for (uint8_t i = 0; i < n; i++) {
+    const char *id = cfg.entities[watched[i]].id;
+    filter[id]["state"] = true;
+    reply += std::string(i ? "," : "") + "\"" + id +
+             "\":{\"state\":\"0\",\"last_changed\":\"x\",\"extra\":[1,2]}";
+  }
+  reply += "}";
+
+  PollScheduler poller;
+  poller.begin(n);
+  for (uint8_t i = 0; i < n; i++) // The first zone's tab is open
+    poller.setVisible(i, zoneUses(cfg.zones[0], watched[i]));
+  bool want[ZONE_MAX_ENTITIES];
+  uint32_t polls = 0, sets = 0;
+  counting = true;
+  allocs = 0;
+  for (uint32_t now = 1000; now < 600000; now += 500) {
+    if (!poller.due(now, false, want))
+      continue;
+    reply[reply.find("\"state\":\"") + 9] = '0' + polls % 10;
+    if (deserializeJson(doc, reply.c_str(), reply.size(),
+                        DeserializationOption::Filter(filter)))
+      break;
+    for (uint8_t i = 0; i < n; i++) {
+      const ZoneEntity &e = cfg.entities[watched[i]];
+      if (want[i])
+        sets += store.set(e.slot, doc[e.id]["state"] | "");
+    }
+    doc.clear();
+    poller.polled(want, now);
+    polls++;
+  }
+  counting = false;
+  TEST_ASSERT_EQUAL(0, allocs);
+  TEST_ASSERT_TRUE(polls >= 100); // Every 5 s for the visible ones
+  TEST_ASSERT_TRUE(sets > 0);
+}
+
+int main(int, char **) {
+  UNITY_BEGIN();
+  RUN_TEST(test_zones_and_their_entities);
+  RUN_TEST(test_defaults_and_limits);
+  RUN_TEST(test_ids_are_interned_once_with_shared_domains);
+  RUN_TEST(test_types_and_watched_flags);
+  RUN_TEST(test_scenes);
+  RUN_TEST(test_zone_uses);
+  RUN_TEST(test_bad_json_keeps_nothing);
+  RUN_TEST(test_full_pool_refuses_zones);
+  RUN_TEST(test_load_allocates_only_its_document);
+  RUN_TEST(test_poll_cycle_allocates_nothing);
+  return UNITY_END();
+}
@@ -0,0 +1,310 @@
+// Zone pages built on first visit and evicted under memory pressure, with
+// 5 and 20 zones in a host LVGL heap: pio test -e native -f
+// test_zone_pages. Prints boot time, peak heap and tab-switch latency.
+// Also runs a failed command for a light whose page was evicted meanwhile.
+// The subset fonts are in src/, which host tests do not build
+#define ui_font_14 lv_font_montserrat_14
+#include "config.h"
+#include "entity_bindings.h"
+#include "ha_commands.h"
+#include "light_row.h"
+#include "zone_pages.h"
+#include <chrono>
+#include <stdio.h>
+#include <unity.h>
+
+#define HOR 480
+#define VER 320
+
+static lv_color_t buf[HOR * 20];
+static lv_disp_draw_buf_t drawBuf;
+static lv_disp_drv_t drv;
+
+static void flush(lv_disp_drv_t *d, const lv_area_t *, lv_color_t *) {
+  lv_disp_flush_ready(d);
+}
+
+static uint32_t micros() {
+  using namespace std::chrono;
+  return (uint32_t)duration_cast<microseconds>(
+             steady_clock::now().time_since_epoch())
+      .count();
+}
+
+static ZonePages pages;
+static lv_obj_t *home;
+static lv_obj_t *tabview;
+static lv_obj_t *tabs[ZONE_MAX_ZONES];
+static uint8_t zoneCount;
+static uint32_t evictions;
+static uint32_t peakUsed;
+static EntityStore store;
+static EntityBinder binder;
+static int16_t lights[2]; // Shown by the two light rows of every page
+
+static void heap(lv_mem_monitor_t &m) {
+  lv_mem_monitor(&m);
+  uint32_t used = m.total_size - m.free_size;
+  if (used > peakUsed)
+    peakUsed = used;
+}
+
+// The widgets of a zone page as main.cpp builds them: a card with the
+// sensor labels, a chart and two light rows, and a card with three sliders
+static void buildPage(lv_obj_t *t) {
+  lv_obj_t *c = lv_obj_create(t);
+  lv_obj_set_size(c, 456, 170);
+  lv_obj_t *sl = lv_obj_create(c);
+  lv_obj_set_size(sl, 180, 130);
+  lv_obj_set_flex_flow(sl, LV_FLEX_FLOW_COLUMN);
+  lv_label_set_text(lv_label_create(sl), "21.5C");
+  lv_label_set_text(lv_label_create(sl), "Hum: 48%");
+  lv_obj_t *chart = lv_chart_create(sl);
+  lv_obj_set_size(chart, 176, 60);
+  lv_chart_set_point_count(chart, 60);
+  lv_chart_add_series(chart, lv_color_hex(0xFF9100), LV_CHART_AXIS_PRIMARY_Y);
+  lv_chart_add_series(chart, lv_color_hex(0x00B0FF),
+                      LV_CHART_AXIS_SECONDARY_Y);
+  for (int i = 0; i < 2; i++) {
+    lv_obj_t *row = lightRowCreate(c, i ? "Luz 2" : "Luz 1");
+    lv_obj_set_pos(row, 214, 14 + i * (LIGHT_ROW_HEIGHT + 10));
+    binder.toggle(lights[i], row);
+  }
+  lv_obj_t *sc = lv_obj_create(t);
+  lv_obj_set_size(sc, 456, 140);
+  for (int i = 0; i < 3; i++) {
+    lv_label_set_text(lv_label_create(sc), i ? "Persiana" : "LED");
+    lv_obj_set_size(lv_slider_create(sc), 250, 10);
+    lv_label_set_text(lv_label_create(sc), "--");
+  }
+}
+
+// Deletes the least recently shown page other than `idx`; its index, or -1
+static int8_t evictFor(uint8_t idx) {
+  int8_t lru = pages.evict(idx);
+  if (lru >= 0) {
+    lv_obj_clean(tabs[lru]);
+    evictions++;
+  }
+  return lru;
+}
+
+// showZonePage() with lv_mem_monitor() for the heap report
+static void showZone(uint8_t idx, uint32_t now) {
+  if (!pages.visit(idx, now))
+    return;
+  lv_mem_monitor_t m;
+  for (;;) {
+    heap(m);
+    if (m.free_biggest_size >= ZONE_PAGE_RESERVE)
+      break;
+    if (evictFor(idx) < 0)
+      break;
+  }
+  buildPage(tabs[idx]);
+  heap(m);
+}
+
+// Tab switch from the nav bar to `tab`, drawn; returns its time in us
+static uint32_t switchTo(uint16_t tab, uint32_t now) {
+  uint32_t t0 = micros();
+  if (tab > 0)
+    showZone(tab - 1, now);
+  lv_tabview_set_act(tabview, tab, LV_ANIM_OFF);
+  lv_refr_now(NULL);
+  return micros() - t0;
+}
+
+// Screen with a tabview of HOME and `zones` empty zone tabs; returns the
+// time to build and draw it in us
+static uint32_t boot(uint8_t zones) {
+  uint32_t t0 = micros();
+  store = EntityStore();
+  binder = EntityBinder();
+  lights[0] = store.intern("light.salon", ENTITY_BOOL);
+  lights[1] = store.intern("light.cocina", ENTITY_BOOL);
+  store.set(lights[0], "off");
+  store.set(lights[1], "off");
+  lv_obj_t *scr = lv_obj_create(NULL);
+  lv_scr_load(scr);
+  tabview = lv_tabview_create(scr, LV_DIR_TOP, 0);
+  lv_obj_set_size(tabview, HOR, 260);
+  lv_tabview_add_tab(tabview, "HOME");
+  zoneCount = zones;
+  for (uint8_t i = 0; i < zones; i++) {
+    char name[8];
+    snprintf(name, sizeof(name), "Z%u", i + 1);
+    tabs[i] = lv_tabview_add_tab(tabview, name);
+    lv_obj_set_flex_flow(tabs[i], LV_FLEX_FLOW_COLUMN);
+  }
+  pages.begin(zones);
+  lv_refr_now(NULL);
+  return micros() - t0;
+}
+
+void setUp() {
+  evictions = 0;
+  peakUsed = 0;
+}
+
+void tearDown() {
+  lv_obj_t *scr = lv_scr_act();
+  if (scr != home) {
+    lv_scr_load(home);
+    lv_obj_del(scr);
+  }
+}
+
+static void test_build_on_first_visit_only() {
+  pages.begin(3);
+  TEST_ASSERT_TRUE(pages.visit(1, 100));
+  TEST_ASSERT_FALSE(pages.visit(1, 200));
+  TEST_ASSERT_TRUE(pages.built(1));
+  TEST_ASSERT_FALSE(pages.built(0));
+  TEST_ASSERT_EQUAL_UINT8(1, pages.builtCount());
+}
+
+static void test_evicts_least_recently_shown() {
+  pages.begin(4);
+  pages.visit(0, 100);
+  pages.visit(1, 200);
+  pages.visit(2, 300);
+  pages.visit(0, 400); // Zone 1 becomes the newest
+  TEST_ASSERT_EQUAL_INT8(1, pages.evict(3));
+  TEST_ASSERT_EQUAL_INT8(2, pages.evict(3));
+  TEST_ASSERT_EQUAL_INT8(0, pages.evict(3));
+  TEST_ASSERT_EQUAL_INT8(-1, pages.evict(3));
+  TEST_ASSERT_TRUE(pages.visit(1, 500)); // Rebuilt on the next visit
+}
+
+static void test_never_evicts_the_page_shown() {
+  pages.begin(2);
+  pages.visit(0, 100);
+  pages.visit(1, 200);
+  TEST_ASSERT_EQUAL_INT8(1, pages.evict(0));
+  TEST_ASSERT_EQUAL_INT8(-1, pages.evict(0));
+  TEST_ASSERT_TRUE(pages.built(0));
+}
+
+// millis() | 1 keeps a visit at time 0 from reading as "not built"
+static void test_visit_at_time_zero_counts() {
+  pages.begin(2);
+  pages.visit(0, 0);
+  TEST_ASSERT_TRUE(pages.built(0));
+  TEST_ASSERT_FALSE(pages.visit(0, 0));
+}
+
+// Every zone of `zones` shown twice in a row; reports the costs
+static void visitAll(uint8_t zones) {
+  uint32_t bootUs = boot(zones);
+  uint32_t worst = 0, total = 0, n = 0, now = 1000;
+  for (uint8_t round = 0; round < 2; round++) {
+    for (uint16_t tab = 0; tab <= zones; tab++) {
+      uint32_t us = switchTo(tab, now += 1000);
+      worst = us > worst ? us : worst;
+      total += us;
+      n++;
+      if (tab > 0) {
+        TEST_ASSERT_TRUE(pages.built(tab - 1));
+        TEST_ASSERT_GREATER_THAN(0, lv_obj_get_child_cnt(tabs[tab - 1]));
+      }
+    }
+  }
+  lv_mem_monitor_t m;
+  lv_mem_monitor(&m);
+  char line[160];
+  snprintf(line, sizeof(line),
+           "%u zones: boot %lu us, peak heap %lu of %lu B, switch mean %lu "
+           "us worst %lu us, %lu evictions, %u pages built",
+           zones, (unsigned long)bootUs, (unsigned long)peakUsed,
+           (unsigned long)m.total_size, (unsigned long)(total / n),
+           (unsigned long)worst, (unsigned long)evictions,
+           pages.builtCount());
+  TEST_MESSAGE(line);
+}
+
+// Five pages fit next to the reserve: nothing is built twice
+static void test_five_zones_stay_built() {
+  visitAll(5);
+  TEST_ASSERT_EQUAL_UINT32(0, evictions);
+  TEST_ASSERT_EQUAL_UINT8(5, pages.builtCount());
+}
+
+// More pages than fit: the old ones go and the heap keeps its reserve
+static void test_twenty_zones_evict() {
+  visitAll(20);
+  TEST_ASSERT_GREATER_THAN(0, evictions);
+  TEST_ASSERT_LESS_THAN(20, pages.builtCount());
+  lv_mem_monitor_t m;
+  lv_mem_monitor(&m);
+  TEST_ASSERT_GREATER_OR_EQUAL(ZONE_PAGE_RESERVE / 2, m.free_biggest_size);
+}
+
+// An evicted page comes back with all its widgets
+static void test_rebuilt_page_matches_first_build() {
+  boot(20);
+  switchTo(1, 1000);
+  uint32_t first = lv_obj_get_child_cnt(tabs[0]);
+  for (uint16_t tab = 2; tab <= 20 && pages.built(0); tab++)
+    switchTo(tab, 1000 + tab);
+  TEST_ASSERT_FALSE(pages.built(0));
+  switchTo(1, 5000);
+  TEST_ASSERT_EQUAL_UINT32(first, lv_obj_get_child_cnt(tabs[0]));
+}
+
+// The light row of zone 1 for `light`
+static lv_obj_t *zoneOneRow(uint8_t light) {
+  return lv_obj_get_child(lv_obj_get_child(tabs[0], 0), 1 + light);
+}
+
+// A switch flipped on zone 1, whose page goes while the call waits and
+// fails: the rollback goes through the store, writes nothing to the freed
+// rows and is shown by the rebuilt page
+static void test_failed_command_after_eviction() {
+  boot(3);
+  switchTo(1, 1000);
+  binder.refresh(store);
+  lv_obj_add_state(zoneOneRow(0), LV_STATE_CHECKED);
+  HaCommandQueue queue;
+  TEST_ASSERT_TRUE(
+      queue.post("light", "turn_on", "light.salon", lights[0], false));
+
+  switchTo(0, 2000);
+  TEST_ASSERT_EQUAL_INT8(0, evictFor(1));
+  TEST_ASSERT_FALSE(pages.built(0));
+
+  HaCommand cmd;
+  TEST_ASSERT_TRUE(queue.take(cmd));
+  TEST_ASSERT_FALSE(queue.finish());
+  store.restore(cmd.handle, cmd.rollback);
+  TEST_ASSERT_EQUAL_UINT8(0, binder.refresh(store));
+  TEST_ASSERT_EQUAL(LV_RES_OK, lv_mem_test());
+
+  switchTo(1, 3000);
+  TEST_ASSERT_EQUAL_UINT8(2, binder.refresh(store));
+  TEST_ASSERT_FALSE(lv_obj_has_state(zoneOneRow(0), LV_STATE_CHECKED));
+  TEST_ASSERT_FALSE(store.get(lights[0]).on);
+}
+
+int main(int, char **) {
+  lv_init();
+  lv_disp_draw_buf_init(&drawBuf, buf, NULL, HOR * 20);
+  lv_disp_drv_init(&drv);
+  drv.hor_res = HOR;
+  drv.ver_res = VER;
+  drv.flush_cb = flush;
+  drv.draw_buf = &drawBuf;
+  lv_disp_drv_register(&drv);
+  home = lv_scr_act();
+
+  UNITY_BEGIN();
+  RUN_TEST(test_build_on_first_visit_only);
+  RUN_TEST(test_evicts_least_recently_shown);
+  RUN_TEST(test_never_evicts_the_page_shown);
+  RUN_TEST(test_visit_at_time_zero_counts);
+  RUN_TEST(test_five_zones_stay_built);
+  RUN_TEST(test_twenty_zones_evict);
+  RUN_TEST(test_rebuilt_page_matches_first_build);
+  RUN_TEST(test_failed_command_after_eviction);
+  return UNITY_END();
+}
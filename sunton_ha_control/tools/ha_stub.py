@@ -0,0 +1,256 @@
+#!/usr/bin/env python3
+"""Stand-in Home Assistant for measuring the panel's polling on a LAN.
+
+Point HA_URL in secrets.h at this machine, flash, and compare the panel's
+"HA poll: ... ms, min heap ..." lines. The stub answers:
+
+  GET  /api/states/<entity_id>    one entity (per-entity polling)
+  POST /api/template              the batched template from ha_states.h
+  POST /api/services/<d>/<s>      always 200
+  GET  /api/websocket             auth + subscribe_entities (ha_ws.h)
+
+Templates are not rendered; the ids of the "ids" variable (or those inside
+expand([...]) for older firmware) are answered in the same shape the real
+template produces, and the requests per minute are printed. Every response is
+padded with the attributes a real HA state carries, so body sizes are
+realistic.
+
+WebSocket clients get the initial "a" event for their entities and then a
+"c" event every --ws-period seconds, or the events of --replay: a JSON
+lines file of {"dt": <seconds since previous>, "c": {...}} recorded from a
+real HA. Each push is logged with its send time, and the byte rate is
+printed when the client goes away.
+
+  ha_stub.py [--port 8123] [--delay-ms 20] [--replay events.jsonl]
+"""
+import argparse
+import base64
+import hashlib
+import json
+import random
+import re
+import select
+import struct
+import sys
+import time
+from datetime import datetime, timezone
+from http.server import BaseHTTPRequestHandler, ThreadingHTTPServer
+
+STATES = {}
+WS_GUID = "258EAFA5-E914-47DA-95CA-C5AB0DC85B11"
+
+
+def state_of(entity_id):
+    if entity_id not in STATES or random.random() < 0.2:
+        if "temperatura" in entity_id:
+            value = "%.1f" % random.uniform(18, 26)
+        elif "humedad" in entity_id:
+            value = str(random.randint(35, 65))
+        else:
+            value = random.choice(["on", "off"])
+        STATES[entity_id] = {
+            "entity_id": entity_id,
+            "state": value,
+            "attributes": {
+                "unit_of_measurement": "C",
+                "device_class": "temperature",
+                "friendly_name": entity_id.split(".")[-1].replace("_", " "),
+            },
+            "last_changed": datetime.now(timezone.utc).isoformat(),
+            "last_updated": datetime.now(timezone.utc).isoformat(),
+            "context": {"id": "01HZX" + "0" * 21, "parent_id": None,
+                        "user_id": None},
+        }
+    return STATES[entity_id]
+
+
+POLLS = {"start": time.time(), "requests": 0, "entities": 0}
+
+
+def count_poll(entities):
+    """Prints template requests and entities per minute, once a minute."""
+    POLLS["requests"] += 1
+    POLLS["entities"] += entities
+    elapsed = time.time() - POLLS["start"]
+    if elapsed >= 60:
+        print("polls: %.1f req/min, %.1f entities/min" %
+              (POLLS["requests"] * 60 / elapsed,
+               POLLS["entities"] * 60 / elapsed), file=sys.stderr)
+        POLLS.update(start=time.time(), requests=0, entities=0)
+
+
+def compressed(s):
+    return {"s": s["state"], "a": s["attributes"], "c": s["context"]["id"],
+            "lc": datetime.fromisoformat(s["last_changed"]).timestamp()}
+
+
+class WsConn:
+    def __init__(self, sock):
+        self.sock = sock
+        self.sent = 0
+
+    def send(self, obj):
+        data = json.dumps(obj).encode()
+        n = len(data)
+        if n < 126:
+            head = struct.pack("!BB", 0x81, n)
+        elif n < 65536:
+            head = struct.pack("!BBH", 0x81, 126, n)
+        else:
+            head = struct.pack("!BBQ", 0x81, 127, n)
+        self.sock.sendall(head + data)
+        self.sent += len(head) + n
+
+    def recv_exact(self, n):
+        buf = b""
+        while len(buf) < n:
+            chunk = self.sock.recv(n - len(buf))
+            if not chunk:
+                raise ConnectionError
+            buf += chunk
+        return buf
+
+    def recv(self):
+        """Returns (opcode, payload) of the next client frame."""
+        b0, b1 = self.recv_exact(2)
+        n = b1 & 0x7F
+        if n == 126:
+            n = struct.unpack("!H", self.recv_exact(2))[0]
+        elif n == 127:
+            n = struct.unpack("!Q", self.recv_exact(8))[0]
+        mask = self.recv_exact(4) if b1 & 0x80 else b"\0\0\0\0"
+        data = bytes(c ^ mask[i % 4] for i, c in enumerate(self.recv_exact(n)))
+        return b0 & 0x0F, data
+
+
+class Handler(BaseHTTPRequestHandler):
+    protocol_version = "HTTP/1.1"
+    disable_nagle_algorithm = True  # Headers and body go out separately
+    delay = 0.0
+    served = 0
+    ws_period = 5.0
+    replay = []
+
+    def reply(self, code, body):
+        data = body.encode()
+        time.sleep(self.delay)
+        self.send_response(code)
+        self.send_header("Content-Type", "application/json")
+        self.send_header("Content-Length", str(len(data)))
+        self.end_headers()
+        self.wfile.write(data)
+        Handler.served += len(data)
+
+    def do_GET(self):
+        if self.path == "/api/websocket":
+            return self.websocket()
+        if not self.path.startswith("/api/states/"):
+            return self.reply(404, "{}")
+        self.reply(200, json.dumps(state_of(self.path[12:])))
+
+    def do_POST(self):
+        body = self.rfile.read(int(self.headers.get("Content-Length", 0)))
+        if self.path == "/api/template":
+            req = json.loads(body)
+            ids = req.get("variables", {}).get("ids")
+            if ids is None:
+                m = re.search(r"expand\(\[(.*?)\]\)", req["template"])
+                ids = re.findall(r"'([^']+)'", m.group(1)) if m else []
+            count_poll(len(ids))
+            out = {}
+            for i in ids:
+                s = state_of(i)
+                out[i] = {"state": s["state"],
+                          "last_changed": s["last_changed"]}
+            return self.reply(200, json.dumps(out))
+        if self.path.startswith("/api/services/"):
+            return self.reply(200, "[]")
+        self.reply(404, "{}")
+
+    def websocket(self):
+        key = self.headers["Sec-WebSocket-Key"] + WS_GUID
+        accept = base64.b64encode(hashlib.sha1(key.encode()).digest())
+        self.send_response(101)
+        self.send_header("Upgrade", "websocket")
+        self.send_header("Connection", "Upgrade")
+        self.send_header("Sec-WebSocket-Accept", accept.decode())
+        self.end_headers()
+        self.close_connection = True
+
+        ws = WsConn(self.connection)
+        start = time.time()
+        ids, sub = [], None
+        events = iter(self.replay)
+        pending, next_at = None, None
+
+        def upcoming():
+            if self.replay:
+                return next(events, None)
+            return {"dt": self.ws_period,
+                    "c": {i: {"+": {"s": state_of(i)["state"]}}
+                          for i in random.sample(ids, 1)}}
+
+        ws.send({"type": "auth_required", "ha_version": "stub"})
+        try:
+            while True:
+                timeout = None if pending is None else \
+                    max(0, next_at - time.time())
+                ready, _, _ = select.select([self.connection], [], [], timeout)
+                if not ready:
+                    ws.send({"id": sub, "type": "event",
+                             "event": {"c": pending["c"]}})
+                    print("ws push at %.3f: %s" % (time.time(),
+                          json.dumps(pending["c"])), file=sys.stderr)
+                    pending = upcoming()
+                    if pending:
+                        next_at = time.time() + pending["dt"]
+                    continue
+                op, data = ws.recv()
+                if op == 0x8:
+                    break
+                if op == 0x9:
+                    self.connection.sendall(
+                        struct.pack("!BB", 0x8A, len(data)) + data)
+                    continue
+                msg = json.loads(data)
+                if msg.get("type") == "auth":
+                    ws.send({"type": "auth_ok", "ha_version": "stub"})
+                elif msg.get("type") == "subscribe_entities":
+                    sub, ids = msg["id"], msg["entity_ids"]
+                    ws.send({"id": sub, "type": "result", "success": True,
+                             "result": None})
+                    ws.send({"id": sub, "type": "event", "event": {
+                        "a": {i: compressed(state_of(i)) for i in ids}}})
+                    pending = upcoming() if ids else None
+                    if pending:
+                        next_at = time.time() + pending["dt"]
+        except (ConnectionError, OSError):
+            pass
+        secs = max(time.time() - start, 1e-3)
+        print("ws closed after %.0f s: %d bytes, %.0f B/h" %
+              (secs, ws.sent, ws.sent * 3600 / secs), file=sys.stderr)
+
+    def log_message(self, fmt, *args):
+        print("%s  (%d bytes served)" % (fmt % args, Handler.served),
+              file=sys.stderr)
+
+
+def main():
+    ap = argparse.ArgumentParser()
+    ap.add_argument("--port", type=int, default=8123)
+    ap.add_argument("--delay-ms", type=float, default=0,
+                    help="server think time added to every response")
+    ap.add_argument("--ws-period", type=float, default=5,
+                    help="seconds between random WebSocket changes")
+    ap.add_argument("--replay", help="JSON lines of recorded \"c\" events")
+    args = ap.parse_args()
+    Handler.delay = args.delay_ms / 1000
+    Handler.ws_period = args.ws_period
+    if args.replay:
+        with open(args.replay) as f:
+            Handler.replay = [json.loads(line) for line in f if line.strip()]
+    ThreadingHTTPServer(("", args.port), Handler).serve_forever()
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,226 @@
+#!/usr/bin/env python3
+"""MQTT transport (ha_mqtt.h) against a local broker, compared with REST.
+
+With a Mosquitto broker on this machine standing in for HA, the benchmark
+plays both sides: an "HA" client publishes mqtt_statestream updates and a
+"panel" client subscribed to the same topics as the firmware receives them.
+Each update is sent only after the previous one arrived, and its latency
+and size on the wire (the PUBLISH packet) are recorded. With --rest, the
+same entities are read with GET /api/states/<id> over one keep-alive
+connection (ha_stub.py or a real HA) and measured the same way: request
+plus response bytes, excluding TCP/IP overhead on both sides.
+
+  mqtt_bench.py [--broker 127.0.0.1] [--count 500] [--rest http://127.0.0.1:8123]
+
+With --ha it instead acts as the HA side for a flashed panel: it answers
+commands on the command topics with the resulting state, as the README
+automation would, and changes a random sensor every --period seconds.
+
+  mqtt_bench.py --ha [--period 5]
+
+Only the parts of MQTT 3.1.1 used here are implemented (QoS 0, no TLS).
+"""
+import argparse
+import random
+import socket
+import struct
+import sys
+import time
+from urllib.parse import urlparse
+
+STATE_PREFIX = "homeassistant/statestream"  # config.h HA_MQTT_STATE_PREFIX
+CMD_PREFIX = "delfin/cmd"                    # config.h HA_MQTT_CMD_PREFIX
+ENTITIES = ["sensor.hab%d_%s" % (i, kind) for i in (1, 2, 3)
+            for kind in ("temperatura", "humedad")] + \
+    ["sensor.salon_temperatura", "sensor.salon_humedad",
+     "input_boolean.alarma"]
+TOKEN = "x" * 183  # Length of a long-lived HA token
+
+
+def utf8(s):
+    data = s.encode()
+    return struct.pack("!H", len(data)) + data
+
+
+def state_topic(entity_id):
+    return "%s/%s/state" % (STATE_PREFIX, entity_id.replace(".", "/", 1))
+
+
+def random_state(entity_id):
+    if "temperatura" in entity_id:
+        return "%.1f" % random.uniform(18, 26)
+    if "humedad" in entity_id:
+        return str(random.randint(35, 65))
+    return random.choice(["on", "off"])
+
+
+class Mqtt:
+    def __init__(self, host, port, client_id):
+        self.sock = socket.create_connection((host, port))
+        self.sock.setsockopt(socket.IPPROTO_TCP, socket.TCP_NODELAY, 1)
+        self.buf = b""
+        self.send(0x10, utf8("MQTT") + b"\x04\x02" + struct.pack("!H", 60) +
+                  utf8(client_id))
+        kind, body, _ = self.read()
+        if kind != 0x20 or body[1] != 0:
+            sys.exit("broker refused %s" % client_id)
+
+    def send(self, head, body):
+        n, length = len(body), b""
+        while True:
+            n, digit = n >> 7, n & 0x7F
+            length += bytes([digit | (0x80 if n else 0)])
+            if not n:
+                break
+        self.sock.sendall(bytes([head]) + length + body)
+
+    def recv_exact(self, n):
+        while len(self.buf) < n:
+            chunk = self.sock.recv(65536)
+            if not chunk:
+                raise ConnectionError("broker closed the connection")
+            self.buf += chunk
+        data, self.buf = self.buf[:n], self.buf[n:]
+        return data
+
+    def read(self):
+        """Returns (packet type, body, packet size in bytes)."""
+        head = self.recv_exact(1)[0]
+        n, shift, size = 0, 0, 1
+        while True:
+            digit = self.recv_exact(1)[0]
+            n, shift, size = n | (digit & 0x7F) << shift, shift + 7, size + 1
+            if not digit & 0x80:
+                break
+        return head & 0xF0, self.recv_exact(n), size + n
+
+    def read_publish(self):
+        """Returns (topic, payload, packet size) of the next PUBLISH."""
+        while True:
+            kind, body, size = self.read()
+            if kind == 0x30:
+                n = struct.unpack("!H", body[:2])[0]
+                return body[2:2 + n].decode(), body[2 + n:], size
+
+    def publish(self, topic, payload, retain=False):
+        self.send(0x30 | (1 if retain else 0), utf8(topic) + payload.encode())
+
+    def subscribe(self, topics):
+        self.send(0x82, struct.pack("!H", 1) +
+                  b"".join(utf8(t) + b"\x00" for t in topics))
+        while self.read()[0] != 0x90:
+            pass
+
+
+def summary(name, latencies, sizes):
+    latencies.sort()
+    p99 = latencies[max(0, (len(latencies) * 99 + 99) // 100 - 1)]
+    print("%s: %d updates, mean %.2f ms, p99 %.2f ms, %.0f B/update" %
+          (name, len(latencies), 1000 * sum(latencies) / len(latencies),
+           1000 * p99, sum(sizes) / len(sizes)))
+
+
+def bench_mqtt(args):
+    ha = Mqtt(args.broker, args.port, "bench-ha")
+    panel = Mqtt(args.broker, args.port, "bench-panel")
+    panel.subscribe([state_topic(e) for e in ENTITIES])
+    # Retained states from earlier runs arrive first
+    panel.sock.settimeout(0.2)
+    try:
+        while True:
+            panel.read_publish()
+    except socket.timeout:
+        pass
+    panel.sock.settimeout(None)
+
+    latencies, sizes = [], []
+    for _ in range(args.count):
+        entity = random.choice(ENTITIES)
+        t0 = time.perf_counter()
+        ha.publish(state_topic(entity), random_state(entity), retain=True)
+        while True:
+            topic, _, size = panel.read_publish()
+            if topic == state_topic(entity):
+                break
+        latencies.append(time.perf_counter() - t0)
+        sizes.append(size)
+    summary("mqtt", latencies, sizes)
+
+
+def bench_rest(args):
+    url = urlparse(args.rest)
+    sock = socket.create_connection((url.hostname, url.port or 80))
+    sock.setsockopt(socket.IPPROTO_TCP, socket.TCP_NODELAY, 1)
+    stream = sock.makefile("rb")
+    latencies, sizes = [], []
+    for _ in range(args.count):
+        entity = random.choice(ENTITIES)
+        req = ("GET /api/states/%s HTTP/1.1\r\nHost: %s\r\n"
+               "Authorization: Bearer %s\r\nConnection: keep-alive\r\n\r\n" %
+               (entity, url.netloc, TOKEN)).encode()
+        t0 = time.perf_counter()
+        sock.sendall(req)
+        size, length = len(req), 0
+        while True:
+            line = stream.readline()
+            size += len(line)
+            if line.lower().startswith(b"content-length:"):
+                length = int(line.split(b":")[1])
+            if line in (b"\r\n", b""):
+                break
+        size += len(stream.read(length))
+        latencies.append(time.perf_counter() - t0)
+        sizes.append(size)
+    summary("rest", latencies, sizes)
+
+
+def stand_in(args):
+    ha = Mqtt(args.broker, args.port, "bench-ha-stand-in")
+    states = {e: random_state(e) for e in ENTITIES}
+    for entity, state in states.items():
+        ha.publish(state_topic(entity), state, retain=True)
+    ha.subscribe([CMD_PREFIX + "/#"])
+    ha.sock.settimeout(args.period)
+    while True:
+        try:
+            topic, payload, size = ha.read_publish()
+        except socket.timeout:
+            sensors = [e for e in ENTITIES if e.startswith("sensor.")]
+            entity = random.choice(sensors)
+            states[entity] = random_state(entity)
+        else:
+            # <prefix>/<domain>/<object_id>/set, "<domain>.<service>"
+            domain, object_id = topic.split("/")[-3:-1]
+            entity = domain + "." + object_id
+            service = payload.decode().split(".")[-1]
+            if service == "toggle":
+                on = states.get(entity) != "on"
+            else:
+                on = service == "turn_on"
+            states[entity] = "on" if on else "off"
+            print("cmd at %.3f: %s %s (%d bytes)" %
+                  (time.time(), entity, payload.decode(), size),
+                  file=sys.stderr)
+        ha.publish(state_topic(entity), states[entity], retain=True)
+
+
+def main():
+    ap = argparse.ArgumentParser()
+    ap.add_argument("--broker", default="127.0.0.1")
+    ap.add_argument("--port", type=int, default=1883)
+    ap.add_argument("--count", type=int, default=500)
+    ap.add_argument("--rest", help="HA or ha_stub.py URL to compare with")
+    ap.add_argument("--ha", action="store_true",
+                    help="act as HA for a panel built with the mqtt env")
+    ap.add_argument("--period", type=float, default=5,
+                    help="seconds between random sensor changes (--ha)")
+    args = ap.parse_args()
+    if args.ha:
+        return stand_in(args)
+    bench_mqtt(args)
+    if args.rest:
+        bench_rest(args)
+
+
+if __name__ == "__main__":
+    main()
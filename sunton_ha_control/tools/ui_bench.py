@@ -0,0 +1,146 @@
+#!/usr/bin/env python3
+"""Collects and compares the render benchmark of the LVGL panels.
+
+A firmware built with the "bench" environment (lib/ui_bench) runs
+its scripted cases once at boot and prints one "BENCH {...}" JSON line per
+case, then "BENCH end". capture reads them from the serial port (pyserial)
+or from a saved monitor log, and writes a JSON file tagged with the git
+commit:
+
+  ui_bench.py capture /dev/ttyACM0 -o bench.json [--history bench.jsonl]
+  ui_bench.py capture monitor.log -o bench.json
+
+--history appends the run as one line, to follow the numbers across
+commits. compare prints the change per case between two runs and exits
+with 1 when a frame got slower than --threshold percent, or drew more
+pixels, so it can gate a change:
+
+  ui_bench.py compare base.json bench.json [--threshold 10]
+
+Works with the three LVGL panels (sunton_ha_control, sunton_ha_panel,
+sunton_s3_touch_panel); the "ui" field tells them apart.
+"""
+import argparse
+import json
+import os
+import subprocess
+import sys
+import time
+
+PREFIX = "BENCH "
+END = "BENCH end"
+
+
+def parse_lines(lines):
+    results = {}
+    for line in lines:
+        line = line.strip()
+        if line == END:
+            break
+        if not line.startswith(PREFIX):
+            continue
+        try:
+            r = json.loads(line[len(PREFIX):])
+        except ValueError:
+            continue  # Cut by a reset or mixed with other output
+        results["%s/%s" % (r.pop("ui"), r.pop("case"))] = r
+    return results
+
+
+def serial_lines(port, baud, timeout):
+    import serial  # pyserial, only needed for a live board
+    deadline = time.time() + timeout
+    with serial.Serial(port, baud, timeout=1) as s:
+        while time.time() < deadline:
+            line = s.readline().decode(errors="replace")
+            if line:
+                sys.stdout.write(line)
+                yield line
+                if line.strip() == END:
+                    return
+    sys.exit("no \"%s\" within %d s; is the bench firmware flashed?" %
+             (END, timeout))
+
+
+def git_commit():
+    try:
+        return subprocess.check_output(
+            ["git", "rev-parse", "--short", "HEAD"],
+            stderr=subprocess.DEVNULL).decode().strip()
+    except (OSError, subprocess.CalledProcessError):
+        return None
+
+
+def capture(args):
+    if os.path.isfile(args.source):
+        with open(args.source, errors="replace") as f:
+            results = parse_lines(f)
+    else:
+        results = parse_lines(serial_lines(args.source, args.baud,
+                                           args.timeout))
+    if not results:
+        sys.exit("no BENCH lines found")
+    run = {"commit": git_commit(), "time": int(time.time()),
+           "results": results}
+    with open(args.output, "w") as f:
+        json.dump(run, f, indent=1, sort_keys=True)
+    if args.history:
+        with open(args.history, "a") as f:
+            f.write(json.dumps(run, sort_keys=True) + "\n")
+    print("%d cases -> %s" % (len(results), args.output))
+
+
+def change(old, new):
+    return (new - old) * 100.0 / old if old else 0.0
+
+
+def compare(args):
+    with open(args.base) as f:
+        base = json.load(f)
+    with open(args.new) as f:
+        new = json.load(f)
+    print("%s -> %s" % (base.get("commit"), new.get("commit")))
+    print("%-36s %9s %9s %7s %9s %9s" %
+          ("case", "mean_us", "was", "change", "px", "was"))
+    worse = []
+    for case in sorted(set(base["results"]) | set(new["results"])):
+        b = base["results"].get(case)
+        n = new["results"].get(case)
+        if not b or not n:
+            print("%-36s %s" % (case, "new" if n else "gone"))
+            continue
+        pct = change(b["mean_us"], n["mean_us"])
+        flag = ""
+        if pct > args.threshold or n["px"] > b["px"]:
+            flag = "  <-- slower" if pct > args.threshold else "  <-- more px"
+            worse.append(case)
+        print("%-36s %9d %9d %+6.1f%% %9d %9d%s" %
+              (case, n["mean_us"], b["mean_us"], pct, n["px"], b["px"],
+               flag))
+    if worse:
+        print("%d case(s) regressed" % len(worse))
+        sys.exit(1)
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    sub = ap.add_subparsers(dest="cmd", required=True)
+    c = sub.add_parser("capture", help="read BENCH lines from a port or log")
+    c.add_argument("source", help="serial port or saved log file")
+    c.add_argument("-o", "--output", default="bench.json")
+    c.add_argument("--history", help="JSON lines file to append the run to")
+    c.add_argument("--baud", type=int, default=115200)
+    c.add_argument("--timeout", type=int, default=120)
+    c.set_defaults(func=capture)
+    d = sub.add_parser("compare", help="compare two captured runs")
+    d.add_argument("base")
+    d.add_argument("new")
+    d.add_argument("--threshold", type=float, default=10.0,
+                   help="allowed frame time increase, percent")
+    d.set_defaults(func=compare)
+    args = ap.parse_args()
+    args.func(args)
+
+
+if __name__ == "__main__":
+    main()
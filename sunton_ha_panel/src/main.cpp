@@ -1,21 +1,57 @@
+#include "axs_touch.h"
+#include "boot_seq.h"
+#include "entity_bindings.h"
+#include "entity_store.h"
+#include "ha_client.h"
+#include "ha_commands.h"
 #include "secrets.h"
+#include "touch_irq.h"
+#include "wifi_manager.h"
 #include <Arduino.h>
 #include <ArduinoJson.h>
 #include <Arduino_GFX_Library.h>
-#include <HTTPClient.h>
 #include <WiFi.h>
 #include <Wire.h>
 #include <lvgl.h>
 
+// HA transport: 0 = REST + WebSocket, 1 = MQTT (env "mqtt")
+#ifndef HA_TRANSPORT_MQTT
+#define HA_TRANSPORT_MQTT 0
+#endif
+#if HA_TRANSPORT_MQTT
+#include "ha_mqtt.h"
+#else
+#include "ha_ws.h"
+#endif
+
+// Scripted render benchmark at boot (env "bench"), see ui_bench.h
+#ifndef UI_BENCH
+#define UI_BENCH 0
+#endif
+#if UI_BENCH
+#include "ui_bench.h"
+UiBench uiBench;
+#endif
+
+// Touch-to-photon latency and fps (env "trace"), see latency_trace.h
+#ifndef LATENCY_TRACE
+#define LATENCY_TRACE 0
+#endif
+#include "latency_trace.h"
+#if LATENCY_TRACE
+LatencyTrace latTrace;
+#endif
+
 // Pin definitions
 #define GFX_BL 1
-#define TOUCH_ADDR 0x3B
 #define TOUCH_SDA 4
 #define TOUCH_SCL 8
 #define TOUCH_I2C_CLOCK 400000
 #define TOUCH_RST_PIN 12
-#define TOUCH_INT_PIN 11
-#define AXS_MAX_TOUCH_NUMBER 1
+#define TOUCH_INT_PIN 11 // -1 polls the controller instead
+
+AxsTouch axs;
+TouchIrq touch;
 
 // GFX Setup
 Arduino_ESP32QSPI *bus = new Arduino_ESP32QSPI(45, 47, 21, 48, 40, 39);
@@ -35,193 +71,164 @@ lv_obj_t *hum_label;
 lv_obj_t *status_label;
 lv_obj_t *light_switch;
 
-// Periodic HA update
+// Periodic HA update (REST fallback while the push transport is down)
 unsigned long lastHAUpdate = 0;
 const unsigned long HA_UPDATE_INTERVAL = 5000;
 
+// Entities
+#define ENTITY_TEMP "sensor.temperatura_andrea_temperature"
+#define ENTITY_HUM "sensor.temperatura_andrea_humidity"
+#define ENTITY_ALARM "input_boolean.alarma"
+const char *const haEntities[] = {ENTITY_TEMP, ENTITY_HUM, ENTITY_ALARM};
+const uint8_t HA_ENTITY_COUNT = sizeof(haEntities) / sizeof(haEntities[0]);
+EntityStore store;
+EntityBinder bindings;
+#if HA_TRANSPORT_MQTT
+HaMqtt haPush;
+#else
+HaWebSocket haPush;
+#endif
+HaClient ha;          // REST fallback poll, on the command worker task
+HaClient haCmdClient; // Used by the command worker task only
+HaCommandWorker haCmd;
+WifiManager wifi;
+
+// Boot phases, see boot_seq.h. The touch controller comes out of reset on
+// a task while the UI is built; input hands it to the touch task once both
+// are up. wifi and sync are only timed, and sync is skipped when wifi
+// failed. Same order as the boot.add() calls in setup().
+enum {
+  PHASE_DISPLAY,
+  PHASE_TOUCH,
+  PHASE_UI,
+  PHASE_INPUT,
+  PHASE_HA,
+  PHASE_WIFI,
+  PHASE_SYNC,
+};
+BootSeq boot;
+volatile bool touchReady = false; // Set by bootInput()
+
 // Display flush callback
+uint32_t flushAreas = 0; // Since the last status line
+
 void my_disp_flush(lv_disp_drv_t *disp, const lv_area_t *area,
                    lv_color_t *color_p) {
   uint32_t w = (area->x2 - area->x1 + 1);
   uint32_t h = (area->y2 - area->y1 + 1);
   gfx->draw16bitBeRGBBitmap(area->x1, area->y1, (uint16_t *)&color_p->full, w,
                             h);
+  flushAreas++;
+#if UI_BENCH
+  uiBench.flushed(area);
+#endif
+  LAT_FLUSHED(disp);
   lv_disp_flush_ready(disp);
 }
 
-// Touch sensing logic (original manual I2C)
-bool getTouchPoint(uint16_t &x, uint16_t &y) {
-  uint8_t data[(AXS_MAX_TOUCH_NUMBER * 6 + 2)] = {0};
-  const uint8_t read_cmd[11] = {
-      0xb5,
-      0xab,
-      0xa5,
-      0x5a,
-      0x00,
-      0x00,
-      (uint8_t)((AXS_MAX_TOUCH_NUMBER * 6 + 2) >> 8),
-      (uint8_t)((AXS_MAX_TOUCH_NUMBER * 6 + 2) & 0xff),
-      0x00,
-      0x00,
-      0x00};
-
-  Wire.beginTransmission(TOUCH_ADDR);
-  Wire.write(read_cmd, 11);
-  if (Wire.endTransmission() != 0)
-    return false;
-
-  if (Wire.requestFrom((uint16_t)TOUCH_ADDR, (uint8_t)sizeof(data)) !=
-      (uint8_t)sizeof(data))
-    return false;
-  for (int i = 0; i < (int)sizeof(data); i++)
-    data[i] = Wire.read();
-
-  if (data[1] > 0 && data[1] <= AXS_MAX_TOUCH_NUMBER) {
-    uint16_t rawX = ((data[2] & 0x0F) << 8) | data[3];
-    uint16_t rawY = ((data[4] & 0x0F) << 8) | data[5];
-    if (rawX > 500 || rawY > 500)
-      return false;
-    // Map to screen orientation
-    y = map(rawX, 0, 320, 320, 0);
-    x = rawY;
-    return true;
-  }
-  return false;
-}
+// Touch controller read for the touch task: 1 touched, 0 none, -1 bus error
+int8_t getTouchPoint(uint16_t &x, uint16_t &y) { return axs.readPoint(x, y); }
 
-// Touch read callback for LVGL
+// Touch read callback for LVGL: events come from the touch task
 void my_touchpad_read(lv_indev_drv_t *indev_driver, lv_indev_data_t *data) {
-  uint16_t touchX, touchY;
-  if (getTouchPoint(touchX, touchY)) {
-    data->state = LV_INDEV_STATE_PR;
-    data->point.x = touchX;
-    data->point.y = touchY;
-  } else {
-    data->state = LV_INDEV_STATE_REL;
-  }
+  if (!touchReady)
+    return;
+  touch.read(data);
+  LAT_TOUCH(touch.last().us, touch.last().pressed); // From the INT edge
 }
 
 // HA Helpers
-void connectWiFi() {
-  Serial.print("WiFi: ");
-  WiFi.begin(WIFI_SSID, WIFI_PASS);
-  int counter = 0;
-  while (WiFi.status() != WL_CONNECTED && counter < 20) {
-    delay(500);
-    Serial.print(".");
-    counter++;
-  }
-  if (WiFi.status() == WL_CONNECTED) {
-    Serial.println("OK");
-    // Test base API
-    WiFiClient client;
-    HTTPClient http;
-    String url = String(HA_URL);
-    url.trim();
-    url += "/api/";
-    Serial.print("Testing HA API: [");
-    Serial.print(url);
-    Serial.println("]");
-    if (http.begin(client, url)) {
-      http.addHeader("Authorization", "Bearer " + String(HA_TOKEN));
-      int code = http.GET();
-      Serial.print("HA API Resp: ");
-      Serial.println(code);
-      if (code == 200)
-        Serial.println("API Logic: OK");
-      else
-        Serial.println(
-            "API Logic: FAIL (Check if 'api:' is in configuration.yaml)");
-      http.end();
-    }
-  } else {
-    Serial.println("FAIL");
+// From wifi.loop() on every link change
+void onWifi(bool online) {
+  haCmd.online(online); // Commands wait in the queue while offline
+  if (online && boot.running(PHASE_WIFI))
+    boot.complete(PHASE_WIFI);
+  if (!online) {
+    lv_label_set_text(status_label, "Reconectando...");
+    lv_obj_set_style_text_color(status_label, lv_color_hex(0xFF0000), 0);
+    return;
   }
+  lastHAUpdate = millis() - HA_UPDATE_INTERVAL; // Refresh right away
 }
 
-void callHAService(const char *domain, const char *service,
-                   const char *entity_id) {
+// Runs on the command worker task
+int callHAService(const char *domain, const char *service,
+                  const char *entity_id) {
   if (WiFi.status() != WL_CONNECTED)
-    return;
+    return -1;
 
-  WiFiClient client;
-  HTTPClient http;
-  String url = String(HA_URL);
-  url.trim();
-  url += "/api/services/" + String(domain) + "/" + String(service);
-
-  Serial.print("HA Service URL: [");
-  Serial.print(url);
-  Serial.println("]");
-  if (http.begin(client, url)) {
-    http.addHeader("Authorization", "Bearer " + String(HA_TOKEN));
-    http.addHeader("Content-Type", "application/json");
-
-    StaticJsonDocument<256> doc;
-    doc["entity_id"] = entity_id;
-    String body;
-    serializeJson(doc, body);
-
-    int code = http.POST(body);
-    Serial.print("HA Service Resp: ");
-    Serial.println(code);
-    if (code < 0) {
-      Serial.print("HTTP Error: ");
-      Serial.println(http.errorToString(code).c_str());
-    }
-    http.end();
-  } else {
+  Serial.printf("HA Service: %s/%s %s\n", domain, service, entity_id);
+  int code = haCmdClient.callService(domain, service, entity_id);
+  Serial.print("HA Service Resp: ");
+  Serial.println(code);
+  if (code < 0)
     Serial.println("HA Service: Unable to connect");
-  }
+  return code;
+}
+
+int execCommand(const HaCommand &cmd) {
+#if HA_TRANSPORT_MQTT
+  if (haPush.command(cmd.domain, cmd.service, cmd.entity))
+    return 200; // Taken by the broker
+#endif
+  return callHAService(cmd.domain, cmd.service, cmd.entity);
 }
 
-String getEntityState(const char *entity_id) {
+// Through the store, so no widget pointer waits in the command queue; the
+// binding redraws the switch
+// Back on the UI thread: undo the switch if HA did not take the change
+void onCommandDone(const HaResult &r) {
+  if (r.code >= 200 && r.code < 300)
+    return;
+  lv_label_set_text(status_label, "Error HA");
+  lv_obj_set_style_text_color(status_label, lv_color_hex(0xFF0000), 0);
+  if (r.cmd.handle >= 0 && !r.superseded)
+    store.restore(r.cmd.handle, r.cmd.rollback);
+}
+
+// Runs on the command worker task; false when HA did not answer with the
+// state
+bool getEntityState(const char *entity_id, char *state, size_t size) {
   if (WiFi.status() != WL_CONNECTED)
-    return "err";
-
-  WiFiClient client;
-  HTTPClient http;
-  String url = String(HA_URL);
-  url.trim();
-  url += "/api/states/" + String(entity_id);
-
-  Serial.print("HA GetState URL: [");
-  Serial.print(url);
-  Serial.println("]");
-  String state = "err";
-  if (http.begin(client, url)) {
-    http.addHeader("Authorization", "Bearer " + String(HA_TOKEN));
-    int code = http.GET();
-    Serial.print("HA GetState Resp: ");
-    Serial.println(code);
-    if (code == 200) {
-      String payload = http.getString();
-      DynamicJsonDocument doc(2048);
-      deserializeJson(doc, payload);
-      state = doc["state"].as<String>();
-      Serial.print("Entity: ");
-      Serial.print(entity_id);
-      Serial.print(" State: ");
-      Serial.println(state);
-    } else if (code < 0) {
-      Serial.print("HTTP Error: ");
-      Serial.println(http.errorToString(code).c_str());
+    return false;
+
+  char path[96];
+  snprintf(path, sizeof(path), "/api/states/%s", entity_id);
+  bool ok = false;
+  int code = ha.get(path);
+  Serial.print("HA GetState Resp: ");
+  Serial.println(code);
+  if (code == 200) {
+    StaticJsonDocument<64> filter;
+    filter["state"] = true;
+    StaticJsonDocument<128> doc;
+    if (!deserializeJson(doc, ha.body(),
+                         DeserializationOption::Filter(filter))) {
+      strlcpy(state, doc["state"] | "", size);
+      ok = true;
     }
-    http.end();
-  } else {
+    Serial.print("Entity: ");
+    Serial.print(entity_id);
+    Serial.print(" State: ");
+    Serial.println(ok ? state : "err");
+  } else if (code == 401 || code == 404) {
+    Serial.println("HA GetState: check the token and 'api:' in "
+                   "configuration.yaml");
+  } else if (code < 0) {
     Serial.println("HA GetState: Unable to connect");
   }
-  return state;
+  ha.end();
+  return ok;
 }
 
 // LVGL Event
 void alarm_switch_event(lv_event_t *e) {
   lv_obj_t *sw = lv_event_get_target(e);
-  if (lv_obj_has_state(sw, LV_STATE_CHECKED)) {
-    callHAService("input_boolean", "turn_on", "input_boolean.alarma");
-  } else {
-    callHAService("input_boolean", "turn_off", "input_boolean.alarma");
-  }
+  bool on = lv_obj_has_state(sw, LV_STATE_CHECKED);
+  int16_t h = store.find(ENTITY_ALARM);
+  if (!haCmd.post("input_boolean", on ? "turn_on" : "turn_off", ENTITY_ALARM,
+                  h, !on))
+    store.restore(h, !on);
 }
 
 // LVGL UI Creation
@@ -249,6 +256,7 @@ void createUI() {
   temp_label = lv_label_create(temp_panel);
   lv_label_set_text(temp_label, "--. -");
   lv_obj_align(temp_label, LV_ALIGN_CENTER, 0, 10);
+  bindings.label(store.intern(ENTITY_TEMP, ENTITY_NUMBER), temp_label, "%s°C");
 
   // Humidity Panel
   lv_obj_t *hum_panel = lv_obj_create(screen);
@@ -260,6 +268,7 @@ void createUI() {
   hum_label = lv_label_create(hum_panel);
   lv_label_set_text(hum_label, "--%");
   lv_obj_align(hum_label, LV_ALIGN_CENTER, 0, 10);
+  bindings.label(store.intern(ENTITY_HUM, ENTITY_NUMBER), hum_label, "%s%%");
 
   // Alarm Switch
   lv_obj_t *alarm_panel = lv_obj_create(screen);
@@ -272,57 +281,136 @@ void createUI() {
   lv_obj_align(light_switch, LV_ALIGN_RIGHT_MID, -20, 0);
   lv_obj_add_event_cb(light_switch, alarm_switch_event, LV_EVENT_VALUE_CHANGED,
                       NULL);
+  bindings.toggle(store.intern(ENTITY_ALARM, ENTITY_BOOL), light_switch);
 }
 
+// A state from the WebSocket or from a REST poll; the widgets follow in
+// loop() through the bindings
+void onHaState(const char *entity_id, const char *state) {
+  store.set(entity_id, state);
+  if (boot.running(PHASE_SYNC))
+    boot.complete(PHASE_SYNC); // First state from HA
+}
+
+// REST fallback while the push transport is down: one entity per slice on
+// the command worker, so loop() never waits on HA. pollDone() hands the
+// states to the store on loop().
+struct StatePoll {
+  uint8_t next;
+  bool ok[HA_ENTITY_COUNT];
+  char state[HA_ENTITY_COUNT][ENTITY_STATE_LEN];
+};
+StatePoll statePoll;
+bool statePolling = false;
+
+bool pollStep(void *) {
+  StatePoll &p = statePoll;
+  uint8_t i = p.next++;
+  p.ok[i] = getEntityState(haEntities[i], p.state[i], sizeof(p.state[i]));
+  return p.next < HA_ENTITY_COUNT;
+}
+
+void pollDone(void *) {
+  for (uint8_t i = 0; i < HA_ENTITY_COUNT; i++)
+    if (statePoll.ok[i])
+      onHaState(haEntities[i], statePoll.state[i]);
+  uint32_t mean, p99;
+  ha.stats(mean, p99); // The worker is done with `ha` until the next job
+  Serial.printf("HA rest: mean %lu ms, p99 %lu ms, %lu connects\n",
+                (unsigned long)mean, (unsigned long)p99,
+                (unsigned long)ha.connects());
+  statePolling = false;
+}
+
+uint32_t widgetUpdates = 0; // Since the last status line
+uint32_t loopMaxMs = 0;     // Longest loop() iteration, same period
+
 void updateHA() {
   if (millis() - lastHAUpdate < HA_UPDATE_INTERVAL)
     return;
   lastHAUpdate = millis();
-
-  if (WiFi.status() == WL_CONNECTED) {
+  static uint32_t touchReads = 0;
+  Serial.printf("UI: %lu widget updates, %lu flushed areas, max loop %lu ms\n",
+                (unsigned long)widgetUpdates, (unsigned long)flushAreas,
+                (unsigned long)loopMaxMs);
+  Serial.printf("Touch: %lu reads (%s), %lu events dropped\n",
+                (unsigned long)(touch.reads() - touchReads),
+                touch.mode() == TOUCH_IRQ ? "irq" : "poll",
+                (unsigned long)touch.dropped());
+  touchReads = touch.reads();
+  widgetUpdates = flushAreas = loopMaxMs = 0;
+
+  if (wifi.connected()) {
     lv_label_set_text(status_label, "Conectado");
     lv_obj_set_style_text_color(status_label, lv_color_hex(0x00FF00), 0);
-
-    String t = getEntityState("sensor.temperatura_andrea_temperature");
-    if (t != "err")
-      lv_label_set_text_fmt(temp_label, "%s°C", t.c_str());
-
-    String h = getEntityState("sensor.temperatura_andrea_humidity");
-    if (h != "err")
-      lv_label_set_text_fmt(hum_label, "%s%%", h.c_str());
-
-    String l = getEntityState("input_boolean.alarma");
-    if (l == "on")
-      lv_obj_add_state(light_switch, LV_STATE_CHECKED);
-    else
-      lv_obj_clear_state(light_switch, LV_STATE_CHECKED);
+    if (haPush.ready()) {
+      Serial.printf("HA push: %lu updates, %llu B/h\n",
+                    (unsigned long)haPush.updates(),
+                    (uint64_t)haPush.bytesReceived() * 3600000 / millis());
+      return;
+    }
+    if (!statePolling) {
+      memset(&statePoll, 0, sizeof(statePoll));
+      statePolling = haCmd.job(pollStep, pollDone, NULL);
+    }
   } else {
-    lv_label_set_text(status_label, "Reconectando...");
-    lv_obj_set_style_text_color(status_label, lv_color_hex(0xFF0000), 0);
-    connectWiFi();
+    Serial.printf("WiFi: offline, %lu reconnects so far\n",
+                  (unsigned long)wifi.reconnects());
   }
 }
 
-void setup() {
-  Serial.begin(115200);
+#if UI_BENCH
+void runUiBench() {
+  uiBench.begin("ha_panel");
+  uiBench.run("full_invalidate",
+              [](uint16_t) { lv_obj_invalidate(lv_scr_act()); });
+  uiBench.run("switch_toggle", [](uint16_t i) {
+    store.set(ENTITY_ALARM, i & 1 ? "off" : "on");
+    bindings.refresh(store);
+  });
+  uiBench.run("label_update", [](uint16_t i) {
+    char t[8];
+    snprintf(t, sizeof(t), "%u.%u", 20 + i % 5, i % 10);
+    store.set(ENTITY_TEMP, t);
+    bindings.refresh(store);
+  });
+  uiBench.end();
+}
+#endif
 
-  gfx->begin();
+bool bootDisplay() {
+  if (!gfx->begin()) {
+    Serial.println("Gfx FAIL");
+    return false;
+  }
   gfx->setRotation(1);
   gfx->fillScreen(0x0000);
 
   pinMode(GFX_BL, OUTPUT);
   digitalWrite(GFX_BL, HIGH);
+  return true;
+}
 
-  // Initialize touch hardware
+bool bootTouch() {
   Wire.begin(TOUCH_SDA, TOUCH_SCL);
   Wire.setClock(TOUCH_I2C_CLOCK);
-  pinMode(TOUCH_INT_PIN, INPUT_PULLUP);
   pinMode(TOUCH_RST_PIN, OUTPUT);
   digitalWrite(TOUCH_RST_PIN, LOW);
   delay(200);
   digitalWrite(TOUCH_RST_PIN, HIGH);
   delay(200);
+  axs.begin(axsCal(1, 480, 320));
+  return true;
+}
+
+// On the loop task, so the INT pin interrupt is set up on the UI core
+bool bootInput() {
+  touch.begin(getTouchPoint, TOUCH_INT_PIN); // Only this task uses Wire now
+  touchReady = true;
+  return true;
+}
 
+bool bootUi() {
   lv_init();
   lv_disp_draw_buf_init(&draw_buf, buf, NULL, screenWidth * 20);
 
@@ -338,16 +426,68 @@ void setup() {
   lv_indev_drv_init(&indev_drv);
   indev_drv.type = LV_INDEV_TYPE_POINTER;
   indev_drv.read_cb = my_touchpad_read;
+  LAT_INDEV(indev_drv);
   lv_indev_drv_register(&indev_drv);
 
-  connectWiFi();
-  lastHAUpdate = millis() - HA_UPDATE_INTERVAL; // Force immediate update
   createUI();
+#if UI_BENCH
+  runUiBench();
+#endif
+  LAT_BEGIN("ha_panel");
+  lv_refr_now(NULL);
+  gfx->flush();
+  return true;
+}
+
+// After the UI, which interns the entities in the store
+bool bootHa() {
+  ha.begin(HA_URL, HA_TOKEN);
+  haCmdClient.begin(HA_URL, HA_TOKEN);
+  wifi.begin(WIFI_SSID, WIFI_PASS, onWifi); // Connects from loop()
+#if HA_TRANSPORT_MQTT
+  haPush.begin(MQTT_SERVER, MQTT_USER, MQTT_PASS, haEntities, HA_ENTITY_COUNT,
+               onHaState);
+#else
+  haPush.begin(HA_URL, HA_TOKEN, haEntities, HA_ENTITY_COUNT, onHaState);
+#endif
+  haCmd.begin(execCommand, onCommandDone);
+  haCmd.online(false);
+  return true;
+}
+
+void setup() {
+  Serial.begin(115200);
+  boot.add("display", BOOT_MAIN, bootDisplay);
+  boot.add("touch", BOOT_TASK, bootTouch);
+  boot.add("ui", BOOT_MAIN, bootUi, BOOT_BIT(PHASE_DISPLAY));
+  boot.add("input", BOOT_MAIN, bootInput, 0,
+           BOOT_BIT(PHASE_TOUCH) | BOOT_BIT(PHASE_UI));
+  boot.add("ha", BOOT_MAIN, bootHa, BOOT_BIT(PHASE_UI));
+  boot.add("wifi", BOOT_EXTERNAL, NULL, BOOT_BIT(PHASE_HA));
+  boot.add("sync", BOOT_EXTERNAL, NULL, 0, BOOT_BIT(PHASE_WIFI));
+  // The loop below never runs without a UI; the touch reset may still be
+  // going on
+  while (!boot.ended(PHASE_HA)) {
+    boot.poll();
+    delay(1);
+  }
 }
 
 void loop() {
+  static uint32_t lastLoop = millis();
+  uint32_t now = millis();
+  loopMaxMs = max(loopMaxMs, now - lastLoop);
+  lastLoop = now;
+
+  boot.poll();
+  wifi.loop();
   lv_timer_handler();
   gfx->flush(); // Send canvas to display
+  LAT_PRESENTED();
+  if (wifi.connected())
+    haPush.loop();
+  haCmd.poll();
+  widgetUpdates += bindings.refresh(store);
   updateHA();
   delay(5);
 }
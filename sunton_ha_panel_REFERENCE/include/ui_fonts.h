@@ -0,0 +1,14 @@
+// Generated by scripts/font_subset.py, do not edit.
+// Glyphs: 0x20-0x7E,0xA1,0xB0,0xBF,0xC1,0xC9,0xCD,0xD1,0xD3,0xDA,0xDC,0xE1,0xE9,0xED,0xF1,0xF3,0xFA,0xFC
+//
+// Forced into every file, LVGL's own included (-include in
+// platformio.ini), so the subset fonts replace Montserrat as the default
+// and are declared wherever lvgl.h is.
+
+#ifndef UI_FONTS_H
+#define UI_FONTS_H
+
+#define LV_FONT_DEFAULT &ui_font_14
+#define LV_FONT_CUSTOM_DECLARE LV_FONT_DECLARE(ui_font_14)
+
+#endif
@@ -0,0 +1,231 @@
+// TouchSampler replaying interrupt and I2C traces, recorded and simulated:
+// pio test -e native -f test_touch_sampler
+#include "touch_irq.h"
+#include <stdio.h>
+#include <unity.h>
+#include <vector>
+
+static TouchSampler s;
+static std::vector<TouchEvent> events;
+static uint32_t reads;
+
+// A trace as logged on the panel, one line per interrupt edge ("edge")
+// or controller read ("read" and its result, then x y when touched):
+// a tap on (120, 80) that slides 2 px, and a bus error in between.
+static const char *const tapTrace = "1000000 edge\n"
+                                    "1000180 read 1 120 80\n"
+                                    "1010200 read 1 120 80\n"
+                                    "1020210 read 1 122 80\n"
+                                    "1030190 read -1\n"
+                                    "1040200 read 1 122 80\n"
+                                    "1050230 read 0\n";
+
+static void replay(const char *trace) {
+  char line[64];
+  const char *p = trace;
+  while (*p) {
+    size_t n = strcspn(p, "\n");
+    snprintf(line, sizeof(line), "%.*s", (int)n, p);
+    p += n + (p[n] == '\n');
+    unsigned long us;
+    char what[8];
+    int res = 0;
+    unsigned x = 0, y = 0;
+    if (sscanf(line, "%lu %7s %d %u %u", &us, what, &res, &x, &y) < 2)
+      continue;
+    if (strcmp(what, "edge") == 0) {
+      s.edge(us);
+      continue;
+    }
+    TouchEvent ev;
+    reads++;
+    if (s.sample(us, res, x, y, ev))
+      events.push_back(ev);
+  }
+}
+
+// A finger on the panel from `down` to `up` (us), moving `dx` px every
+// 10 ms from (x, y)
+struct Finger {
+  uint32_t down;
+  uint32_t up;
+  uint16_t x;
+  uint16_t y;
+  int16_t dx;
+};
+
+#define WAKE_US 150 // Edge to the task reading, as measured on the panel
+
+// What the controller answers at `us`
+static int8_t touchAt(const std::vector<Finger> &f, uint32_t us,
+                      uint16_t &x, uint16_t &y) {
+  for (const Finger &g : f) {
+    if (us >= g.down && us < g.up) {
+      x = g.x + g.dx * (int32_t)((us - g.down) / 10000);
+      y = g.y;
+      return 1;
+    }
+  }
+  return 0;
+}
+
+// The controller pulls the line low on a touch and on the release
+static bool edgeIn(const std::vector<Finger> &f, uint32_t from, uint32_t to,
+                   uint32_t &at) {
+  bool found = false;
+  for (const Finger &g : f) {
+    const uint32_t e[2] = {g.down, g.up};
+    for (uint32_t t : e) {
+      if (t > from && t <= to && (!found || t < at)) {
+        at = t;
+        found = true;
+      }
+    }
+  }
+  return found;
+}
+
+// TouchIrq::run() against simulated fingers until `end` (us), with the
+// line wired or not. The stuck-line check is left out: no I2C there.
+static void simulate(const std::vector<Finger> &f, bool wired, uint32_t end) {
+  uint32_t now = 0;
+  while (now < end) {
+    uint32_t ms = s.wait();
+    uint32_t deadline = now + (ms ? ms : TOUCH_STUCK_MS / 2) * 1000;
+    uint32_t edge = 0;
+    if (wired && edgeIn(f, now, deadline, edge)) {
+      s.edge(edge);
+      now = edge + WAKE_US;
+    } else {
+      now = deadline;
+      if (!ms)
+        continue; // Idle, waiting for the line
+    }
+    uint16_t x = 0, y = 0;
+    int8_t res = touchAt(f, now, x, y);
+    reads++;
+    TouchEvent ev;
+    if (s.sample(now, res, x, y, ev))
+      events.push_back(ev);
+  }
+}
+
+void setUp() {
+  s = TouchSampler();
+  events.clear();
+  reads = 0;
+}
+void tearDown() {}
+
+// The press carries the edge time, not the read's; later events their read
+static void test_trace_events_and_times() {
+  s.begin(true);
+  replay(tapTrace);
+  TEST_ASSERT_EQUAL_UINT32(6, reads);
+  TEST_ASSERT_EQUAL(3, events.size());
+  TEST_ASSERT_EQUAL_UINT32(1000000, events[0].us);
+  TEST_ASSERT_TRUE(events[0].pressed);
+  TEST_ASSERT_EQUAL_UINT16(120, events[0].x);
+  TEST_ASSERT_EQUAL_UINT32(1020210, events[1].us); // Moved
+  TEST_ASSERT_EQUAL_UINT16(122, events[1].x);
+  TEST_ASSERT_EQUAL_UINT32(1050230, events[2].us);
+  TEST_ASSERT_FALSE(events[2].pressed);
+  TEST_ASSERT_EQUAL_UINT16(122, events[2].x); // Released where it was
+  TEST_ASSERT_EQUAL(TOUCH_IRQ, s.mode());
+  TEST_ASSERT_EQUAL_UINT32(0, s.wait()); // Asleep until the next edge
+}
+
+// A touch read with no edge before it: the line is not wired
+static void test_trace_without_edges_falls_back_to_polling() {
+  s.begin(true);
+  replay("20000 read 0\n40000 read 0\n60000 read 1 10 10\n80000 read 0\n");
+  TEST_ASSERT_EQUAL(TOUCH_POLL, s.mode());
+  TEST_ASSERT_EQUAL(2, events.size());
+  TEST_ASSERT_EQUAL_UINT32(60000, events[0].us);
+  TEST_ASSERT_EQUAL_UINT32(TOUCH_POLL_MS, s.wait());
+}
+
+// Until the first edge the line is untested and the task polls
+static void test_probe_polls_until_first_edge() {
+  s.begin(true);
+  TEST_ASSERT_EQUAL(TOUCH_PROBE, s.mode());
+  TEST_ASSERT_EQUAL_UINT32(TOUCH_POLL_MS, s.wait());
+  s.edge(5000);
+  TEST_ASSERT_EQUAL(TOUCH_IRQ, s.mode());
+  TEST_ASSERT_EQUAL_UINT32(TOUCH_ACTIVE_MS, s.wait());
+}
+
+// Without a pin an edge changes nothing
+static void test_no_pin_polls() {
+  s.begin(false);
+  s.edge(1000);
+  TEST_ASSERT_EQUAL(TOUCH_POLL, s.mode());
+  TEST_ASSERT_EQUAL_UINT32(TOUCH_POLL_MS, s.wait());
+}
+
+// A minute with three taps: no reads while untouched, presses stamped at
+// the edge, releases seen within one active period
+static void test_wired_reads_only_while_touched() {
+  std::vector<Finger> f = {{2000000, 2120000, 100, 100, 0},
+                           {15000000, 15300000, 200, 50, 3},
+                           {40000000, 40080000, 400, 300, 0}};
+  s.begin(true);
+  simulate(f, true, 60000000);
+  uint32_t touchedMs = 120 + 300 + 80;
+  // First tap found by probing, then one read per active period per tap
+  TEST_ASSERT_LESS_OR_EQUAL(2000 / TOUCH_POLL_MS + touchedMs /
+                                TOUCH_ACTIVE_MS + 2 * 3,
+                            reads);
+  TEST_ASSERT_EQUAL(TOUCH_IRQ, s.mode());
+  uint8_t presses = 0;
+  for (size_t i = 0; i < events.size(); i++) {
+    const TouchEvent &e = events[i];
+    if (e.pressed && (i == 0 || !events[i - 1].pressed)) {
+      TEST_ASSERT_EQUAL_UINT32(f[presses].down, e.us);
+      presses++;
+    } else if (!e.pressed) {
+      uint32_t up = f[presses - 1].up;
+      TEST_ASSERT_GREATER_OR_EQUAL(up, e.us);
+      TEST_ASSERT_LESS_OR_EQUAL(up + TOUCH_ACTIVE_MS * 1000 + WAKE_US, e.us);
+    }
+  }
+  TEST_ASSERT_EQUAL_UINT8(3, presses);
+}
+
+// The sliding finger reports a move per active period
+static void test_wired_drag_moves() {
+  std::vector<Finger> f = {{1000000, 1300000, 200, 50, 3}};
+  s.begin(true);
+  simulate(f, true, 2000000);
+  uint32_t moves = 0;
+  for (size_t i = 1; i + 1 < events.size(); i++)
+    moves += events[i].pressed;
+  TEST_ASSERT_GREATER_OR_EQUAL(300 / 10 - 2, moves);
+  TEST_ASSERT_FALSE(events.back().pressed);
+  TEST_ASSERT_EQUAL_UINT16(events[events.size() - 2].x, events.back().x);
+}
+
+// A line that never falls: the first touch switches to polling and the
+// rest are found within a poll period
+static void test_unwired_line_polls_after_first_touch() {
+  std::vector<Finger> f = {{1000000, 1100000, 50, 50, 0},
+                           {5000000, 5100000, 60, 60, 0}};
+  s.begin(true);
+  simulate(f, false, 10000000);
+  TEST_ASSERT_EQUAL(TOUCH_POLL, s.mode());
+  TEST_ASSERT_EQUAL(4, events.size());
+  TEST_ASSERT_LESS_OR_EQUAL(5000000 + TOUCH_POLL_MS * 1000, events[2].us);
+  TEST_ASSERT_UINT32_WITHIN(2, 10000 / TOUCH_POLL_MS, reads);
+}
+
+int main(int, char **) {
+  UNITY_BEGIN();
+  RUN_TEST(test_trace_events_and_times);
+  RUN_TEST(test_trace_without_edges_falls_back_to_polling);
+  RUN_TEST(test_probe_polls_until_first_edge);
+  RUN_TEST(test_no_pin_polls);
+  RUN_TEST(test_wired_reads_only_while_touched);
+  RUN_TEST(test_wired_drag_moves);
+  RUN_TEST(test_unwired_line_polls_after_first_touch);
+  return UNITY_END();
+}
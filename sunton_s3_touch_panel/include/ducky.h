@@ -0,0 +1,337 @@
+#ifndef DUCKY_H
+#define DUCKY_H
+
+#include "macro_runner.h"
+#include <stdint.h>
+#include <string.h>
+
+// DuckyScript payloads are compiled once into bytecode and replayed from
+// the cache, so a button press does no SD reads or String parsing.
+//
+//   DUCKY_KEYS   mods key          press modifiers + key, release all
+//   DUCKY_TEXT   off:16 len:16     type text[off, off + len)
+//   DUCKY_DELAY  ms:32
+//   DUCKY_REPEAT n:16 from:16 to:16  replay code[from, to) n more times
+//   DUCKY_END
+//
+// Multi-byte operands are little endian. STRINGLN stores its text with a
+// trailing '\n', which USBHIDKeyboard types as Enter. DEFAULT_DELAY is
+// resolved at compile time into a DELAY after every following command.
+// REPEAT replays the command before it, DELAY included, with that
+// command's default delay; a REPEAT is never itself repeated.
+
+enum DuckyOp : uint8_t {
+  DUCKY_END,
+  DUCKY_KEYS,
+  DUCKY_TEXT,
+  DUCKY_DELAY,
+  DUCKY_REPEAT
+};
+
+// Modifier bits; bit i maps to key code 0x80 + i (KEY_LEFT_CTRL...GUI)
+#define DUCKY_MOD_CTRL 0x01
+#define DUCKY_MOD_SHIFT 0x02
+#define DUCKY_MOD_ALT 0x04
+#define DUCKY_MOD_GUI 0x08
+
+struct DuckyProgram {
+  uint8_t *code;
+  uint32_t codeLen;
+  char *text;
+  uint32_t textLen;
+  uint16_t unknownLines; // Lines that were skipped
+};
+
+struct DuckyName {
+  const char *name;
+  uint8_t value;
+};
+
+// Named keys, as USBHIDKeyboard key codes
+static const DuckyName DUCKY_KEYS_TABLE[] = {
+    {"ENTER", 0xB0},     {"ESC", 0xB1},        {"ESCAPE", 0xB1},
+    {"BACKSPACE", 0xB2}, {"TAB", 0xB3},        {"SPACE", ' '},
+    {"CAPSLOCK", 0xC1},  {"F1", 0xC2},         {"F2", 0xC3},
+    {"F3", 0xC4},        {"F4", 0xC5},         {"F5", 0xC6},
+    {"F6", 0xC7},        {"F7", 0xC8},         {"F8", 0xC9},
+    {"F9", 0xCA},        {"F10", 0xCB},        {"F11", 0xCC},
+    {"F12", 0xCD},       {"PRINTSCREEN", 0xCE}, {"SCROLLLOCK", 0xCF},
+    {"PAUSE", 0xD0},     {"BREAK", 0xD0},      {"INSERT", 0xD1},
+    {"HOME", 0xD2},      {"PAGEUP", 0xD3},     {"DELETE", 0xD4},
+    {"DEL", 0xD4},       {"END", 0xD5},        {"PAGEDOWN", 0xD6},
+    {"RIGHT", 0xD7},     {"RIGHTARROW", 0xD7}, {"LEFT", 0xD8},
+    {"LEFTARROW", 0xD8}, {"DOWN", 0xD9},       {"DOWNARROW", 0xD9},
+    {"UP", 0xDA},        {"UPARROW", 0xDA},    {"MENU", 0xED},
+    {"APP", 0xED}};
+
+static const DuckyName DUCKY_MODS_TABLE[] = {
+    {"CTRL", DUCKY_MOD_CTRL},   {"CONTROL", DUCKY_MOD_CTRL},
+    {"SHIFT", DUCKY_MOD_SHIFT}, {"ALT", DUCKY_MOD_ALT},
+    {"GUI", DUCKY_MOD_GUI},     {"WINDOWS", DUCKY_MOD_GUI},
+    {"COMMAND", DUCKY_MOD_GUI}};
+
+class DuckyCompiler {
+public:
+  // Pass p.code = p.text = NULL to only measure codeLen/textLen, then
+  // allocate exactly and compile again.
+  static bool compile(const char *src, size_t len, DuckyProgram &p) {
+    DuckyCompiler c(p);
+    const char *end = src + len;
+    while (src < end) {
+      const char *eol = (const char *)memchr(src, '\n', end - src);
+      if (!eol)
+        eol = end;
+      if (!c.line(src, eol))
+        return false;
+      src = eol + 1;
+    }
+    c.op(DUCKY_END);
+    return true;
+  }
+
+private:
+  explicit DuckyCompiler(DuckyProgram &p) : _p(p) {
+    _p.codeLen = 0;
+    _p.textLen = 0;
+    _p.unknownLines = 0;
+  }
+
+  static bool isSpace(char c) { return c == ' ' || c == '\t' || c == '\r'; }
+
+  static bool word(const char *s, const char *e, const char *w) {
+    size_t n = strlen(w);
+    return (size_t)(e - s) == n && memcmp(s, w, n) == 0;
+  }
+
+  // Matches "CMD" or "CMD <arg>"; `arg` points past the single space.
+  static bool command(const char *s, const char *e, const char *cmd,
+                      const char *&arg) {
+    size_t n = strlen(cmd);
+    if ((size_t)(e - s) < n || memcmp(s, cmd, n) != 0)
+      return false;
+    if (s + n == e) {
+      arg = e;
+      return true;
+    }
+    if (s[n] != ' ')
+      return false;
+    arg = s + n + 1;
+    return true;
+  }
+
+  static bool number(const char *s, const char *e, uint32_t &out) {
+    while (s < e && isSpace(*s))
+      s++;
+    if (s == e)
+      return false;
+    out = 0;
+    for (; s < e; s++) {
+      if (*s < '0' || *s > '9' || out > 0xFFFFFFF)
+        return false;
+      out = out * 10 + (*s - '0');
+    }
+    return true;
+  }
+
+  static int lookup(const DuckyName *t, size_t n, const char *s,
+                    const char *e) {
+    for (size_t i = 0; i < n; i++)
+      if (word(s, e, t[i].name))
+        return t[i].value;
+    return -1;
+  }
+
+  bool line(const char *s, const char *e) {
+    while (s < e && isSpace(*s))
+      s++;
+    while (e > s && isSpace(e[-1]))
+      e--;
+    const char *arg;
+    if (s == e || command(s, e, "REM", arg) ||
+        (e - s >= 2 && !memcmp(s, "//", 2)))
+      return true;
+
+    uint32_t n;
+    uint32_t start = _p.codeLen;
+    bool ln = command(s, e, "STRINGLN", arg);
+    bool pause = false; // DEFAULT_DELAY does not stack on explicit delays
+    if (ln || command(s, e, "STRING", arg)) {
+      uint32_t len = (e - arg) + (ln ? 1 : 0);
+      if (_p.textLen + len > 0xFFFF || len > 0xFFFF)
+        return false;
+      op(DUCKY_TEXT);
+      u16(_p.textLen);
+      u16(len);
+      text(arg, e - arg);
+      if (ln)
+        text("\n", 1);
+    } else if (command(s, e, "DELAY", arg)) {
+      if (!number(arg, e, n))
+        return skip();
+      op(DUCKY_DELAY);
+      u32(n);
+      pause = true;
+    } else if (command(s, e, "DEFAULT_DELAY", arg) ||
+               command(s, e, "DEFAULTDELAY", arg)) {
+      if (!number(arg, e, n))
+        return skip();
+      _defaultDelay = n;
+      return true;
+    } else if (command(s, e, "REPEAT", arg)) {
+      if (!number(arg, e, n) || n == 0 || n > 0xFFFF || !_hasLast)
+        return skip();
+      op(DUCKY_REPEAT);
+      u16(n);
+      u16(_lastFrom);
+      u16(_lastTo);
+      return true;
+    } else if (!keys(s, e)) {
+      return skip();
+    }
+    if (_defaultDelay > 0 && !pause) {
+      op(DUCKY_DELAY);
+      u32(_defaultDelay);
+    }
+    if (_p.codeLen > 0xFFFF)
+      return false;
+    _hasLast = true;
+    _lastFrom = start;
+    _lastTo = _p.codeLen;
+    return true;
+  }
+
+  // "CTRL ALT DELETE", "CTRL-SHIFT ESC", "GUI r", "ENTER", "GUI"
+  bool keys(const char *s, const char *e) {
+    uint8_t mods = 0;
+    int key = -1;
+    while (s < e) {
+      const char *t = s;
+      while (t < e && *t != ' ' && *t != '-')
+        t++;
+      if (t == s)
+        t++; // "-" on its own is a key
+      if (key >= 0)
+        return false; // Nothing may follow the key
+      int m = lookup(DUCKY_MODS_TABLE,
+                     sizeof(DUCKY_MODS_TABLE) / sizeof(DUCKY_MODS_TABLE[0]), s,
+                     t);
+      if (m >= 0) {
+        mods |= m;
+      } else {
+        key = lookup(DUCKY_KEYS_TABLE,
+                     sizeof(DUCKY_KEYS_TABLE) / sizeof(DUCKY_KEYS_TABLE[0]), s,
+                     t);
+        if (key < 0 && t - s == 1)
+          key = (uint8_t)*s;
+        if (key < 0)
+          return false;
+      }
+      s = t;
+      while (s < e && (*s == ' ' || (*s == '-' && s + 1 < e)))
+        s++;
+    }
+    op(DUCKY_KEYS);
+    byte(mods);
+    byte(key < 0 ? 0 : (uint8_t)key);
+    return true;
+  }
+
+  bool skip() {
+    _p.unknownLines++;
+    return true;
+  }
+
+  void byte(uint8_t b) {
+    if (_p.code)
+      _p.code[_p.codeLen] = b;
+    _p.codeLen++;
+  }
+  void op(DuckyOp o) { byte(o); }
+  void u16(uint32_t v) {
+    byte(v & 0xFF);
+    byte((v >> 8) & 0xFF);
+  }
+  void u32(uint32_t v) {
+    u16(v & 0xFFFF);
+    u16(v >> 16);
+  }
+  void text(const char *s, size_t n) {
+    if (_p.text)
+      memcpy(_p.text + _p.textLen, s, n);
+    _p.textLen += n;
+  }
+
+  DuckyProgram &_p;
+  uint32_t _defaultDelay = 0;
+  bool _hasLast = false;
+  uint32_t _lastFrom = 0;
+  uint32_t _lastTo = 0;
+};
+
+// Streams a compiled program into a MacroRunner a few ops at a time, so
+// payloads of any length fit the runner's fixed queue.
+class DuckyPlayer {
+public:
+  void start(const DuckyProgram *p) {
+    _p = p;
+    _pc = 0;
+    _repeatLeft = 0;
+  }
+  void stop() { _p = NULL; }
+  bool active() const { return _p != NULL; }
+
+  template <class KB> void feed(MacroRunner<KB> &m) {
+    // Worst case per op: 4 modifiers + key + release
+    while (_p && m.room() >= 6) {
+      if (_repeatLeft > 0 && _pc == _repeatTo) {
+        if (--_repeatLeft > 0)
+          _pc = _repeatFrom;
+        else
+          _pc = _repeatReturn;
+      }
+      const uint8_t *c = _p->code + _pc;
+      switch (c[0]) {
+      case DUCKY_KEYS:
+        for (uint8_t i = 0; i < 4; i++)
+          if (c[1] & (1 << i))
+            m.press(0x80 + i);
+        if (c[2])
+          m.press(c[2]);
+        m.releaseAll();
+        _pc += 3;
+        break;
+      case DUCKY_TEXT:
+        m.typeRef(_p->text + u16(c + 1), u16(c + 3));
+        _pc += 5;
+        break;
+      case DUCKY_DELAY:
+        m.wait(u16(c + 1) | ((uint32_t)u16(c + 3) << 16));
+        _pc += 5;
+        break;
+      case DUCKY_REPEAT:
+        _repeatLeft = u16(c + 1);
+        _repeatFrom = u16(c + 3);
+        _repeatTo = u16(c + 5);
+        _repeatReturn = _pc + 7;
+        _pc = _repeatFrom;
+        break;
+      case DUCKY_END:
+      default:
+        _p = NULL;
+        break;
+      }
+    }
+  }
+
+private:
+  static uint16_t u16(const uint8_t *b) { return b[0] | (b[1] << 8); }
+
+  const DuckyProgram *_p = NULL;
+  uint32_t _pc = 0;
+  uint16_t _repeatLeft = 0;
+  uint32_t _repeatFrom = 0;
+  uint32_t _repeatTo = 0;
+  uint32_t _repeatReturn = 0;
+};
+
+#endif
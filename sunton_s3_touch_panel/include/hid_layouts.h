@@ -0,0 +1,307 @@
+#ifndef HID_LAYOUTS_H
+#define HID_LAYOUTS_H
+
+#include <stdint.h>
+
+// Keyboard layouts for HidTyper: Unicode code point -> HID usage + modifier
+// byte, with an optional dead key typed first (usage 0 = none). Tables are
+// sorted by code point for binary search.
+//
+// Modifier byte as in the boot keyboard report: 0x02 = left Shift,
+// 0x40 = right Alt (AltGr).
+
+struct HidStroke {
+  uint8_t mods;
+  uint8_t usage;
+};
+
+struct HidLayoutKey {
+  uint16_t cp;
+  HidStroke dead;
+  HidStroke key;
+};
+
+struct HidLayout {
+  const char *name;
+  const HidLayoutKey *keys;
+  uint16_t count;
+};
+
+static const HidLayoutKey HID_LAYOUT_EN_US_KEYS[] = {
+    {0x0009, {0x00, 0x00}, {0x00, 0x2B}}, // \t
+    {0x000A, {0x00, 0x00}, {0x00, 0x28}}, // \n
+    {0x0020, {0x00, 0x00}, {0x00, 0x2C}}, // space
+    {0x0021, {0x00, 0x00}, {0x02, 0x1E}}, // !
+    {0x0022, {0x00, 0x00}, {0x02, 0x34}}, // "
+    {0x0023, {0x00, 0x00}, {0x02, 0x20}}, // #
+    {0x0024, {0x00, 0x00}, {0x02, 0x21}}, // $
+    {0x0025, {0x00, 0x00}, {0x02, 0x22}}, // %
+    {0x0026, {0x00, 0x00}, {0x02, 0x24}}, // &
+    {0x0027, {0x00, 0x00}, {0x00, 0x34}}, // '
+    {0x0028, {0x00, 0x00}, {0x02, 0x26}}, // (
+    {0x0029, {0x00, 0x00}, {0x02, 0x27}}, // )
+    {0x002A, {0x00, 0x00}, {0x02, 0x25}}, // *
+    {0x002B, {0x00, 0x00}, {0x02, 0x2E}}, // +
+    {0x002C, {0x00, 0x00}, {0x00, 0x36}}, // ,
+    {0x002D, {0x00, 0x00}, {0x00, 0x2D}}, // -
+    {0x002E, {0x00, 0x00}, {0x00, 0x37}}, // .
+    {0x002F, {0x00, 0x00}, {0x00, 0x38}}, // /
+    {0x0030, {0x00, 0x00}, {0x00, 0x27}}, // 0
+    {0x0031, {0x00, 0x00}, {0x00, 0x1E}}, // 1
+    {0x0032, {0x00, 0x00}, {0x00, 0x1F}}, // 2
+    {0x0033, {0x00, 0x00}, {0x00, 0x20}}, // 3
+    {0x0034, {0x00, 0x00}, {0x00, 0x21}}, // 4
+    {0x0035, {0x00, 0x00}, {0x00, 0x22}}, // 5
+    {0x0036, {0x00, 0x00}, {0x00, 0x23}}, // 6
+    {0x0037, {0x00, 0x00}, {0x00, 0x24}}, // 7
+    {0x0038, {0x00, 0x00}, {0x00, 0x25}}, // 8
+    {0x0039, {0x00, 0x00}, {0x00, 0x26}}, // 9
+    {0x003A, {0x00, 0x00}, {0x02, 0x33}}, // :
+    {0x003B, {0x00, 0x00}, {0x00, 0x33}}, // ;
+    {0x003C, {0x00, 0x00}, {0x02, 0x36}}, // <
+    {0x003D, {0x00, 0x00}, {0x00, 0x2E}}, // =
+    {0x003E, {0x00, 0x00}, {0x02, 0x37}}, // >
+    {0x003F, {0x00, 0x00}, {0x02, 0x38}}, // ?
+    {0x0040, {0x00, 0x00}, {0x02, 0x1F}}, // @
+    {0x0041, {0x00, 0x00}, {0x02, 0x04}}, // A
+    {0x0042, {0x00, 0x00}, {0x02, 0x05}}, // B
+    {0x0043, {0x00, 0x00}, {0x02, 0x06}}, // C
+    {0x0044, {0x00, 0x00}, {0x02, 0x07}}, // D
+    {0x0045, {0x00, 0x00}, {0x02, 0x08}}, // E
+    {0x0046, {0x00, 0x00}, {0x02, 0x09}}, // F
+    {0x0047, {0x00, 0x00}, {0x02, 0x0A}}, // G
+    {0x0048, {0x00, 0x00}, {0x02, 0x0B}}, // H
+    {0x0049, {0x00, 0x00}, {0x02, 0x0C}}, // I
+    {0x004A, {0x00, 0x00}, {0x02, 0x0D}}, // J
+    {0x004B, {0x00, 0x00}, {0x02, 0x0E}}, // K
+    {0x004C, {0x00, 0x00}, {0x02, 0x0F}}, // L
+    {0x004D, {0x00, 0x00}, {0x02, 0x10}}, // M
+    {0x004E, {0x00, 0x00}, {0x02, 0x11}}, // N
+    {0x004F, {0x00, 0x00}, {0x02, 0x12}}, // O
+    {0x0050, {0x00, 0x00}, {0x02, 0x13}}, // P
+    {0x0051, {0x00, 0x00}, {0x02, 0x14}}, // Q
+    {0x0052, {0x00, 0x00}, {0x02, 0x15}}, // R
+    {0x0053, {0x00, 0x00}, {0x02, 0x16}}, // S
+    {0x0054, {0x00, 0x00}, {0x02, 0x17}}, // T
+    {0x0055, {0x00, 0x00}, {0x02, 0x18}}, // U
+    {0x0056, {0x00, 0x00}, {0x02, 0x19}}, // V
+    {0x0057, {0x00, 0x00}, {0x02, 0x1A}}, // W
+    {0x0058, {0x00, 0x00}, {0x02, 0x1B}}, // X
+    {0x0059, {0x00, 0x00}, {0x02, 0x1C}}, // Y
+    {0x005A, {0x00, 0x00}, {0x02, 0x1D}}, // Z
+    {0x005B, {0x00, 0x00}, {0x00, 0x2F}}, // [
+    {0x005C, {0x00, 0x00}, {0x00, 0x31}}, // backslash
+    {0x005D, {0x00, 0x00}, {0x00, 0x30}}, // ]
+    {0x005E, {0x00, 0x00}, {0x02, 0x23}}, // ^
+    {0x005F, {0x00, 0x00}, {0x02, 0x2D}}, // _
+    {0x0060, {0x00, 0x00}, {0x00, 0x35}}, // `
+    {0x0061, {0x00, 0x00}, {0x00, 0x04}}, // a
+    {0x0062, {0x00, 0x00}, {0x00, 0x05}}, // b
+    {0x0063, {0x00, 0x00}, {0x00, 0x06}}, // c
+    {0x0064, {0x00, 0x00}, {0x00, 0x07}}, // d
+    {0x0065, {0x00, 0x00}, {0x00, 0x08}}, // e
+    {0x0066, {0x00, 0x00}, {0x00, 0x09}}, // f
+    {0x0067, {0x00, 0x00}, {0x00, 0x0A}}, // g
+    {0x0068, {0x00, 0x00}, {0x00, 0x0B}}, // h
+    {0x0069, {0x00, 0x00}, {0x00, 0x0C}}, // i
+    {0x006A, {0x00, 0x00}, {0x00, 0x0D}}, // j
+    {0x006B, {0x00, 0x00}, {0x00, 0x0E}}, // k
+    {0x006C, {0x00, 0x00}, {0x00, 0x0F}}, // l
+    {0x006D, {0x00, 0x00}, {0x00, 0x10}}, // m
+    {0x006E, {0x00, 0x00}, {0x00, 0x11}}, // n
+    {0x006F, {0x00, 0x00}, {0x00, 0x12}}, // o
+    {0x0070, {0x00, 0x00}, {0x00, 0x13}}, // p
+    {0x0071, {0x00, 0x00}, {0x00, 0x14}}, // q
+    {0x0072, {0x00, 0x00}, {0x00, 0x15}}, // r
+    {0x0073, {0x00, 0x00}, {0x00, 0x16}}, // s
+    {0x0074, {0x00, 0x00}, {0x00, 0x17}}, // t
+    {0x0075, {0x00, 0x00}, {0x00, 0x18}}, // u
+    {0x0076, {0x00, 0x00}, {0x00, 0x19}}, // v
+    {0x0077, {0x00, 0x00}, {0x00, 0x1A}}, // w
+    {0x0078, {0x00, 0x00}, {0x00, 0x1B}}, // x
+    {0x0079, {0x00, 0x00}, {0x00, 0x1C}}, // y
+    {0x007A, {0x00, 0x00}, {0x00, 0x1D}}, // z
+    {0x007B, {0x00, 0x00}, {0x02, 0x2F}}, // {
+    {0x007C, {0x00, 0x00}, {0x02, 0x31}}, // |
+    {0x007D, {0x00, 0x00}, {0x02, 0x30}}, // }
+    {0x007E, {0x00, 0x00}, {0x02, 0x35}}, // ~
+};
+
+static const HidLayoutKey HID_LAYOUT_ES_ES_KEYS[] = {
+    {0x0009, {0x00, 0x00}, {0x00, 0x2B}}, // \t
+    {0x000A, {0x00, 0x00}, {0x00, 0x28}}, // \n
+    {0x0020, {0x00, 0x00}, {0x00, 0x2C}}, // space
+    {0x0021, {0x00, 0x00}, {0x02, 0x1E}}, // !
+    {0x0022, {0x00, 0x00}, {0x02, 0x1F}}, // "
+    {0x0023, {0x00, 0x00}, {0x40, 0x20}}, // #
+    {0x0024, {0x00, 0x00}, {0x02, 0x21}}, // $
+    {0x0025, {0x00, 0x00}, {0x02, 0x22}}, // %
+    {0x0026, {0x00, 0x00}, {0x02, 0x23}}, // &
+    {0x0027, {0x00, 0x00}, {0x00, 0x2D}}, // '
+    {0x0028, {0x00, 0x00}, {0x02, 0x25}}, // (
+    {0x0029, {0x00, 0x00}, {0x02, 0x26}}, // )
+    {0x002A, {0x00, 0x00}, {0x02, 0x30}}, // *
+    {0x002B, {0x00, 0x00}, {0x00, 0x30}}, // +
+    {0x002C, {0x00, 0x00}, {0x00, 0x36}}, // ,
+    {0x002D, {0x00, 0x00}, {0x00, 0x38}}, // -
+    {0x002E, {0x00, 0x00}, {0x00, 0x37}}, // .
+    {0x002F, {0x00, 0x00}, {0x02, 0x24}}, // /
+    {0x0030, {0x00, 0x00}, {0x00, 0x27}}, // 0
+    {0x0031, {0x00, 0x00}, {0x00, 0x1E}}, // 1
+    {0x0032, {0x00, 0x00}, {0x00, 0x1F}}, // 2
+    {0x0033, {0x00, 0x00}, {0x00, 0x20}}, // 3
+    {0x0034, {0x00, 0x00}, {0x00, 0x21}}, // 4
+    {0x0035, {0x00, 0x00}, {0x00, 0x22}}, // 5
+    {0x0036, {0x00, 0x00}, {0x00, 0x23}}, // 6
+    {0x0037, {0x00, 0x00}, {0x00, 0x24}}, // 7
+    {0x0038, {0x00, 0x00}, {0x00, 0x25}}, // 8
+    {0x0039, {0x00, 0x00}, {0x00, 0x26}}, // 9
+    {0x003A, {0x00, 0x00}, {0x02, 0x37}}, // :
+    {0x003B, {0x00, 0x00}, {0x02, 0x36}}, // ;
+    {0x003C, {0x00, 0x00}, {0x00, 0x64}}, // <
+    {0x003D, {0x00, 0x00}, {0x02, 0x27}}, // =
+    {0x003E, {0x00, 0x00}, {0x02, 0x64}}, // >
+    {0x003F, {0x00, 0x00}, {0x02, 0x2D}}, // ?
+    {0x0040, {0x00, 0x00}, {0x40, 0x1F}}, // @
+    {0x0041, {0x00, 0x00}, {0x02, 0x04}}, // A
+    {0x0042, {0x00, 0x00}, {0x02, 0x05}}, // B
+    {0x0043, {0x00, 0x00}, {0x02, 0x06}}, // C
+    {0x0044, {0x00, 0x00}, {0x02, 0x07}}, // D
+    {0x0045, {0x00, 0x00}, {0x02, 0x08}}, // E
+    {0x0046, {0x00, 0x00}, {0x02, 0x09}}, // F
+    {0x0047, {0x00, 0x00}, {0x02, 0x0A}}, // G
+    {0x0048, {0x00, 0x00}, {0x02, 0x0B}}, // H
+    {0x0049, {0x00, 0x00}, {0x02, 0x0C}}, // I
+    {0x004A, {0x00, 0x00}, {0x02, 0x0D}}, // J
+    {0x004B, {0x00, 0x00}, {0x02, 0x0E}}, // K
+    {0x004C, {0x00, 0x00}, {0x02, 0x0F}}, // L
+    {0x004D, {0x00, 0x00}, {0x02, 0x10}}, // M
+    {0x004E, {0x00, 0x00}, {0x02, 0x11}}, // N
+    {0x004F, {0x00, 0x00}, {0x02, 0x12}}, // O
+    {0x0050, {0x00, 0x00}, {0x02, 0x13}}, // P
+    {0x0051, {0x00, 0x00}, {0x02, 0x14}}, // Q
+    {0x0052, {0x00, 0x00}, {0x02, 0x15}}, // R
+    {0x0053, {0x00, 0x00}, {0x02, 0x16}}, // S
+    {0x0054, {0x00, 0x00}, {0x02, 0x17}}, // T
+    {0x0055, {0x00, 0x00}, {0x02, 0x18}}, // U
+    {0x0056, {0x00, 0x00}, {0x02, 0x19}}, // V
+    {0x0057, {0x00, 0x00}, {0x02, 0x1A}}, // W
+    {0x0058, {0x00, 0x00}, {0x02, 0x1B}}, // X
+    {0x0059, {0x00, 0x00}, {0x02, 0x1C}}, // Y
+    {0x005A, {0x00, 0x00}, {0x02, 0x1D}}, // Z
+    {0x005B, {0x00, 0x00}, {0x40, 0x2F}}, // [
+    {0x005C, {0x00, 0x00}, {0x40, 0x35}}, // backslash
+    {0x005D, {0x00, 0x00}, {0x40, 0x30}}, // ]
+    {0x005E, {0x02, 0x2F}, {0x00, 0x2C}}, // ^
+    {0x005F, {0x00, 0x00}, {0x02, 0x38}}, // _
+    {0x0060, {0x00, 0x2F}, {0x00, 0x2C}}, // `
+    {0x0061, {0x00, 0x00}, {0x00, 0x04}}, // a
+    {0x0062, {0x00, 0x00}, {0x00, 0x05}}, // b
+    {0x0063, {0x00, 0x00}, {0x00, 0x06}}, // c
+    {0x0064, {0x00, 0x00}, {0x00, 0x07}}, // d
+    {0x0065, {0x00, 0x00}, {0x00, 0x08}}, // e
+    {0x0066, {0x00, 0x00}, {0x00, 0x09}}, // f
+    {0x0067, {0x00, 0x00}, {0x00, 0x0A}}, // g
+    {0x0068, {0x00, 0x00}, {0x00, 0x0B}}, // h
+    {0x0069, {0x00, 0x00}, {0x00, 0x0C}}, // i
+    {0x006A, {0x00, 0x00}, {0x00, 0x0D}}, // j
+    {0x006B, {0x00, 0x00}, {0x00, 0x0E}}, // k
+    {0x006C, {0x00, 0x00}, {0x00, 0x0F}}, // l
+    {0x006D, {0x00, 0x00}, {0x00, 0x10}}, // m
+    {0x006E, {0x00, 0x00}, {0x00, 0x11}}, // n
+    {0x006F, {0x00, 0x00}, {0x00, 0x12}}, // o
+    {0x0070, {0x00, 0x00}, {0x00, 0x13}}, // p
+    {0x0071, {0x00, 0x00}, {0x00, 0x14}}, // q
+    {0x0072, {0x00, 0x00}, {0x00, 0x15}}, // r
+    {0x0073, {0x00, 0x00}, {0x00, 0x16}}, // s
+    {0x0074, {0x00, 0x00}, {0x00, 0x17}}, // t
+    {0x0075, {0x00, 0x00}, {0x00, 0x18}}, // u
+    {0x0076, {0x00, 0x00}, {0x00, 0x19}}, // v
+    {0x0077, {0x00, 0x00}, {0x00, 0x1A}}, // w
+    {0x0078, {0x00, 0x00}, {0x00, 0x1B}}, // x
+    {0x0079, {0x00, 0x00}, {0x00, 0x1C}}, // y
+    {0x007A, {0x00, 0x00}, {0x00, 0x1D}}, // z
+    {0x007B, {0x00, 0x00}, {0x40, 0x34}}, // {
+    {0x007C, {0x00, 0x00}, {0x40, 0x1E}}, // |
+    {0x007D, {0x00, 0x00}, {0x40, 0x31}}, // }
+    {0x007E, {0x40, 0x21}, {0x00, 0x2C}}, // ~
+    {0x00A1, {0x00, 0x00}, {0x00, 0x2E}}, // ¡
+    {0x00A8, {0x02, 0x34}, {0x00, 0x2C}}, // ¨
+    {0x00AA, {0x00, 0x00}, {0x02, 0x35}}, // ª
+    {0x00AC, {0x00, 0x00}, {0x40, 0x23}}, // ¬
+    {0x00B4, {0x00, 0x34}, {0x00, 0x2C}}, // ´
+    {0x00B7, {0x00, 0x00}, {0x02, 0x20}}, // ·
+    {0x00BA, {0x00, 0x00}, {0x00, 0x35}}, // º
+    {0x00BF, {0x00, 0x00}, {0x02, 0x2E}}, // ¿
+    {0x00C0, {0x00, 0x2F}, {0x02, 0x04}}, // À
+    {0x00C1, {0x00, 0x34}, {0x02, 0x04}}, // Á
+    {0x00C2, {0x02, 0x2F}, {0x02, 0x04}}, // Â
+    {0x00C4, {0x02, 0x34}, {0x02, 0x04}}, // Ä
+    {0x00C7, {0x00, 0x00}, {0x02, 0x31}}, // Ç
+    {0x00C8, {0x00, 0x2F}, {0x02, 0x08}}, // È
+    {0x00C9, {0x00, 0x34}, {0x02, 0x08}}, // É
+    {0x00CA, {0x02, 0x2F}, {0x02, 0x08}}, // Ê
+    {0x00CB, {0x02, 0x34}, {0x02, 0x08}}, // Ë
+    {0x00CC, {0x00, 0x2F}, {0x02, 0x0C}}, // Ì
+    {0x00CD, {0x00, 0x34}, {0x02, 0x0C}}, // Í
+    {0x00CE, {0x02, 0x2F}, {0x02, 0x0C}}, // Î
+    {0x00CF, {0x02, 0x34}, {0x02, 0x0C}}, // Ï
+    {0x00D1, {0x00, 0x00}, {0x02, 0x33}}, // Ñ
+    {0x00D2, {0x00, 0x2F}, {0x02, 0x12}}, // Ò
+    {0x00D3, {0x00, 0x34}, {0x02, 0x12}}, // Ó
+    {0x00D4, {0x02, 0x2F}, {0x02, 0x12}}, // Ô
+    {0x00D6, {0x02, 0x34}, {0x02, 0x12}}, // Ö
+    {0x00D9, {0x00, 0x2F}, {0x02, 0x18}}, // Ù
+    {0x00DA, {0x00, 0x34}, {0x02, 0x18}}, // Ú
+    {0x00DB, {0x02, 0x2F}, {0x02, 0x18}}, // Û
+    {0x00DC, {0x02, 0x34}, {0x02, 0x18}}, // Ü
+    {0x00E0, {0x00, 0x2F}, {0x00, 0x04}}, // à
+    {0x00E1, {0x00, 0x34}, {0x00, 0x04}}, // á
+    {0x00E2, {0x02, 0x2F}, {0x00, 0x04}}, // â
+    {0x00E4, {0x02, 0x34}, {0x00, 0x04}}, // ä
+    {0x00E7, {0x00, 0x00}, {0x00, 0x31}}, // ç
+    {0x00E8, {0x00, 0x2F}, {0x00, 0x08}}, // è
+    {0x00E9, {0x00, 0x34}, {0x00, 0x08}}, // é
+    {0x00EA, {0x02, 0x2F}, {0x00, 0x08}}, // ê
+    {0x00EB, {0x02, 0x34}, {0x00, 0x08}}, // ë
+    {0x00EC, {0x00, 0x2F}, {0x00, 0x0C}}, // ì
+    {0x00ED, {0x00, 0x34}, {0x00, 0x0C}}, // í
+    {0x00EE, {0x02, 0x2F}, {0x00, 0x0C}}, // î
+    {0x00EF, {0x02, 0x34}, {0x00, 0x0C}}, // ï
+    {0x00F1, {0x00, 0x00}, {0x00, 0x33}}, // ñ
+    {0x00F2, {0x00, 0x2F}, {0x00, 0x12}}, // ò
+    {0x00F3, {0x00, 0x34}, {0x00, 0x12}}, // ó
+    {0x00F4, {0x02, 0x2F}, {0x00, 0x12}}, // ô
+    {0x00F6, {0x02, 0x34}, {0x00, 0x12}}, // ö
+    {0x00F9, {0x00, 0x2F}, {0x00, 0x18}}, // ù
+    {0x00FA, {0x00, 0x34}, {0x00, 0x18}}, // ú
+    {0x00FB, {0x02, 0x2F}, {0x00, 0x18}}, // û
+    {0x00FC, {0x02, 0x34}, {0x00, 0x18}}, // ü
+    {0x20AC, {0x00, 0x00}, {0x40, 0x22}}, // €
+};
+
+static const HidLayout HID_LAYOUT_EN_US = {
+    "en-US", HID_LAYOUT_EN_US_KEYS,
+    sizeof(HID_LAYOUT_EN_US_KEYS) / sizeof(HID_LAYOUT_EN_US_KEYS[0])};
+
+// Spanish (Spain) as configured on Windows: ´ ` ^ ¨ and AltGr+4 (~) are dead
+// keys, so accented vowels and the bare symbols need two strokes.
+static const HidLayout HID_LAYOUT_ES_ES = {
+    "es-ES", HID_LAYOUT_ES_ES_KEYS,
+    sizeof(HID_LAYOUT_ES_ES_KEYS) / sizeof(HID_LAYOUT_ES_ES_KEYS[0])};
+
+inline const HidLayoutKey *hidLayoutFind(const HidLayout &l, uint16_t cp) {
+  int lo = 0, hi = (int)l.count - 1;
+  while (lo <= hi) {
+    int mid = (lo + hi) / 2;
+    if (l.keys[mid].cp == cp)
+      return &l.keys[mid];
+    if (l.keys[mid].cp < cp)
+      lo = mid + 1;
+    else
+      hi = mid - 1;
+  }
+  return 0;
+}
+
+#endif
@@ -0,0 +1,161 @@
+#ifndef HID_TYPER_H
+#define HID_TYPER_H
+
+#include "hid_layouts.h"
+#include <stdint.h>
+
+// Layout-aware text typing with hand-built keyboard reports.
+//
+// Keyboard.print() goes through the US ASCII map and sends press + release
+// for every character. HidTyper decodes UTF-8, looks each code point up in
+// the active HidLayout and sends the shortest report sequence: consecutive
+// keys with the same modifiers roll over from one key to the next without
+// an empty report in between. A release is only inserted when the same key
+// repeats or the modifiers change.
+//
+// Sink needs send(uint8_t mods, uint8_t usage): one report, one key.
+// poll() is called from loop() with micros(); it sends at most one report
+// per interval and catches up by up to TYPER_MAX_BURST reports when the
+// loop was slow. Each report occupies at least one 1 ms USB frame, so the
+// default interval equals one frame.
+
+#ifndef TYPER_REPORT_INTERVAL_US
+#define TYPER_REPORT_INTERVAL_US 1000
+#endif
+#define TYPER_MAX_BURST 8
+
+template <class Sink> class HidTyper {
+public:
+  HidTyper(Sink &sink, const HidLayout &layout)
+      : _sink(sink), _layout(&layout) {}
+
+  void setLayout(const HidLayout &layout) { _layout = &layout; }
+  const HidLayout &layout() const { return *_layout; }
+  void setReportInterval(uint32_t us) { _intervalUs = us ? us : 1; }
+
+  void begin(const char *text, uint16_t len, uint32_t nowUs) {
+    _text = (const uint8_t *)text;
+    _len = len;
+    _pos = 0;
+    _strokeCount = _strokeIdx = 0;
+    _chars = 0;
+    _skipped = 0;
+    _startUs = nowUs;
+    _lastUs = nowUs - _intervalUs;
+    _busy = true;
+  }
+
+  // Stops typing and releases whatever is held.
+  void cancel() {
+    if (_held.usage || _held.mods)
+      _sink.send(0, 0);
+    _held = {0, 0};
+    _busy = false;
+  }
+
+  bool busy() const { return _busy; }
+
+  void poll(uint32_t nowUs) {
+    if (!_busy || nowUs - _lastUs < _intervalUs)
+      return;
+    uint32_t due = (nowUs - _lastUs) / _intervalUs;
+    if (due > TYPER_MAX_BURST)
+      due = TYPER_MAX_BURST;
+    while (due > 0 && _busy) {
+      if (step(nowUs))
+        due--;
+    }
+    _lastUs = nowUs;
+  }
+
+  // Characters per second of the last finished text.
+  uint32_t lastCps() const { return _cps; }
+  uint16_t lastSkipped() const { return _skipped; }
+
+private:
+  // Sends one report when there is one to send; returns false for
+  // bookkeeping steps (loading the next character, finishing).
+  bool step(uint32_t nowUs) {
+    if (_strokeIdx < _strokeCount) {
+      const HidStroke &s = _strokes[_strokeIdx];
+      if (_held.usage &&
+          (_held.usage == s.usage || _held.mods != s.mods)) {
+        report(0, 0);
+        return true;
+      }
+      report(s.mods, s.usage);
+      _strokeIdx++;
+      return true;
+    }
+    if (_pos < _len) {
+      loadNext();
+      return false;
+    }
+    if (_held.usage || _held.mods) {
+      report(0, 0);
+      return true;
+    }
+    uint32_t dt = nowUs - _startUs;
+    _cps = dt ? (uint32_t)((uint64_t)_chars * 1000000 / dt) : 0;
+    _busy = false;
+    return false;
+  }
+
+  void report(uint8_t mods, uint8_t usage) {
+    _sink.send(mods, usage);
+    _held = {mods, usage};
+  }
+
+  void loadNext() {
+    uint16_t cp = decodeUtf8();
+    const HidLayoutKey *k = hidLayoutFind(*_layout, cp);
+    _strokeCount = _strokeIdx = 0;
+    if (!k) {
+      _skipped++;
+      return;
+    }
+    if (k->dead.usage)
+      _strokes[_strokeCount++] = k->dead;
+    _strokes[_strokeCount++] = k->key;
+    _chars++;
+  }
+
+  // Code points above U+FFFF and malformed bytes decode to 0 (skipped).
+  uint16_t decodeUtf8() {
+    uint8_t c = _text[_pos++];
+    if (c < 0x80)
+      return c;
+    int extra = (c & 0xE0) == 0xC0 ? 1 : (c & 0xF0) == 0xE0 ? 2 : -1;
+    if (extra < 0 || _pos + extra > _len) {
+      while (_pos < _len && (_text[_pos] & 0xC0) == 0x80)
+        _pos++;
+      return 0;
+    }
+    uint16_t cp = c & (extra == 1 ? 0x1F : 0x0F);
+    for (int i = 0; i < extra; i++) {
+      if ((_text[_pos] & 0xC0) != 0x80)
+        return 0;
+      cp = (cp << 6) | (_text[_pos++] & 0x3F);
+    }
+    return cp;
+  }
+
+  Sink &_sink;
+  const HidLayout *_layout;
+  uint32_t _intervalUs = TYPER_REPORT_INTERVAL_US;
+  const uint8_t *_text = 0;
+  uint16_t _len = 0;
+  uint16_t _pos = 0;
+  HidStroke _strokes[2];
+  uint8_t _strokeCount = 0;
+  uint8_t _strokeIdx = 0;
+  HidStroke _held = {0, 0};
+  bool _busy = false;
+  uint32_t _startUs = 0;
+  uint32_t _lastUs = 0;
+  uint32_t _chars = 0;
+  uint16_t _skipped = 0;
+  uint32_t _cps = 0;
+};
+
+#endif
@@ -0,0 +1,159 @@
+#ifndef HOST_LINK_H
+#define HOST_LINK_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+// Print acknowledgement protocol spoken with the PC agent
+// (tools/print_agent.py). Plain text, one message per line, carried over the
+// vendor HID interface:
+//
+//   Panel -> PC:  "PRINT <seq>\n"   Alt+P has been sent
+//   PC -> Panel:  "HELLO\n"         agent started
+//                 "ACK <seq>\n"     command received
+//                 "DONE <seq>\n"    print job finished
+//                 "FAIL <seq>\n"    print job failed
+//
+// 0x00 bytes (HID report padding) are ignored, so the same parser works on a
+// pty or serial port on Linux.
+
+#define HOST_LINK_MAX_LINE 32
+#define PRINT_ACK_TIMEOUT 2000   // No ACK by then -> no agent
+#define PRINT_DONE_TIMEOUT 20000 // After ACK, max wait for DONE/FAIL
+
+enum HostMsgType {
+  HOST_MSG_NONE,
+  HOST_MSG_HELLO,
+  HOST_MSG_ACK,
+  HOST_MSG_DONE,
+  HOST_MSG_FAIL
+};
+
+struct HostMsg {
+  HostMsgType type;
+  uint16_t seq;
+};
+
+class HostLinkParser {
+public:
+  // Returns true when `c` completes a valid message.
+  bool feed(uint8_t c, HostMsg &out) {
+    if (c == 0 || c == '\r')
+      return false;
+    if (c != '\n') {
+      if (_len < HOST_LINK_MAX_LINE - 1)
+        _line[_len++] = (char)c;
+      else
+        _overflow = true;
+      return false;
+    }
+    _line[_len] = '\0';
+    bool ok = !_overflow && parseLine(_line, out);
+    _len = 0;
+    _overflow = false;
+    return ok;
+  }
+
+  static bool parseLine(const char *line, HostMsg &out) {
+    if (strcmp(line, "HELLO") == 0) {
+      out.type = HOST_MSG_HELLO;
+      out.seq = 0;
+      return true;
+    }
+    const char *arg;
+    if (strncmp(line, "ACK ", 4) == 0) {
+      out.type = HOST_MSG_ACK;
+      arg = line + 4;
+    } else if (strncmp(line, "DONE ", 5) == 0) {
+      out.type = HOST_MSG_DONE;
+      arg = line + 5;
+    } else if (strncmp(line, "FAIL ", 5) == 0) {
+      out.type = HOST_MSG_FAIL;
+      arg = line + 5;
+    } else {
+      return false;
+    }
+    if (*arg == '\0')
+      return false;
+    uint32_t seq = 0;
+    for (; *arg; arg++) {
+      if (*arg < '0' || *arg > '9')
+        return false;
+      seq = seq * 10 + (*arg - '0');
+      if (seq > 0xFFFF)
+        return false;
+    }
+    out.seq = (uint16_t)seq;
+    return true;
+  }
+
+private:
+  char _line[HOST_LINK_MAX_LINE];
+  uint8_t _len = 0;
+  bool _overflow = false;
+};
+
+inline int formatPrintCommand(char *buf, size_t size, uint16_t seq) {
+  return snprintf(buf, size, "PRINT %u\n", (unsigned)seq);
+}
+
+enum PrintState {
+  PRINT_IDLE,
+  PRINT_SENT,    // Waiting for ACK
+  PRINT_ACKED,   // Agent has it, waiting for DONE/FAIL
+  PRINT_DONE,    // Confirmed by the agent
+  PRINT_FAILED,  // Agent reported an error
+  PRINT_NO_AGENT // Nobody answered: assume printed (old behaviour)
+};
+
+// Tracks the single print job in flight. Time is passed in (millis()) so the
+// logic also runs on the host.
+class PrintTracker {
+public:
+  uint16_t begin(uint32_t now) {
+    _seq++;
+    _state = PRINT_SENT;
+    _since = now;
+    return _seq;
+  }
+
+  void onMessage(const HostMsg &m, uint32_t now) {
+    if (m.type == HOST_MSG_HELLO) {
+      _agentSeen = true;
+      return;
+    }
+    _agentSeen = true;
+    if (m.seq != _seq)
+      return; // Answer to an older job
+    if (m.type == HOST_MSG_ACK && _state == PRINT_SENT) {
+      _state = PRINT_ACKED;
+      _since = now;
+    } else if (m.type == HOST_MSG_DONE &&
+               (_state == PRINT_SENT || _state == PRINT_ACKED)) {
+      _state = PRINT_DONE;
+    } else if (m.type == HOST_MSG_FAIL &&
+               (_state == PRINT_SENT || _state == PRINT_ACKED)) {
+      _state = PRINT_FAILED;
+    }
+  }
+
+  PrintState poll(uint32_t now) {
+    if (_state == PRINT_SENT && now - _since >= PRINT_ACK_TIMEOUT)
+      _state = PRINT_NO_AGENT;
+    else if (_state == PRINT_ACKED && now - _since >= PRINT_DONE_TIMEOUT)
+      _state = PRINT_FAILED;
+    return _state;
+  }
+
+  void reset() { _state = PRINT_IDLE; }
+  bool agentSeen() const { return _agentSeen; }
+
+private:
+  uint16_t _seq = 0;
+  PrintState _state = PRINT_IDLE;
+  uint32_t _since = 0;
+  bool _agentSeen = false;
+};
+
+#endif
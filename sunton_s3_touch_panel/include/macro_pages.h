@@ -0,0 +1,169 @@
+#ifndef MACRO_PAGES_H
+#define MACRO_PAGES_H
+
+#include "ducky.h"
+#include <ArduinoJson.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Macro pages read once at boot from /macros.json on the SD card:
+//
+// {"pages": [
+//   {"name": "PC", "macros": [
+//     {"label": "CMD", "builtin": "cmd"},
+//     {"label": "Ventas", "payload": "/ventas.txt", "color": "43A047"},
+//     {"label": "Firma", "script": "STRINGLN Un saludo,\nSTRING Tomas"}
+//   ]}
+// ]}
+//
+// "builtin" names one of MACRO_BUILTIN_NAMES, "payload" a DuckyScript file
+// (compiled and cached on first use), "script" inline DuckyScript that is
+// compiled here. Everything ends up in the flat MacroConfig tables; the
+// LVGL objects are built per page only when that page is shown.
+
+#define MACRO_MAX_PAGES 8
+#define MACRO_MAX_ITEMS 64
+#define MACRO_LABEL_LEN 20
+#define MACRO_PAGE_NAME_LEN 16
+#define MACRO_PATH_LEN 40
+#define MACRO_DEFAULT_COLOR 0x1E88E5
+
+enum MacroBuiltin : uint8_t {
+  BUILTIN_PRINT,
+  BUILTIN_CMD,
+  BUILTIN_POWERSHELL,
+  BUILTIN_NOTEPAD,
+  BUILTIN_TASKMGR,
+  BUILTIN_LOCK,
+  BUILTIN_CUSTOM1,
+  BUILTIN_CUSTOM2,
+  BUILTIN_WINR,
+  BUILTIN_SCREENSHOT,
+  BUILTIN_BROWSER,
+  BUILTIN_VSCODE,
+  BUILTIN_COUNT
+};
+
+static const char *const MACRO_BUILTIN_NAMES[BUILTIN_COUNT] = {
+    "print", "cmd",    "powershell", "notepad",    "taskmgr", "lock",
+    "custom1", "custom2", "winr",     "screenshot", "browser", "vscode"};
+
+// Labels of the built-in page used when there is no /macros.json
+static const char *const MACRO_BUILTIN_LABELS[BUILTIN_COUNT] = {
+    "IMPRIMIR", "CMD",      "POWERSHELL", "NOTEPAD", "TAREAS",    "BLOQUEAR",
+    "CUSTOM 1", "CUSTOM 2", "WIN+R",      "CAPTURA", "NAVEGADOR", "VS CODE"};
+
+enum MacroKind : uint8_t { MACRO_BUILTIN, MACRO_PAYLOAD, MACRO_SCRIPT };
+
+struct MacroItem {
+  char label[MACRO_LABEL_LEN];
+  uint32_t color;
+  MacroKind kind;
+  uint8_t builtin;           // MACRO_BUILTIN
+  char path[MACRO_PATH_LEN]; // MACRO_PAYLOAD
+  DuckyProgram script;       // MACRO_SCRIPT
+};
+
+struct MacroPage {
+  char name[MACRO_PAGE_NAME_LEN];
+  uint8_t first; // Index of the first item in MacroConfig::items
+  uint8_t count;
+};
+
+struct MacroConfig {
+  MacroPage pages[MACRO_MAX_PAGES];
+  uint8_t pageCount;
+  MacroItem items[MACRO_MAX_ITEMS];
+  uint8_t itemCount;
+};
+
+typedef void *(*MacroAlloc)(size_t);
+
+inline void macroConfigDefaults(MacroConfig &cfg) {
+  memset(&cfg, 0, sizeof(cfg));
+  MacroPage &p = cfg.pages[cfg.pageCount++];
+  strlcpy(p.name, "PC", sizeof(p.name));
+  p.first = 0;
+  for (uint8_t i = 0; i < BUILTIN_COUNT; i++) {
+    MacroItem &m = cfg.items[cfg.itemCount++];
+    strlcpy(m.label, MACRO_BUILTIN_LABELS[i], sizeof(m.label));
+    m.color = i == BUILTIN_PRINT ? 0xFF9800 : MACRO_DEFAULT_COLOR;
+    m.kind = MACRO_BUILTIN;
+    m.builtin = i;
+  }
+  p.count = cfg.itemCount;
+}
+
+inline bool macroParseItem(JsonObjectConst o, MacroItem &m,
+                           MacroAlloc alloc) {
+  memset(&m, 0, sizeof(m));
+  strlcpy(m.label, o["label"] | "?", sizeof(m.label));
+  const char *color = o["color"] | "";
+  if (*color == '#')
+    color++;
+  m.color = *color ? strtoul(color, NULL, 16) : MACRO_DEFAULT_COLOR;
+
+  if (const char *b = o["builtin"]) {
+    for (uint8_t i = 0; i < BUILTIN_COUNT; i++) {
+      if (strcmp(b, MACRO_BUILTIN_NAMES[i]) == 0) {
+        m.kind = MACRO_BUILTIN;
+        m.builtin = i;
+        return true;
+      }
+    }
+    return false;
+  }
+  if (const char *path = o["payload"]) {
+    m.kind = MACRO_PAYLOAD;
+    strlcpy(m.path, path, sizeof(m.path));
+    return true;
+  }
+  if (const char *src = o["script"]) {
+    size_t len = strlen(src);
+    DuckyProgram &p = m.script;
+    if (!DuckyCompiler::compile(src, len, p))
+      return false;
+    p.code = (uint8_t *)alloc(p.codeLen);
+    p.text = (char *)alloc(p.textLen + 1);
+    if (!p.code || !p.text || !DuckyCompiler::compile(src, len, p)) {
+      free(p.code);
+      free(p.text);
+      return false;
+    }
+    m.kind = MACRO_SCRIPT;
+    return true;
+  }
+  return false;
+}
+
+// Fills `cfg` from a JSON document (File, Stream or char buffer). Invalid
+// entries are skipped; returns the number of macros loaded, or -1 if the
+// document cannot be parsed.
+template <class TInput>
+int macroConfigLoad(TInput &input, size_t docSize, MacroConfig &cfg,
+                    MacroAlloc alloc) {
+  DynamicJsonDocument doc(docSize);
+  if (deserializeJson(doc, input))
+    return -1;
+  memset(&cfg, 0, sizeof(cfg));
+  for (JsonObjectConst page : doc["pages"].as<JsonArrayConst>()) {
+    if (cfg.pageCount >= MACRO_MAX_PAGES)
+      break;
+    MacroPage &p = cfg.pages[cfg.pageCount];
+    strlcpy(p.name, page["name"] | "?", sizeof(p.name));
+    p.first = cfg.itemCount;
+    for (JsonObjectConst item : page["macros"].as<JsonArrayConst>()) {
+      if (cfg.itemCount >= MACRO_MAX_ITEMS)
+        break;
+      if (macroParseItem(item, cfg.items[cfg.itemCount], alloc))
+        cfg.itemCount++;
+    }
+    p.count = cfg.itemCount - p.first;
+    if (p.count > 0)
+      cfg.pageCount++;
+  }
+  return cfg.itemCount;
+}
+
+#endif
@@ -0,0 +1,158 @@
+#ifndef MACRO_RUNNER_H
+#define MACRO_RUNNER_H
+
+#include <stdint.h>
+#include <string.h>
+
+// Cooperative HID macro executor. Macros are queued as actions and drained
+// from loop() with run(millis()), so a WAIT never blocks LVGL.
+//
+// KB needs press(uint8_t), releaseAll(), type(const char *, uint16_t) and
+// typing(); text is handed over whole and the runner waits until typing()
+// is false. A recording fake works the same on the host. call() runs a
+// function in line with the keys, e.g. to report what has been sent.
+
+#define MACRO_QUEUE_LEN 64
+#define MACRO_TEXT_POOL 512
+
+enum MacroOp : uint8_t {
+  MACRO_PRESS,
+  MACRO_RELEASE_ALL,
+  MACRO_TYPE,
+  MACRO_WAIT,
+  MACRO_CALL
+};
+
+typedef void (*MacroFn)();
+
+struct MacroAction {
+  MacroOp op;
+  uint8_t key;
+  uint16_t len;     // MACRO_TYPE: text length
+  uint32_t ms;      // MACRO_WAIT
+  const char *text; // MACRO_TYPE: text pool or caller-owned buffer
+  MacroFn fn;       // MACRO_CALL
+};
+
+template <class KB> class MacroRunner {
+public:
+  explicit MacroRunner(KB &kb) : _kb(kb) {}
+
+  bool press(uint8_t key) {
+    return push({MACRO_PRESS, key, 0, 0, NULL, NULL});
+  }
+  bool releaseAll() { return push({MACRO_RELEASE_ALL, 0, 0, 0, NULL, NULL}); }
+  bool wait(uint32_t ms) { return push({MACRO_WAIT, 0, 0, ms, NULL, NULL}); }
+  // Runs `fn` once every action queued before it has run; dropped by
+  // cancel() like the rest.
+  bool call(MacroFn fn) { return push({MACRO_CALL, 0, 0, 0, NULL, fn}); }
+
+  // Copies `text` into the pool; the pool is recycled once the queue drains.
+  bool type(const char *text) { return type(text, strlen(text)); }
+  bool type(const char *text, size_t len) {
+    if (len == 0)
+      return true;
+    if (len > 0xFFFF || _textUsed + len > MACRO_TEXT_POOL)
+      return false;
+    char *dst = _text + _textUsed;
+    if (!push({MACRO_TYPE, 0, (uint16_t)len, 0, dst, NULL}))
+      return false;
+    memcpy(dst, text, len);
+    _textUsed += len;
+    return true;
+  }
+
+  // Types from a buffer the caller keeps alive until the action has run.
+  bool typeRef(const char *text, uint16_t len) {
+    return len == 0 || push({MACRO_TYPE, 0, len, 0, text, NULL});
+  }
+
+  // Press `mod` + `key` and release both.
+  bool combo(uint8_t mod, uint8_t key) {
+    return press(mod) && press(key) && releaseAll();
+  }
+
+  // Free slots, so callers can check a whole macro fits before queueing it.
+  uint16_t room() const { return MACRO_QUEUE_LEN - _count; }
+  bool busy() const { return _count > 0; }
+
+  // Drops everything pending and releases any held key.
+  void cancel() {
+    bool held = _keysHeld || _typing;
+    clear();
+    if (held)
+      _kb.releaseAll();
+  }
+
+  // Executes every action that is due at `now`; returns when the queue is
+  // empty or the next action is a WAIT that has not elapsed yet.
+  void run(uint32_t now) {
+    while (_count > 0) {
+      MacroAction &a = _queue[_head];
+      switch (a.op) {
+      case MACRO_PRESS:
+        _kb.press(a.key);
+        _keysHeld = true;
+        break;
+      case MACRO_RELEASE_ALL:
+        _kb.releaseAll();
+        _keysHeld = false;
+        break;
+      case MACRO_TYPE:
+        if (!_typing) {
+          _kb.type(a.text, a.len);
+          _typing = true;
+        }
+        if (_kb.typing())
+          return; // Keep typing on the next pass
+        _typing = false;
+        break;
+      case MACRO_WAIT:
+        if (!_waiting) {
+          _waiting = true;
+          _waitStart = now;
+        }
+        if (now - _waitStart < a.ms)
+          return;
+        _waiting = false;
+        break;
+      case MACRO_CALL:
+        a.fn();
+        break;
+      }
+      _head = (_head + 1) % MACRO_QUEUE_LEN;
+      _count--;
+    }
+    _textUsed = 0;
+  }
+
+private:
+  bool push(const MacroAction &a) {
+    if (_count >= MACRO_QUEUE_LEN)
+      return false;
+    _queue[(_head + _count) % MACRO_QUEUE_LEN] = a;
+    _count++;
+    return true;
+  }
+
+  void clear() {
+    _head = _count = 0;
+    _textUsed = 0;
+    _typing = false;
+    _waiting = false;
+    _keysHeld = false;
+  }
+
+  KB &_kb;
+  MacroAction _queue[MACRO_QUEUE_LEN];
+  char _text[MACRO_TEXT_POOL];
+  uint16_t _head = 0;
+  uint16_t _count = 0;
+  uint32_t _textUsed = 0;
+  bool _typing = false;
+  bool _waiting = false;
+  uint32_t _waitStart = 0;
+  bool _keysHeld = false;
+};
+
+#endif
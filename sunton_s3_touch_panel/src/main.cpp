@@ -1,3 +1,12 @@
+#include "axs_touch.h"
+#include "boot_seq.h"
+#include "ducky.h"
+#include "hid_typer.h"
+#include "host_link.h"
+#define LV_SPLIT_IMPLEMENTATION
+#include "lv_mem_split.h"
+#include "macro_pages.h"
+#include "macro_runner.h"
 #include <Arduino.h>
 #include <ArduinoJson.h>
 #include <Arduino_GFX_Library.h>
@@ -7,12 +16,31 @@
 #include <TJpg_Decoder.h>
 #include <USB.h>
 #include <USBHIDKeyboard.h>
+#include <USBHIDVendor.h>
 #include <Wire.h>
 #include <lvgl.h>
 #include <string.h>
 
+// Scripted render benchmark at boot (env "bench"), see ui_bench.h
+#ifndef UI_BENCH
+#define UI_BENCH 0
+#endif
+#if UI_BENCH
+#include "ui_bench.h"
+UiBench uiBench;
+#endif
+
+// Touch-to-photon latency and fps (env "trace"), see latency_trace.h
+#ifndef LATENCY_TRACE
+#define LATENCY_TRACE 0
+#endif
+#include "latency_trace.h"
+#if LATENCY_TRACE
+LatencyTrace latTrace;
+#endif
+
 // Forward declarations & Global Objects
-void printLabel();
+bool printLabel();
 class Arduino_AXS15231B;
 class Arduino_Canvas;
 
@@ -39,6 +67,49 @@ volatile bool imageReady = false;
 
 // --- Move these here to be available globally ---
 USBHIDKeyboard Keyboard;
+
+// Layout of the PCs the panel types into (HID_LAYOUT_EN_US / _ES_ES)
+#ifndef HID_KEYBOARD_LAYOUT
+#define HID_KEYBOARD_LAYOUT HID_LAYOUT_ES_ES
+#endif
+
+// Text goes out as raw reports built from the layout tables
+struct ReportSink {
+  void send(uint8_t mods, uint8_t usage) {
+    KeyReport r = {mods, 0, {usage, 0, 0, 0, 0, 0}};
+    Keyboard.sendReport(&r);
+  }
+};
+ReportSink reportSink;
+HidTyper<ReportSink> typer(reportSink, HID_KEYBOARD_LAYOUT);
+
+// Keyboard as seen by MacroRunner. Printable keys in combos ("GUI r",
+// "CTRL -") are looked up in the layout too, instead of the US ASCII map.
+struct PanelKeyboard {
+  size_t press(uint8_t k) {
+    const HidLayoutKey *lk =
+        k < 0x80 ? hidLayoutFind(typer.layout(), k) : NULL;
+    if (!lk || lk->dead.usage)
+      return Keyboard.press(k);
+    for (uint8_t i = 0; i < 8; i++)
+      if (lk->key.mods & (1 << i))
+        Keyboard.pressRaw(0xE0 + i);
+    return Keyboard.pressRaw(lk->key.usage);
+  }
+  void releaseAll() {
+    typer.cancel();
+    Keyboard.releaseAll();
+  }
+  void type(const char *text, uint16_t len) {
+    typer.begin(text, len, micros());
+  }
+  bool typing() { return typer.busy(); }
+};
+PanelKeyboard panelKeyboard;
+MacroRunner<PanelKeyboard> macro(panelKeyboard);
+USBHIDVendor HostLink(63, false); // Print acks from the PC agent
+HostLinkParser hostParser;
+PrintTracker printJob;
 Arduino_ESP32QSPI *bus = new Arduino_ESP32QSPI(45, 47, 21, 48, 40, 39);
 Arduino_AXS15231B *g =
     new Arduino_AXS15231B(bus, GFX_NOT_DEFINED, 0, false, 320, 480);
@@ -47,11 +118,18 @@ lv_obj_t *statusLabel = NULL;
 bool sdReady = false;
 bool keyboardReady = false;
 
-enum DisplayMode { MODE_UI, MODE_RECIBIDO, MODE_IMAGE, MODE_IMPRESO };
+enum DisplayMode {
+  MODE_UI,
+  MODE_RECIBIDO,
+  MODE_IMAGE,
+  MODE_IMPRESO,
+  MODE_PRINT_ERROR
+};
 DisplayMode currentMode = MODE_UI;
 unsigned long stateStartTime = 0;
 const unsigned long DURATION_RECIBIDO = 2000;
-const unsigned long DURATION_IMAGE = 3000; // Duration to show image after print
+const unsigned long DURATION_IMAGE =
+    3000; // Image time when no PC agent confirms the print
 const unsigned long DURATION_IMPRESO_TEXT =
     3000; // Duration for "Impreso" label
 
@@ -148,7 +226,6 @@ class ImageCallbacks : public NimBLECharacteristicCallbacks {
 
 // Pins Sunton 3.5" (AXS15231B)
 #define GFX_BL 1
-#define TOUCH_ADDR 0x3B
 #define TOUCH_SDA 4
 #define TOUCH_SCL 8
 #define TOUCH_I2C_CLOCK 400000
@@ -174,218 +251,424 @@ void my_disp_flush(lv_disp_drv_t *disp, const lv_area_t *area,
   uint32_t w = (area->x2 - area->x1 + 1);
   uint32_t h = (area->y2 - area->y1 + 1);
   gfx->draw16bitRGBBitmap(area->x1, area->y1, (uint16_t *)&color_p->full, w, h);
+#if UI_BENCH
+  uiBench.flushed(area);
+#endif
+  LAT_FLUSHED(disp);
   lv_disp_flush_ready(disp);
 }
 
 // Touch Handling
-bool getTouchPoint(uint16_t &x, uint16_t &y) {
-  uint8_t data[8] = {0};
-  const uint8_t cmd[11] = {0xb5, 0xab, 0xa5, 0x5a, 0x00, 0x00,
-                           0x00, 0x08, 0x00, 0x00, 0x00};
-  Wire.beginTransmission(TOUCH_ADDR);
-  Wire.write(cmd, 11);
-  if (Wire.endTransmission() != 0)
-    return false;
-  if (Wire.requestFrom((uint16_t)TOUCH_ADDR, (uint8_t)8) != 8)
-    return false;
-  for (int i = 0; i < 8; i++)
-    data[i] = Wire.read();
-  if (data[1] > 0 && data[1] <= 10) {
-    uint16_t rx = ((data[2] & 0x0F) << 8) | data[3];
-    uint16_t ry = ((data[4] & 0x0F) << 8) | data[5];
-    if (rx > 320 || ry > 480)
-      return false;
-    y = map(rx, 0, 320, 320, 0);
-    x = ry;
-    return true;
+AxsTouch axs;
+TouchGestures gestures;
+void stepPage(int8_t dir);
+
+volatile bool touchReady = false; // Set by bootTouch() after the reset
+
+void my_touchpad_read(lv_indev_drv_t *drv, lv_indev_data_t *data) {
+  if (!touchReady)
+    return;
+  static AxsPoint last = {0, 0, 0};
+  static uint8_t points = 0;
+  AxsPoint pts[AXS_MAX_POINTS];
+  int8_t n = axs.read(pts);
+  if (n >= 0)
+    points = n; // A bus error keeps the touch as it was
+  if (n > 0)
+    last = pts[0];
+  TouchGesture g = gestures.feed(millis(), points, last.x, last.y);
+  if (g == GESTURE_SWIPE_LEFT || g == GESTURE_SWIPE_RIGHT) {
+    lv_indev_reset(lv_indev_get_act(), NULL); // No click where it started
+    stepPage(g == GESTURE_SWIPE_LEFT ? 1 : -1);
   }
-  return false;
+  bool down = points > 0 && !gestures.swiped();
+  LAT_TOUCH(micros(), down);
+  data->state = down ? LV_INDEV_STATE_PR : LV_INDEV_STATE_REL;
+  data->point.x = last.x;
+  data->point.y = last.y;
 }
 
-void my_touchpad_read(lv_indev_drv_t *drv, lv_indev_data_t *data) {
-  uint16_t tx, ty;
-  if (getTouchPoint(tx, ty)) {
-    data->state = LV_INDEV_STATE_PR;
-    data->point.x = tx;
-    data->point.y = ty;
-  } else {
-    data->state = LV_INDEV_STATE_REL;
+// SD Payloads (DuckyScript, compiled once and cached in PSRAM)
+#define PAYLOAD_CACHE_SLOTS 4
+
+struct CachedPayload {
+  char path[40];
+  size_t size;
+  time_t mtime; // size + mtime invalidate the entry
+  DuckyProgram prog;
+};
+CachedPayload payloadCache[PAYLOAD_CACHE_SLOTS];
+uint8_t payloadCacheNext = 0;
+DuckyPlayer payload;
+
+void freePayload(CachedPayload &c) {
+  free(c.prog.code);
+  free(c.prog.text);
+  memset(&c, 0, sizeof(c));
+}
+
+// Reads the whole file in one go and compiles it twice: once to size the
+// bytecode, once into exact PSRAM buffers.
+bool compilePayload(File &f, DuckyProgram &out) {
+  size_t size = f.size();
+  char *src = (char *)ps_malloc(size + 1);
+  if (!src)
+    return false;
+  DuckyProgram p = {};
+  bool ok = f.read((uint8_t *)src, size) == size &&
+            DuckyCompiler::compile(src, size, p);
+  if (ok) {
+    p.code = (uint8_t *)ps_malloc(p.codeLen);
+    p.text = (char *)ps_malloc(p.textLen + 1);
+    ok = p.code && p.text && DuckyCompiler::compile(src, size, p);
+  }
+  free(src);
+  if (!ok) {
+    free(p.code);
+    free(p.text);
+    return false;
   }
+  out = p;
+  return true;
 }
 
-// SD Macro Parser (Duckyscript Lite)
-void processSDCommand(String cmd) {
-  cmd.trim();
-  if (cmd.length() == 0 || cmd.startsWith("//"))
-    return;
+const DuckyProgram *loadPayload(const char *path) {
+  File f = SD.open(path);
+  if (!f)
+    return NULL;
+  size_t size = f.size();
+  time_t mtime = f.getLastWrite();
+
+  CachedPayload *slot = NULL;
+  for (int i = 0; i < PAYLOAD_CACHE_SLOTS; i++) {
+    if (strcmp(payloadCache[i].path, path) == 0) {
+      slot = &payloadCache[i];
+      break;
+    }
+  }
+  if (slot && slot->size == size && slot->mtime == mtime) {
+    f.close();
+    return &slot->prog;
+  }
+  if (!slot) {
+    slot = &payloadCache[payloadCacheNext];
+    payloadCacheNext = (payloadCacheNext + 1) % PAYLOAD_CACHE_SLOTS;
+  }
+  freePayload(*slot);
 
-  if (cmd.startsWith("DELAY ")) {
-    delay(cmd.substring(6).toInt());
-  } else if (cmd.startsWith("STRING ")) {
-    Keyboard.print(cmd.substring(7));
-  } else if (cmd == "ENTER") {
-    Keyboard.press(KEY_RETURN);
-    Keyboard.releaseAll();
-  } else if (cmd.startsWith("GUI ") || cmd.startsWith("WINDOWS ")) {
-    char k = cmd.substring(cmd.indexOf(' ') + 1).charAt(0);
-    Keyboard.press(KEY_LEFT_GUI);
-    Keyboard.press(k);
-    Keyboard.releaseAll();
-  } else if (cmd.startsWith("ALT ")) {
-    char k = cmd.substring(4).charAt(0);
-    Keyboard.press(KEY_LEFT_ALT);
-    Keyboard.press(k);
-    Keyboard.releaseAll();
-  } else if (cmd == "TAB") {
-    Keyboard.press(KEY_TAB);
-    Keyboard.releaseAll();
+  unsigned long t0 = millis();
+  bool ok = compilePayload(f, slot->prog);
+  f.close();
+  if (!ok) {
+    Serial.printf("Payload: %s failed to compile\n", path);
+    return NULL;
   }
+  strlcpy(slot->path, path, sizeof(slot->path));
+  slot->size = size;
+  slot->mtime = mtime;
+  Serial.printf("Payload: %s -> %u B code, %u B text, %u skipped (%lu ms)\n",
+                path, slot->prog.codeLen, slot->prog.textLen,
+                slot->prog.unknownLines, millis() - t0);
+  return &slot->prog;
 }
 
 void executeSDPayload(const char *path) {
   if (!sdReady)
     return;
-  File f = SD.open(path);
-  if (!f)
-    return;
-  while (f.available()) {
-    processSDCommand(f.readStringUntil('\n'));
+  const DuckyProgram *p = loadPayload(path);
+  if (p)
+    payload.start(p);
+}
+
+bool macroBusy() { return macro.busy() || payload.active(); }
+
+void cancelMacro() {
+  payload.stop();
+  macro.cancel();
+}
+
+// Host Link
+void sendPrintCommand() {
+  char line[HOST_LINK_MAX_LINE];
+  int n = formatPrintCommand(line, sizeof(line), printJob.begin(millis()));
+  HostLink.write((const uint8_t *)line, n);
+}
+
+void pollHostLink() {
+  HostMsg m;
+  while (HostLink.available()) {
+    if (hostParser.feed(HostLink.read(), m)) {
+      Serial.printf("HostLink: msg %d seq %u\n", m.type, m.seq);
+      printJob.onMessage(m, millis());
+    }
   }
-  f.close();
 }
 
 // Shortcut Actions
-void printLabel() {
-  Serial.println("HID: Sending Alt+P...");
-  Keyboard.press(KEY_LEFT_ALT);
-  Keyboard.press('p');
-  delay(10); // Tiny delay to ensure Windows registers the combo
-  Keyboard.releaseAll();
-  Serial.println("HID: Alt+P Sent");
-}
-
-void openCMD() {
-  Keyboard.press(KEY_LEFT_GUI);
-  Keyboard.press('r');
-  Keyboard.releaseAll();
-  delay(400);
-  Keyboard.print("cmd");
-  delay(100);
-  Keyboard.press(KEY_RETURN);
-  Keyboard.releaseAll();
+// Alt+P, and the PRINT line to the agent once the keys are out, so the job
+// is tracked from then on. False when the macro queue is full: nothing is
+// queued and no job starts.
+bool printLabel() {
+  if (macro.room() < 5) {
+    Serial.println("HID: Alt+P not queued, macro queue full");
+    return false;
+  }
+  macro.press(KEY_LEFT_ALT);
+  macro.press('p');
+  macro.wait(10); // Tiny delay to ensure Windows registers the combo
+  macro.releaseAll();
+  macro.call(sendPrintCommand);
+  Serial.println("HID: Alt+P Queued");
+  return true;
 }
 
-void openPowerShell() {
-  Keyboard.press(KEY_LEFT_GUI);
-  Keyboard.press('r');
-  Keyboard.releaseAll();
-  delay(400);
-  Keyboard.print("powershell");
-  delay(100);
-  Keyboard.press(KEY_RETURN);
-  Keyboard.releaseAll();
+// Win+R, type `cmd` in the Run box and press Enter.
+void runDialog(const char *cmd) {
+  macro.combo(KEY_LEFT_GUI, 'r');
+  macro.wait(400);
+  macro.type(cmd);
+  macro.wait(100);
+  macro.press(KEY_RETURN);
+  macro.releaseAll();
 }
 
-void openNotepad() {
-  Keyboard.press(KEY_LEFT_GUI);
-  Keyboard.press('r');
-  Keyboard.releaseAll();
-  delay(400);
-  Keyboard.print("notepad");
-  delay(100);
-  Keyboard.press(KEY_RETURN);
-  Keyboard.releaseAll();
+void openCMD() { runDialog("cmd"); }
+
+void openPowerShell() { runDialog("powershell"); }
+
+void openNotepad() { runDialog("notepad"); }
+
+void lockPC() { macro.combo(KEY_LEFT_GUI, 'l'); }
+
+void openTaskManager() {
+  macro.press(KEY_LEFT_CTRL);
+  macro.press(KEY_LEFT_SHIFT);
+  macro.press(KEY_ESC);
+  macro.releaseAll();
 }
 
-void lockPC() {
-  Keyboard.press(KEY_LEFT_GUI);
-  Keyboard.press('l');
-  Keyboard.releaseAll();
+// Macro pages
+MacroConfig macroCfg;
+
+// True when the pages came from /macros.json
+bool loadMacroConfig() {
+  File f;
+  if (sdReady)
+    f = SD.open("/macros.json");
+  if (f) {
+    int n = macroConfigLoad(f, f.size() * 2 + 1024, macroCfg, ps_malloc);
+    f.close();
+    if (n > 0) {
+      Serial.printf("Macros: %d in %d pages\n", n, macroCfg.pageCount);
+      return true;
+    }
+    Serial.println("Macros: /macros.json invalid, using defaults");
+  }
+  macroConfigDefaults(macroCfg);
+  return false;
 }
 
-void openTaskManager() {
-  Keyboard.press(KEY_LEFT_CTRL);
-  Keyboard.press(KEY_LEFT_SHIFT);
-  Keyboard.press(KEY_ESC);
-  Keyboard.releaseAll();
+void runBuiltin(uint8_t builtin) {
+  switch (builtin) {
+  case BUILTIN_PRINT:
+    printLabel();
+    break;
+  case BUILTIN_CMD:
+    openCMD();
+    break;
+  case BUILTIN_POWERSHELL:
+    openPowerShell();
+    break;
+  case BUILTIN_NOTEPAD:
+    openNotepad();
+    break;
+  case BUILTIN_TASKMGR:
+    openTaskManager();
+    break;
+  case BUILTIN_LOCK:
+    lockPC();
+    break;
+  case BUILTIN_CUSTOM1:
+    executeSDPayload("/payloads/custom1.txt");
+    break;
+  case BUILTIN_CUSTOM2:
+    executeSDPayload("/payloads/custom2.txt");
+    break;
+  case BUILTIN_WINR:
+    macro.combo(KEY_LEFT_GUI, 'r');
+    break;
+  case BUILTIN_SCREENSHOT:
+    macro.combo(KEY_LEFT_GUI, KEY_PRTSC);
+    break;
+  case BUILTIN_BROWSER:
+    runDialog("https://google.com");
+    break;
+  case BUILTIN_VSCODE:
+    macro.press(KEY_LEFT_GUI);
+    macro.releaseAll();
+    macro.wait(400);
+    macro.type("code");
+    macro.wait(400);
+    macro.press(KEY_RETURN);
+    macro.releaseAll();
+    break;
+  }
+}
+
+void runMacro(uint8_t idx) {
+  MacroItem &m = macroCfg.items[idx];
+  Serial.printf("Macro: %s\n", m.label);
+  switch (m.kind) {
+  case MACRO_BUILTIN:
+    runBuiltin(m.builtin);
+    break;
+  case MACRO_PAYLOAD:
+    executeSDPayload(m.path);
+    break;
+  case MACRO_SCRIPT:
+    payload.start(&m.script);
+    break;
+  }
 }
 
 // UI Event
+unsigned long statusMsgTime = 0;
+bool statusMsgPending = false;
+
 static void btn_event_cb(lv_event_t *e) {
-  uintptr_t type = (uintptr_t)lv_event_get_user_data(e);
+  uintptr_t idx = (uintptr_t)lv_event_get_user_data(e);
   if (lv_event_get_code(e) == LV_EVENT_CLICKED) {
-    String msg = "Executing...";
-    switch (type) {
-    case 0:
-      msg = "Printing Label";
-      printLabel();
-      break;
-    case 1:
-      msg = "CMD";
-      openCMD();
-      break;
-    case 2:
-      msg = "PowerShell";
-      openPowerShell();
-      break;
-    case 3:
-      msg = "Notepad";
-      openNotepad();
-      break;
-    case 4:
-      msg = "Task Mgr";
-      openTaskManager();
-      break;
-    case 5:
-      msg = "Locking PC";
-      lockPC();
-      break;
-    case 6:
-      msg = "Custom 1";
-      executeSDPayload("/payloads/custom1.txt");
-      break;
-    case 7:
-      msg = "Custom 2";
-      executeSDPayload("/payloads/custom2.txt");
-      break;
-    case 8:
-      msg = "Win+R";
-      Keyboard.press(KEY_LEFT_GUI);
-      Keyboard.press('r');
-      Keyboard.releaseAll();
-      break;
-    case 9:
-      msg = "Screenshot";
-      Keyboard.press(KEY_LEFT_GUI);
-      Keyboard.press(KEY_PRTSC);
-      Keyboard.releaseAll();
-      break;
-    case 10:
-      msg = "Browser";
-      Keyboard.press(KEY_LEFT_GUI);
-      Keyboard.press('r');
-      Keyboard.releaseAll();
-      delay(400);
-      Keyboard.print("https://google.com");
-      delay(100);
-      Keyboard.press(KEY_RETURN);
-      Keyboard.releaseAll();
-      break;
-    case 11:
-      msg = "VS Code";
-      Keyboard.press(KEY_LEFT_GUI);
-      Keyboard.print("code");
-      delay(400);
-      Keyboard.press(KEY_RETURN);
-      Keyboard.releaseAll();
-      break;
+    // A tap while a macro is still typing cancels it
+    if (macroBusy()) {
+      cancelMacro();
+      lv_label_set_text(statusLabel, "Cancelado");
+    } else {
+      runMacro(idx);
+      lv_label_set_text(statusLabel, macroCfg.items[idx].label);
     }
-    lv_label_set_text(statusLabel, msg.c_str());
-    delay(500);
-    lv_label_set_text(statusLabel, "Ready");
+    statusMsgTime = millis();
+    statusMsgPending = true;
   }
 }
 
+// Page objects are built the first time a page is shown and deleted again
+// when more than MACRO_PAGES_BUILT pages exist, so the LVGL heap only holds
+// the buttons of the pages in use.
+#define MACRO_PAGES_BUILT 2
+
+lv_obj_t *pageArea = NULL;
+lv_obj_t *pageTitle = NULL;
+lv_obj_t *navBtn[2]; // Hidden with a single page
+lv_obj_t *pageObj[MACRO_MAX_PAGES];
+uint32_t pageUsed[MACRO_MAX_PAGES]; // LRU stamp
+uint32_t pageStamp = 0;
+uint8_t currentPage = 0;
+
+lv_obj_t *buildPage(uint8_t p) {
+  const MacroPage &page = macroCfg.pages[p];
+  lv_obj_t *cont = lv_obj_create(pageArea);
+  lv_obj_set_size(cont, lv_pct(100), lv_pct(100));
+  lv_obj_set_style_bg_opa(cont, LV_OPA_TRANSP, 0);
+  lv_obj_set_style_border_width(cont, 0, 0);
+  lv_obj_set_style_pad_all(cont, 8, 0);
+  lv_obj_set_style_pad_gap(cont, 8, 0);
+  lv_obj_set_flex_flow(cont, LV_FLEX_FLOW_ROW_WRAP);
+  lv_obj_set_scroll_dir(cont, LV_DIR_VER);
+
+  for (uint8_t i = 0; i < page.count; i++) {
+    uint8_t idx = page.first + i;
+    lv_obj_t *btn = lv_btn_create(cont);
+    lv_obj_set_size(btn, 106, 70);
+    lv_obj_set_style_bg_color(btn, lv_color_hex(macroCfg.items[idx].color), 0);
+    lv_obj_set_style_radius(btn, 12, 0);
+    lv_obj_add_event_cb(btn, btn_event_cb, LV_EVENT_CLICKED,
+                        (void *)(uintptr_t)idx);
+    lv_obj_t *l = lv_label_create(btn);
+    lv_label_set_text(l, macroCfg.items[idx].label);
+    lv_obj_center(l);
+  }
+  return cont;
+}
+
+void evictPages() {
+  for (;;) {
+    uint8_t built = 0, oldest = 0;
+    for (uint8_t i = 0; i < macroCfg.pageCount; i++) {
+      if (!pageObj[i])
+        continue;
+      built++;
+      if (!pageObj[oldest] || pageUsed[i] < pageUsed[oldest])
+        oldest = i;
+    }
+    if (built <= MACRO_PAGES_BUILT)
+      return;
+    lv_obj_del(pageObj[oldest]);
+    pageObj[oldest] = NULL;
+  }
+}
+
+void showPage(uint8_t p) {
+  uint32_t t0 = micros();
+  bool built = pageObj[p] == NULL;
+  if (pageObj[currentPage])
+    lv_obj_add_flag(pageObj[currentPage], LV_OBJ_FLAG_HIDDEN);
+  if (built)
+    pageObj[p] = buildPage(p);
+  lv_obj_clear_flag(pageObj[p], LV_OBJ_FLAG_HIDDEN);
+  pageUsed[p] = ++pageStamp;
+  currentPage = p;
+  evictPages();
+  lv_label_set_text_fmt(pageTitle, "%s  %d/%d", macroCfg.pages[p].name,
+                        p + 1, macroCfg.pageCount);
+
+  LvMemReport mem;
+  lvMemReport(mem);
+  Serial.printf("Page %d %s in %lu us, LVGL heap %lu used / %lu free\n", p,
+                built ? "built" : "shown", (unsigned long)(micros() - t0),
+                (unsigned long)mem.used, (unsigned long)mem.free);
+}
+
+// Nav buttons and touch swipes, wrapping around
+void stepPage(int8_t dir) {
+  uint8_t n = macroCfg.pageCount;
+  if (n > 1)
+    showPage((currentPage + n + dir) % n);
+}
+
+static void nav_event_cb(lv_event_t *e) {
+  stepPage((int8_t)(intptr_t)lv_event_get_user_data(e));
+}
+
+lv_obj_t *createNavButton(lv_obj_t *parent, const char *sym, int dir) {
+  lv_obj_t *btn = lv_btn_create(parent);
+  lv_obj_set_size(btn, 50, 35);
+  lv_obj_set_style_bg_color(btn, lv_color_hex(0x2A2F3D), 0);
+  lv_obj_add_event_cb(btn, nav_event_cb, LV_EVENT_CLICKED,
+                      (void *)(intptr_t)dir);
+  lv_obj_t *l = lv_label_create(btn);
+  lv_label_set_text(l, sym);
+  lv_obj_center(l);
+  return btn;
+}
+
+// Drops the built pages and shows the first one of macroCfg; the header and
+// status bar stay, so a new config swaps only the pages on screen
+void reloadPages() {
+  for (uint8_t i = 0; i < MACRO_MAX_PAGES; i++) {
+    if (pageObj[i])
+      lv_obj_del(pageObj[i]);
+    pageObj[i] = NULL;
+  }
+  currentPage = 0;
+  for (uint8_t i = 0; i < 2; i++) {
+    if (macroCfg.pageCount > 1)
+      lv_obj_clear_flag(navBtn[i], LV_OBJ_FLAG_HIDDEN);
+    else
+      lv_obj_add_flag(navBtn[i], LV_OBJ_FLAG_HIDDEN);
+  }
+  showPage(0);
+}
+
 void createMacroUI() {
   lv_obj_t *scr = lv_scr_act();
   lv_obj_set_style_bg_color(scr, lv_color_hex(0x0A0B10), 0);
@@ -394,54 +677,78 @@ void createMacroUI() {
   lv_obj_set_size(header, 480, 45);
   lv_obj_set_style_bg_color(header, lv_color_hex(0x161922), 0);
   lv_obj_set_style_border_width(header, 0, 0);
-  lv_obj_t *title = lv_label_create(header);
-  lv_label_set_text(title, "DELFIN PANEL");
-  lv_obj_set_style_text_color(title, lv_color_hex(0xFFFFFF), 0);
-  lv_obj_center(title);
+  lv_obj_set_style_pad_all(header, 0, 0);
+  lv_obj_clear_flag(header, LV_OBJ_FLAG_SCROLLABLE);
+  pageTitle = lv_label_create(header);
+  lv_obj_set_style_text_color(pageTitle, lv_color_hex(0xFFFFFF), 0);
+  lv_obj_center(pageTitle);
+  navBtn[0] = createNavButton(header, LV_SYMBOL_LEFT, -1);
+  lv_obj_align(navBtn[0], LV_ALIGN_LEFT_MID, 5, 0);
+  navBtn[1] = createNavButton(header, LV_SYMBOL_RIGHT, 1);
+  lv_obj_align(navBtn[1], LV_ALIGN_RIGHT_MID, -5, 0);
+
+  pageArea = lv_obj_create(scr);
+  lv_obj_set_size(pageArea, 480, 245);
+  lv_obj_align(pageArea, LV_ALIGN_TOP_MID, 0, 45);
+  lv_obj_set_style_bg_opa(pageArea, LV_OPA_TRANSP, 0);
+  lv_obj_set_style_border_width(pageArea, 0, 0);
+  lv_obj_set_style_pad_all(pageArea, 0, 0);
+  lv_obj_clear_flag(pageArea, LV_OBJ_FLAG_SCROLLABLE);
 
   statusLabel = lv_label_create(scr);
   lv_obj_align(statusLabel, LV_ALIGN_BOTTOM_MID, 0, -5);
   lv_label_set_text(statusLabel, "Listo");
   lv_obj_set_style_text_color(statusLabel, lv_color_hex(0x8C92AC), 0);
 
-  lv_obj_t *btn = lv_btn_create(scr);
-  lv_obj_set_size(btn, 200, 80);
-  lv_obj_center(btn);
-  lv_obj_set_style_bg_color(btn, lv_color_hex(0x1E88E5), 0);
-  lv_obj_set_style_radius(btn, 12, 0);
-  lv_obj_add_event_cb(btn, btn_event_cb, LV_EVENT_CLICKED,
-                      (void *)(uintptr_t)1);
-
-  lv_obj_t *l = lv_label_create(btn);
-  lv_label_set_text(l, "ABRIR TERMINAL");
-  lv_obj_set_style_text_font(l, &lv_font_montserrat_20, 0);
-  lv_obj_center(l);
-
-  // --- Add a Test HID Button ---
-  lv_obj_t *testBtn = lv_btn_create(scr);
-  lv_obj_set_size(testBtn, 150, 50);
-  lv_obj_align(testBtn, LV_ALIGN_BOTTOM_LEFT, 10, -50);
-  lv_obj_set_style_bg_color(testBtn, lv_color_hex(0xFF9800), 0);
-  lv_obj_add_event_cb(
-      testBtn,
-      [](lv_event_t *e) {
-        if (lv_event_get_code(e) == LV_EVENT_CLICKED) {
-          Serial.println("UI: Test HID Button Clicked");
-          printLabel(); // Test Alt+P combo
-        }
-      },
-      LV_EVENT_CLICKED, NULL);
-  lv_obj_t *testLabel = lv_label_create(testBtn);
-  lv_label_set_text(testLabel, "TEST HID");
-  lv_obj_center(testLabel);
+  reloadPages();
 }
 
-void setup() {
-  Serial.begin(115200);
-  delay(1000);
+#if UI_BENCH
+void runUiBench() {
+  uiBench.begin("s3_touch_panel");
+  uiBench.run("full_invalidate",
+              [](uint16_t) { lv_obj_invalidate(lv_scr_act()); });
+  if (macroCfg.pageCount > 1)
+    uiBench.run("page_switch", [](uint16_t) {
+      showPage((currentPage + 1) % macroCfg.pageCount);
+    });
+  showPage(0);
+  lv_refr_now(NULL);
+  if (lv_obj_get_child_cnt(pageObj[0]))
+    uiBench.run("button_press", [](uint16_t i) {
+      lv_obj_t *btn = lv_obj_get_child(pageObj[0], 0);
+      if (i & 1)
+        lv_obj_clear_state(btn, LV_STATE_PRESSED);
+      else
+        lv_obj_add_state(btn, LV_STATE_PRESSED);
+    });
+  uiBench.run("label_update", [](uint16_t i) {
+    lv_label_set_text_fmt(statusLabel, "RAM:%u | BLE:OK | HID:READY",
+                          200000 + i * 37);
+  });
+  uiBench.end();
+}
+#endif
+
+// Boot phases, see boot_seq.h. The UI is up once display and ui have run;
+// touch, SD and BLE start on their own tasks meanwhile. Same order as the
+// boot.add() calls in setup().
+enum {
+  PHASE_DISPLAY,
+  PHASE_UI,
+  PHASE_USB,
+  PHASE_TOUCH,
+  PHASE_SD,
+  PHASE_MACROS,
+  PHASE_BLE,
+};
+BootSeq boot;
 
-  if (!gfx->begin())
+bool bootDisplay() {
+  if (!gfx->begin()) {
     Serial.println("Gfx FAIL");
+    return false;
+  }
   gfx->setRotation(1);
   gfx->fillScreen(0x0000);
   gfx->flush();
@@ -449,26 +756,11 @@ void setup() {
   // Optional: Use PWM for backlight if supported, otherwise just a reliable
   // level
   analogWrite(GFX_BL, 128); // 50% brightness to save power
+  return true;
+}
 
-  pinMode(TOUCH_RST_PIN, OUTPUT);
-  digitalWrite(TOUCH_RST_PIN, LOW);
-  delay(100);
-  digitalWrite(TOUCH_RST_PIN, HIGH);
-  delay(100);
-  Wire.begin(TOUCH_SDA, TOUCH_SCL);
-
-  USB.begin();
-  Keyboard.begin();
-  keyboardReady = true;
-  Serial.println("USB: HID & CDC Initialized");
-
-  SPI.begin(SD_SCK, SD_MISO, SD_MOSI, SD_CS);
-  if (SD.begin(SD_CS)) {
-    sdReady = true;
-    if (!SD.exists("/payloads"))
-      SD.mkdir("/payloads");
-  }
-
+// Built-in pages until the SD card has been read (PHASE_MACROS)
+bool bootUi() {
   lv_init();
   lv_disp_draw_buf_init(&draw_buf, buf, NULL, screenWidth * 30);
   static lv_disp_drv_t d_drv;
@@ -483,16 +775,66 @@ void setup() {
   lv_indev_drv_init(&i_drv);
   i_drv.type = LV_INDEV_TYPE_POINTER;
   i_drv.read_cb = my_touchpad_read;
+  LAT_INDEV(i_drv);
   lv_indev_drv_register(&i_drv);
 
+  macroConfigDefaults(macroCfg);
   createMacroUI();
-  lv_label_set_text(statusLabel, sdReady ? "Ready (SD OK)" : "Ready (No SD)");
+  lv_label_set_text(statusLabel, "Starting...");
+  LAT_BEGIN("s3_touch_panel");
+  lv_refr_now(NULL);
+  gfx->flush();
 
   // --- JPEG Decoder Initialization ---
   TJpgDec.setCallback(tjpg_callback);
   TJpgDec.setJpgScale(1);
+  return true;
+}
 
-  // --- BLE Initialization ---
+bool bootUsb() {
+  HostLink.begin();
+  USB.begin();
+  Keyboard.begin();
+  keyboardReady = true;
+  Serial.println("USB: HID & CDC Initialized");
+  return true;
+}
+
+bool bootTouch() {
+  pinMode(TOUCH_RST_PIN, OUTPUT);
+  digitalWrite(TOUCH_RST_PIN, LOW);
+  delay(100);
+  digitalWrite(TOUCH_RST_PIN, HIGH);
+  delay(100);
+  Wire.begin(TOUCH_SDA, TOUCH_SCL);
+  axs.begin(axsCal(1, 480, 320));
+  touchReady = true;
+  return true;
+}
+
+// After PHASE_TOUCH: SD_SCK is the touch reset pin
+bool bootSd() {
+  SPI.begin(SD_SCK, SD_MISO, SD_MOSI, SD_CS);
+  if (SD.begin(SD_CS)) {
+    sdReady = true;
+    if (!SD.exists("/payloads"))
+      SD.mkdir("/payloads");
+  }
+  return sdReady;
+}
+
+// Pages from /macros.json replace the built-in ones in place
+bool bootMacros() {
+  if (loadMacroConfig())
+    reloadPages();
+  lv_label_set_text(statusLabel, sdReady ? "Ready (SD OK)" : "Ready (No SD)");
+#if UI_BENCH
+  runUiBench();
+#endif
+  return true;
+}
+
+bool bootBle() {
   NimBLEDevice::init("DelfinPanel");
   pServer = NimBLEDevice::createServer();
   pServer->setCallbacks(new MyServerCallbacks());
@@ -515,22 +857,57 @@ void setup() {
   pAdvertising->setScanResponse(true);
   pAdvertising->start();
   Serial.println("BLE Server Started as 'DelfinPanel'");
-  Serial.printf("USB HID Initialized: %s\n", keyboardReady ? "YES" : "NO");
+  return true;
+}
+
+void setup() {
+  Serial.begin(115200);
+  boot.add("display", BOOT_MAIN, bootDisplay);
+  boot.add("ui", BOOT_MAIN, bootUi, BOOT_BIT(PHASE_DISPLAY));
+  boot.add("usb", BOOT_MAIN, bootUsb);
+  boot.add("touch", BOOT_TASK, bootTouch);
+  boot.add("sd", BOOT_TASK, bootSd, BOOT_BIT(PHASE_TOUCH));
+  boot.add("macros", BOOT_MAIN, bootMacros,
+           BOOT_BIT(PHASE_UI) | BOOT_BIT(PHASE_SD));
+  boot.add("ble", BOOT_TASK, bootBle);
+  boot.poll(); // Runs display, ui and usb; the tasks are under way
 }
 
 unsigned long lastStatusLog = 0;
 
 void loop() {
+  boot.poll();
   unsigned long now = millis();
+  pollHostLink();
+  payload.feed(macro);
+  bool wasTyping = typer.busy();
+  typer.poll(micros());
+  if (wasTyping && !typer.busy())
+    Serial.printf("HID: typed at %u cps (%u skipped)\n", typer.lastCps(),
+                  typer.lastSkipped());
+  macro.run(now);
+  if (statusMsgPending && !macroBusy() && now - statusMsgTime >= 500) {
+    statusMsgPending = false;
+    lv_label_set_text(statusLabel, "Ready");
+  }
 
   // Periodic status log
   if (now - lastStatusLog >= 3000) {
     lastStatusLog = now;
+    LvMemReport mem;
+    lvMemReport(mem);
     char buf[128];
-    snprintf(buf, sizeof(buf), "RAM:%d | BLE:%s | HID:%s", ESP.getFreeHeap(),
-             deviceConnected ? "OK" : "DISC", keyboardReady ? "READY" : "ERR");
+    snprintf(buf, sizeof(buf),
+             "RAM:%d | LV:%u%% fr:%u%% | BLE:%s | HID:%s | PC:%s",
+             ESP.getFreeHeap(), mem.usedPct, mem.fragPct,
+             deviceConnected ? "OK" : "DISC", keyboardReady ? "READY" : "ERR",
+             printJob.agentSeen() ? "OK" : "--");
     lv_label_set_text(statusLabel, buf);
-    Serial.println(buf);
+    Serial.printf("%s | LVGL %lu/%lu B, biggest %lu B, PSRAM %lu B, "
+                  "%lu spilled, %lu failed\n",
+                  buf, (unsigned long)mem.used, (unsigned long)mem.size,
+                  (unsigned long)mem.biggest, (unsigned long)mem.psram,
+                  (unsigned long)mem.spilled, (unsigned long)mem.failed);
   }
 
   if (imageReady) {
@@ -553,22 +930,44 @@ void loop() {
       g->flush();
 
       // Trigger Print
-      printLabel();
-      lv_label_set_text(statusLabel, "Imprimiendo...");
-      Serial.println("State: IMAGE + PRINTING");
+      printJob.reset();
+      if (printLabel()) {
+        lv_label_set_text(statusLabel, "Imprimiendo...");
+        Serial.println("State: IMAGE + PRINTING");
+      } else {
+        currentMode = MODE_PRINT_ERROR;
+        lv_label_set_text(statusLabel, "Error al imprimir");
+        Serial.println("State: PRINT ERROR (not queued)");
+      }
     }
     break;
 
-  case MODE_IMAGE:
-    if (now - stateStartTime >= DURATION_IMAGE) {
+  case MODE_IMAGE: {
+    // Leave as soon as the PC agent answers; only fall back to the fixed
+    // duration when no agent is listening.
+    PrintState ps = printJob.poll(now);
+    if (ps == PRINT_IDLE && !macroBusy())
+      ps = PRINT_FAILED; // Alt+P was cancelled before it went out
+    if (ps == PRINT_DONE ||
+        (ps == PRINT_NO_AGENT && now - stateStartTime >= DURATION_IMAGE)) {
+      printJob.reset();
       currentMode = MODE_IMPRESO;
       stateStartTime = now;
       lv_label_set_text(statusLabel, "¡Impreso!");
-      Serial.println("State: IMPRESO LABEL");
+      Serial.println(ps == PRINT_DONE ? "State: IMPRESO (confirmed)"
+                                      : "State: IMPRESO (no agent)");
+    } else if (ps == PRINT_FAILED) {
+      printJob.reset();
+      currentMode = MODE_PRINT_ERROR;
+      stateStartTime = now;
+      lv_label_set_text(statusLabel, "Error al imprimir");
+      Serial.println("State: PRINT ERROR");
     }
     break;
+  }
 
   case MODE_IMPRESO:
+  case MODE_PRINT_ERROR:
     if (now - stateStartTime >= DURATION_IMPRESO_TEXT) {
       currentMode = MODE_UI;
       lv_label_set_text(statusLabel, "Lista");
@@ -584,5 +983,6 @@ void loop() {
   }
 
   gfx->flush();
+  LAT_PRESENTED();
   delay(5);
 }
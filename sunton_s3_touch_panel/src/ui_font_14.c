@@ -0,0 +1,1173 @@
+/*******************************************************************************
+ * Size: 14 px
+ * Bpp: 4
+ * Opts: scripts/font_subset.py, Montserrat-Medium.ttf, compressed
+ * Glyphs: 0x20-0x7E,0xA1,0xB0,0xBF,0xC1,0xC9,0xCD,0xD1,0xD3,0xDA,0xDC,0xE1,0xE9,0xED,0xF1,0xF3,0xFA,0xFC,0xF053-0xF054
+ ******************************************************************************/
+
+// Generated by scripts/font_subset.py, do not edit.
+
+#ifdef LV_LVGL_H_INCLUDE_SIMPLE
+#include "lvgl.h"
+#else
+#include "lvgl/lvgl.h"
+#endif
+
+#if !LV_USE_FONT_COMPRESSED
+#error "ui_font_14 is compressed: build with -DLV_USE_FONT_COMPRESSED=1"
+#endif
+
+/*-----------------
+ *    BITMAPS
+ *----------------*/
+
+/*Store the image of the glyphs*/
+static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
+    /* U+0020 " " */
+
+    /* U+0021 "!" */
+    0xda, 0x3, 0x10, 0x0, 0xb8, 0x3, 0xc4, 0x54,
+    0xd6, 0xee, 0xe0,
+
+    /* U+0022 "\"" */
+    0x2f, 0x19, 0x91, 0x80, 0x8c, 0x1, 0xfd, 0xe0,
+
+    /* U+0023 "#" */
+    0x0, 0xb4, 0x81, 0x2c, 0x3, 0x8c, 0x80, 0x88,
+    0x0, 0x3f, 0xf0, 0xff, 0xa5, 0xbd, 0xca, 0xe0,
+    0xee, 0xc8, 0xf6, 0xa2, 0x82, 0xa8, 0x80, 0xc4,
+    0x20, 0x7, 0x8, 0x1, 0x98, 0x0, 0x9f, 0x77,
+    0x7f, 0x8b, 0x7c, 0x2f, 0xe, 0x72, 0xc7, 0x30,
+    0x4, 0x62, 0x86, 0xe4, 0x66, 0x0, 0x8c, 0xc0,
+    0xcc, 0x0, 0x80,
+
+    /* U+0024 "$" */
+    0x0, 0xce, 0x1, 0xfa, 0x80, 0x3f, 0xf8, 0x43,
+    0x3c, 0x5d, 0x46, 0x0, 0xd4, 0x81, 0xb0, 0x40,
+    0x23, 0x96, 0x35, 0xa7, 0x3, 0xc, 0x10, 0xe,
+    0x19, 0x7f, 0x36, 0x10, 0x9, 0xba, 0x6, 0x3d,
+    0x40, 0x21, 0x62, 0xf4, 0xb0, 0x0, 0x80, 0x43,
+    0xe2, 0x24, 0xf8, 0x53, 0x68, 0x41, 0x48, 0x4b,
+    0x18, 0x4a, 0x0, 0x36, 0x71, 0x74, 0x88, 0x7,
+    0x58, 0x6,
+
+    /* U+0025 "%" */
+    0x8, 0xed, 0x30, 0xa, 0x9c, 0x0, 0x8b, 0x75,
+    0xc0, 0x5, 0x67, 0x0, 0x1d, 0x2b, 0x80, 0x6,
+    0x38, 0x2, 0x3c, 0x3, 0x10, 0xba, 0x20, 0x9,
+    0x33, 0x7f, 0xca, 0x27, 0x98, 0x40, 0x3, 0xee,
+    0x14, 0x45, 0xdc, 0x91, 0x0, 0xd7, 0x60, 0x62,
+    0x23, 0x90, 0x4, 0xa2, 0xc0, 0x20, 0x1, 0x0,
+    0x86, 0x24, 0x9, 0x59, 0x8a, 0x40, 0xb, 0xb1,
+    0x0, 0xdd, 0xe1,
+
+    /* U+0026 "&" */
+    0x0, 0x26, 0x76, 0x18, 0x6, 0x1a, 0x5a, 0x6f,
+    0x0, 0xc6, 0x36, 0x9c, 0x20, 0x18, 0x8e, 0xce,
+    0x6c, 0x3, 0xa1, 0xb2, 0x58, 0x3, 0x2d, 0x41,
+    0x68, 0x13, 0x1, 0x55, 0x1f, 0xd2, 0xaf, 0x1,
+    0xc1, 0x40, 0xb1, 0x99, 0xc0, 0xe1, 0x4a, 0xa9,
+    0x22, 0x40, 0x96, 0x5, 0xd8, 0xeb, 0x18, 0xc0,
+
+    /* U+0027 "'" */
+    0x2f, 0x13, 0x1, 0x0, 0xf0,
+
+    /* U+0028 "(" */
+    0x4, 0xe1, 0xf, 0x71, 0x12, 0x68, 0x28, 0x20,
+    0x19, 0x0, 0x39, 0x80, 0x6, 0x20, 0x1e, 0x31,
+    0x0, 0x73, 0x0, 0xc, 0x80, 0xa, 0x8, 0x2,
+    0xba, 0x0, 0xe7, 0x10,
+
+    /* U+0029 ")" */
+    0x5e, 0x10, 0x53, 0x70, 0x2, 0xe8, 0x3, 0x10,
+    0x41, 0x80, 0x80, 0x81, 0x80, 0x2, 0x60, 0x1e,
+    0x13, 0x2, 0x6, 0x6, 0x2, 0xc, 0x41, 0x5,
+    0xd0, 0x53, 0x70,
+
+    /* U+002A "*" */
+    0x0, 0x49, 0x80, 0x19, 0x41, 0xe4, 0x93, 0x9e,
+    0x84, 0x80, 0x44, 0x1e, 0xb, 0xad, 0x7a, 0x4e,
+    0xe0, 0x6a, 0x20,
+
+    /* U+002B "+" */
+    0x0, 0xa2, 0x80, 0x3f, 0xf8, 0xe3, 0xfe, 0x75,
+    0xff, 0x18, 0xe6, 0x19, 0x33, 0x4, 0x6, 0x61,
+    0x11, 0x98, 0x40, 0x3f,
+
+    /* U+002C "," */
+    0x3e, 0x51, 0x3, 0x23, 0x42, 0x12,
+
+    /* U+002D "-" */
+    0x3f, 0xfa, 0xb, 0x32, 0xa0,
+
+    /* U+002E "." */
+    0x3e, 0x50, 0x8,
+
+    /* U+002F "/" */
+    0x0, 0xee, 0x40, 0xc, 0x80, 0x80, 0x1b, 0x5c,
+    0x3, 0x9f, 0x40, 0x32, 0x2, 0x0, 0x6d, 0x40,
+    0xe, 0x7f, 0x0, 0xc8, 0xa, 0x1, 0xb5, 0x0,
+    0x39, 0x3c, 0x3, 0x21, 0xa8, 0x6, 0xd4, 0x0,
+    0xe4, 0xf0, 0xc, 0x66, 0x40, 0xc,
+
+    /* U+0030 "0" */
+    0x0, 0x26, 0x76, 0xb8, 0x4, 0x96, 0xd7, 0x53,
+    0x20, 0x4, 0xad, 0x2b, 0xdb, 0x19, 0x13, 0x80,
+    0x25, 0x14, 0x60, 0x60, 0xc, 0x5c, 0x1, 0xfc,
+    0xc0, 0xc0, 0x18, 0xb8, 0x89, 0xc0, 0x12, 0x8a,
+    0x4, 0xac, 0xab, 0xdb, 0x18, 0x25, 0xad, 0xd4,
+    0xc8, 0x0,
+
+    /* U+0031 "1" */
+    0xdf, 0xf5, 0xf5, 0xa0, 0x1a, 0x8, 0x7, 0xff,
+    0x44,
+
+    /* U+0032 "2" */
+    0x7, 0xcf, 0xe9, 0x10, 0x89, 0xbb, 0x42, 0x68,
+    0x47, 0xba, 0x34, 0x18, 0x80, 0x80, 0x46, 0x1,
+    0xe1, 0xb6, 0x10, 0x8, 0x74, 0x60, 0x2, 0x1d,
+    0xd, 0x10, 0x0, 0xe8, 0x68, 0x80, 0x7, 0x6,
+    0x15, 0x10, 0x4c, 0x44, 0xbb, 0xd4,
+
+    /* U+0033 "3" */
+    0x7f, 0xff, 0x2, 0xdd, 0xd4, 0xe, 0x4, 0x89,
+    0x72, 0x40, 0x6, 0x96, 0xa0, 0xc, 0x6c, 0x10,
+    0x20, 0x11, 0x5d, 0x97, 0x4, 0x0, 0x28, 0xdc,
+    0x4a, 0x20, 0x1f, 0x56, 0x32, 0x37, 0x12, 0xca,
+    0xdd, 0xa1, 0xbc, 0x40,
+
+    /* U+0034 "4" */
+    0x0, 0xc3, 0x94, 0x1, 0xf5, 0x85, 0x80, 0x79,
+    0xd3, 0x84, 0x3, 0x92, 0x28, 0x88, 0x20, 0x11,
+    0x54, 0xa0, 0x6a, 0x0, 0x7, 0xd1, 0xc4, 0x40,
+    0x62, 0xc, 0x4b, 0xdd, 0x4, 0xf1, 0xad, 0xdf,
+    0x4, 0x59, 0x11, 0x13, 0x80, 0x90, 0x40, 0x3f,
+    0xc0,
+
+    /* U+0035 "5" */
+    0x9, 0xff, 0xe0, 0x1, 0xa5, 0xde, 0x0, 0x31,
+    0xa2, 0x60, 0x0, 0xf8, 0x7, 0x8a, 0x3f, 0xad,
+    0x0, 0x19, 0x8b, 0xb0, 0x51, 0x1, 0x99, 0x16,
+    0xc1, 0x44, 0x3, 0xe9, 0xd7, 0x45, 0xb0, 0x59,
+    0x5a, 0xbb, 0x6, 0x90,
+
+    /* U+0036 "6" */
+    0x0, 0x15, 0x77, 0xeb, 0x0, 0xf, 0x1a, 0x2e,
+    0x88, 0x1, 0xe5, 0x8c, 0x8e, 0x80, 0x47, 0x20,
+    0x1e, 0x60, 0x5, 0xff, 0xa8, 0x80, 0x42, 0xce,
+    0xe9, 0xfc, 0x18, 0x1a, 0x11, 0x78, 0x8c, 0xc2,
+    0x1, 0xfa, 0x1e, 0x15, 0xb8, 0xcc, 0xd, 0x49,
+    0x50, 0x9a, 0x0,
+
+    /* U+0037 "7" */
+    0x9f, 0xff, 0x60, 0x1d, 0xde, 0x15, 0x0, 0x22,
+    0x42, 0x2b, 0x9c, 0x0, 0xb9, 0x8, 0x3, 0x1a,
+    0x78, 0x7, 0x49, 0xa0, 0x6, 0x25, 0xa0, 0xe,
+    0xa1, 0x60, 0xc, 0x2c, 0xc0, 0xe, 0x71, 0x90,
+    0x8,
+
+    /* U+0038 "8" */
+    0x1, 0x9d, 0xfd, 0x91, 0x0, 0x53, 0xdd, 0xc9,
+    0x40, 0x4, 0x86, 0x46, 0xb4, 0x0, 0x1d, 0x18,
+    0x9d, 0x18, 0x3, 0x8b, 0x3b, 0xb, 0x80, 0x7c,
+    0xa6, 0xe4, 0xbc, 0x50, 0xb9, 0x91, 0xb8, 0x90,
+    0x3, 0xf9, 0xb, 0xd9, 0x1b, 0xc9, 0x7, 0xd2,
+    0x2e, 0x13, 0xc4,
+
+    /* U+0039 "9" */
+    0x3, 0xbe, 0xe5, 0x10, 0x16, 0x85, 0xc0, 0xe1,
+    0x51, 0xda, 0xb5, 0x9d, 0x80, 0x80, 0x72, 0x61,
+    0xb8, 0x94, 0x91, 0xa4, 0x4f, 0x69, 0x30, 0x1,
+    0xff, 0x36, 0xcd, 0x40, 0x2, 0x64, 0x45, 0xd0,
+    0x75, 0x47, 0xc4, 0x60, 0xdb, 0xb5, 0x4d, 0x80,
+
+    /* U+003A ":" */
+    0x3e, 0x50, 0x8, 0xf9, 0x40, 0x3f, 0x8f, 0x94,
+    0x2,
+
+    /* U+003B ";" */
+    0x3e, 0x50, 0x8, 0xf9, 0x40, 0x3f, 0x8f, 0x94,
+    0x40, 0xc8, 0xd0, 0x84, 0x80,
+
+    /* U+003C "<" */
+    0x0, 0xe5, 0xb3, 0x0, 0x14, 0x6c, 0x61, 0x5,
+    0xe0, 0xf6, 0xb8, 0x89, 0x4b, 0xc8, 0x2, 0x1e,
+    0x9d, 0xfa, 0x40, 0x9, 0x6f, 0xa, 0x4c,
+
+    /* U+003D "=" */
+    0x1f, 0xff, 0x18, 0xdd, 0xf8, 0x81, 0x13, 0xc2,
+    0x1, 0xf8, 0x7f, 0xfc, 0x63, 0x99, 0xe2,
+
+    /* U+003E ">" */
+    0x1b, 0x50, 0xe, 0x1d, 0x9e, 0x93, 0x0, 0x9b,
+    0x34, 0x77, 0x8, 0x2, 0x2d, 0x52, 0x0, 0x1c,
+    0xfc, 0xef, 0x90, 0xe8, 0x6e, 0x30, 0x80,
+
+    /* U+003F "?" */
+    0x7, 0xdf, 0xea, 0x29, 0x95, 0x5c, 0x27, 0x46,
+    0x3a, 0x34, 0x18, 0x90, 0x5, 0xe6, 0x1, 0xa1,
+    0xfc, 0x2, 0x66, 0x69, 0x80, 0x5d, 0x26, 0x1,
+    0xa1, 0xc0, 0x3a, 0x9c, 0x3, 0x9b, 0x80, 0x0,
+
+    /* U+0040 "@" */
+    0x0, 0x85, 0xb3, 0xbf, 0x69, 0x0, 0x38, 0xf2,
+    0xd2, 0xee, 0xa, 0x90, 0x8, 0x75, 0x70, 0x6e,
+    0xbb, 0x4d, 0x64, 0x1, 0x6f, 0x14, 0x91, 0x67,
+    0x2d, 0xae, 0x62, 0x96, 0x69, 0xcc, 0xb6, 0x40,
+    0x33, 0x64, 0x52, 0x91, 0x80, 0x48, 0x0, 0x33,
+    0x3b, 0x80, 0x3e, 0xf0, 0x3, 0x3, 0xb8, 0x14,
+    0x88, 0x1, 0x60, 0x1, 0x84, 0x88, 0x26, 0x9c,
+    0x85, 0x2a, 0xa3, 0xff, 0xb, 0xc0, 0x52, 0xd6,
+    0x6, 0x16, 0x92, 0x84, 0x3c, 0xc, 0xf7, 0x24,
+    0xb3, 0xa4, 0x0, 0x3a, 0xba, 0xea, 0x8d, 0x42,
+    0x1, 0xc7, 0x95, 0x76, 0xaa, 0x68, 0x6,
+
+    /* U+0041 "A" */
+    0x0, 0xd9, 0xc2, 0x1, 0xf2, 0x19, 0x98, 0x3,
+    0xee, 0x6b, 0x90, 0xf, 0x12, 0xdb, 0x3, 0x0,
+    0x75, 0xa9, 0x4, 0xd0, 0x6, 0x17, 0x90, 0x3,
+    0x12, 0x0, 0x4c, 0x39, 0xfe, 0xe1, 0xf0, 0xa,
+    0xa3, 0x33, 0x5a, 0x10, 0x29, 0xb1, 0x9e, 0x43,
+    0xb0, 0x97, 0x10, 0xe, 0xa7, 0x10,
+
+    /* U+0042 "B" */
+    0x8f, 0xfd, 0xd6, 0x80, 0x1, 0xbb, 0xc1, 0x64,
+    0x6, 0x89, 0x2d, 0x3, 0x80, 0x71, 0x48, 0xb8,
+    0x17, 0xfd, 0xae, 0xc4, 0x3, 0x99, 0x5c, 0x3b,
+    0x1, 0x9e, 0x47, 0x6a, 0x0, 0xff, 0x1a, 0x26,
+    0x86, 0xb0, 0x1b, 0xba, 0x96, 0x1c,
+
+    /* U+0043 "C" */
+    0x0, 0x9f, 0x3b, 0x96, 0x80, 0x1, 0xc9, 0x4a,
+    0xb2, 0xb5, 0xb, 0x2c, 0x84, 0x59, 0xc5, 0x15,
+    0x82, 0x0, 0xc6, 0xa, 0x8, 0x1, 0xff, 0xc5,
+    0x50, 0x40, 0xf, 0x85, 0x60, 0x80, 0x31, 0x80,
+    0x2c, 0xb2, 0x11, 0x67, 0x14, 0x7, 0x25, 0x2a,
+    0xca, 0x94,
+
+    /* U+0044 "D" */
+    0x8f, 0xfd, 0xd4, 0x80, 0x10, 0xdd, 0xd0, 0x36,
+    0xe0, 0x3, 0x44, 0x9a, 0xe2, 0x8, 0x1, 0xf3,
+    0x9f, 0x0, 0x7e, 0x56, 0x0, 0xff, 0xe3, 0x2b,
+    0x0, 0x7c, 0xe7, 0xc0, 0x68, 0x93, 0x5c, 0x41,
+    0x0, 0x6e, 0xe8, 0x1b, 0x70,
+
+    /* U+0045 "E" */
+    0x8f, 0xff, 0x30, 0xd, 0xdf, 0x38, 0x1a, 0x27,
+    0x8, 0x7, 0xf1, 0x7f, 0xec, 0x0, 0xe, 0x66,
+    0xf0, 0x1, 0x9f, 0x80, 0x3f, 0xc6, 0x89, 0xc4,
+    0x3, 0x77, 0xe0,
+
+    /* U+0046 "F" */
+    0x8f, 0xff, 0x30, 0xd, 0xdf, 0x38, 0x1a, 0x27,
+    0x8, 0x7, 0xff, 0x14, 0xbf, 0xf6, 0x0, 0x7,
+    0x33, 0x78, 0x0, 0xcf, 0xc0, 0x1f, 0xfc, 0x50,
+
+    /* U+0047 "G" */
+    0x0, 0x9f, 0x3b, 0x98, 0xa0, 0x1, 0xc9, 0x4b,
+    0xb2, 0x53, 0x5, 0x96, 0x42, 0xaa, 0x35, 0x85,
+    0x60, 0x80, 0x31, 0x2, 0x82, 0x0, 0x7f, 0xf0,
+    0xee, 0x54, 0x10, 0x3, 0xe1, 0x58, 0x20, 0xf,
+    0xac, 0xb2, 0x15, 0x50, 0xa2, 0x3, 0x92, 0x97,
+    0x64, 0x88,
+
+    /* U+0048 "H" */
+    0x8d, 0x0, 0xe8, 0xd0, 0xf, 0xfe, 0x81, 0x7f,
+    0xf3, 0x80, 0x7, 0x33, 0x98, 0x0, 0x67, 0xe1,
+    0x0, 0xff, 0xe8, 0x0,
+
+    /* U+0049 "I" */
+    0x8d, 0x0, 0xff, 0xe3, 0x0,
+
+    /* U+004A "J" */
+    0x2f, 0xfd, 0x85, 0x77, 0x28, 0x1, 0x12, 0x30,
+    0xf, 0xfe, 0x69, 0x0, 0x44, 0xdf, 0x48, 0xe9,
+    0x9c, 0xd7, 0x4e, 0xc0,
+
+    /* U+004B "K" */
+    0x8d, 0x0, 0xcb, 0xea, 0x1, 0xc9, 0x52, 0xa0,
+    0x18, 0xea, 0x18, 0x3, 0x1e, 0xb3, 0x80, 0x62,
+    0xd2, 0x80, 0xc, 0x7e, 0x66, 0x60, 0xc, 0x2d,
+    0xad, 0x26, 0x1, 0xd, 0x4, 0xa6, 0x90, 0x0,
+    0xc4, 0x1, 0x45, 0xc0, 0x1e, 0x1e, 0x2a,
+
+    /* U+004C "L" */
+    0x8d, 0x0, 0xff, 0xf9, 0x9a, 0x27, 0x8, 0xd,
+    0xdf, 0x10,
+
+    /* U+004D "M" */
+    0x8d, 0x10, 0xf, 0x46, 0x81, 0x30, 0x7, 0x13,
+    0x80, 0x52, 0x40, 0x1a, 0x40, 0x23, 0x58, 0x0,
+    0x91, 0xc, 0x1, 0x42, 0xa0, 0x2, 0x1f, 0x80,
+    0x23, 0x68, 0x6, 0x19, 0x0, 0xe8, 0x27, 0x88,
+    0x8, 0x18, 0x4, 0x31, 0x5, 0x50, 0x7, 0xcc,
+    0xb0, 0x1, 0xfd, 0x46, 0x1, 0x80,
+
+    /* U+004E "N" */
+    0x8e, 0x20, 0xd, 0x1a, 0x3, 0xc0, 0x1f, 0x9,
+    0xc8, 0x7, 0x8e, 0x59, 0x80, 0x1e, 0x66, 0x41,
+    0x80, 0x7a, 0x4b, 0x84, 0x3, 0xdc, 0x74, 0x1,
+    0xe2, 0xa4, 0x60, 0xf, 0x24, 0x8, 0x7, 0xce,
+    0xa0,
+
+    /* U+004F "O" */
+    0x0, 0x9f, 0x3b, 0x96, 0xa0, 0x18, 0x72, 0x52,
+    0xac, 0xaa, 0x40, 0x2b, 0x2c, 0x84, 0x59, 0xb6,
+    0x60, 0xa, 0xc1, 0x0, 0x64, 0x5b, 0x5, 0x4,
+    0x0, 0xf6, 0x10, 0x80, 0x7f, 0xc2, 0xa0, 0x80,
+    0x1e, 0xc2, 0x1, 0x58, 0x20, 0xc, 0x8b, 0x60,
+    0xb, 0x2c, 0x84, 0x59, 0xb6, 0x60, 0x0, 0x72,
+    0x52, 0xac, 0xaa, 0x40, 0x0,
+
+    /* U+0050 "P" */
+    0x8f, 0xfb, 0xb1, 0xc0, 0x21, 0xbb, 0x55, 0xcd,
+    0x80, 0xd, 0x12, 0x7b, 0x43, 0x0, 0xf2, 0x3,
+    0x0, 0x78, 0x80, 0x40, 0x30, 0xa7, 0x92, 0x1,
+    0x7f, 0xba, 0xdf, 0xc0, 0x3, 0x99, 0x75, 0x90,
+    0x0, 0xcf, 0x8, 0x7, 0xfe,
+
+    /* U+0051 "Q" */
+    0x0, 0x9f, 0x3b, 0x96, 0xa0, 0x18, 0x72, 0x52,
+    0xac, 0xaa, 0x40, 0x28, 0x2c, 0x84, 0x59, 0xb6,
+    0x60, 0xb, 0x41, 0x0, 0x64, 0x5b, 0x5, 0x4,
+    0x0, 0xf6, 0x10, 0x7, 0xfe, 0x16, 0x4, 0x0,
+    0xf6, 0x10, 0x92, 0xc1, 0x0, 0x64, 0x5a, 0x0,
+    0x59, 0xe4, 0x22, 0xcd, 0xab, 0x80, 0x7, 0x19,
+    0x6e, 0x92, 0x68, 0x3, 0xc, 0x6e, 0x88, 0x54,
+    0xa5, 0x0, 0x38, 0xbd, 0xf3, 0x55, 0x80, 0x3c,
+    0x57, 0xba, 0xc2,
+
+    /* U+0052 "R" */
+    0x8f, 0xfb, 0xb1, 0xc0, 0x21, 0xbb, 0x55, 0xcd,
+    0x80, 0xd, 0x12, 0x7b, 0x43, 0x0, 0xf2, 0x3,
+    0x0, 0x78, 0x80, 0x40, 0x30, 0xa7, 0x12, 0x1,
+    0x7f, 0xba, 0xdb, 0xc0, 0x3, 0x99, 0x18, 0x90,
+    0x0, 0xcf, 0x72, 0x30, 0x7, 0x8a, 0xe4, 0xc0,
+
+    /* U+0053 "S" */
+    0x1, 0x9d, 0xfd, 0xa3, 0x0, 0x6a, 0x5d, 0xc2,
+    0x80, 0x47, 0x2c, 0x8d, 0x6e, 0x6, 0x18, 0x1,
+    0xe1, 0x97, 0xd9, 0x51, 0x0, 0x9b, 0xac, 0xef,
+    0xd4, 0x2, 0x16, 0xae, 0x7b, 0x0, 0x10, 0x6,
+    0xc1, 0x12, 0x64, 0xaa, 0x34, 0x20, 0xa5, 0x95,
+    0xdc, 0x94, 0x0,
+
+    /* U+0054 "T" */
+    0xef, 0xff, 0x8a, 0xae, 0xca, 0x57, 0x71, 0xa2,
+    0x46, 0x28, 0x90, 0x80, 0x7f, 0xfc, 0xc0,
+
+    /* U+0055 "U" */
+    0x9c, 0x0, 0xea, 0xa0, 0x7, 0xff, 0x7c, 0x40,
+    0x44, 0x1, 0xce, 0x7a, 0x48, 0x1, 0x11, 0xfa,
+    0x9d, 0x3a, 0x37, 0x9b, 0x6, 0xbd, 0x5c, 0x26,
+    0x80,
+
+    /* U+0056 "V" */
+    0xcb, 0x0, 0xf5, 0x65, 0x21, 0x0, 0x61, 0x59,
+    0x61, 0xb0, 0xd, 0x24, 0xa0, 0xce, 0x20, 0x13,
+    0x50, 0x2, 0x45, 0xc0, 0xa, 0x2c, 0x0, 0x15,
+    0xb0, 0x4, 0xb0, 0x80, 0x52, 0x48, 0x66, 0xa0,
+    0xc, 0x66, 0xf9, 0x43, 0x0, 0xe9, 0x45, 0xe0,
+    0xf, 0x29, 0x11, 0x40, 0x20,
+
+    /* U+0057 "W" */
+    0x6f, 0x10, 0xd, 0xb6, 0x1, 0x8f, 0xc9, 0xc1,
+    0xc0, 0x23, 0x24, 0x10, 0xa, 0xcc, 0x85, 0x34,
+    0x2, 0xb4, 0x17, 0x0, 0x96, 0xc0, 0x1a, 0x82,
+    0x0, 0x5d, 0x7d, 0x0, 0x19, 0x20, 0x1, 0xc1,
+    0x0, 0xc9, 0xf5, 0x4, 0x2c, 0x8c, 0x0, 0x29,
+    0xe1, 0x48, 0x28, 0x2e, 0xa, 0xa0, 0xd, 0xa8,
+    0x2f, 0xa0, 0x7, 0xd2, 0x25, 0x80, 0x64, 0x18,
+    0x17, 0x0, 0x6a, 0x59, 0x18, 0x6, 0x23, 0x64,
+    0x10, 0x2, 0xb, 0x28, 0x7, 0xac, 0x34, 0x3,
+    0x38, 0x58, 0x4,
+
+    /* U+0058 "X" */
+    0x4f, 0x50, 0x8, 0x76, 0x41, 0x1e, 0xc8, 0x1,
+    0x1, 0x0, 0x8, 0x2e, 0x4, 0x6e, 0x10, 0xb,
+    0x8a, 0x2a, 0xc, 0x3, 0x14, 0x39, 0x38, 0x7,
+    0xbc, 0x8, 0x40, 0x39, 0x5a, 0x8e, 0x80, 0x30,
+    0xdb, 0xaf, 0x23, 0x80, 0x54, 0x50, 0x7, 0x10,
+    0x30, 0x74, 0xf0, 0x9, 0xd3, 0x84,
+
+    /* U+0059 "Y" */
+    0xbb, 0x0, 0x74, 0xe4, 0x22, 0x80, 0x46, 0xde,
+    0x6d, 0x2, 0x0, 0x86, 0x30, 0x83, 0x90, 0x55,
+    0x40, 0x0, 0x61, 0xce, 0xe4, 0x40, 0x26, 0x4d,
+    0x27, 0x0, 0xef, 0x19, 0x0, 0xf3, 0x3, 0x0,
+    0x7f, 0xf2, 0x40,
+
+    /* U+005A "Z" */
+    0x4f, 0xff, 0xa5, 0x6e, 0xf9, 0x42, 0x85, 0x13,
+    0x2, 0xc9, 0x80, 0x62, 0xa6, 0x60, 0x7, 0x71,
+    0x48, 0x7, 0x49, 0x70, 0x7, 0x33, 0x28, 0x80,
+    0x31, 0xcc, 0x20, 0x6, 0x1e, 0x33, 0x22, 0x63,
+    0x72, 0x3b, 0xbe, 0xf0,
+
+    /* U+005B "[" */
+    0x8f, 0xf3, 0x1, 0x5b, 0x80, 0xa0, 0x80, 0x7f,
+    0xf6, 0x45, 0x4, 0xa, 0xdc,
+
+    /* U+005C "\\" */
+    0x6d, 0x0, 0xe7, 0x23, 0x0, 0xc2, 0x96, 0x1,
+    0xda, 0xa0, 0x1c, 0xe4, 0x60, 0x18, 0x52, 0xc0,
+    0x3b, 0x54, 0x3, 0x9c, 0x88, 0x1, 0x85, 0x14,
+    0x3, 0xb6, 0xc0, 0x39, 0xcc, 0x80, 0x30, 0xa2,
+    0x80, 0x76, 0xd8, 0x7, 0x39, 0x90,
+
+    /* U+005D "]" */
+    0xbf, 0xf1, 0xc4, 0x80, 0xd, 0x0, 0x3f, 0xfb,
+    0x46, 0x80, 0x8, 0x90, 0x0,
+
+    /* U+005E "^" */
+    0x0, 0x56, 0x80, 0x44, 0x82, 0x80, 0xa, 0x6a,
+    0xe0, 0x2, 0xd3, 0xa0, 0xab, 0x10, 0xbb, 0x77,
+    0x0, 0x15, 0x40,
+
+    /* U+005F "_" */
+    0xff, 0xfb, 0x33, 0xe0,
+
+    /* U+0060 "`" */
+    0x1b, 0xc1, 0x15, 0xad, 0x0,
+
+    /* U+0061 "a" */
+    0x4, 0xce, 0xe5, 0x10, 0x3, 0xae, 0xe6, 0x90,
+    0x5, 0x3a, 0xaa, 0x10, 0x41, 0x77, 0xfd, 0x60,
+    0x65, 0x49, 0x79, 0x40, 0x6, 0x8, 0x43, 0x0,
+    0x94, 0x6d, 0x1a, 0x0, 0x3, 0x4f, 0x75, 0x0,
+    0x0,
+
+    /* U+0062 "b" */
+    0xb9, 0x0, 0xff, 0xe5, 0x9c, 0x77, 0x2c, 0xc0,
+    0xa, 0x97, 0x60, 0xc3, 0x1, 0xd5, 0x55, 0x9c,
+    0x82, 0x8, 0x5, 0x68, 0x1, 0xf1, 0x82, 0x8,
+    0x5, 0x6e, 0x0, 0xd5, 0x55, 0x9c, 0x83, 0xa5,
+    0xd8, 0x30, 0xc0,
+
+    /* U+0063 "c" */
+    0x0, 0x3e, 0xfe, 0xb0, 0x2, 0x65, 0x56, 0xb2,
+    0x84, 0xd6, 0xe9, 0x1a, 0x8e, 0xa, 0x1, 0x10,
+    0x7, 0xf3, 0x82, 0x80, 0x44, 0x4, 0xd6, 0xe8,
+    0xfa, 0x81, 0x32, 0xab, 0xa9, 0x40,
+
+    /* U+0064 "d" */
+    0x0, 0xf0, 0xfa, 0x0, 0x7f, 0xf2, 0x23, 0x7f,
+    0x14, 0x2, 0xa6, 0xab, 0x4a, 0x0, 0x12, 0xdb,
+    0xa4, 0x48, 0x1, 0xc1, 0x40, 0x25, 0x0, 0xff,
+    0x9c, 0x14, 0x2, 0x50, 0x1, 0x2d, 0xba, 0x44,
+    0x80, 0x54, 0xd5, 0x69, 0xa0, 0x0,
+
+    /* U+0065 "e" */
+    0x0, 0x46, 0xf6, 0x20, 0x2, 0x56, 0xe9, 0x2d,
+    0x9, 0xbd, 0x92, 0x1f, 0xdc, 0x37, 0xfe, 0x75,
+    0x0, 0x5e, 0x66, 0xd7, 0x2, 0x33, 0x88, 0xc9,
+    0xa6, 0x11, 0xb1, 0x2, 0x61, 0x6e, 0xca, 0x80,
+
+    /* U+0066 "f" */
+    0x0, 0x4f, 0x69, 0x82, 0xb4, 0x59, 0x6, 0x9b,
+    0x30, 0x71, 0xcf, 0xf8, 0x3d, 0x4a, 0xe8, 0xc,
+    0x85, 0x10, 0x1, 0xff, 0xd3,
+
+    /* U+0067 "g" */
+    0x0, 0x3e, 0xfe, 0x27, 0x30, 0x4c, 0xaa, 0xed,
+    0x42, 0x4, 0xd6, 0xe8, 0xf6, 0x0, 0x70, 0x40,
+    0x9, 0x40, 0x30, 0x80, 0x79, 0xc1, 0x40, 0x25,
+    0x0, 0x13, 0x5b, 0xa3, 0xd8, 0x5, 0x32, 0xab,
+    0xb5, 0x1, 0x80, 0x1f, 0x7f, 0x1c, 0x18, 0x2e,
+    0x99, 0x1b, 0x90, 0xc2, 0x2, 0x2e, 0xcb, 0x40,
+
+    /* U+0068 "h" */
+    0xb9, 0x0, 0xff, 0xe5, 0x9c, 0xf7, 0x2c, 0x80,
+    0xa, 0x57, 0x66, 0xe0, 0x0, 0xd2, 0xaa, 0x4c,
+    0xc0, 0x82, 0x0, 0x50, 0x70, 0x30, 0x8, 0x40,
+    0x40, 0x3f, 0xf9, 0x80,
+
+    /* U+0069 "i" */
+    0xba, 0x12, 0xa8, 0xb9, 0x0, 0xff, 0xe1, 0x0,
+
+    /* U+006A "j" */
+    0x0, 0xaa, 0xc0, 0x23, 0x20, 0xa, 0x64, 0x1,
+    0x55, 0x0, 0x3f, 0xfb, 0xaa, 0x88, 0xd2, 0x8a,
+    0x46,
+
+    /* U+006B "k" */
+    0xb9, 0x0, 0xff, 0xe7, 0xe, 0x60, 0x40, 0x21,
+    0xd0, 0xd1, 0x0, 0xe, 0x8e, 0x88, 0x0, 0xf4,
+    0xec, 0x40, 0x25, 0x23, 0x82, 0x0, 0x8b, 0x34,
+    0x24, 0x2, 0x42, 0x1a, 0x47, 0x0, 0xe4, 0x88,
+    0x20,
+
+    /* U+006C "l" */
+    0xb9, 0x0, 0xff, 0xe4, 0x0,
+
+    /* U+006D "m" */
+    0xb9, 0x97, 0x72, 0x85, 0x73, 0xf1, 0x0, 0xc,
+    0x57, 0x9, 0x97, 0x6a, 0x6b, 0x20, 0x2b, 0x56,
+    0x82, 0x87, 0x5a, 0x15, 0x7, 0x0, 0x88, 0x10,
+    0x2, 0x2e, 0x3, 0x0, 0xfe, 0x70, 0xf, 0xfe,
+    0xe0,
+
+    /* U+006E "n" */
+    0xb9, 0x8e, 0xe5, 0x90, 0x1, 0x8e, 0xec, 0xdc,
+    0x0, 0x1a, 0x55, 0x49, 0x98, 0x10, 0x40, 0xa,
+    0xe, 0x6, 0x1, 0x8, 0x8, 0x7, 0xff, 0x30,
+
+    /* U+006F "o" */
+    0x0, 0x3e, 0xfe, 0xb0, 0x5, 0x32, 0xab, 0x59,
+    0x70, 0x26, 0xb7, 0x48, 0x84, 0x8b, 0x82, 0x80,
+    0x4a, 0x2a, 0x1, 0xfc, 0xe0, 0xa0, 0x12, 0x8a,
+    0x93, 0x5b, 0xa4, 0x42, 0x44, 0x26, 0x55, 0x6b,
+    0x2e, 0x0,
+
+    /* U+0070 "p" */
+    0xb9, 0x8e, 0xe5, 0x98, 0x1, 0xd2, 0xec, 0x18,
+    0x60, 0xd, 0x55, 0x59, 0xc8, 0x20, 0x80, 0x56,
+    0x80, 0x1f, 0x18, 0x20, 0x80, 0x56, 0xe0, 0xd,
+    0x55, 0x59, 0xc8, 0x3a, 0x5d, 0x83, 0xc, 0x1,
+    0x1d, 0xcb, 0x30, 0xf, 0xfe, 0x28,
+
+    /* U+0071 "q" */
+    0x0, 0x46, 0xfe, 0x1f, 0xa0, 0x53, 0x55, 0xa6,
+    0x80, 0x9, 0x6d, 0xd2, 0x24, 0x0, 0xe0, 0xa0,
+    0x12, 0x80, 0x7f, 0xce, 0xa, 0x1, 0x28, 0x0,
+    0x96, 0xdd, 0x22, 0x40, 0x2a, 0x6a, 0xb4, 0xa0,
+    0xd, 0x1b, 0xf8, 0xa0, 0x1f, 0xfc, 0x80,
+
+    /* U+0072 "r" */
+    0xb9, 0x97, 0x20, 0x31, 0x5a, 0x80, 0xd2, 0x88,
+    0x20, 0x80, 0x46, 0x1, 0xff, 0xc6,
+
+    /* U+0073 "s" */
+    0x5, 0xce, 0xda, 0x23, 0xa4, 0xab, 0x13, 0x50,
+    0x94, 0x6b, 0x14, 0x1c, 0x96, 0x10, 0x2f, 0xb0,
+    0xbf, 0x30, 0x16, 0x9d, 0x3b, 0x6b, 0x64, 0x63,
+    0xe5, 0x1b, 0xba, 0x58,
+
+    /* U+0074 "t" */
+    0x4, 0x60, 0xd, 0x94, 0x1, 0x63, 0x9f, 0xf0,
+    0x7a, 0x95, 0xd0, 0x19, 0xa, 0x20, 0x3, 0xff,
+    0x91, 0xa6, 0xaa, 0x10, 0x56, 0xb8, 0x20,
+
+    /* U+0075 "u" */
+    0xc8, 0x0, 0x8b, 0xcc, 0x3, 0xff, 0x9a, 0x20,
+    0x10, 0x80, 0x18, 0x80, 0x24, 0x0, 0x7a, 0x42,
+    0x3c, 0x80, 0x16, 0x56, 0xee, 0x0,
+
+    /* U+0076 "v" */
+    0xc9, 0x0, 0xd5, 0x53, 0x80, 0x42, 0xb2, 0xe0,
+    0xa0, 0x6, 0x33, 0xb, 0xf0, 0x2, 0xa8, 0x0,
+    0xa4, 0x24, 0x37, 0x0, 0x19, 0xab, 0xdc, 0x40,
+    0x2a, 0x64, 0xa0, 0xc, 0xe0, 0x66, 0x0,
+
+    /* U+0077 "w" */
+    0xb8, 0x0, 0x9b, 0xc4, 0x2, 0xd5, 0xd5, 0x0,
+    0xa8, 0x1c, 0x0, 0x66, 0x57, 0x23, 0x2, 0x35,
+    0xd0, 0x5, 0xa0, 0xa, 0x58, 0x2a, 0x4a, 0x8,
+    0x2f, 0x0, 0x35, 0x42, 0xf4, 0xcc, 0xc8, 0x68,
+    0x0, 0x72, 0x63, 0x70, 0xbb, 0x6b, 0x80, 0x42,
+    0xb0, 0xa2, 0xa, 0x6f, 0xa0, 0x1b, 0xc7, 0xc0,
+    0x4, 0x86, 0x80, 0x0,
+
+    /* U+0078 "x" */
+    0x5f, 0x30, 0x3, 0xf0, 0xab, 0x70, 0x14, 0x58,
+    0x84, 0x4, 0xf3, 0x28, 0x0, 0x79, 0x86, 0x0,
+    0x33, 0x80, 0x78, 0x6a, 0x1a, 0x80, 0x2a, 0x57,
+    0x95, 0x70, 0x75, 0x90, 0x2b, 0x83,
+
+    /* U+0079 "y" */
+    0xc, 0x90, 0xd, 0x54, 0xa, 0x71, 0x0, 0xa,
+    0xc8, 0x38, 0x38, 0x1, 0x8c, 0xc0, 0x2f, 0x40,
+    0xa, 0xa0, 0x5, 0x46, 0x64, 0x37, 0x0, 0x8c,
+    0xd5, 0xce, 0x20, 0x1a, 0x9d, 0x68, 0x3, 0x98,
+    0x10, 0xc0, 0x38, 0x43, 0x80, 0x34, 0x24, 0x1a,
+    0x80, 0x42, 0x74, 0xbc, 0x1, 0x80,
+
+    /* U+007A "z" */
+    0x5f, 0xfe, 0xa4, 0xbb, 0x9c, 0x38, 0x51, 0xa,
+    0xce, 0x80, 0x15, 0x2c, 0x0, 0x50, 0xb4, 0x1,
+    0x23, 0xd0, 0x80, 0xa, 0x94, 0x11, 0x6, 0xa2,
+    0xb7, 0x77, 0x80,
+
+    /* U+007B "{" */
+    0x0, 0x37, 0x50, 0x2, 0x52, 0x0, 0x43, 0x88,
+    0x3, 0xfe, 0x20, 0x8, 0xf0, 0xd0, 0xa, 0x4c,
+    0xc0, 0x2e, 0xe, 0x1, 0xff, 0xc5, 0x11, 0x71,
+    0x0, 0x21, 0x20,
+
+    /* U+007C "|" */
+    0x8b, 0x0, 0xff, 0xe7, 0x0,
+
+    /* U+007D "}" */
+    0xbe, 0x50, 0x4, 0x25, 0x80, 0xf, 0xc4, 0x3,
+    0xff, 0x86, 0x40, 0x4, 0x2d, 0x20, 0x52, 0xa2,
+    0x1, 0x5, 0x0, 0xff, 0xe2, 0x1f, 0x10, 0x2,
+    0x1a, 0x0, 0x0,
+
+    /* U+007E "~" */
+    0x8, 0xfd, 0x61, 0xc4, 0x16, 0xe8, 0x87, 0x2,
+    0x6, 0xa, 0xf6, 0x60, 0x0,
+
+    /* U+00A1 "¡" */
+    0xc9, 0x7e, 0xb7, 0xa6, 0x11, 0x7, 0xb8, 0x0,
+    0x44, 0x0, 0x30,
+
+    /* U+00B0 "°" */
+    0x6, 0xee, 0x28, 0x15, 0xda, 0x20, 0x2f, 0x4a,
+    0xc8, 0x4d, 0x64, 0x68, 0x46, 0xbb, 0x94, 0x21,
+    0x3b, 0xa7, 0x0,
+
+    /* U+00BF "¿" */
+    0x0, 0x46, 0x80, 0x77, 0xb0, 0x7, 0x3d, 0x80,
+    0x73, 0x40, 0x6, 0x28, 0xf0, 0x8, 0xbd, 0x1c,
+    0x2, 0x96, 0xa0, 0xc, 0x9a, 0x1, 0xc5, 0x46,
+    0x29, 0x93, 0xc3, 0x9d, 0x6f, 0x67, 0xba, 0xce,
+    0xb2,
+
+    /* U+00C1 "Á" */
+    0x0, 0xe7, 0xe3, 0x0, 0xf9, 0xef, 0xc, 0x3,
+    0xe7, 0xc2, 0x0, 0xfd, 0x9c, 0x20, 0x1f, 0x21,
+    0x99, 0x80, 0x3e, 0xe6, 0xb9, 0x0, 0xf1, 0x2d,
+    0xb0, 0x30, 0x7, 0x5a, 0x90, 0x4d, 0x0, 0x61,
+    0x79, 0x0, 0x31, 0x20, 0x4, 0xc3, 0x9f, 0xee,
+    0x1f, 0x0, 0xaa, 0x33, 0x35, 0xa1, 0x2, 0x9b,
+    0x19, 0xe4, 0x3b, 0x9, 0x71, 0x0, 0xea, 0x71,
+
+    /* U+00C9 "É" */
+    0x0, 0xd5, 0x84, 0x1, 0xa4, 0x34, 0x80, 0x34,
+    0xd0, 0x80, 0x23, 0xff, 0xcc, 0x3, 0x77, 0xce,
+    0x6, 0x89, 0xc2, 0x1, 0xfc, 0x5f, 0xfb, 0x0,
+    0x3, 0x99, 0xbc, 0x0, 0x67, 0xe0, 0xf, 0xf1,
+    0xa2, 0x71, 0x0, 0xdd, 0xf8,
+
+    /* U+00CD "Í" */
+    0x7, 0xe3, 0x6a, 0xc3, 0x6d, 0x20, 0x8d, 0x0,
+    0xff, 0xed, 0x0,
+
+    /* U+00D1 "Ñ" */
+    0x0, 0x1f, 0x51, 0x68, 0x6, 0xaa, 0x6e, 0x90,
+    0x3, 0x5a, 0x3e, 0xc8, 0x2, 0x38, 0x2, 0x20,
+    0x8d, 0x1, 0xe0, 0xf, 0x84, 0xe4, 0x3, 0xc7,
+    0x2c, 0xc0, 0xf, 0x33, 0x20, 0xc0, 0x3d, 0x25,
+    0xc2, 0x1, 0xee, 0x3a, 0x0, 0xf1, 0x52, 0x30,
+    0x7, 0x92, 0x4, 0x3, 0xe7, 0x50,
+
+    /* U+00D3 "Ó" */
+    0x0, 0xf5, 0xe0, 0x80, 0x7e, 0xa1, 0xc1, 0x0,
+    0xfd, 0x54, 0x0, 0xfc, 0xf9, 0xdc, 0xb5, 0x0,
+    0xc3, 0x92, 0x95, 0x65, 0x52, 0x1, 0x59, 0x64,
+    0x22, 0xcd, 0xb3, 0x0, 0x56, 0x8, 0x3, 0x22,
+    0xd8, 0x28, 0x20, 0x7, 0xb0, 0x84, 0x3, 0xfe,
+    0x15, 0x4, 0x0, 0xf6, 0x10, 0xa, 0xc1, 0x0,
+    0x64, 0x5b, 0x0, 0x59, 0x64, 0x22, 0xcd, 0xb3,
+    0x0, 0x3, 0x92, 0x95, 0x65, 0x52, 0x0,
+
+    /* U+00DA "Ú" */
+    0x0, 0xc5, 0xd0, 0x1, 0xc5, 0xf1, 0x0, 0xe,
+    0x2d, 0x60, 0xa, 0x70, 0x3, 0xaa, 0x80, 0x1f,
+    0xfd, 0xf1, 0x1, 0x10, 0x7, 0x39, 0xe9, 0x20,
+    0x4, 0x47, 0xea, 0x74, 0xe8, 0xde, 0x6c, 0x1a,
+    0xf5, 0x70, 0x9a, 0x0,
+
+    /* U+00DC "Ü" */
+    0x0, 0x2e, 0x5, 0xb0, 0x6, 0x5e, 0xa, 0x70,
+    0xe, 0x20, 0x11, 0x0, 0x27, 0x0, 0x3a, 0xa8,
+    0x1, 0xff, 0xdf, 0x10, 0x11, 0x0, 0x73, 0x9e,
+    0x92, 0x0, 0x44, 0x7e, 0xa7, 0x4e, 0x8d, 0xe6,
+    0xc1, 0xaf, 0x57, 0x9, 0xa0,
+
+    /* U+00E1 "á" */
+    0x0, 0xd1, 0xa6, 0x1, 0x9d, 0x30, 0xc0, 0x33,
+    0xe0, 0x80, 0x49, 0x9d, 0xca, 0x20, 0x7, 0x5d,
+    0xcd, 0x20, 0xa, 0x75, 0x54, 0x20, 0x82, 0xef,
+    0xfa, 0xc0, 0xca, 0x92, 0xf2, 0x80, 0xc, 0x10,
+    0x86, 0x1, 0x28, 0xda, 0x34, 0x0, 0x6, 0x9e,
+    0xea, 0x0, 0x0,
+
+    /* U+00E9 "é" */
+    0x0, 0xcb, 0xca, 0x1, 0x92, 0x35, 0x40, 0x32,
+    0x69, 0x80, 0x68, 0xde, 0xc4, 0x0, 0x4a, 0xdd,
+    0x25, 0xa1, 0x37, 0xb2, 0x43, 0xfb, 0x86, 0xff,
+    0xce, 0xa0, 0xb, 0xcc, 0xda, 0xe0, 0x46, 0x71,
+    0x19, 0x34, 0xc2, 0x36, 0x20, 0x4c, 0x2d, 0xd9,
+    0x50,
+
+    /* U+00ED "í" */
+    0xa, 0xc2, 0x90, 0xd2, 0x9a, 0x10, 0xb9, 0x0,
+    0xff, 0xe9, 0x0,
+
+    /* U+00F1 "ñ" */
+    0x2, 0xdb, 0x2c, 0x10, 0x2, 0xde, 0xe9, 0xc4,
+    0x0, 0xae, 0xdb, 0x40, 0xb, 0xb4, 0xf6, 0x51,
+    0x0, 0x18, 0xee, 0xcd, 0xc0, 0x1, 0xa5, 0x54,
+    0x99, 0x81, 0x4, 0x0, 0xa0, 0xe0, 0x60, 0x10,
+    0x80, 0x80, 0x7f, 0xf3, 0x0,
+
+    /* U+00F3 "ó" */
+    0x0, 0xc7, 0xcc, 0x1, 0xc7, 0xd4, 0xc0, 0x1c,
+    0x7a, 0x80, 0x1c, 0xfb, 0xfa, 0xc0, 0x14, 0xca,
+    0xad, 0x65, 0xc0, 0x9a, 0xdd, 0x22, 0x12, 0x2e,
+    0xa, 0x1, 0x28, 0xa8, 0x7, 0xf3, 0x82, 0x80,
+    0x4a, 0x2a, 0x4d, 0x6e, 0x91, 0x9, 0x10, 0x99,
+    0x55, 0xac, 0xb8, 0x0,
+
+    /* U+00FA "ú" */
+    0x0, 0x87, 0x68, 0x3, 0xe, 0xad, 0x0, 0x61,
+    0xc8, 0x0, 0xb2, 0x0, 0x22, 0xf3, 0x0, 0xff,
+    0xe6, 0x88, 0x4, 0x20, 0x6, 0x20, 0x9, 0x0,
+    0x1e, 0x90, 0x8f, 0x20, 0x5, 0x95, 0xbb, 0x80,
+    0x0,
+
+    /* U+00FC "ü" */
+    0x3, 0xe0, 0x88, 0x0, 0x47, 0x81, 0x32, 0x0,
+    0xc4, 0x2, 0x20, 0x6, 0x40, 0x4, 0x5e, 0x60,
+    0x1f, 0xfc, 0xd1, 0x0, 0x84, 0x0, 0xc4, 0x1,
+    0x20, 0x3, 0xd2, 0x11, 0xe4, 0x0, 0xb2, 0xb7,
+    0x70, 0x0,
+
+    /* U+F053 */
+    0x0, 0xe2, 0xd7, 0x0, 0xc5, 0xe5, 0x40, 0x11,
+    0x79, 0xf, 0x80, 0xb, 0xc8, 0x70, 0x80, 0xbc,
+    0x87, 0x8, 0x7, 0xc8, 0x70, 0x80, 0x3c, 0x20,
+    0x10, 0xf9, 0xe, 0x98, 0x4, 0x5e, 0x43, 0xa6,
+    0x1, 0x17, 0x90, 0xe9, 0x80, 0x45, 0xe4, 0x3c,
+    0x1, 0x8b, 0xce, 0xc0,
+
+    /* U+F054 */
+    0xa, 0xb1, 0x0, 0xc4, 0xa9, 0x42, 0x1, 0x15,
+    0x2, 0x50, 0x80, 0x4b, 0x40, 0x94, 0x20, 0x12,
+    0xd0, 0x25, 0x8, 0x4, 0xb4, 0x9, 0x40, 0x18,
+    0xc0, 0x2, 0x1, 0x34, 0x82, 0x50, 0x1, 0xa4,
+    0x12, 0xc0, 0xd, 0x20, 0x96, 0x0, 0x29, 0x5,
+    0xb0, 0x8, 0x99, 0x68, 0x3, 0x0,
+};
+
+
+/*---------------------
+ *  GLYPH DESCRIPTION
+ *--------------------*/
+
+static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
+    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
+    {.bitmap_index = 0, .adv_w = 60, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 0, .adv_w = 60, .box_w = 2, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 11, .adv_w = 88, .box_w = 5, .box_h = 4, .ofs_x = 0, .ofs_y = 6},
+    {.bitmap_index = 19, .adv_w = 157, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 70, .adv_w = 139, .box_w = 9, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 128, .adv_w = 189, .box_w = 12, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 187, .adv_w = 154, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 235, .adv_w = 47, .box_w = 3, .box_h = 4, .ofs_x = 0, .ofs_y = 6},
+    {.bitmap_index = 240, .adv_w = 75, .box_w = 4, .box_h = 14, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 268, .adv_w = 76, .box_w = 4, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 295, .adv_w = 90, .box_w = 6, .box_h = 6, .ofs_x = 0, .ofs_y = 5},
+    {.bitmap_index = 314, .adv_w = 130, .box_w = 8, .box_h = 7, .ofs_x = 0, .ofs_y = 2},
+    {.bitmap_index = 334, .adv_w = 51, .box_w = 3, .box_h = 4, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 340, .adv_w = 86, .box_w = 5, .box_h = 2, .ofs_x = 0, .ofs_y = 3},
+    {.bitmap_index = 345, .adv_w = 51, .box_w = 3, .box_h = 2, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 348, .adv_w = 79, .box_w = 7, .box_h = 14, .ofs_x = -1, .ofs_y = -1},
+    {.bitmap_index = 386, .adv_w = 149, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 428, .adv_w = 83, .box_w = 4, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 437, .adv_w = 129, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 475, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 511, .adv_w = 150, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 552, .adv_w = 129, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 588, .adv_w = 138, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 631, .adv_w = 134, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 664, .adv_w = 144, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 707, .adv_w = 138, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 747, .adv_w = 51, .box_w = 3, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 756, .adv_w = 51, .box_w = 3, .box_h = 10, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 769, .adv_w = 130, .box_w = 8, .box_h = 6, .ofs_x = 0, .ofs_y = 2},
+    {.bitmap_index = 792, .adv_w = 130, .box_w = 8, .box_h = 6, .ofs_x = 0, .ofs_y = 2},
+    {.bitmap_index = 807, .adv_w = 130, .box_w = 8, .box_h = 6, .ofs_x = 0, .ofs_y = 2},
+    {.bitmap_index = 830, .adv_w = 128, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 862, .adv_w = 232, .box_w = 14, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 949, .adv_w = 164, .box_w = 11, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 995, .adv_w = 170, .box_w = 9, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1033, .adv_w = 162, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1075, .adv_w = 185, .box_w = 10, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1112, .adv_w = 150, .box_w = 8, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1139, .adv_w = 142, .box_w = 8, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1163, .adv_w = 173, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1205, .adv_w = 182, .box_w = 9, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1225, .adv_w = 69, .box_w = 2, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1230, .adv_w = 115, .box_w = 6, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1250, .adv_w = 161, .box_w = 9, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1289, .adv_w = 133, .box_w = 8, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1299, .adv_w = 214, .box_w = 11, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1345, .adv_w = 182, .box_w = 9, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1378, .adv_w = 188, .box_w = 12, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1431, .adv_w = 162, .box_w = 9, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1468, .adv_w = 188, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 1535, .adv_w = 163, .box_w = 9, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1575, .adv_w = 139, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1618, .adv_w = 131, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1633, .adv_w = 177, .box_w = 9, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1658, .adv_w = 159, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1703, .adv_w = 252, .box_w = 16, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1778, .adv_w = 151, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1824, .adv_w = 145, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1859, .adv_w = 147, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1895, .adv_w = 75, .box_w = 4, .box_h = 14, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 1908, .adv_w = 79, .box_w = 7, .box_h = 14, .ofs_x = -1, .ofs_y = -1},
+    {.bitmap_index = 1946, .adv_w = 75, .box_w = 4, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 1959, .adv_w = 131, .box_w = 6, .box_h = 6, .ofs_x = 1, .ofs_y = 2},
+    {.bitmap_index = 1978, .adv_w = 112, .box_w = 7, .box_h = 2, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 1982, .adv_w = 134, .box_w = 4, .box_h = 2, .ofs_x = 1, .ofs_y = 9},
+    {.bitmap_index = 1987, .adv_w = 134, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2020, .adv_w = 153, .box_w = 8, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2055, .adv_w = 128, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2085, .adv_w = 153, .box_w = 9, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2123, .adv_w = 137, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2155, .adv_w = 79, .box_w = 6, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2176, .adv_w = 155, .box_w = 9, .box_h = 11, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 2224, .adv_w = 153, .box_w = 8, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2252, .adv_w = 63, .box_w = 2, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2260, .adv_w = 64, .box_w = 5, .box_h = 14, .ofs_x = -2, .ofs_y = -3},
+    {.bitmap_index = 2277, .adv_w = 138, .box_w = 8, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2310, .adv_w = 63, .box_w = 2, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2315, .adv_w = 237, .box_w = 13, .box_h = 8, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2348, .adv_w = 153, .box_w = 8, .box_h = 8, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2372, .adv_w = 142, .box_w = 9, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2406, .adv_w = 153, .box_w = 8, .box_h = 11, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 2444, .adv_w = 153, .box_w = 9, .box_h = 11, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 2483, .adv_w = 92, .box_w = 5, .box_h = 8, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2497, .adv_w = 112, .box_w = 7, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2525, .adv_w = 93, .box_w = 6, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2548, .adv_w = 152, .box_w = 8, .box_h = 8, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2570, .adv_w = 125, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2601, .adv_w = 201, .box_w = 13, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2653, .adv_w = 124, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2683, .adv_w = 125, .box_w = 9, .box_h = 11, .ofs_x = -1, .ofs_y = -3},
+    {.bitmap_index = 2729, .adv_w = 117, .box_w = 7, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2756, .adv_w = 79, .box_w = 5, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 2783, .adv_w = 67, .box_w = 2, .box_h = 14, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 2788, .adv_w = 79, .box_w = 5, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 2815, .adv_w = 130, .box_w = 8, .box_h = 3, .ofs_x = 0, .ofs_y = 3},
+    {.bitmap_index = 2828, .adv_w = 60, .box_w = 2, .box_h = 10, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 2839, .adv_w = 94, .box_w = 6, .box_h = 6, .ofs_x = 0, .ofs_y = 5},
+    {.bitmap_index = 2858, .adv_w = 128, .box_w = 7, .box_h = 11, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 2891, .adv_w = 164, .box_w = 11, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2947, .adv_w = 150, .box_w = 8, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2984, .adv_w = 69, .box_w = 4, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2995, .adv_w = 182, .box_w = 9, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3041, .adv_w = 188, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3104, .adv_w = 177, .box_w = 9, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3140, .adv_w = 177, .box_w = 9, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3177, .adv_w = 134, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3220, .adv_w = 137, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3261, .adv_w = 63, .box_w = 4, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3272, .adv_w = 153, .box_w = 8, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3309, .adv_w = 142, .box_w = 9, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3353, .adv_w = 152, .box_w = 8, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3386, .adv_w = 152, .box_w = 8, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3420, .adv_w = 140, .box_w = 8, .box_h = 12, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 3464, .adv_w = 140, .box_w = 8, .box_h = 12, .ofs_x = 0, .ofs_y = -1}
+};
+
+/*---------------------
+ *  CHARACTER MAPPING
+ *--------------------*/
+
+static const uint16_t unicode_list_1[] = {
+    0x0, 0xf, 0x1e, 0x20, 0x28, 0x2c, 0x30, 0x32,
+    0x39, 0x3b, 0x40, 0x48, 0x4c, 0x50, 0x52, 0x59,
+    0x5b, 0xefb2, 0xefb3
+};
+
+/*Collect the unicode lists and glyph_id offsets*/
+static const lv_font_fmt_txt_cmap_t cmaps[] =
+{
+    {
+        .range_start = 32, .range_length = 95, .glyph_id_start = 1,
+        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+    },
+    {
+        .range_start = 161, .range_length = 61364, .glyph_id_start = 96,
+        .unicode_list = unicode_list_1, .glyph_id_ofs_list = NULL, .list_length = 19, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
+    }
+};
+
+/*-----------------
+ *    KERNING
+ *----------------*/
+
+/*Map glyph_ids to kern left classes*/
+static const uint8_t kern_left_class_mapping[] =
+{
+    0, 0, 1, 2, 0, 3, 4, 5, 2, 6, 7, 8, 9, 10, 9, 10,
+    11, 12, 0, 13, 14, 15, 16, 17, 18, 19, 12, 20, 20, 0, 0, 0,
+    21, 22, 23, 24, 25, 22, 26, 27, 28, 29, 29, 30, 31, 32, 29, 29,
+    22, 33, 34, 35, 3, 36, 30, 37, 37, 38, 39, 40, 41, 42, 43, 0,
+    44, 0, 45, 46, 47, 48, 49, 50, 51, 45, 52, 52, 53, 48, 45, 45,
+    46, 46, 54, 55, 56, 57, 51, 58, 58, 59, 58, 60, 41, 0, 0, 9,
+    61, 62, 63, 23, 26, 29, 29, 22, 30, 30, 45, 49, 51, 45, 46, 51,
+    51, 0, 0
+};
+
+/*Map glyph_ids to kern right classes*/
+static const uint8_t kern_right_class_mapping[] =
+{
+    0, 0, 1, 2, 0, 3, 4, 5, 2, 6, 7, 8, 9, 10, 9, 10,
+    11, 12, 13, 14, 15, 16, 17, 12, 18, 19, 20, 21, 21, 0, 0, 0,
+    22, 23, 24, 25, 23, 25, 25, 25, 23, 25, 25, 26, 25, 25, 25, 25,
+    23, 25, 23, 25, 3, 27, 28, 29, 29, 30, 31, 32, 33, 34, 35, 0,
+    36, 0, 37, 38, 39, 39, 39, 0, 39, 38, 40, 41, 38, 38, 42, 42,
+    39, 42, 39, 42, 43, 44, 45, 46, 46, 47, 48, 49, 0, 0, 35, 9,
+    50, 51, 52, 24, 25, 25, 25, 23, 28, 28, 37, 39, 42, 42, 39, 45,
+    45, 0, 0
+};
+
+/*Kern values between classes*/
+static const int8_t kern_class_values[] =
+{
+    0, 1, 0, 0, 0, 0, 0, 2, 0, 1, 0, 0, 2, 0, 0, 0,
+    0, 2, 0, 0, 0, 0, 0, 0, 0, 5, 4, 0, 2, 0, 4, 0,
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 10, 0, 6, -5, 0, 0, 4, 0, -12, -13, 2,
+    11, 5, 4, -9, 2, 11, 1, 9, 2, 7, 0, -10, 0, 0, 2, 0,
+    0, 0, 0, 0, 0, 13, 2, -2, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 4, -10, 0, -7, 0, 0, 0, 0, 0, -4,
+    4, 4, 0, 0, -2, 0, -2, 2, 0, -2, 0, -2, -1, -4, 0, 0,
+    0, 0, -2, 0, 0, -3, -3, 0, 0, -2, 0, -4, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -2, -2, -2, 0, 0, -3, -2, 0, -6, 0, -27,
+    0, 0, -4, -11, 4, 7, 0, 0, -4, 2, 2, 7, 4, -4, 4, 0,
+    0, -13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8, 0, 0,
+    3, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -6, 0,
+    -3, -11, 0, -9, -2, 0, 0, -7, 0, 0, 9, 0, -7, -2, -1, 1,
+    0, -4, 0, 0, -2, -17, 0, 3, 0, 7, -6, 0, -4, 0, -9, 3,
+    0, -18, -2, 9, 2, 0, 0, 0, 0, 0, 0, 2, 0, -3, -1, -3,
+    0, -2, -9, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0,
+    2, 0, 0, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0,
+    0, 0, 0, 0, 0, 9, 2, 1, 0, 0, 0, 0, 20, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 4, 2, 7,
+    -2, 0, 0, 4, -2, -7, -31, 2, 6, 4, 0, -3, 0, 8, 0, 7,
+    0, 7, 0, -21, 0, -3, 7, 0, 7, -2, 4, 2, 0, 0, 1, -2,
+    0, 0, -4, 18, 0, 18, 0, 7, 0, 9, 3, 9, 4, 0, 7, -18,
+    0, 0, -4, -8, 0, 0, 0, -2, 1, -2, 0, 2, -4, -3, -4, 2,
+    0, -2, 0, 0, 0, -9, 2, -4, 0, -4, -7, 0, -5, -4, -7, 0,
+    0, -15, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, -3, -5, -3,
+    -3, 0, 0, 0, 1, -12, 2, -14, 0, 0, 0, -7, -2, 0, 22, -3,
+    -3, 2, 2, -2, 0, -3, 2, 0, 0, -12, -4, 7, 0, 13, -7, -2,
+    -8, 0, -8, 4, 0, -22, 0, 2, 2, 0, -3, 0, 2, 0, 0, -2,
+    -3, -7, 0, -7, 0, 1, -14, 2, 0, 13, -4, 0, -8, 0, 7, 0,
+    -15, -22, -15, -4, 7, 0, 0, -15, 0, 3, -5, 0, -3, 0, -4, -9,
+    0, -2, 7, 0, 7, 0, 7, 0, 0, 6, 7, -27, -15, 0, -15, 2,
+    1, -15, -15, -6, -15, -7, -13, -7, -15, -15, 11, -17, 0, 2, 0, 0,
+    0, 0, 0, 2, 2, -3, -4, 0, -1, -1, -2, 0, 0, -2, 0, 0,
+    0, -4, 0, -2, 0, -5, -4, 0, -6, -7, -7, -4, 0, -4, 0, -4,
+    0, 0, 0, 0, -2, 0, 0, 2, 0, 2, -2, 2, 0, 0, 1, -7,
+    0, 0, 0, 2, -2, 0, 0, 0, -2, 2, 2, -1, 0, 0, 0, -4,
+    0, -1, 0, 0, 0, 0, 0, 1, 0, 3, -2, 0, -3, 0, -4, 0,
+    0, -2, 0, 7, 0, 0, -2, 0, 0, 0, 0, 0, -1, 1, -2, 1,
+    -2, 0, 0, 0, 0, -2, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -1, 0, -2, -3, 0, 0, 0, 0, 0, 1, 0, 0, -2, 0,
+    -2, -2, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0,
+    0, -2, -3, -2, 0, 0, -3, 0, 0, -7, -2, -7, 4, 0, 0, -4,
+    2, 4, 6, 0, -6, -1, -3, 0, -1, -11, 2, -2, 2, -12, 2, 0,
+    0, 1, -12, 0, -12, -2, -19, -2, 0, -11, 0, 4, 6, 0, 3, 0,
+    0, 0, 0, 0, 0, -4, -3, -4, 0, 0, -7, 2, 0, 0, 0, -2,
+    0, 0, 0, -2, 0, 0, 0, 0, 0, -1, -1, 0, -1, -3, 0, 0,
+    0, 0, 0, 0, 0, -2, -2, 0, -2, -3, -2, 0, 0, -2, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2, -2, 0, 0, -3, 0,
+    0, -2, 0, -4, 2, 0, 0, -3, 1, 2, 2, 0, 0, 0, 0, 0,
+    0, -2, 0, 0, 0, 0, 0, 2, 0, 0, -2, 0, -2, -2, -3, 0,
+    0, 0, 0, 0, 0, 0, 2, 0, -2, 0, 0, 0, 0, -2, -3, -2,
+    0, 0, -4, 0, 0, 7, -2, 1, -7, 0, 0, 6, -11, -12, -9, -4,
+    2, 0, -2, -15, -4, 0, -4, 0, -4, 3, -4, -14, 0, -6, 0, 0,
+    1, -1, 2, -2, 0, 2, 0, -7, -9, 0, -11, -5, -5, -5, -7, -3,
+    -6, 0, -4, 0, -6, -6, 1, -14, 0, 1, 0, -2, 0, 0, 0, 2,
+    0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -1,
+    0, -1, -2, 0, -4, -5, -5, -1, 0, -7, 0, 0, 0, 0, 0, 0,
+    -2, 0, 0, 0, 0, 1, -1, 1, 0, 0, 0, -4, 0, 2, 0, 0,
+    0, 0, 0, 0, 0, 0, 11, 0, 0, 0, 0, 0, 0, 2, 0, 0,
+    0, -2, 0, 2, 0, 8, -2, 0, -5, -2, -8, 0, 0, -4, 0, 2,
+    0, 0, 0, 0, 0, 0, 0, 2, 0, 2, -2, 2, 0, 0, 0, 0,
+    -2, 0, 0, 0, -4, 0, 0, 3, 0, -11, -7, 0, 0, 0, -3, -11,
+    0, 0, -2, 2, 0, -6, -1, -10, 0, -6, 0, 0, -3, -4, -3, -2,
+    -4, 0, 0, -4, 0, 0, -2, 0, 0, 0, 0, 0, 0, 2, 0, 2,
+    0, -2, 2, -24, 0, -4, 0, 0, 0, 0, 3, 0, 2, -4, -4, 0,
+    -2, -2, -3, 0, 0, 0, 0, 0, 0, -7, 0, -2, 0, -3, -2, 0,
+    -5, -6, -7, -2, 0, -4, 0, -7, 0, 0, 0, 0, 18, 0, 0, 1,
+    0, 0, -3, 0, 0, 0, 2, -4, 0, -10, 0, 0, 0, 0, 0, -21,
+    -4, 7, 7, -2, -9, 0, 2, -3, 0, -11, -1, -3, 2, -16, -2, 3,
+    0, 3, -8, -3, -8, -7, -9, 0, 0, -13, 0, 13, 0, 0, -1, 0,
+    0, 0, -1, -1, -2, -6, -7, -6, 0, 2, -21, 4, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -2, 0, -1, -2, -3, 0, 0, -4, 0, -2,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, -4, 0, 0, 4, -1, 3, 0, -5, 2, -2, -1, -6,
+    -2, 0, -3, -2, -2, 0, -3, -4, 0, 0, -2, -1, -2, -4, -3, 0,
+    0, -2, 0, 2, -2, 0, -5, 0, 0, 0, -4, 0, -4, 0, -4, 0,
+    -4, -2, 2, -3, 0, 0, 0, 0, 0, 0, 0, 0, -4, 2, 0, -3,
+    0, -2, -3, -7, -2, -2, -2, -1, -2, -3, -1, 0, 0, 0, 0, 0,
+    -2, -2, -2, 0, 0, 0, 0, 3, -2, 0, -2, 0, 0, 0, -2, -3,
+    -2, -2, -3, -2, -2, -2, 0, 0, 2, 9, -1, 0, -6, 0, -2, 4,
+    0, -2, -9, -3, 3, 0, 0, -11, -4, 2, -4, 2, 0, -2, -2, -7,
+    0, -3, 1, 0, 0, -4, 0, 0, 0, 2, 2, -4, -4, 0, -4, -2,
+    -3, -2, -2, 0, -4, 1, -4, 1, -4, -2, 7, -11, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, -3, 0,
+    0, -2, -2, 0, 0, 0, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0,
+    0, 0, -2, 0, 0, 0, 0, -2, 0, 0, -3, 0, -4, 0, 0, 0,
+    -7, 0, 2, -5, 4, 0, -2, -11, 0, 0, -5, -2, 0, -9, -6, -6,
+    0, 0, -10, -2, -9, -9, -11, 0, -6, 0, 2, 15, -3, 0, -5, -2,
+    -1, -2, -4, -6, -4, -8, -9, -8, -5, 0, -2, 0, 0, 0, -2, 0,
+    1, 0, 0, -16, -2, 7, 5, -5, -8, 0, 1, -7, 0, -11, -2, -2,
+    4, -21, -3, 1, 0, 0, -15, -3, -12, -2, -16, 0, 0, -16, 0, 13,
+    1, 0, -2, 0, 0, 0, 0, -1, -2, -9, -2, -9, 0, 0, -15, 0,
+    0, 0, 0, 0, -7, 0, -2, 0, -1, -6, -11, 0, 0, -1, -3, -7,
+    -2, 0, -2, 0, 0, 0, 0, -10, -2, -7, -7, -2, -4, -6, -2, -4,
+    0, -4, -2, -7, -3, 0, -3, -4, -2, -4, 0, 1, 0, -2, -7, -2,
+    0, 0, 4, -12, 0, -4, 0, 0, 0, 0, 3, 0, 2, -4, 9, 0,
+    -2, -2, -3, 0, 0, 0, 0, 0, 0, -7, 0, -2, 0, -3, -2, 0,
+    -5, -6, -7, -2, 0, -4, 2, 9, 0, 0, 0, 0, 18, 0, 0, 1,
+    0, 0, -3, 0, 0, 0, 2, -4, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -2, -4, 0, 0, 0, 0, 0, -1, 0, 0,
+    0, -2, -2, 0, 0, -4, -2, 0, 0, -4, 0, 4, -1, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 3, -2, 4, 2, -2, 0,
+    -7, -4, 0, 7, -7, -7, -4, -4, 9, 4, 2, -19, -2, 4, -2, 0,
+    -2, 2, -2, -8, 0, -2, 2, -3, -2, -7, -2, 0, 0, 7, 4, 0,
+    -6, 0, -12, -3, 6, -3, -9, 1, -3, -7, -7, -7, -2, -4, 9, -13,
+    2, 0, -3, 0, -6, 0, 2, 7, -5, -8, -9, -6, 7, 0, 1, -16,
+    -2, 2, -4, -2, -5, 0, -5, -8, -3, -3, -2, 0, 0, -5, -5, -2,
+    0, 7, 5, -2, -12, 0, -12, -3, 0, -8, -13, -1, -7, -4, -7, -4,
+    -6, -7, 6, -16, 0, 0, -3, 0, -4, -2, 0, -2, -4, 0, 4, -7,
+    2, 0, 0, -12, 0, -2, -5, -4, -2, -7, -6, -7, -5, 0, -7, -2,
+    -5, -4, -7, -2, 0, 0, 1, 11, -4, 0, -7, -2, 0, -2, -4, -5,
+    -6, -6, -9, -6, -3, -2, -4, 1, 4, 0, -3, 0, -11, -3, 1, 4,
+    -7, -8, -4, -7, 7, -2, 1, -21, -4, 4, -5, -4, -8, 0, -7, -9,
+    -3, -2, -2, -2, -5, -7, -1, 0, 0, 7, 6, -2, -15, 0, -13, -5,
+    5, -9, -15, -4, -8, -9, -11, -9, -7, -9, 4, -18, 0, 0, 0, 0,
+    -3, 0, 0, 2, -3, 4, 2, -4, 4, 0, 0, -7, -1, 0, -1, 0,
+    1, 1, -2, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 2, 7,
+    0, 0, -3, 0, 0, 0, 0, -2, -2, -3, 0, -3, 0, 1, 0, 0,
+    1, 2, 0, 0, 0, 0, 2, 1, -2, 0, 9, 0, 4, 1, 1, -3,
+    0, 4, 0, 0, 0, 2, 0, 0, 0, 0, 4, 0, 5, 1, 6, 0,
+    0, 7, 0, 6, -2, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, -13, 0, -2, 4, 0, 7, -31, 0, 22, 3, -4,
+    -4, 2, 2, -2, 1, -11, 0, 0, 11, -13, -4, 7, 0, 7, -4, -2,
+    -9, 4, -4, 0, 0, -15, 9, 31, 0, 0, 0, 0, 27, 0, 0, 0,
+    0, 4, 0, 4, 0, 9, -13, 7, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -4, 0, 0, -4, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 4, -6,
+    0, 0, 1, -2, 0, 2, 29, -4, -2, 7, 6, -6, 2, 0, 0, 2,
+    2, -3, -7, 13, 7, 18, 0, -2, -2, 11, -2, 4, 0, -29, 6, 0,
+    -2, 0, -6, 0, 24, 0, 2, -4, -6, -3, 8, 4, 6, 2, 0, 0,
+    0, 0, 0, -6, 0, 0, 0, -6, 0, 0, 0, 0, -5, -1, 0, 0,
+    0, -5, 0, -3, 0, -11, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -15, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, -2, 0, -2,
+    0, 0, -4, 0, 0, -3, 0, -6, 0, 0, 0, -4, 2, -3, 0, 0,
+    -6, -2, -5, 0, 0, -6, 0, -2, 0, -11, 0, -2, 0, 0, -18, -4,
+    -9, -2, -8, 0, 0, -15, 0, -6, -1, 0, 0, 0, 0, 0, 0, 0,
+    0, -3, -4, -3, -2, 0, -4, -2, 0, 0, 0, 0, -5, 0, -5, 3,
+    -2, 4, 0, -2, -5, -2, -4, -4, 0, -3, -1, -2, 2, -6, -1, 0,
+    0, 0, -20, -2, -3, 0, -5, 0, -2, -11, -2, 0, 0, -2, -2, 0,
+    0, 0, 0, 2, 0, -2, -4, -2, -2, 0, 4, -2, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -5, 0, -2, 0, 0, 0, -4, 2, 0, 0, 0, -6, -2, -4, 0,
+    0, -6, 0, -2, 0, -11, 0, 0, 0, 0, -22, 0, -4, -8, -11, 0,
+    0, -15, 0, -2, -3, 0, 0, 0, 0, 0, 0, 0, 0, -2, -3, -2,
+    -1, 0, -3, -2, 1, 0, 0, 4, -3, 0, 7, 11, -2, -2, -7, 3,
+    11, 4, 5, -6, 3, 9, 3, 6, 5, 6, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 14, 11, -4, -2, 0, -2, 18, 10, 18, 0, 0,
+    0, 2, 0, 2, 0, 0, 8, -3, 0, 0, -4, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0,
+    0, 0, -19, -3, -2, -9, -11, 0, 0, -15, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0,
+    0, 3, 0, 0, 0, 0, -19, -3, -2, -9, -11, 0, 0, -9, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -2, 0, 0, 0, -5, 2, 0, -2, 2, 4, 2, -7,
+    0, 0, -2, 2, 0, 2, 0, 0, 0, 0, -6, 0, -2, -2, -4, 0,
+    -2, -9, 0, 14, -2, 0, -5, -2, 0, -2, -4, 0, -2, -6, -4, -6,
+    -3, 0, 0, 0, 0, 0, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    -2, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, -19, -3,
+    -2, -9, -11, 0, 0, -15, 0, 0, 0, 0, 0, 0, 11, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, -7, -3, -2, 7,
+    -2, -2, -9, 1, -1, 1, -2, -6, 0, 5, 0, 2, 1, 2, -5, -9,
+    -3, 0, -9, -4, -6, -9, -9, 0, -4, -4, -3, -3, -2, -2, -3, -2,
+    0, -2, -1, 3, 0, 3, -2, 3, 0, 0, 7, -8, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, -2, -2, -2, 0, 0, -6, 0, -1,
+    0, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2, -2, 0, 0, -3, 0,
+    0, 0, 0, 0, -2, 0, 0, -4, -2, 2, 0, -4, -4, -2, 0, -6,
+    -2, -5, -2, -3, 0, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -15, 0, 7, 0, 0, -4, 0, 0, 0, 0, -3, 0, -2, 0, -2,
+    0, 0, -1, 0, 0, 0, -2, 0, -5, 0, 0, 9, -3, -7, -7, 2,
+    2, 2, 0, -6, 2, 3, 2, 7, 2, 7, -2, -6, 0, 0, -9, 0,
+    0, -7, -6, 0, 0, -4, 0, -3, -4, 0, -3, 0, -3, 0, -2, 3,
+    0, -2, -7, -2, -2, 0, 8, -7, 0, 0, -2, 0, -4, 0, 0, 3,
+    -5, 0, 2, -2, 2, 0, 0, -7, 0, -2, -1, 0, -2, 2, -2, 0,
+    0, 0, -9, -3, -5, 0, -7, 0, 0, -11, 0, 8, -2, 0, -4, 0,
+    1, 0, -2, 0, -2, -7, 0, -7, -2, 0, 2, 0, 0, 0, 0, 0,
+    -2, 0, 0, 2, -3, 1, 0, 0, -3, -2, 0, -3, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -14, 0, 5,
+    0, 0, -2, 0, 0, 0, 0, 0, 0, -2, -2, -2, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 9, 0, -4, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, 0, 2, 0, 2, -4, 0, -7, -2, -9, 0,
+    0, -12, 1, 2, 0, 0, 0, 0, 15, 0, 0, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 4, 4, 5, 0, 0, 0, 7, 0, -14, -13, 1,
+    10, 7, 4, -9, 2, 9, 0, 8, 0, 4, 2, -21, 0, -2, 9, 0,
+    6, -4, 4, 0, 0, 12, 0, 0, 0, 0, -4, 0, 0, 0, -1, 4,
+    0, 8, 2, 8, 0, 0, 0, -14, -1, -8, 0, -13, -4, 0, 0, -19,
+    -9, 1, 9, -11, -10, 0, 0, -10, 0, -10, -10, 0, -1, -30, -12, 3,
+    0, 0, -13, -8, -15, 2, -17, 0, 0, -21, 2, 11, -4, 0, -7, -3,
+    16, -3, -2, -3, -11, -11, 2, -5, 0, 0, -13, -6
+};
+
+/*Collect the kern class' data in one place*/
+static const lv_font_fmt_txt_kern_classes_t kern_classes = {
+    .class_pair_values   = kern_class_values,
+    .left_class_mapping  = kern_left_class_mapping,
+    .right_class_mapping = kern_right_class_mapping,
+    .left_class_cnt      = 63,
+    .right_class_cnt     = 52,
+};
+
+/*--------------------
+ *  ALL CUSTOM DATA
+ *--------------------*/
+
+/*Store all the custom data of the font*/
+static lv_font_fmt_txt_glyph_cache_t cache;
+static const lv_font_fmt_txt_dsc_t font_dsc = {
+    .glyph_bitmap = glyph_bitmap,
+    .glyph_dsc = glyph_dsc,
+    .cmaps = cmaps,
+    .kern_dsc = &kern_classes,
+    .kern_scale = 16,
+    .cmap_num = 2,
+    .bpp = 4,
+    .kern_classes = 1,
+    .bitmap_format = 1,
+    .cache = &cache
+};
+
+
+/*-----------------
+ *  PUBLIC FONT
+ *----------------*/
+
+/*Initialize a public general font descriptor*/
+const lv_font_t ui_font_14 = {
+    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/
+    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
+    .line_height = 16,          /*The maximum line height required by the font*/
+    .base_line = 3,             /*Baseline measured from the bottom of the line*/
+    .subpx = LV_FONT_SUBPX_NONE,
+    .underline_position = -1,
+    .underline_thickness = 1,
+    .dsc = &font_dsc           /*The custom font data. Will be accessed by `get_glyph_bitmap/dsc` */
+};
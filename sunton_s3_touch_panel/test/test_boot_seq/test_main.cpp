@@ -0,0 +1,242 @@
+// BootPlan driven the way BootSeq::poll() drives it, on a simulated clock
+// with peripheral latencies: pio test -e native -f test_boot_seq
+#include "boot_seq.h"
+#include <unity.h>
+
+#define NEVER 0xFFFFFFFFUL // An external phase that is left to expire()
+
+// How long a phase takes and how it ends
+struct Latency {
+  uint32_t ms;
+  bool ok;
+};
+
+static BootPlan plan;
+static bool noTask[BOOT_MAX_PHASES]; // xTaskCreate() fails for these
+
+// Main phases hold the loop task for their latency; task and external
+// phases end that long after they start. Between passes the loop idles
+// until the next of those ends. Returns when all have ended.
+static void simulate(const Latency *lat) {
+  uint32_t now = 0, due[BOOT_MAX_PHASES];
+  for (uint8_t i = 0; i < BOOT_MAX_PHASES; i++)
+    due[i] = NEVER;
+  for (;;) {
+    bool more = true;
+    while (more) {
+      more = false;
+      for (uint8_t i = 0; i < plan.count(); i++)
+        if (plan.running(i) && due[i] <= now)
+          plan.finish(i, lat[i].ok, due[i]);
+      plan.expire(now);
+      if (plan.skip(now))
+        more = true;
+      int8_t i;
+      while ((i = plan.take(BOOT_TASK, now)) >= 0) {
+        if (noTask[i]) {
+          plan.finish(i, false, now);
+          more = true;
+        } else {
+          due[i] = now + lat[i].ms;
+        }
+      }
+      while ((i = plan.take(BOOT_EXTERNAL, now)) >= 0)
+        due[i] = lat[i].ms == NEVER ? NEVER : now + lat[i].ms;
+      if ((i = plan.take(BOOT_MAIN, now)) >= 0) {
+        now += lat[i].ms;
+        plan.finish(i, lat[i].ok, now);
+        more = true;
+      }
+    }
+    if (plan.done())
+      return;
+    uint32_t next = NEVER;
+    for (uint8_t i = 0; i < plan.count(); i++) {
+      if (!plan.running(i))
+        continue;
+      uint32_t t = due[i] != NEVER ? due[i] : plan.start(i) + BOOT_EXTERNAL_MS;
+      if (t < next)
+        next = t;
+    }
+    if (next == NEVER)
+      TEST_FAIL_MESSAGE("nothing left to end the boot");
+    now = next;
+  }
+}
+
+// The phases of sunton_s3_touch_panel's setup()
+enum { S3_DISPLAY, S3_UI, S3_USB, S3_TOUCH, S3_SD, S3_MACROS, S3_BLE };
+
+static void addS3() {
+  plan.add("display", BOOT_MAIN, NULL);
+  plan.add("ui", BOOT_MAIN, NULL, BOOT_BIT(S3_DISPLAY));
+  plan.add("usb", BOOT_MAIN, NULL);
+  plan.add("touch", BOOT_TASK, NULL);
+  plan.add("sd", BOOT_TASK, NULL, BOOT_BIT(S3_TOUCH));
+  plan.add("macros", BOOT_MAIN, NULL, BOOT_BIT(S3_UI) | BOOT_BIT(S3_SD));
+  plan.add("ble", BOOT_TASK, NULL);
+}
+
+// Display init, LVGL and first frame, USB, two 100 ms reset pulses, SD
+// mount, macros.json, NimBLE
+static Latency s3[] = {{120, true}, {180, true}, {30, true},  {210, true},
+                       {350, true}, {60, true},  {650, true}};
+
+// The phases of sunton_ha_control's setup()
+enum {
+  HA_DISPLAY,
+  HA_TOUCH,
+  HA_CONFIG,
+  HA_HA,
+  HA_UI,
+  HA_WIFI,
+  HA_SYNC
+};
+
+static void addHa() {
+  plan.add("display", BOOT_MAIN, NULL);
+  plan.add("touch", BOOT_TASK, NULL);
+  plan.add("config", BOOT_TASK, NULL);
+  plan.add("ha", BOOT_MAIN, NULL, BOOT_BIT(HA_CONFIG));
+  plan.add("ui", BOOT_MAIN, NULL, BOOT_BIT(HA_DISPLAY) | BOOT_BIT(HA_HA));
+  plan.add("wifi", BOOT_EXTERNAL, NULL, BOOT_BIT(HA_HA));
+  plan.add("sync", BOOT_EXTERNAL, NULL, 0, BOOT_BIT(HA_WIFI));
+}
+
+static Latency ha[] = {{150, true}, {220, true},  {90, true}, {20, true},
+                       {250, true}, {2500, true}, {400, true}};
+
+static void assertPhase(uint8_t i, uint32_t start, uint32_t end) {
+  TEST_ASSERT_EQUAL_UINT32_MESSAGE(start, plan.start(i), plan.name(i));
+  TEST_ASSERT_EQUAL_UINT32_MESSAGE(end, plan.end(i), plan.name(i));
+}
+
+void setUp() {
+  plan = BootPlan();
+  for (uint8_t i = 0; i < BOOT_MAX_PHASES; i++)
+    noTask[i] = false;
+}
+
+void tearDown() {}
+
+static void test_s3_ui_is_up_before_the_peripherals() {
+  addS3();
+  simulate(s3);
+  assertPhase(S3_DISPLAY, 0, 120);
+  assertPhase(S3_UI, 120, 300);
+  assertPhase(S3_USB, 300, 330);
+  assertPhase(S3_TOUCH, 0, 210);
+  assertPhase(S3_SD, 300, 650); // Noticed between ui and usb
+  assertPhase(S3_MACROS, 650, 710);
+  assertPhase(S3_BLE, 0, 650);
+  TEST_ASSERT_EQUAL_UINT32(710, plan.total());
+}
+
+static void test_s3_beats_the_serial_setup() {
+  addS3();
+  simulate(s3);
+  uint32_t serial = 0;
+  for (uint8_t i = 0; i < plan.count(); i++)
+    serial += s3[i].ms;
+  TEST_ASSERT_EQUAL_UINT32(1600, serial);
+  TEST_ASSERT_LESS_THAN_UINT32(serial / 2, plan.total());
+}
+
+static void test_slow_sd_only_delays_macros() {
+  Latency slow[7];
+  for (uint8_t i = 0; i < 7; i++)
+    slow[i] = s3[i];
+  slow[S3_SD].ms = 5000;
+  addS3();
+  simulate(slow);
+  assertPhase(S3_UI, 120, 300);
+  assertPhase(S3_SD, 300, 5300);
+  assertPhase(S3_MACROS, 5300, 5360);
+}
+
+static void test_after_runs_when_a_dependency_failed() {
+  Latency noSd[7];
+  for (uint8_t i = 0; i < 7; i++)
+    noSd[i] = s3[i];
+  noSd[S3_SD].ok = false;
+  addS3();
+  simulate(noSd);
+  TEST_ASSERT_EQUAL(BOOT_FAILED, plan.state(S3_SD));
+  TEST_ASSERT_TRUE(plan.ok(S3_MACROS)); // Built-in pages, "No SD"
+}
+
+static void test_ha_sync_waits_for_wifi() {
+  addHa();
+  simulate(ha);
+  assertPhase(HA_DISPLAY, 0, 150);
+  assertPhase(HA_CONFIG, 0, 90);
+  assertPhase(HA_HA, 150, 170);
+  assertPhase(HA_UI, 170, 420);
+  assertPhase(HA_WIFI, 170, 2670);
+  assertPhase(HA_SYNC, 2670, 3070);
+  TEST_ASSERT_EQUAL_UINT32(3070, plan.total());
+}
+
+static void test_needs_skips_when_a_dependency_failed() {
+  Latency noWifi[7];
+  for (uint8_t i = 0; i < 7; i++)
+    noWifi[i] = ha[i];
+  noWifi[HA_WIFI].ms = NEVER;
+  addHa();
+  simulate(noWifi);
+  TEST_ASSERT_EQUAL(BOOT_FAILED, plan.state(HA_WIFI));
+  assertPhase(HA_WIFI, 170, 170 + BOOT_EXTERNAL_MS);
+  TEST_ASSERT_EQUAL(BOOT_SKIPPED, plan.state(HA_SYNC));
+  assertPhase(HA_SYNC, 170 + BOOT_EXTERNAL_MS, 170 + BOOT_EXTERNAL_MS);
+  TEST_ASSERT_TRUE(plan.done());
+}
+
+static void test_skip_cascades_but_after_still_runs() {
+  plan.add("a", BOOT_MAIN, NULL);
+  plan.add("b", BOOT_MAIN, NULL, 0, BOOT_BIT(0));
+  plan.add("c", BOOT_TASK, NULL, 0, BOOT_BIT(1));
+  plan.add("d", BOOT_MAIN, NULL, BOOT_BIT(1));
+  Latency lat[] = {{10, false}, {10, true}, {10, true}, {10, true}};
+  simulate(lat);
+  TEST_ASSERT_EQUAL(BOOT_FAILED, plan.state(0));
+  TEST_ASSERT_EQUAL(BOOT_SKIPPED, plan.state(1));
+  TEST_ASSERT_EQUAL(BOOT_SKIPPED, plan.state(2));
+  TEST_ASSERT_TRUE(plan.ok(3));
+  assertPhase(3, 10, 20);
+}
+
+static void test_failed_task_start_ends_the_phase() {
+  noTask[S3_TOUCH] = true;
+  addS3();
+  simulate(s3);
+  TEST_ASSERT_EQUAL(BOOT_FAILED, plan.state(S3_TOUCH));
+  assertPhase(S3_TOUCH, 0, 0);
+  assertPhase(S3_SD, 0, 350); // Started in the same pass
+  TEST_ASSERT_TRUE(plan.done());
+}
+
+static void test_add_is_bounded() {
+  Latency lat[BOOT_MAX_PHASES];
+  for (uint8_t i = 0; i < BOOT_MAX_PHASES; i++) {
+    TEST_ASSERT_EQUAL_UINT8(i, plan.add("p", BOOT_MAIN, NULL));
+    lat[i] = {1, true};
+  }
+  TEST_ASSERT_EQUAL_UINT8(BOOT_NONE, plan.add("extra", BOOT_MAIN, NULL));
+  TEST_ASSERT_EQUAL_UINT8(BOOT_MAX_PHASES, plan.count());
+  simulate(lat);
+  TEST_ASSERT_EQUAL_UINT32(BOOT_MAX_PHASES, plan.total());
+}
+
+int main(int, char **) {
+  UNITY_BEGIN();
+  RUN_TEST(test_s3_ui_is_up_before_the_peripherals);
+  RUN_TEST(test_s3_beats_the_serial_setup);
+  RUN_TEST(test_slow_sd_only_delays_macros);
+  RUN_TEST(test_after_runs_when_a_dependency_failed);
+  RUN_TEST(test_ha_sync_waits_for_wifi);
+  RUN_TEST(test_needs_skips_when_a_dependency_failed);
+  RUN_TEST(test_skip_cascades_but_after_still_runs);
+  RUN_TEST(test_failed_task_start_ends_the_phase);
+  RUN_TEST(test_add_is_bounded);
+  return UNITY_END();
+}
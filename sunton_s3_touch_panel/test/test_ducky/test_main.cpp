@@ -0,0 +1,227 @@
+// DuckyCompiler bytecode and DuckyPlayer replay: pio test -e native
+#include "ducky.h"
+#include <stdlib.h>
+#include <string>
+#include <unity.h>
+#include <vector>
+
+struct FakeKeyboard {
+  std::string log;
+  uint32_t now = 0;
+
+  void press(uint8_t key) { log += "P" + std::to_string(key) + " "; }
+  void releaseAll() { log += "R "; }
+  void type(const char *text, uint16_t len) {
+    log += "T[" + std::string(text, len) + "]@" + std::to_string(now) + " ";
+  }
+  bool typing() { return false; }
+};
+
+static std::vector<uint8_t> code;
+static std::vector<char> text;
+static DuckyProgram prog;
+
+// Both passes, as compilePayload() runs them
+static bool compile(const char *src, size_t len) {
+  prog.code = NULL;
+  prog.text = NULL;
+  if (!DuckyCompiler::compile(src, len, prog))
+    return false;
+  code.assign(prog.codeLen, 0xEE);
+  text.assign(prog.textLen + 1, 0);
+  prog.code = code.data();
+  prog.text = text.data();
+  uint32_t codeLen = prog.codeLen, textLen = prog.textLen;
+  bool ok = DuckyCompiler::compile(src, len, prog);
+  TEST_ASSERT_EQUAL(codeLen, prog.codeLen);
+  TEST_ASSERT_EQUAL(textLen, prog.textLen);
+  return ok;
+}
+
+static bool compile(const char *src) { return compile(src, strlen(src)); }
+
+static uint32_t u16(size_t at) { return code[at] | (code[at + 1] << 8); }
+static uint32_t u32(size_t at) { return u16(at) | (u16(at + 2) << 16); }
+
+// Plays the program to the end on a 1 ms clock
+static std::string play(uint32_t limit = 100000) {
+  static FakeKeyboard kb;
+  static MacroRunner<FakeKeyboard> runner(kb);
+  DuckyPlayer player;
+  runner.cancel();
+  kb = FakeKeyboard();
+  player.start(&prog);
+  while ((player.active() || runner.busy()) && kb.now < limit) {
+    player.feed(runner);
+    runner.run(kb.now);
+    kb.now++;
+  }
+  return kb.log;
+}
+
+void setUp() {}
+void tearDown() {}
+
+static void test_string_goes_to_the_text_table() {
+  TEST_ASSERT_TRUE(compile("STRING hello world"));
+  TEST_ASSERT_EQUAL(6, prog.codeLen);
+  TEST_ASSERT_EQUAL(DUCKY_TEXT, code[0]);
+  TEST_ASSERT_EQUAL(0, u16(1));
+  TEST_ASSERT_EQUAL(11, u16(3));
+  TEST_ASSERT_EQUAL(DUCKY_END, code[5]);
+  TEST_ASSERT_EQUAL_STRING("hello world", text.data());
+}
+
+static void test_stringln_appends_a_newline() {
+  TEST_ASSERT_TRUE(compile("STRINGLN ab\nSTRING cd"));
+  TEST_ASSERT_EQUAL(3, u16(3));
+  TEST_ASSERT_EQUAL(3, u16(6)); // Second text starts after "ab\n"
+  TEST_ASSERT_EQUAL(2, u16(8));
+  TEST_ASSERT_EQUAL_STRING("ab\ncd", text.data());
+}
+
+static void test_bare_string_reads_nothing_past_the_line() {
+  // The byte after the buffer must not turn it into STRINGLN
+  const char src[] = "STRINGL";
+  TEST_ASSERT_TRUE(compile(src, 6));
+  TEST_ASSERT_EQUAL(DUCKY_TEXT, code[0]);
+  TEST_ASSERT_EQUAL(0, u16(3));
+  TEST_ASSERT_EQUAL(0, prog.textLen);
+
+  // Same from a buffer that ends exactly at the line
+  char *exact = (char *)malloc(6);
+  memcpy(exact, "STRING", 6);
+  TEST_ASSERT_TRUE(compile(exact, 6));
+  free(exact);
+  TEST_ASSERT_EQUAL(0, prog.textLen);
+}
+
+static void test_keys_and_modifier_combos() {
+  TEST_ASSERT_TRUE(compile("CTRL ALT DELETE\nCTRL-SHIFT ESC\nGUI r\nENTER\n"
+                           "GUI\nF12\nALT -"));
+  const uint8_t want[] = {
+      DUCKY_KEYS, DUCKY_MOD_CTRL | DUCKY_MOD_ALT,   0xD4,
+      DUCKY_KEYS, DUCKY_MOD_CTRL | DUCKY_MOD_SHIFT, 0xB1,
+      DUCKY_KEYS, DUCKY_MOD_GUI,                    'r',
+      DUCKY_KEYS, 0,                                0xB0,
+      DUCKY_KEYS, DUCKY_MOD_GUI,                    0,
+      DUCKY_KEYS, 0,                                0xCD,
+      DUCKY_KEYS, DUCKY_MOD_ALT,                    '-',
+      DUCKY_END};
+  TEST_ASSERT_EQUAL(sizeof(want), prog.codeLen);
+  TEST_ASSERT_EQUAL_MEMORY(want, code.data(), sizeof(want));
+  TEST_ASSERT_EQUAL(0, prog.unknownLines);
+}
+
+static void test_comments_blanks_and_crlf() {
+  TEST_ASSERT_TRUE(compile("REM setup\r\n\r\n// note\r\n  ENTER  \r\nREM"));
+  TEST_ASSERT_EQUAL(4, prog.codeLen);
+  TEST_ASSERT_EQUAL(DUCKY_KEYS, code[0]);
+  TEST_ASSERT_EQUAL(0xB0, code[2]);
+  TEST_ASSERT_EQUAL(0, prog.unknownLines);
+}
+
+static void test_unknown_lines_are_counted_and_skipped() {
+  TEST_ASSERT_TRUE(compile("FOO\nCTRL NOPE\nDELAY x\nREPEAT 3\nENTER ENTER\n"
+                           "STRING ok"));
+  TEST_ASSERT_EQUAL(5, prog.unknownLines); // REPEAT with nothing before
+  TEST_ASSERT_EQUAL(DUCKY_TEXT, code[0]);
+  TEST_ASSERT_EQUAL(6, prog.codeLen);
+}
+
+static void test_delay_operand_is_32_bit() {
+  TEST_ASSERT_TRUE(compile("DELAY 70000"));
+  TEST_ASSERT_EQUAL(DUCKY_DELAY, code[0]);
+  TEST_ASSERT_EQUAL(70000, u32(1));
+}
+
+static void test_default_delay_follows_commands_but_not_delays() {
+  TEST_ASSERT_TRUE(compile("DEFAULT_DELAY 100\nENTER\nDELAY 5\nTAB\n"
+                           "DEFAULTDELAY 0\nTAB"));
+  const uint8_t want[] = {DUCKY_KEYS,  0,    0xB0, DUCKY_DELAY, 100, 0, 0, 0,
+                          DUCKY_DELAY, 5,    0,    0,           0,
+                          DUCKY_KEYS,  0,    0xB3, DUCKY_DELAY, 100, 0, 0, 0,
+                          DUCKY_KEYS,  0,    0xB3, DUCKY_END};
+  TEST_ASSERT_EQUAL(sizeof(want), prog.codeLen);
+  TEST_ASSERT_EQUAL_MEMORY(want, code.data(), sizeof(want));
+}
+
+static void test_repeat_covers_the_command_and_its_default_delay() {
+  TEST_ASSERT_TRUE(compile("DEFAULT_DELAY 10\nTAB\nREPEAT 4"));
+  TEST_ASSERT_EQUAL(DUCKY_REPEAT, code[8]);
+  TEST_ASSERT_EQUAL(4, u16(9));
+  TEST_ASSERT_EQUAL(0, u16(11));
+  TEST_ASSERT_EQUAL(8, u16(13)); // KEYS + DELAY
+}
+
+static void test_repeat_after_delay_repeats_the_delay() {
+  TEST_ASSERT_TRUE(compile("STRING a\nDELAY 50\nREPEAT 2\nSTRING b"));
+  TEST_ASSERT_EQUAL(DUCKY_REPEAT, code[10]);
+  TEST_ASSERT_EQUAL(5, u16(13));
+  TEST_ASSERT_EQUAL(10, u16(15));
+  // "a", then 50 ms three times before "b"
+  std::string log = play();
+  TEST_ASSERT_EQUAL_STRING("T[a]@0 T[b]@150 ", log.c_str());
+}
+
+static void test_repeat_of_repeat_replays_the_original_command() {
+  TEST_ASSERT_TRUE(compile("STRING x\nREPEAT 1\nREPEAT 2"));
+  TEST_ASSERT_EQUAL(u16(8), u16(15));
+  TEST_ASSERT_EQUAL(u16(10), u16(17));
+  std::string log = play();
+  TEST_ASSERT_EQUAL_STRING("T[x]@0 T[x]@0 T[x]@0 T[x]@0 ", log.c_str());
+}
+
+static void test_player_replays_keys_with_modifiers() {
+  TEST_ASSERT_TRUE(compile("CTRL SHIFT ESC\nSTRINGLN hi"));
+  std::string log = play();
+  TEST_ASSERT_EQUAL_STRING("P128 P129 P177 R T[hi\n]@0 ", log.c_str());
+}
+
+static void test_player_streams_payloads_longer_than_the_queue() {
+  std::string src, want;
+  for (int i = 0; i < 300; i++) {
+    src += "STRING " + std::to_string(i) + "\nENTER\n";
+    want += "T[" + std::to_string(i) + "]@";
+  }
+  TEST_ASSERT_TRUE(compile(src.c_str()));
+  std::string log = play();
+  size_t typed = 0, enters = 0;
+  for (size_t at = 0; (at = log.find("T[", at)) != std::string::npos; at++)
+    typed++;
+  for (size_t at = 0; (at = log.find("P176 R", at)) != std::string::npos;
+       at++)
+    enters++;
+  TEST_ASSERT_EQUAL(300, typed);
+  TEST_ASSERT_EQUAL(300, enters);
+  TEST_ASSERT_EQUAL(0, log.find("T[0]@0 P176 R T[1]@0 "));
+}
+
+static void test_text_table_limit_fails_the_compile() {
+  std::string src;
+  std::string line = "STRING " + std::string(1000, 'x') + "\n";
+  for (int i = 0; i < 66; i++)
+    src += line;
+  prog.code = NULL;
+  prog.text = NULL;
+  TEST_ASSERT_FALSE(DuckyCompiler::compile(src.data(), src.size(), prog));
+}
+
+int main(int, char **) {
+  UNITY_BEGIN();
+  RUN_TEST(test_string_goes_to_the_text_table);
+  RUN_TEST(test_stringln_appends_a_newline);
+  RUN_TEST(test_bare_string_reads_nothing_past_the_line);
+  RUN_TEST(test_keys_and_modifier_combos);
+  RUN_TEST(test_comments_blanks_and_crlf);
+  RUN_TEST(test_unknown_lines_are_counted_and_skipped);
+  RUN_TEST(test_delay_operand_is_32_bit);
+  RUN_TEST(test_default_delay_follows_commands_but_not_delays);
+  RUN_TEST(test_repeat_covers_the_command_and_its_default_delay);
+  RUN_TEST(test_repeat_after_delay_repeats_the_delay);
+  RUN_TEST(test_repeat_of_repeat_replays_the_original_command);
+  RUN_TEST(test_player_replays_keys_with_modifiers);
+  RUN_TEST(test_player_streams_payloads_longer_than_the_queue);
+  RUN_TEST(test_text_table_limit_fails_the_compile);
+  return UNITY_END();
+}
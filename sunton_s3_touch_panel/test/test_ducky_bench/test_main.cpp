@@ -0,0 +1,169 @@
+// Per-press cost of the compiled payload against the line interpreter it
+// replaced (processSDCommand() on Arduino Strings, reproduced here on
+// std::string): pio test -e native -f test_ducky_bench
+#include "ducky.h"
+#include <chrono>
+#include <stdio.h>
+#include <string>
+#include <unity.h>
+#include <vector>
+
+#define KEY_LEFT_ALT 0x82
+#define KEY_LEFT_GUI 0x83
+#define KEY_RETURN 0xB0
+#define KEY_TAB 0xB3
+#define PRESSES 2000
+
+// Folds everything it is asked to do into a checksum
+struct HashKeyboard {
+  uint32_t hash = 2166136261u;
+
+  void mix(uint32_t v) { hash = (hash ^ v) * 16777619u; }
+  void press(uint8_t key) { mix(key); }
+  void releaseAll() { mix(0x100); }
+  void type(const char *text, uint16_t len) {
+    for (uint16_t i = 0; i < len; i++)
+      mix((uint8_t)text[i]);
+  }
+  bool typing() { return false; }
+};
+
+static HashKeyboard kb;
+static MacroRunner<HashKeyboard> runner(kb);
+static uint32_t clockMs;
+
+// Waits pass instantly; only the parsing and queueing are measured
+static void drain() {
+  while (runner.busy()) {
+    runner.run(clockMs);
+    clockMs += 1000;
+  }
+}
+
+static bool processLine(std::string cmd) {
+  size_t a = cmd.find_first_not_of(" \t\r");
+  size_t b = cmd.find_last_not_of(" \t\r");
+  cmd = a == std::string::npos ? "" : cmd.substr(a, b - a + 1);
+  if (cmd.empty() || cmd.compare(0, 2, "//") == 0)
+    return true;
+  if (cmd.compare(0, 6, "DELAY ") == 0)
+    return runner.wait(atoi(cmd.substr(6).c_str()));
+  if (cmd.compare(0, 7, "STRING ") == 0)
+    return runner.type(cmd.c_str() + 7, cmd.length() - 7);
+  if (cmd == "ENTER")
+    return runner.press(KEY_RETURN) && runner.releaseAll();
+  if (cmd.compare(0, 4, "GUI ") == 0 || cmd.compare(0, 8, "WINDOWS ") == 0)
+    return runner.combo(KEY_LEFT_GUI, cmd.substr(cmd.find(' ') + 1)[0]);
+  if (cmd.compare(0, 4, "ALT ") == 0)
+    return runner.combo(KEY_LEFT_ALT, cmd.substr(4)[0]);
+  if (cmd == "TAB")
+    return runner.press(KEY_TAB) && runner.releaseAll();
+  return true;
+}
+
+// One press of the old path: split the file into lines, parse each one
+static void interpret(const std::string &file) {
+  size_t at = 0;
+  while (at < file.size()) {
+    size_t eol = file.find('\n', at);
+    if (eol == std::string::npos)
+      eol = file.size();
+    std::string line = file.substr(at, eol - at);
+    if (runner.room() < 3)
+      drain(); // A combo must not be cut in half
+    while (!processLine(line))
+      drain(); // Text pool full; the old code gave up here
+    at = eol + 1;
+  }
+  drain();
+}
+
+static void play(const DuckyProgram &p) {
+  DuckyPlayer player;
+  player.start(&p);
+  while (player.active()) {
+    player.feed(runner);
+    drain();
+  }
+}
+
+static std::string payload() {
+  std::string s = "// Opens a terminal and fills in a form\n"
+                  "GUI r\nDELAY 300\nSTRING cmd /k echo lista de precios\n"
+                  "ENTER\nDELAY 500\n";
+  for (int i = 0; i < 40; i++) {
+    s += "STRING Producto " + std::to_string(i) + " - referencia interna\n";
+    s += "TAB\nSTRING " + std::to_string(i * 37) + ",50\nTAB\n";
+    s += "ALT s\nDELAY 20\nENTER\n";
+  }
+  return s;
+}
+
+static double usSince(std::chrono::steady_clock::time_point t) {
+  return std::chrono::duration<double, std::micro>(
+             std::chrono::steady_clock::now() - t)
+      .count();
+}
+
+void setUp() {
+  runner.cancel();
+  kb = HashKeyboard();
+}
+
+void tearDown() {}
+
+static void test_bytecode_types_what_the_interpreter_typed() {
+  std::string src = payload();
+  interpret(src);
+  uint32_t want = kb.hash;
+
+  DuckyProgram p = {};
+  TEST_ASSERT_TRUE(DuckyCompiler::compile(src.data(), src.size(), p));
+  std::vector<uint8_t> code(p.codeLen);
+  std::vector<char> text(p.textLen);
+  p.code = code.data();
+  p.text = text.data();
+  TEST_ASSERT_TRUE(DuckyCompiler::compile(src.data(), src.size(), p));
+  TEST_ASSERT_EQUAL(0, p.unknownLines);
+
+  kb = HashKeyboard();
+  play(p);
+  TEST_ASSERT_EQUAL(want, kb.hash);
+}
+
+static void test_bytecode_press_is_cheaper_than_interpreting() {
+  std::string src = payload();
+  std::chrono::steady_clock::time_point t = std::chrono::steady_clock::now();
+  for (int i = 0; i < PRESSES; i++)
+    interpret(src);
+  double lineUs = usSince(t) / PRESSES;
+
+  t = std::chrono::steady_clock::now();
+  DuckyProgram p = {};
+  DuckyCompiler::compile(src.data(), src.size(), p);
+  std::vector<uint8_t> code(p.codeLen);
+  std::vector<char> text(p.textLen);
+  p.code = code.data();
+  p.text = text.data();
+  DuckyCompiler::compile(src.data(), src.size(), p);
+  double compileUs = usSince(t);
+
+  t = std::chrono::steady_clock::now();
+  for (int i = 0; i < PRESSES; i++)
+    play(p);
+  double codeUs = usSince(t) / PRESSES;
+
+  printf("%u bytes of script, %u code + %u text bytes\n",
+         (unsigned)src.size(), (unsigned)p.codeLen, (unsigned)p.textLen);
+  printf("line interpreter: %.2f us/press\n", lineUs);
+  printf("bytecode: %.2f us/press, %.2f us to compile once\n", codeUs,
+         compileUs);
+  TEST_ASSERT_TRUE(codeUs < lineUs);
+}
+
+int main(int, char **) {
+  UNITY_BEGIN();
+  RUN_TEST(test_bytecode_types_what_the_interpreter_typed);
+  RUN_TEST(test_bytecode_press_is_cheaper_than_interpreting);
+  return UNITY_END();
+}
@@ -0,0 +1,187 @@
+// HidTyper report sequences on the en-US and es-ES layouts: pio test -e
+// native -f test_hid_typer
+#include "hid_typer.h"
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include <unity.h>
+
+// Records each report as "mods:usage" in hex
+struct FakeSink {
+  std::string log;
+  uint32_t reports = 0;
+
+  void send(uint8_t mods, uint8_t usage) {
+    char b[8];
+    snprintf(b, sizeof(b), "%02X:%02X ", mods, usage);
+    log += b;
+    reports++;
+  }
+};
+
+static FakeSink sink;
+static HidTyper<FakeSink> typer(sink, HID_LAYOUT_EN_US);
+
+// Types `text` to the end, one report interval per poll
+static std::string type(const HidLayout &layout, const char *text) {
+  typer.setLayout(layout);
+  typer.begin(text, strlen(text), 0);
+  for (uint32_t now = 0; typer.busy() && now < 1000000;
+       now += TYPER_REPORT_INTERVAL_US)
+    typer.poll(now);
+  return sink.log;
+}
+
+void setUp() {
+  typer.cancel();
+  typer.setReportInterval(TYPER_REPORT_INTERVAL_US);
+  sink = FakeSink();
+}
+
+void tearDown() {}
+
+static void check_sorted(const HidLayout &l) {
+  for (uint16_t i = 1; i < l.count; i++)
+    TEST_ASSERT_TRUE_MESSAGE(l.keys[i - 1].cp < l.keys[i].cp, l.name);
+  for (uint16_t i = 0; i < l.count; i++)
+    TEST_ASSERT_TRUE(hidLayoutFind(l, l.keys[i].cp) == &l.keys[i]);
+}
+
+static void test_tables_are_sorted_and_searchable() {
+  check_sorted(HID_LAYOUT_EN_US);
+  check_sorted(HID_LAYOUT_ES_ES);
+  TEST_ASSERT_TRUE(hidLayoutFind(HID_LAYOUT_EN_US, 0x00F1) == NULL);
+  TEST_ASSERT_TRUE(hidLayoutFind(HID_LAYOUT_ES_ES, 0x0001) == NULL);
+  TEST_ASSERT_TRUE(hidLayoutFind(HID_LAYOUT_ES_ES, 0xFFFF) == NULL);
+}
+
+static void test_both_layouts_cover_printable_ascii() {
+  for (uint16_t cp = 0x20; cp < 0x7F; cp++) {
+    TEST_ASSERT_NOT_NULL(hidLayoutFind(HID_LAYOUT_EN_US, cp));
+    TEST_ASSERT_NOT_NULL(hidLayoutFind(HID_LAYOUT_ES_ES, cp));
+  }
+}
+
+static void test_same_modifiers_roll_over_without_release() {
+  std::string log = type(HID_LAYOUT_EN_US, "abc");
+  TEST_ASSERT_EQUAL_STRING("00:04 00:05 00:06 00:00 ", log.c_str());
+}
+
+static void test_repeated_key_and_modifier_change_release() {
+  std::string log = type(HID_LAYOUT_EN_US, "Hi!!");
+  TEST_ASSERT_EQUAL_STRING("02:0B 00:00 00:0C 00:00 02:1E 00:00 02:1E 00:00 ",
+                           log.c_str());
+}
+
+static void test_en_us_symbols() {
+  std::string log = type(HID_LAYOUT_EN_US, "@\"/\n");
+  TEST_ASSERT_EQUAL_STRING("02:1F 02:34 00:00 00:38 00:28 00:00 ",
+                           log.c_str());
+}
+
+static void test_es_es_symbols_move_and_use_altgr() {
+  std::string log = type(HID_LAYOUT_ES_ES, "@\"/-");
+  TEST_ASSERT_EQUAL_STRING("40:1F 00:00 02:1F 02:24 00:00 00:38 00:00 ",
+                           log.c_str());
+}
+
+static void test_es_es_direct_keys() {
+  std::string log = type(HID_LAYOUT_ES_ES, "ñÑç¿¡€");
+  TEST_ASSERT_EQUAL_STRING("00:33 00:00 02:33 00:00 00:31 00:00 02:2E 00:00 "
+                           "00:2E 00:00 40:22 00:00 ",
+                           log.c_str());
+}
+
+static void test_es_es_accents_go_through_the_dead_key() {
+  // ´ then a; Shift+´ (¨) then Shift+u; ` then e
+  std::string log = type(HID_LAYOUT_ES_ES, "áÜè");
+  TEST_ASSERT_EQUAL_STRING("00:34 00:04 00:00 02:34 02:18 00:00 00:2F 00:08 "
+                           "00:00 ",
+                           log.c_str());
+}
+
+static void test_es_es_bare_dead_key_symbols_add_a_space() {
+  std::string log = type(HID_LAYOUT_ES_ES, "^~");
+  TEST_ASSERT_EQUAL_STRING("02:2F 00:00 00:2C 00:00 40:21 00:00 00:2C 00:00 ",
+                           log.c_str());
+}
+
+static void test_spanish_sentence_report_count() {
+  const char *text = "¿Qué tal, señor López?";
+  std::string log = type(HID_LAYOUT_ES_ES, text);
+  // 22 characters, é and ó two strokes each
+  TEST_ASSERT_EQUAL(0, typer.lastSkipped());
+  TEST_ASSERT_EQUAL(0, log.compare(0, 12, "02:2E 02:14 "));
+  TEST_ASSERT_EQUAL(0, log.compare(log.size() - 12, 12, "02:2D 00:00 "));
+  TEST_ASSERT_TRUE(sink.reports >= 24);
+  TEST_ASSERT_TRUE(sink.reports < 48); // Press + release would be 48
+}
+
+static void test_unmapped_and_malformed_input_is_skipped() {
+  std::string log = type(HID_LAYOUT_EN_US, "añ\xFF"
+                                           "b\xE2\x82");
+  TEST_ASSERT_EQUAL_STRING("00:04 00:05 00:00 ", log.c_str());
+  TEST_ASSERT_EQUAL(3, typer.lastSkipped());
+}
+
+static void test_poll_sends_one_report_per_interval() {
+  typer.setLayout(HID_LAYOUT_EN_US);
+  typer.begin("abcdefghij", 10, 5000);
+  typer.poll(5000);
+  TEST_ASSERT_EQUAL(1, sink.reports);
+  typer.poll(5999);
+  TEST_ASSERT_EQUAL(1, sink.reports);
+  typer.poll(6000);
+  TEST_ASSERT_EQUAL(2, sink.reports);
+  typer.poll(9000); // Three intervals late
+  TEST_ASSERT_EQUAL(5, sink.reports);
+}
+
+static void test_late_poll_catches_up_at_most_a_burst() {
+  typer.setLayout(HID_LAYOUT_EN_US);
+  typer.begin("abcdefghijklmnopqrst", 20, 0);
+  typer.poll(0);
+  typer.poll(100000);
+  TEST_ASSERT_EQUAL(1 + TYPER_MAX_BURST, sink.reports);
+}
+
+static void test_chars_per_second() {
+  // 11 reports 1 ms apart; done on the poll after the last one
+  type(HID_LAYOUT_EN_US, "abcdefghij");
+  TEST_ASSERT_EQUAL(909, typer.lastCps());
+  setUp();
+  typer.setReportInterval(2000);
+  type(HID_LAYOUT_EN_US, "abcdefghij");
+  TEST_ASSERT_EQUAL(454, typer.lastCps());
+}
+
+static void test_cancel_releases_held_keys() {
+  typer.setLayout(HID_LAYOUT_ES_ES);
+  typer.begin("@@", 2, 0);
+  typer.poll(0);
+  typer.cancel();
+  TEST_ASSERT_FALSE(typer.busy());
+  TEST_ASSERT_EQUAL_STRING("40:1F 00:00 ", sink.log.c_str());
+  typer.cancel(); // Nothing held: no extra report
+  TEST_ASSERT_EQUAL(2, sink.reports);
+}
+
+int main(int, char **) {
+  UNITY_BEGIN();
+  RUN_TEST(test_tables_are_sorted_and_searchable);
+  RUN_TEST(test_both_layouts_cover_printable_ascii);
+  RUN_TEST(test_same_modifiers_roll_over_without_release);
+  RUN_TEST(test_repeated_key_and_modifier_change_release);
+  RUN_TEST(test_en_us_symbols);
+  RUN_TEST(test_es_es_symbols_move_and_use_altgr);
+  RUN_TEST(test_es_es_direct_keys);
+  RUN_TEST(test_es_es_accents_go_through_the_dead_key);
+  RUN_TEST(test_es_es_bare_dead_key_symbols_add_a_space);
+  RUN_TEST(test_spanish_sentence_report_count);
+  RUN_TEST(test_unmapped_and_malformed_input_is_skipped);
+  RUN_TEST(test_poll_sends_one_report_per_interval);
+  RUN_TEST(test_late_poll_catches_up_at_most_a_burst);
+  RUN_TEST(test_chars_per_second);
+  RUN_TEST(test_cancel_releases_held_keys);
+  return UNITY_END();
+}
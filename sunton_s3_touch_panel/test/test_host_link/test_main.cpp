@@ -0,0 +1,183 @@
+// Print acknowledgement protocol: HostLinkParser lines and the PrintTracker
+// states with their timeouts. pio test -e native -f test_host_link
+#include "host_link.h"
+#include <unity.h>
+
+static HostLinkParser parser;
+static PrintTracker job;
+
+// Feeds `text` and returns the number of messages it completed; the last
+// one is left in `out`
+static int feed(const char *text, HostMsg &out) {
+  int n = 0;
+  for (; *text; text++)
+    if (parser.feed((uint8_t)*text, out))
+      n++;
+  return n;
+}
+
+static HostMsg msg(HostMsgType type, uint16_t seq) {
+  HostMsg m = {type, seq};
+  return m;
+}
+
+void setUp() {
+  parser = HostLinkParser();
+  job = PrintTracker();
+}
+
+void tearDown() {}
+
+static void test_parses_every_message() {
+  HostMsg m;
+  TEST_ASSERT_EQUAL(1, feed("HELLO\n", m));
+  TEST_ASSERT_EQUAL(HOST_MSG_HELLO, m.type);
+  TEST_ASSERT_EQUAL(1, feed("ACK 7\n", m));
+  TEST_ASSERT_EQUAL(HOST_MSG_ACK, m.type);
+  TEST_ASSERT_EQUAL_UINT16(7, m.seq);
+  TEST_ASSERT_EQUAL(1, feed("DONE 65535\n", m));
+  TEST_ASSERT_EQUAL(HOST_MSG_DONE, m.type);
+  TEST_ASSERT_EQUAL_UINT16(65535, m.seq);
+  TEST_ASSERT_EQUAL(1, feed("FAIL 0\n", m));
+  TEST_ASSERT_EQUAL(HOST_MSG_FAIL, m.type);
+  TEST_ASSERT_EQUAL_UINT16(0, m.seq);
+}
+
+// HID reports are padded with 0x00 and a line may span two of them
+static void test_ignores_padding_and_cr() {
+  HostMsg m;
+  const uint8_t report[] = {'A', 'C', 'K', ' ', '1', 0, 0, 0};
+  for (uint8_t c : report)
+    TEST_ASSERT_FALSE(parser.feed(c, m));
+  TEST_ASSERT_EQUAL(1, feed("2\r\n", m));
+  TEST_ASSERT_EQUAL(HOST_MSG_ACK, m.type);
+  TEST_ASSERT_EQUAL_UINT16(12, m.seq);
+  TEST_ASSERT_EQUAL(2, feed("HELLO\nDONE 12\n", m));
+  TEST_ASSERT_EQUAL(HOST_MSG_DONE, m.type);
+}
+
+static void test_rejects_bad_lines() {
+  HostMsg m;
+  const char *bad[] = {"",         "HELLO 1",   "ACK",     "ACK ",
+                       "ACK x",    "ACK 1x",    "ACK -1",  "DONE 65536",
+                       "PRINT 3",  "ack 1",     "FAIL  1", "NOPE"};
+  for (const char *line : bad)
+    TEST_ASSERT_FALSE_MESSAGE(HostLinkParser::parseLine(line, m), line);
+  TEST_ASSERT_EQUAL(0, feed("ACK 1x\n\n", m));
+  TEST_ASSERT_EQUAL(1, feed("ACK 1\n", m)); // Good again after a bad one
+}
+
+// A line longer than the buffer is dropped whole, not cut into a message
+static void test_drops_overlong_lines() {
+  HostMsg m;
+  char line[HOST_LINK_MAX_LINE + 8];
+  memset(line, '0', sizeof(line));
+  memcpy(line, "ACK ", 4);
+  line[sizeof(line) - 2] = '\n';
+  line[sizeof(line) - 1] = '\0';
+  TEST_ASSERT_EQUAL(0, feed(line, m));
+  TEST_ASSERT_EQUAL(1, feed("DONE 4\n", m));
+  TEST_ASSERT_EQUAL_UINT16(4, m.seq);
+}
+
+static void test_formats_print_command() {
+  char buf[16];
+  TEST_ASSERT_EQUAL(9, formatPrintCommand(buf, sizeof(buf), 42));
+  TEST_ASSERT_EQUAL_STRING("PRINT 42\n", buf);
+}
+
+static void test_idle_until_begin() {
+  TEST_ASSERT_EQUAL(PRINT_IDLE, job.poll(100000));
+  job.onMessage(msg(HOST_MSG_DONE, 0), 0);
+  TEST_ASSERT_EQUAL(PRINT_IDLE, job.poll(100000));
+}
+
+static void test_ack_then_done() {
+  uint16_t seq = job.begin(1000);
+  TEST_ASSERT_EQUAL(PRINT_SENT, job.poll(1000));
+  job.onMessage(msg(HOST_MSG_ACK, seq), 1500);
+  TEST_ASSERT_EQUAL(PRINT_ACKED, job.poll(1500 + PRINT_ACK_TIMEOUT));
+  job.onMessage(msg(HOST_MSG_DONE, seq), 9000);
+  TEST_ASSERT_EQUAL(PRINT_DONE, job.poll(9000));
+  TEST_ASSERT_EQUAL(PRINT_DONE, job.poll(100000)); // Stays until reset
+  job.reset();
+  TEST_ASSERT_EQUAL(PRINT_IDLE, job.poll(100000));
+}
+
+static void test_ack_then_fail() {
+  uint16_t seq = job.begin(0);
+  job.onMessage(msg(HOST_MSG_ACK, seq), 10);
+  job.onMessage(msg(HOST_MSG_FAIL, seq), 20);
+  TEST_ASSERT_EQUAL(PRINT_FAILED, job.poll(20));
+  job.onMessage(msg(HOST_MSG_DONE, seq), 30); // Too late
+  TEST_ASSERT_EQUAL(PRINT_FAILED, job.poll(30));
+}
+
+// The agent may answer DONE without an ACK seen first
+static void test_done_without_ack() {
+  uint16_t seq = job.begin(0);
+  job.onMessage(msg(HOST_MSG_DONE, seq), 10);
+  TEST_ASSERT_EQUAL(PRINT_DONE, job.poll(10));
+}
+
+static void test_no_ack_means_no_agent() {
+  job.begin(5000);
+  TEST_ASSERT_EQUAL(PRINT_SENT, job.poll(5000 + PRINT_ACK_TIMEOUT - 1));
+  TEST_ASSERT_EQUAL(PRINT_NO_AGENT, job.poll(5000 + PRINT_ACK_TIMEOUT));
+  TEST_ASSERT_FALSE(job.agentSeen());
+}
+
+// The DONE timeout counts from the ACK, not from begin()
+static void test_no_done_after_ack_fails() {
+  uint16_t seq = job.begin(0);
+  job.onMessage(msg(HOST_MSG_ACK, seq), 1900);
+  TEST_ASSERT_EQUAL(PRINT_ACKED, job.poll(1900 + PRINT_DONE_TIMEOUT - 1));
+  TEST_ASSERT_EQUAL(PRINT_FAILED, job.poll(1900 + PRINT_DONE_TIMEOUT));
+}
+
+// Answers to an older job move nothing, but show that an agent is there
+static void test_ignores_other_sequences() {
+  uint16_t old = job.begin(0);
+  job.reset();
+  uint16_t seq = job.begin(100);
+  TEST_ASSERT_NOT_EQUAL(old, seq);
+  job.onMessage(msg(HOST_MSG_DONE, old), 200);
+  TEST_ASSERT_EQUAL(PRINT_SENT, job.poll(200));
+  TEST_ASSERT_TRUE(job.agentSeen());
+  job.onMessage(msg(HOST_MSG_ACK, seq), 300);
+  TEST_ASSERT_EQUAL(PRINT_ACKED, job.poll(300));
+}
+
+static void test_hello_marks_agent_only() {
+  job.begin(0);
+  job.onMessage(msg(HOST_MSG_HELLO, 0), 10);
+  TEST_ASSERT_TRUE(job.agentSeen());
+  TEST_ASSERT_EQUAL(PRINT_SENT, job.poll(10));
+}
+
+// millis() wraps after 49 days; the timeouts still run on the difference
+static void test_timeouts_across_millis_wrap() {
+  uint32_t t0 = 0xFFFFFFFFu - 500;
+  job.begin(t0);
+  TEST_ASSERT_EQUAL(PRINT_SENT, job.poll(t0 + 1000));
+  TEST_ASSERT_EQUAL(PRINT_NO_AGENT, job.poll(t0 + PRINT_ACK_TIMEOUT));
+}
+
+int main(int, char **) {
+  UNITY_BEGIN();
+  RUN_TEST(test_parses_every_message);
+  RUN_TEST(test_ignores_padding_and_cr);
+  RUN_TEST(test_rejects_bad_lines);
+  RUN_TEST(test_drops_overlong_lines);
+  RUN_TEST(test_formats_print_command);
+  RUN_TEST(test_idle_until_begin);
+  RUN_TEST(test_ack_then_done);
+  RUN_TEST(test_ack_then_fail);
+  RUN_TEST(test_done_without_ack);
+  RUN_TEST(test_no_ack_means_no_agent);
+  RUN_TEST(test_no_done_after_ack_fails);
+  RUN_TEST(test_ignores_other_sequences);
+  RUN_TEST(test_hello_marks_agent_only);
+  RUN_TEST(test_timeouts_across_millis_wrap);
+  return UNITY_END();
+}
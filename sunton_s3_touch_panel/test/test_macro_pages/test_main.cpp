@@ -0,0 +1,210 @@
+// macroConfigLoad with good, bad and oversized /macros.json documents:
+// pio test -e native -f test_macro_pages
+#include <string.h>
+
+// glibc only has strlcpy from 2.38 on; the ESP32 libc always does
+#if defined(__GLIBC__) && !__GLIBC_PREREQ(2, 38)
+static size_t strlcpy(char *dst, const char *src, size_t size) {
+  size_t len = strlen(src);
+  if (size) {
+    size_t n = len < size - 1 ? len : size - 1;
+    memcpy(dst, src, n);
+    dst[n] = '\0';
+  }
+  return len;
+}
+#endif
+
+#include "macro_pages.h"
+#include <string>
+#include <unity.h>
+
+#define DOC_SIZE 8192 // main.cpp sizes it from the file: 2x + 1 KB
+
+static MacroConfig cfg;
+static uint32_t allocs;
+
+static void *countingAlloc(size_t n) {
+  allocs++;
+  return malloc(n);
+}
+
+static void *failingAlloc(size_t) { return NULL; }
+
+static int load(const char *json, size_t docSize = DOC_SIZE,
+                MacroAlloc alloc = countingAlloc) {
+  return macroConfigLoad(json, docSize, cfg, alloc);
+}
+
+// Frees what the scripts of `cfg` allocated
+static void freeScripts() {
+  for (uint8_t i = 0; i < cfg.itemCount; i++) {
+    if (cfg.items[i].kind == MACRO_SCRIPT) {
+      free(cfg.items[i].script.code);
+      free(cfg.items[i].script.text);
+    }
+  }
+}
+
+void setUp() {
+  memset(&cfg, 0, sizeof(cfg));
+  allocs = 0;
+}
+
+void tearDown() { freeScripts(); }
+
+static void test_loads_every_kind() {
+  const char *json = "{\"pages\": ["
+                     "{\"name\": \"PC\", \"macros\": ["
+                     "  {\"label\": \"CMD\", \"builtin\": \"cmd\"},"
+                     "  {\"label\": \"Ventas\", \"payload\": \"/ventas.txt\","
+                     "   \"color\": \"#43A047\"}]},"
+                     "{\"name\": \"Texto\", \"macros\": ["
+                     "  {\"label\": \"Firma\", \"script\":"
+                     "   \"STRINGLN Un saludo,\\nSTRING Tomas\","
+                     "   \"color\": \"E53935\"}]}"
+                     "]}";
+  TEST_ASSERT_EQUAL(3, load(json));
+  TEST_ASSERT_EQUAL_UINT8(2, cfg.pageCount);
+  TEST_ASSERT_EQUAL_STRING("PC", cfg.pages[0].name);
+  TEST_ASSERT_EQUAL_UINT8(0, cfg.pages[0].first);
+  TEST_ASSERT_EQUAL_UINT8(2, cfg.pages[0].count);
+  TEST_ASSERT_EQUAL_STRING("Texto", cfg.pages[1].name);
+  TEST_ASSERT_EQUAL_UINT8(2, cfg.pages[1].first);
+  TEST_ASSERT_EQUAL_UINT8(1, cfg.pages[1].count);
+
+  const MacroItem &cmd = cfg.items[0];
+  TEST_ASSERT_EQUAL(MACRO_BUILTIN, cmd.kind);
+  TEST_ASSERT_EQUAL_UINT8(BUILTIN_CMD, cmd.builtin);
+  TEST_ASSERT_EQUAL_HEX32(MACRO_DEFAULT_COLOR, cmd.color);
+
+  const MacroItem &ventas = cfg.items[1];
+  TEST_ASSERT_EQUAL(MACRO_PAYLOAD, ventas.kind);
+  TEST_ASSERT_EQUAL_STRING("/ventas.txt", ventas.path);
+  TEST_ASSERT_EQUAL_HEX32(0x43A047, ventas.color);
+
+  const MacroItem &firma = cfg.items[2];
+  TEST_ASSERT_EQUAL(MACRO_SCRIPT, firma.kind);
+  TEST_ASSERT_EQUAL_HEX32(0xE53935, firma.color);
+  TEST_ASSERT_NOT_NULL(firma.script.code);
+  TEST_ASSERT_GREATER_THAN(0, firma.script.codeLen);
+  TEST_ASSERT_EQUAL_UINT32(strlen("Un saludo,\nTomas"), firma.script.textLen);
+  TEST_ASSERT_EQUAL(2, allocs); // Code and text, sized exactly
+}
+
+static void test_defaults_match_the_old_page() {
+  macroConfigDefaults(cfg);
+  TEST_ASSERT_EQUAL_UINT8(1, cfg.pageCount);
+  TEST_ASSERT_EQUAL_UINT8(BUILTIN_COUNT, cfg.itemCount);
+  TEST_ASSERT_EQUAL_UINT8(BUILTIN_COUNT, cfg.pages[0].count);
+  TEST_ASSERT_EQUAL_STRING("IMPRIMIR", cfg.items[BUILTIN_PRINT].label);
+  TEST_ASSERT_EQUAL_UINT8(BUILTIN_VSCODE, cfg.items[BUILTIN_VSCODE].builtin);
+}
+
+// A document that does not parse leaves the previous config alone
+static void test_broken_json_is_refused() {
+  macroConfigDefaults(cfg);
+  TEST_ASSERT_EQUAL(-1, load("{\"pages\": [{\"name\": \"PC\""));
+  TEST_ASSERT_EQUAL(-1, load(""));
+  TEST_ASSERT_EQUAL(-1, load("pages"));
+  TEST_ASSERT_EQUAL_UINT8(BUILTIN_COUNT, cfg.itemCount);
+}
+
+// Bad entries are skipped, and a page left empty is dropped
+static void test_bad_entries_are_skipped() {
+  const char *json = "{\"pages\": ["
+                     "{\"name\": \"Mal\", \"macros\": ["
+                     "  {\"label\": \"X\", \"builtin\": \"format_c\"},"
+                     "  {\"label\": \"Nada\"},"
+                     "  \"CMD\", 3, null]},"
+                     "{\"macros\": ["
+                     "  {\"builtin\": \"lock\"},"
+                     "  {\"label\": \"Sin color\", \"builtin\": \"cmd\","
+                     "   \"color\": \"\"}]},"
+                     "{\"name\": \"Sin lista\"},"
+                     "{\"name\": \"Lista mala\", \"macros\": {}}"
+                     "]}";
+  TEST_ASSERT_EQUAL(2, load(json));
+  TEST_ASSERT_EQUAL_UINT8(1, cfg.pageCount);
+  TEST_ASSERT_EQUAL_STRING("?", cfg.pages[0].name);
+  TEST_ASSERT_EQUAL_UINT8(0, cfg.pages[0].first);
+  TEST_ASSERT_EQUAL_STRING("?", cfg.items[0].label);
+  TEST_ASSERT_EQUAL_UINT8(BUILTIN_LOCK, cfg.items[0].builtin);
+  TEST_ASSERT_EQUAL_HEX32(MACRO_DEFAULT_COLOR, cfg.items[1].color);
+}
+
+static void test_no_pages_loads_nothing() {
+  TEST_ASSERT_EQUAL(0, load("{}"));
+  TEST_ASSERT_EQUAL(0, load("{\"pages\": 5}"));
+  TEST_ASSERT_EQUAL(0, load("[]"));
+  TEST_ASSERT_EQUAL_UINT8(0, cfg.pageCount);
+}
+
+// Without memory for the compiled code the script is skipped, not half set
+static void test_script_without_memory_is_skipped() {
+  const char *json = "{\"pages\": [{\"name\": \"PC\", \"macros\": ["
+                     "{\"label\": \"S\", \"script\": \"STRING hola\"},"
+                     "{\"label\": \"C\", \"builtin\": \"cmd\"}]}]}";
+  TEST_ASSERT_EQUAL(1, load(json, DOC_SIZE, failingAlloc));
+  TEST_ASSERT_EQUAL(MACRO_BUILTIN, cfg.items[0].kind);
+  TEST_ASSERT_EQUAL_STRING("C", cfg.items[0].label);
+}
+
+// A document bigger than the JSON pool the caller allows is refused whole
+static void test_oversized_document_is_refused() {
+  std::string json = "{\"pages\": [{\"name\": \"PC\", \"macros\": [";
+  for (int i = 0; i < 40; i++)
+    json += std::string(i ? "," : "") +
+            "{\"label\": \"Macro\", \"builtin\": \"cmd\"}";
+  json += "]}]}";
+  TEST_ASSERT_EQUAL(40, load(json.c_str()));
+  TEST_ASSERT_EQUAL(-1, load(json.c_str(), 512));
+}
+
+// Past MACRO_MAX_PAGES / MACRO_MAX_ITEMS the rest is left out, and long
+// strings are cut to their fields
+static void test_oversized_config_is_capped() {
+  std::string json = "{\"pages\": [";
+  for (int p = 0; p < MACRO_MAX_PAGES + 2; p++) {
+    json += p ? ",{" : "{";
+    json += "\"name\": \"Una pagina con un nombre largo\", \"macros\": [";
+    for (int i = 0; i < 12; i++)
+      json += std::string(i ? "," : "") +
+              "{\"label\": \"Etiqueta demasiado larga para el boton\", "
+              "\"payload\": \"/macros/una/ruta/muy/larga/que/no/cabe.txt\"}";
+    json += "]}";
+  }
+  json += "]}";
+  TEST_ASSERT_EQUAL(MACRO_MAX_ITEMS, load(json.c_str(), 65536));
+  TEST_ASSERT_EQUAL_UINT8(MACRO_MAX_ITEMS / 12 + 1, cfg.pageCount);
+  TEST_ASSERT_EQUAL_UINT8(MACRO_MAX_ITEMS % 12,
+                          cfg.pages[cfg.pageCount - 1].count);
+  TEST_ASSERT_EQUAL_UINT(MACRO_PAGE_NAME_LEN - 1, strlen(cfg.pages[0].name));
+  TEST_ASSERT_EQUAL_UINT(MACRO_LABEL_LEN - 1, strlen(cfg.items[0].label));
+  TEST_ASSERT_EQUAL_UINT(MACRO_PATH_LEN - 1, strlen(cfg.items[0].path));
+}
+
+// A script over the compiler's 64 KB text limit is skipped
+static void test_oversized_script_is_skipped() {
+  std::string json = "{\"pages\": [{\"name\": \"PC\", \"macros\": ["
+                     "{\"label\": \"Largo\", \"script\": \"STRING ";
+  json += std::string(0x10000, 'a');
+  json += "\"}, {\"label\": \"Corto\", \"script\": \"STRING b\"}]}]}";
+  TEST_ASSERT_EQUAL(1, load(json.c_str(), 2 * json.size() + 1024));
+  TEST_ASSERT_EQUAL_STRING("Corto", cfg.items[0].label);
+  TEST_ASSERT_EQUAL(2, allocs);
+}
+
+int main(int, char **) {
+  UNITY_BEGIN();
+  RUN_TEST(test_loads_every_kind);
+  RUN_TEST(test_defaults_match_the_old_page);
+  RUN_TEST(test_broken_json_is_refused);
+  RUN_TEST(test_bad_entries_are_skipped);
+  RUN_TEST(test_no_pages_loads_nothing);
+  RUN_TEST(test_script_without_memory_is_skipped);
+  RUN_TEST(test_oversized_document_is_refused);
+  RUN_TEST(test_oversized_config_is_capped);
+  RUN_TEST(test_oversized_script_is_skipped);
+  return UNITY_END();
+}
@@ -0,0 +1,256 @@
+// Macro pages built on first show and evicted past MACRO_PAGES_BUILT, as
+// showPage() does, in a host LVGL heap: pio test -e native -f
+// test_macro_pages_bench. Prints lv_mem_monitor() use and the switch time
+// for a page built, shown again, and with every page kept.
+#include <string.h>
+
+// glibc only has strlcpy from 2.38 on; the ESP32 libc always does
+#if defined(__GLIBC__) && !__GLIBC_PREREQ(2, 38)
+static size_t strlcpy(char *dst, const char *src, size_t size) {
+  size_t len = strlen(src);
+  if (size) {
+    size_t n = len < size - 1 ? len : size - 1;
+    memcpy(dst, src, n);
+    dst[n] = '\0';
+  }
+  return len;
+}
+#endif
+
+#include "macro_pages.h"
+#include <chrono>
+#include <lvgl.h>
+#include <stdio.h>
+#include <string>
+#include <unity.h>
+
+#define HOR 480
+#define VER 320
+#define MACRO_PAGES_BUILT 2 // As in main.cpp
+#define ROUNDS 4
+
+static lv_color_t buf[HOR * 20];
+static lv_disp_draw_buf_t drawBuf;
+static lv_disp_drv_t drv;
+
+static void flush(lv_disp_drv_t *d, const lv_area_t *, lv_color_t *) {
+  lv_disp_flush_ready(d);
+}
+
+static uint32_t micros() {
+  using namespace std::chrono;
+  return (uint32_t)duration_cast<microseconds>(
+             steady_clock::now().time_since_epoch())
+      .count();
+}
+
+static MacroConfig macroCfg;
+static lv_obj_t *home;
+static lv_obj_t *pageArea;
+static lv_obj_t *pageObj[MACRO_MAX_PAGES];
+static uint32_t pageUsed[MACRO_MAX_PAGES];
+static uint32_t pageStamp;
+static uint8_t currentPage;
+static uint8_t keep; // Pages left built after a switch
+static uint32_t evictions;
+static uint32_t peakUsed;
+
+static uint32_t heapUsed() {
+  lv_mem_monitor_t m;
+  lv_mem_monitor(&m);
+  uint32_t used = m.total_size - m.free_size;
+  if (used > peakUsed)
+    peakUsed = used;
+  return used;
+}
+
+// buildPage(), evictPages() and showPage() of main.cpp, without the labels
+// of the header
+static lv_obj_t *buildPage(uint8_t p) {
+  const MacroPage &page = macroCfg.pages[p];
+  lv_obj_t *cont = lv_obj_create(pageArea);
+  lv_obj_set_size(cont, lv_pct(100), lv_pct(100));
+  lv_obj_set_style_bg_opa(cont, LV_OPA_TRANSP, 0);
+  lv_obj_set_style_border_width(cont, 0, 0);
+  lv_obj_set_style_pad_all(cont, 8, 0);
+  lv_obj_set_style_pad_gap(cont, 8, 0);
+  lv_obj_set_flex_flow(cont, LV_FLEX_FLOW_ROW_WRAP);
+  lv_obj_set_scroll_dir(cont, LV_DIR_VER);
+  for (uint8_t i = 0; i < page.count; i++) {
+    uint8_t idx = page.first + i;
+    lv_obj_t *btn = lv_btn_create(cont);
+    lv_obj_set_size(btn, 106, 70);
+    lv_obj_set_style_bg_color(btn, lv_color_hex(macroCfg.items[idx].color), 0);
+    lv_obj_set_style_radius(btn, 12, 0);
+    lv_obj_t *l = lv_label_create(btn);
+    lv_label_set_text(l, macroCfg.items[idx].label);
+    lv_obj_center(l);
+  }
+  return cont;
+}
+
+static void evictPages() {
+  for (;;) {
+    uint8_t built = 0, oldest = 0;
+    for (uint8_t i = 0; i < macroCfg.pageCount; i++) {
+      if (!pageObj[i])
+        continue;
+      built++;
+      if (!pageObj[oldest] || pageUsed[i] < pageUsed[oldest])
+        oldest = i;
+    }
+    if (built <= keep)
+      return;
+    lv_obj_del(pageObj[oldest]);
+    pageObj[oldest] = NULL;
+    evictions++;
+  }
+}
+
+// Shows page `p` and draws it; returns the time taken in us, and whether
+// the page had to be built in `built`
+static uint32_t showPage(uint8_t p, bool &built) {
+  uint32_t t0 = micros();
+  built = pageObj[p] == NULL;
+  if (pageObj[currentPage])
+    lv_obj_add_flag(pageObj[currentPage], LV_OBJ_FLAG_HIDDEN);
+  if (built)
+    pageObj[p] = buildPage(p);
+  lv_obj_clear_flag(pageObj[p], LV_OBJ_FLAG_HIDDEN);
+  pageUsed[p] = ++pageStamp;
+  currentPage = p;
+  evictPages();
+  lv_refr_now(NULL);
+  return micros() - t0;
+}
+
+// `pages` pages of 12 buttons, loaded from JSON like /macros.json
+static void loadPages(uint8_t pages) {
+  std::string json = "{\"pages\": [";
+  for (uint8_t p = 0; p < pages; p++) {
+    char name[32];
+    snprintf(name, sizeof(name), "%s{\"name\": \"P%u\", \"macros\": [",
+             p ? "," : "", p + 1);
+    json += name;
+    for (uint8_t i = 0; i < 12 && p * 12 + i < MACRO_MAX_ITEMS; i++)
+      json += std::string(i ? "," : "") +
+              "{\"label\": \"Macro\", \"builtin\": \"cmd\"}";
+    json += "]}";
+  }
+  json += "]}";
+  const char *text = json.c_str();
+  // 64-bit JSON slots take twice the room they do on the ESP32
+  TEST_ASSERT_GREATER_THAN(0, macroConfigLoad(text, 65536, macroCfg, malloc));
+}
+
+struct Cost {
+  uint32_t builds, buildUs, shows, showUs, worstUs;
+};
+
+// Every page shown in turn for ROUNDS rounds, keeping `kept` built;
+// reports the costs and returns them
+static Cost cycle(uint8_t pages, uint8_t kept) {
+  loadPages(pages);
+  keep = kept;
+  lv_obj_t *scr = lv_obj_create(NULL);
+  lv_scr_load(scr);
+  pageArea = lv_obj_create(scr);
+  lv_obj_set_size(pageArea, 480, 245);
+  lv_obj_align(pageArea, LV_ALIGN_TOP_MID, 0, 45);
+  lv_obj_clear_flag(pageArea, LV_OBJ_FLAG_SCROLLABLE);
+  memset(pageObj, 0, sizeof(pageObj));
+  pageStamp = 0;
+  currentPage = 0;
+  evictions = 0;
+  peakUsed = 0;
+  uint32_t base = heapUsed();
+
+  Cost c = {0, 0, 0, 0, 0};
+  for (uint8_t r = 0; r < ROUNDS; r++) {
+    for (uint8_t p = 0; p < macroCfg.pageCount; p++) {
+      bool built;
+      uint32_t us = showPage(p, built);
+      heapUsed();
+      if (built) {
+        c.builds++;
+        c.buildUs += us;
+      } else {
+        c.shows++;
+        c.showUs += us;
+      }
+      c.worstUs = us > c.worstUs ? us : c.worstUs;
+    }
+  }
+  lv_mem_monitor_t m;
+  lv_mem_monitor(&m);
+  char line[200];
+  snprintf(line, sizeof(line),
+           "%u pages, %u kept: peak heap +%lu B (%lu of %lu B), %lu builds "
+           "mean %lu us, %lu shows mean %lu us, worst %lu us, %lu evictions",
+           macroCfg.pageCount, kept, (unsigned long)(peakUsed - base),
+           (unsigned long)peakUsed, (unsigned long)m.total_size,
+           (unsigned long)c.builds,
+           (unsigned long)(c.builds ? c.buildUs / c.builds : 0),
+           (unsigned long)c.shows,
+           (unsigned long)(c.shows ? c.showUs / c.shows : 0),
+           (unsigned long)c.worstUs, (unsigned long)evictions);
+  TEST_MESSAGE(line);
+  TEST_ASSERT_EQUAL(LV_RES_OK, lv_mem_test());
+  return c;
+}
+
+void setUp() {}
+
+void tearDown() {
+  lv_obj_t *scr = lv_scr_act();
+  if (scr != home) {
+    lv_scr_load(home);
+    lv_obj_del(scr);
+  }
+}
+
+// With two pages nothing is evicted: each is built once
+static void test_two_pages_build_once() {
+  Cost c = cycle(2, MACRO_PAGES_BUILT);
+  TEST_ASSERT_EQUAL_UINT32(2, c.builds);
+  TEST_ASSERT_EQUAL_UINT32(0, evictions);
+}
+
+// Five pages cycled with two kept: every switch builds, and the heap holds
+// two pages whatever the page count
+static void test_five_pages_evict() {
+  Cost c = cycle(5, MACRO_PAGES_BUILT);
+  uint32_t lazyPeak = peakUsed;
+  TEST_ASSERT_EQUAL_UINT32(5 * ROUNDS, c.builds);
+  TEST_ASSERT_EQUAL_UINT32(5 * ROUNDS - MACRO_PAGES_BUILT, evictions);
+  tearDown();
+  cycle(5, MACRO_MAX_PAGES);
+  TEST_ASSERT_LESS_THAN(peakUsed, lazyPeak);
+}
+
+// The most pages the config holds, kept or evicted
+static void test_max_pages() {
+  cycle(MACRO_MAX_ITEMS / 12 + 1, MACRO_PAGES_BUILT);
+  uint32_t lazyPeak = peakUsed;
+  tearDown();
+  cycle(MACRO_MAX_ITEMS / 12 + 1, MACRO_MAX_PAGES);
+  TEST_ASSERT_LESS_THAN(peakUsed, lazyPeak);
+}
+
+int main(int, char **) {
+  lv_init();
+  lv_disp_draw_buf_init(&drawBuf, buf, NULL, HOR * 20);
+  lv_disp_drv_init(&drv);
+  drv.hor_res = HOR;
+  drv.ver_res = VER;
+  drv.flush_cb = flush;
+  drv.draw_buf = &drawBuf;
+  lv_disp_drv_register(&drv);
+  home = lv_scr_act();
+
+  UNITY_BEGIN();
+  RUN_TEST(test_two_pages_build_once);
+  RUN_TEST(test_five_pages_evict);
+  RUN_TEST(test_max_pages);
+  return UNITY_END();
+}
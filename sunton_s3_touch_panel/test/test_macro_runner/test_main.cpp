@@ -0,0 +1,195 @@
+// MacroRunner against a fake clock and a keyboard that records what it is
+// asked to do: pio test -e native
+#include "macro_runner.h"
+#include <string>
+#include <unity.h>
+
+struct FakeKeyboard {
+  std::string log;
+  uint8_t typingPasses = 0; // run() passes each type() stays busy for
+  uint8_t busy = 0;
+
+  void press(uint8_t key) { log += "P" + std::to_string(key) + " "; }
+  void releaseAll() { log += "R "; }
+  void type(const char *text, uint16_t len) {
+    log += "T[" + std::string(text, len) + "] ";
+    busy = typingPasses;
+  }
+  bool typing() {
+    if (busy == 0)
+      return false;
+    busy--;
+    return true;
+  }
+};
+
+static FakeKeyboard kb;
+static MacroRunner<FakeKeyboard> runner(kb);
+static std::string calls; // From MACRO_CALL actions
+
+void setUp() {
+  runner.cancel();
+  kb = FakeKeyboard();
+  calls.clear();
+}
+
+void tearDown() {}
+
+static void test_runs_in_order_without_waits() {
+  runner.press(0x82);
+  runner.press('p');
+  runner.releaseAll();
+  TEST_ASSERT_TRUE(runner.busy());
+  runner.run(0);
+  TEST_ASSERT_EQUAL_STRING("P130 P112 R ", kb.log.c_str());
+  TEST_ASSERT_FALSE(runner.busy());
+}
+
+static void test_wait_holds_the_queue_until_due() {
+  runner.press('a');
+  runner.wait(400);
+  runner.press('b');
+  runner.run(1000);
+  TEST_ASSERT_EQUAL_STRING("P97 ", kb.log.c_str());
+  runner.run(1399);
+  TEST_ASSERT_EQUAL_STRING("P97 ", kb.log.c_str());
+  runner.run(1400);
+  TEST_ASSERT_EQUAL_STRING("P97 P98 ", kb.log.c_str());
+  TEST_ASSERT_FALSE(runner.busy());
+}
+
+static void test_wait_counts_from_when_it_is_reached() {
+  runner.wait(100);
+  runner.run(5000); // Queued long before; the wait starts now
+  TEST_ASSERT_TRUE(runner.busy());
+  runner.run(5099);
+  TEST_ASSERT_TRUE(runner.busy());
+  runner.run(5100);
+  TEST_ASSERT_FALSE(runner.busy());
+}
+
+static void test_clock_wraps() {
+  runner.wait(20);
+  runner.press('x');
+  runner.run(0xFFFFFFF0u);
+  runner.run(3); // 19 ms later
+  TEST_ASSERT_EQUAL_STRING("", kb.log.c_str());
+  runner.run(4);
+  TEST_ASSERT_EQUAL_STRING("P120 ", kb.log.c_str());
+}
+
+static void test_type_waits_for_the_keyboard() {
+  kb.typingPasses = 2;
+  runner.type("cmd");
+  runner.press(0xB0);
+  runner.run(0);
+  TEST_ASSERT_EQUAL_STRING("T[cmd] ", kb.log.c_str());
+  runner.run(1);
+  TEST_ASSERT_EQUAL_STRING("T[cmd] ", kb.log.c_str());
+  runner.run(2);
+  TEST_ASSERT_EQUAL_STRING("T[cmd] P176 ", kb.log.c_str());
+}
+
+static void test_type_copies_the_text() {
+  char buf[8] = "abc";
+  runner.type(buf);
+  buf[0] = 'z';
+  runner.run(0);
+  TEST_ASSERT_EQUAL_STRING("T[abc] ", kb.log.c_str());
+}
+
+static void test_text_pool_is_bounded_and_recycled() {
+  char big[MACRO_TEXT_POOL + 1];
+  memset(big, 'a', sizeof(big));
+  TEST_ASSERT_FALSE(runner.type(big, sizeof(big)));
+  TEST_ASSERT_FALSE(runner.busy());
+  TEST_ASSERT_TRUE(runner.type(big, MACRO_TEXT_POOL));
+  TEST_ASSERT_FALSE(runner.type("b"));
+  runner.run(0);
+  TEST_ASSERT_TRUE(runner.type("b")); // Pool free again once drained
+}
+
+static void test_queue_is_bounded() {
+  for (uint16_t i = 0; i < MACRO_QUEUE_LEN; i++)
+    TEST_ASSERT_TRUE(runner.wait(1));
+  TEST_ASSERT_EQUAL(0, runner.room());
+  TEST_ASSERT_FALSE(runner.press('a'));
+}
+
+static void test_cancel_releases_held_keys() {
+  runner.press(0x80);
+  runner.wait(1000);
+  runner.press('r');
+  runner.run(0);
+  TEST_ASSERT_EQUAL_STRING("P128 ", kb.log.c_str());
+  runner.cancel();
+  TEST_ASSERT_EQUAL_STRING("P128 R ", kb.log.c_str());
+  TEST_ASSERT_FALSE(runner.busy());
+  runner.run(5000);
+  TEST_ASSERT_EQUAL_STRING("P128 R ", kb.log.c_str());
+}
+
+static void test_cancel_without_held_keys_sends_nothing() {
+  runner.wait(1000);
+  runner.run(0);
+  runner.cancel();
+  TEST_ASSERT_EQUAL_STRING("", kb.log.c_str());
+}
+
+static void test_call_runs_after_the_keys() {
+  runner.press(0x82);
+  runner.press('p');
+  runner.wait(10);
+  runner.releaseAll();
+  runner.call([] { calls += "print "; });
+  runner.run(0);
+  TEST_ASSERT_EQUAL_STRING("", calls.c_str());
+  runner.run(10);
+  TEST_ASSERT_EQUAL_STRING("P130 P112 R ", kb.log.c_str());
+  TEST_ASSERT_EQUAL_STRING("print ", calls.c_str());
+}
+
+static void test_cancel_drops_pending_calls() {
+  runner.wait(10);
+  runner.call([] { calls += "print "; });
+  runner.run(0);
+  runner.cancel();
+  runner.run(100);
+  TEST_ASSERT_EQUAL_STRING("", calls.c_str());
+}
+
+// Win+R, "notepad", Enter with the waits of runDialog(): how long the
+// macro takes with the loop running every 5 ms
+static void test_run_dialog_timing() {
+  runner.combo(0x83, 'r');
+  runner.wait(400);
+  runner.type("notepad");
+  runner.wait(100);
+  runner.press(0xB0);
+  runner.releaseAll();
+  uint32_t t = 0;
+  while (runner.busy() && t < 10000) {
+    runner.run(t);
+    t += 5;
+  }
+  TEST_ASSERT_EQUAL_STRING("P131 P114 R T[notepad] P176 R ", kb.log.c_str());
+  TEST_ASSERT_EQUAL_UINT32(505, t); // 400 + 100 ms, plus the last pass
+}
+
+int main(int, char **) {
+  UNITY_BEGIN();
+  RUN_TEST(test_runs_in_order_without_waits);
+  RUN_TEST(test_wait_holds_the_queue_until_due);
+  RUN_TEST(test_wait_counts_from_when_it_is_reached);
+  RUN_TEST(test_clock_wraps);
+  RUN_TEST(test_type_waits_for_the_keyboard);
+  RUN_TEST(test_type_copies_the_text);
+  RUN_TEST(test_text_pool_is_bounded_and_recycled);
+  RUN_TEST(test_queue_is_bounded);
+  RUN_TEST(test_cancel_releases_held_keys);
+  RUN_TEST(test_cancel_without_held_keys_sends_nothing);
+  RUN_TEST(test_call_runs_after_the_keys);
+  RUN_TEST(test_cancel_drops_pending_calls);
+  RUN_TEST(test_run_dialog_timing);
+  return UNITY_END();
+}
@@ -0,0 +1,73 @@
+#!/usr/bin/env python3
+"""PC-side print agent for the Delfin panel.
+
+Answers the panel's "PRINT <seq>" lines (see include/host_link.h) with
+ACK, then DONE or FAIL once the print command has finished.
+
+  Linux (hidraw):        print_agent.py --hidraw /dev/hidraw3
+  Local stand-in (pty):  print_agent.py --tty /dev/pts/5
+
+--print-cmd is run for every job; its exit code decides DONE/FAIL. Without
+it the agent confirms immediately.
+"""
+import argparse
+import os
+import subprocess
+import sys
+
+REPORT_ID = 6  # HID_REPORT_ID_VENDOR in arduino-esp32
+REPORT_SIZE = 63
+
+
+class Link:
+    def __init__(self, path, hidraw):
+        self.fd = os.open(path, os.O_RDWR)
+        self.hidraw = hidraw
+        self.buf = b""
+
+    def send(self, line):
+        data = line.encode() + b"\n"
+        if not self.hidraw:
+            os.write(self.fd, data)
+            return
+        for i in range(0, len(data), REPORT_SIZE):
+            chunk = data[i:i + REPORT_SIZE].ljust(REPORT_SIZE, b"\0")
+            os.write(self.fd, bytes([REPORT_ID]) + chunk)
+
+    def lines(self):
+        while True:
+            data = os.read(self.fd, REPORT_SIZE + 1)
+            if not data:
+                return
+            if self.hidraw and data[0] == REPORT_ID:
+                data = data[1:]
+            self.buf += data.replace(b"\0", b"")
+            while b"\n" in self.buf:
+                line, self.buf = self.buf.split(b"\n", 1)
+                yield line.strip().decode(errors="replace")
+
+
+def main():
+    ap = argparse.ArgumentParser()
+    dev = ap.add_mutually_exclusive_group(required=True)
+    dev.add_argument("--hidraw", help="vendor HID node of the panel")
+    dev.add_argument("--tty", help="serial port or pty")
+    ap.add_argument("--print-cmd", help="command that waits for the job")
+    args = ap.parse_args()
+
+    link = Link(args.hidraw or args.tty, args.hidraw is not None)
+    link.send("HELLO")
+    for line in link.lines():
+        if not line.startswith("PRINT "):
+            continue
+        seq = line[6:]
+        link.send("ACK " + seq)
+        ok = True
+        if args.print_cmd:
+            ok = subprocess.call(args.print_cmd, shell=True) == 0
+        link.send(("DONE " if ok else "FAIL ") + seq)
+        print("job", seq, "ok" if ok else "failed", file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,79 @@
+#!/usr/bin/env python3
+"""Round trip of tools/print_agent.py over a pty pair, playing the panel.
+
+The agent runs in --tty mode on the slave end; this script reads HELLO on
+the master end, sends PRINT lines padded with 0x00 like HID reports, and
+expects ACK then DONE (print command exits 0) or FAIL (exits 1). Exits
+non-zero on the first missing or wrong line.
+
+  print_agent_test.py [--timeout 5]
+"""
+import argparse
+import os
+import pty
+import select
+import subprocess
+import sys
+import tty
+
+AGENT = os.path.join(os.path.dirname(os.path.abspath(__file__)),
+                     "print_agent.py")
+
+
+class Panel:
+    def __init__(self, master, timeout):
+        self.fd = master
+        self.timeout = timeout
+        self.buf = b""
+
+    def send(self, line):
+        os.write(self.fd, line.encode() + b"\n" + b"\0" * 8)
+
+    def expect(self, want):
+        while b"\n" not in self.buf:
+            ready, _, _ = select.select([self.fd], [], [], self.timeout)
+            if not ready:
+                raise SystemExit("timeout waiting for %r" % want)
+            self.buf += os.read(self.fd, 256)
+        line, self.buf = self.buf.split(b"\n", 1)
+        line = line.strip().decode(errors="replace")
+        if line != want:
+            raise SystemExit("expected %r, got %r" % (want, line))
+        print("<-", line)
+
+
+def run(print_cmd, jobs, timeout):
+    master, slave = pty.openpty()
+    tty.setraw(slave)  # No echo, no \n -> \r\n
+    agent = subprocess.Popen(
+        [sys.executable, AGENT, "--tty", os.ttyname(slave),
+         "--print-cmd", print_cmd],
+        stderr=subprocess.DEVNULL)
+    try:
+        panel = Panel(master, timeout)
+        panel.expect("HELLO")
+        for seq, answer in jobs:
+            print("->", "PRINT %d" % seq)
+            panel.send("PRINT %d" % seq)
+            panel.expect("ACK %d" % seq)
+            panel.expect("%s %d" % (answer, seq))
+    finally:
+        agent.kill()
+        agent.wait()
+        os.close(master)
+        os.close(slave)
+
+
+def main():
+    ap = argparse.ArgumentParser()
+    ap.add_argument("--timeout", type=float, default=5,
+                    help="seconds to wait for each line")
+    args = ap.parse_args()
+
+    run("true", [(1, "DONE"), (2, "DONE"), (65535, "DONE")], args.timeout)
+    run("false", [(7, "FAIL")], args.timeout)
+    print("print_agent: round trip OK")
+
+
+if __name__ == "__main__":
+    main()